@@ -62,4 +62,23 @@ extern const char * JTEST_CYCLE_STRF;
                          __jtest_cycle_end_count));     \
     } while (0)
 
+/**
+ *  Wrap the function call, fn_call, and store its execution cycles in the
+ *  uint32_t lvalue cycles, without displaying them.  Used by tests that
+ *  compare the cost of several implementations.
+ */
+#define JTEST_MEASURE_CYCLES(cycles, fn_call)           \
+    do                                                  \
+    {                                                   \
+        JTEST_SYSTICK_RESET(SysTick);                   \
+        JTEST_SYSTICK_START(SysTick);                   \
+                                                        \
+        fn_call;                                        \
+                                                        \
+        (cycles) = JTEST_SYSTICK_INITIAL_VALUE -        \
+            JTEST_SYSTICK_VALUE(SysTick);               \
+                                                        \
+        JTEST_SYSTICK_RESET(SysTick);                   \
+    } while (0)
+
 #endif /* _JTEST_CYCLE_H_ */
@@ -7,6 +7,7 @@
 JTEST_DECLARE_GROUP(abs_tests);
 JTEST_DECLARE_GROUP(add_tests);
 JTEST_DECLARE_GROUP(dot_prod_tests);
+JTEST_DECLARE_GROUP(f16_tests);
 JTEST_DECLARE_GROUP(mult_tests);
 JTEST_DECLARE_GROUP(negate_tests);
 JTEST_DECLARE_GROUP(offset_tests);
@@ -7,5 +7,6 @@
 JTEST_DECLARE_GROUP(pid_reset_tests);
 JTEST_DECLARE_GROUP(sin_cos_tests);
 JTEST_DECLARE_GROUP(pid_tests);
+JTEST_DECLARE_GROUP(clarke_park_tests);
 
 #endif /* _CONTROLLER_TESTS_H_ */
@@ -6,10 +6,15 @@
 /*--------------------------------------------------------------------------------*/
 
 JTEST_DECLARE_GROUP(biquad_tests);
+JTEST_DECLARE_GROUP(cic_tests);
 JTEST_DECLARE_GROUP(conv_tests);
 JTEST_DECLARE_GROUP(correlate_tests);
+JTEST_DECLARE_GROUP(fdaf_tests);
 JTEST_DECLARE_GROUP(fir_tests);
 JTEST_DECLARE_GROUP(iir_tests);
 JTEST_DECLARE_GROUP(lms_tests);
+JTEST_DECLARE_GROUP(median_tests);
+JTEST_DECLARE_GROUP(resample_tests);
+JTEST_DECLARE_GROUP(xcorr_tests);
 
 #endif /* _FILTERING_TESTS_H_ */
@@ -0,0 +1,38 @@
+#ifndef _INTERPOLATION_TEST_DATA_H_
+#define _INTERPOLATION_TEST_DATA_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+#define INTERPOLATION_MAX_LEN 256
+#define INTERPOLATION_TABLE_LEN 64
+#define INTERPOLATION_GRID_LEN 16
+
+/*--------------------------------------------------------------------------------*/
+/* Variable Declarations */
+/*--------------------------------------------------------------------------------*/
+
+extern float32_t interpolation_output_fut[INTERPOLATION_MAX_LEN];
+extern float32_t interpolation_output_ref[INTERPOLATION_MAX_LEN];
+extern float32_t interpolation_output_f32_fut[INTERPOLATION_MAX_LEN];
+extern float32_t interpolation_output_f32_ref[INTERPOLATION_MAX_LEN];
+extern float32_t interpolation_x_f32[INTERPOLATION_MAX_LEN];
+extern float32_t interpolation_y_f32[INTERPOLATION_MAX_LEN];
+extern q31_t interpolation_x_q31[INTERPOLATION_MAX_LEN];
+extern q31_t interpolation_y_q31[INTERPOLATION_MAX_LEN];
+extern float32_t interpolation_table_f32[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN];
+extern q31_t interpolation_table_q31[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN];
+extern q15_t interpolation_table_q15[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN];
+extern q7_t interpolation_table_q7[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN];
+
+/* Fill the tables and query points used by the interpolation tests. */
+void interpolation_test_init(void);
+
+#endif /* _INTERPOLATION_TEST_DATA_H_ */
@@ -0,0 +1,10 @@
+#ifndef _INTERPOLATION_TESTS_H_
+#define _INTERPOLATION_TESTS_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Test/Group Declarations */
+/*--------------------------------------------------------------------------------*/
+JTEST_DECLARE_GROUP(linear_interp_tests);
+JTEST_DECLARE_GROUP(bilinear_interp_tests);
+
+#endif /* _INTERPOLATION_TESTS_H_ */
@@ -4,8 +4,10 @@
 /*--------------------------------------------------------------------------------*/
 /* Test/Group Declarations */
 /*--------------------------------------------------------------------------------*/
+JTEST_DECLARE_GROUP(batch_tests);
 JTEST_DECLARE_GROUP(copy_tests);
 JTEST_DECLARE_GROUP(fill_tests);
+JTEST_DECLARE_GROUP(plan_tests);
 JTEST_DECLARE_GROUP(x_to_y_tests);
 
 #endif /* _SUPPORT_TESTS_H_ */
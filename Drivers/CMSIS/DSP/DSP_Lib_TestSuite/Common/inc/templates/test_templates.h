@@ -12,6 +12,7 @@
 /*--------------------------------------------------------------------------------*/
 /* Function Aliases for use in Templates. */
 /*--------------------------------------------------------------------------------*/
+#define ref_q63_t_to_float ref_q63_to_float
 #define ref_q31_t_to_float ref_q31_to_float
 #define ref_q15_t_to_float ref_q15_to_float
 #define ref_q7_t_to_float  ref_q7_to_float
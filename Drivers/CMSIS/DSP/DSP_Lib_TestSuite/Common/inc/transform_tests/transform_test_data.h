@@ -44,5 +44,6 @@ ARR_DESC_DECLARE(transform_dct_fftlens);
 ARR_DESC_DECLARE(transform_cfft_f32_structs);
 ARR_DESC_DECLARE(transform_cfft_q31_structs);
 ARR_DESC_DECLARE(transform_cfft_q15_structs);
+ARR_DESC_DECLARE(transform_cfft_f16_structs);
 
 #endif /* _TRANSFORM_TEST_DATA_H_ */
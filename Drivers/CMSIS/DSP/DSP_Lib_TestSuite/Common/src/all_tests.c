@@ -9,6 +9,7 @@
 #include "support_test_group.h"
 #include "transform_test_group.h"
 #include "intrinsics_test_group.h"
+#include "interpolation_test_group.h"
 
 JTEST_DEFINE_GROUP(all_tests)
 {
@@ -25,6 +26,7 @@ JTEST_DEFINE_GROUP(all_tests)
     JTEST_GROUP_CALL(support_tests);
     JTEST_GROUP_CALL(transform_tests);
     JTEST_GROUP_CALL(intrinsics_tests);
+    JTEST_GROUP_CALL(interpolation_tests);
 
     return;
 }
@@ -0,0 +1,172 @@
+#include "jtest.h"
+#include "basic_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "basic_math_templates.h"
+#include "type_abbrev.h"
+#include <string.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Half-precision Vector Functions */
+/*--------------------------------------------------------------------------------*/
+
+#define F16_MAX_BLOCKSIZE 256
+
+/* Block sizes, covering the tails of the unrolled loops */
+static const uint32_t f16_block_sizes[] = { 1, 3, 4, 15, F16_MAX_BLOCKSIZE };
+
+#define F16_NUM_BLOCK_SIZES (sizeof(f16_block_sizes) / sizeof(f16_block_sizes[0]))
+
+static float16_t f16_input_a[F16_MAX_BLOCKSIZE];
+static float16_t f16_input_b[F16_MAX_BLOCKSIZE];
+static float16_t f16_output_fut[F16_MAX_BLOCKSIZE];
+static float16_t f16_output_ref[F16_MAX_BLOCKSIZE];
+static float32_t f16_input_a_f32[F16_MAX_BLOCKSIZE];
+static float32_t f16_input_b_f32[F16_MAX_BLOCKSIZE];
+static float32_t f16_output_f32[F16_MAX_BLOCKSIZE];
+
+/*
+  Inputs in [-4 4) from a linear congruential generator, rounded to half
+  precision.  The floating-point copies hold the rounded values.
+*/
+static void f16_make_inputs(void)
+{
+    uint32_t seed = 12345U;
+    uint32_t i;
+
+    for (i = 0; i < F16_MAX_BLOCKSIZE; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        f16_input_a_f32[i] = (float32_t) (int32_t) seed / 536870912.0f;
+        seed = seed * 1664525U + 1013904223U;
+        f16_input_b_f32[i] = (float32_t) (int32_t) seed / 536870912.0f;
+    }
+
+    arm_float_to_f16(f16_input_a_f32, f16_input_a, F16_MAX_BLOCKSIZE);
+    arm_float_to_f16(f16_input_b_f32, f16_input_b, F16_MAX_BLOCKSIZE);
+    arm_f16_to_float(f16_input_a, f16_input_a_f32, F16_MAX_BLOCKSIZE);
+    arm_f16_to_float(f16_input_b, f16_input_b_f32, F16_MAX_BLOCKSIZE);
+}
+
+/*
+  Element-wise function test template.  Arguments are the function name.  The
+  reference is the floating-point function on the rounded inputs, rounded once
+  to half precision, so the results must be bit exact.
+*/
+#define F16_DEFINE_ELTWISE_TEST(fn_name)                                \
+    JTEST_DEFINE_TEST(arm_##fn_name##_f16_test,                         \
+                      arm_##fn_name##_f16)                              \
+    {                                                                   \
+        uint32_t b, blockSize;                                          \
+                                                                        \
+        f16_make_inputs();                                              \
+                                                                        \
+        for (b = 0; b < F16_NUM_BLOCK_SIZES; b++)                       \
+        {                                                               \
+            blockSize = f16_block_sizes[b];                             \
+                                                                        \
+            JTEST_DUMP_STRF("Block Size: %d\n", (int) blockSize);       \
+                                                                        \
+            memset(f16_output_fut, 0xFF, sizeof(f16_output_fut));       \
+            memset(f16_output_ref, 0xFF, sizeof(f16_output_ref));       \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_##fn_name##_f16(f16_input_a, f16_input_b,           \
+                                    f16_output_fut, blockSize));        \
+                                                                        \
+            arm_##fn_name##_f32(f16_input_a_f32, f16_input_b_f32,       \
+                                f16_output_f32, blockSize);             \
+            arm_float_to_f16(f16_output_f32, f16_output_ref,            \
+                             blockSize);                                \
+                                                                        \
+            TEST_ASSERT_EQUAL(memcmp(f16_output_fut, f16_output_ref,    \
+                                     sizeof(f16_output_fut)), 0);       \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+F16_DEFINE_ELTWISE_TEST(add);
+F16_DEFINE_ELTWISE_TEST(sub);
+F16_DEFINE_ELTWISE_TEST(mult);
+
+JTEST_DEFINE_TEST(arm_scale_f16_test, arm_scale_f16)
+{
+    uint32_t b, blockSize;
+    float32_t scale = 0.7071067812f;
+
+    f16_make_inputs();
+
+    for (b = 0; b < F16_NUM_BLOCK_SIZES; b++)
+    {
+        blockSize = f16_block_sizes[b];
+
+        JTEST_DUMP_STRF("Block Size: %d\n", (int) blockSize);
+
+        memset(f16_output_fut, 0xFF, sizeof(f16_output_fut));
+        memset(f16_output_ref, 0xFF, sizeof(f16_output_ref));
+
+        JTEST_COUNT_CYCLES(
+            arm_scale_f16(f16_input_a, scale, f16_output_fut, blockSize));
+
+        arm_scale_f32(f16_input_a_f32, scale, f16_output_f32, blockSize);
+        arm_float_to_f16(f16_output_f32, f16_output_ref, blockSize);
+
+        TEST_ASSERT_EQUAL(memcmp(f16_output_fut, f16_output_ref,
+                                 sizeof(f16_output_fut)), 0);
+    }
+
+    /* Results out of the half-precision range become infinity */
+    arm_scale_f16(f16_input_a, 1.0e6f, f16_output_fut, 1);
+    TEST_ASSERT_EQUAL(convert_f16_to_f32(f16_output_fut[0]) ==
+                      ((f16_input_a_f32[0] > 0.0f) ? INFINITY : -INFINITY), 1);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The dot product accumulates in single precision, so it matches the
+  floating-point dot product of the rounded inputs up to the summation order.
+*/
+JTEST_DEFINE_TEST(arm_dot_prod_f16_test, arm_dot_prod_f16)
+{
+    uint32_t b, blockSize;
+    float32_t result, resultRef;
+
+    f16_make_inputs();
+
+    for (b = 0; b < F16_NUM_BLOCK_SIZES; b++)
+    {
+        blockSize = f16_block_sizes[b];
+
+        JTEST_DUMP_STRF("Block Size: %d\n", (int) blockSize);
+
+        JTEST_COUNT_CYCLES(
+            arm_dot_prod_f16(f16_input_a, f16_input_b, blockSize, &result));
+
+        arm_dot_prod_f32(f16_input_a_f32, f16_input_b_f32, blockSize, &resultRef);
+
+        TEST_ASSERT_EQUAL(fabsf(result - resultRef) <=
+                          1.0e-5f * (float32_t) blockSize * 16.0f, 1);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(f16_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_add_f16_test);
+    JTEST_TEST_CALL(arm_sub_f16_test);
+    JTEST_TEST_CALL(arm_mult_f16_test);
+    JTEST_TEST_CALL(arm_scale_f16_test);
+    JTEST_TEST_CALL(arm_dot_prod_f16_test);
+}
@@ -0,0 +1,212 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_test_data.h"
+#include "controller_templates.h"
+
+/**
+ *  Block size of the motor control tests.  It is odd so that the remainder
+ *  loops of the unrolled functions are exercised.
+ */
+#define CLARKE_PARK_BLOCK_LEN 255
+
+/**
+ *  The inputs are taken from four disjoint quarters of the controller inputs.
+ */
+#define CLARKE_PARK_INPUT(suffix, type, n)                              \
+    ((type *) controller_##suffix##_inputs + (n) * (CONTROLLER_MAX_LEN / 4))
+
+/**
+ *  Compare both output blocks of a two output function bit exactly.
+ */
+#define CLARKE_PARK_COMPARE_INTERFACE(type)                             \
+    TEST_ASSERT_BUFFERS_EQUAL(                                          \
+        controller_output_ref,                                          \
+        controller_output_fut,                                          \
+        CLARKE_PARK_BLOCK_LEN * sizeof(type));                          \
+    TEST_ASSERT_BUFFERS_EQUAL(                                          \
+        controller_output_f32_ref,                                      \
+        controller_output_f32_fut,                                      \
+        CLARKE_PARK_BLOCK_LEN * sizeof(type))
+
+/**
+ *  Define a JTEST_TEST_t for arm_clarke_block_xxx or arm_inv_clarke_block_xxx,
+ *  compared with the single sample function.
+ */
+#define CLARKE_BLOCK_TEST(fn, suffix, type)                             \
+    JTEST_DEFINE_TEST(arm_##fn##_block_##suffix##_test,                 \
+                      arm_##fn##_block_##suffix)                        \
+    {                                                                   \
+        uint32_t i;                                                     \
+        type * pA = CLARKE_PARK_INPUT(suffix, type, 0);                 \
+        type * pB = CLARKE_PARK_INPUT(suffix, type, 1);                 \
+                                                                        \
+        JTEST_DUMP_STRF("Block Size: %d\n",                             \
+                        (int)CLARKE_PARK_BLOCK_LEN);                    \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_##fn##_block_##suffix(                                  \
+                pA, pB,                                                 \
+                (type *) controller_output_fut,                         \
+                (type *) controller_output_f32_fut,                     \
+                CLARKE_PARK_BLOCK_LEN));                                \
+                                                                        \
+        for (i = 0; i < CLARKE_PARK_BLOCK_LEN; i++)                     \
+        {                                                               \
+            arm_##fn##_##suffix(                                        \
+                pA[i], pB[i],                                           \
+                (type *) controller_output_ref + i,                     \
+                (type *) controller_output_f32_ref + i);                \
+        }                                                               \
+                                                                        \
+        CLARKE_PARK_COMPARE_INTERFACE(type);                            \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/**
+ *  Define a JTEST_TEST_t for arm_park_block_xxx or arm_inv_park_block_xxx,
+ *  compared with the single sample function.
+ */
+#define PARK_BLOCK_TEST(fn, suffix, type)                               \
+    JTEST_DEFINE_TEST(arm_##fn##_block_##suffix##_test,                 \
+                      arm_##fn##_block_##suffix)                        \
+    {                                                                   \
+        uint32_t i;                                                     \
+        type * pA = CLARKE_PARK_INPUT(suffix, type, 0);                 \
+        type * pB = CLARKE_PARK_INPUT(suffix, type, 1);                 \
+        type * pSin = CLARKE_PARK_INPUT(suffix, type, 2);               \
+        type * pCos = CLARKE_PARK_INPUT(suffix, type, 3);               \
+                                                                        \
+        JTEST_DUMP_STRF("Block Size: %d\n",                             \
+                        (int)CLARKE_PARK_BLOCK_LEN);                    \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_##fn##_block_##suffix(                                  \
+                pA, pB,                                                 \
+                (type *) controller_output_fut,                         \
+                (type *) controller_output_f32_fut,                     \
+                pSin, pCos,                                             \
+                CLARKE_PARK_BLOCK_LEN));                                \
+                                                                        \
+        for (i = 0; i < CLARKE_PARK_BLOCK_LEN; i++)                     \
+        {                                                               \
+            arm_##fn##_##suffix(                                        \
+                pA[i], pB[i],                                           \
+                (type *) controller_output_ref + i,                     \
+                (type *) controller_output_f32_ref + i,                 \
+                pSin[i], pCos[i]);                                      \
+        }                                                               \
+                                                                        \
+        CLARKE_PARK_COMPARE_INTERFACE(type);                            \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CLARKE_BLOCK_TEST(clarke, f32, float32_t);
+CLARKE_BLOCK_TEST(clarke, q31, q31_t);
+CLARKE_BLOCK_TEST(inv_clarke, f32, float32_t);
+CLARKE_BLOCK_TEST(inv_clarke, q31, q31_t);
+PARK_BLOCK_TEST(park, f32, float32_t);
+PARK_BLOCK_TEST(park, q31, q31_t);
+PARK_BLOCK_TEST(inv_park, f32, float32_t);
+PARK_BLOCK_TEST(inv_park, q31, q31_t);
+
+/**
+ *  Error of the current loop for the reference chain of single sample functions.
+ */
+#define CLARKE_PARK_PID_ERROR_f32(ref, meas) ((ref) - (meas))
+#define CLARKE_PARK_PID_ERROR_q31(ref, meas) __QSUB((ref), (meas))
+
+/**
+ *  Define a JTEST_TEST_t for arm_clarke_park_pid_xxx, compared with chaining
+ *  arm_clarke_xxx, arm_park_xxx and arm_pid_xxx.  The controller inputs are
+ *  reused as the current references.
+ */
+#define CLARKE_PARK_PID_TEST(suffix, type)                              \
+    JTEST_DEFINE_TEST(arm_clarke_park_pid_##suffix##_test,              \
+                      arm_clarke_park_pid_##suffix)                     \
+    {                                                                   \
+        uint32_t i, j;                                                  \
+        type alpha, beta, d, q;                                         \
+        type * pA = CLARKE_PARK_INPUT(suffix, type, 0);                 \
+        type * pB = CLARKE_PARK_INPUT(suffix, type, 1);                 \
+        type * pSin = CLARKE_PARK_INPUT(suffix, type, 2);               \
+        type * pCos = CLARKE_PARK_INPUT(suffix, type, 3);               \
+        type * pDRef = CLARKE_PARK_INPUT(suffix, type, 3) + 1;          \
+        type * pQRef = CLARKE_PARK_INPUT(suffix, type, 2) + 1;          \
+        arm_pid_instance_##suffix fut_d = { 0 }, fut_q = { 0 };         \
+        arm_pid_instance_##suffix ref_d = { 0 }, ref_q = { 0 };         \
+                                                                        \
+        for (j = 0; j < CONTROLLER_MAX_COEFFS_LEN / 3 - 1; j++)         \
+        {                                                               \
+            fut_d.Kp = ref_d.Kp = controller_##suffix##_coeffs[j*3+0];  \
+            fut_d.Ki = ref_d.Ki = controller_##suffix##_coeffs[j*3+1];  \
+            fut_d.Kd = ref_d.Kd = controller_##suffix##_coeffs[j*3+2];  \
+            fut_q.Kp = ref_q.Kp = controller_##suffix##_coeffs[j*3+3];  \
+            fut_q.Ki = ref_q.Ki = controller_##suffix##_coeffs[j*3+4];  \
+            fut_q.Kd = ref_q.Kd = controller_##suffix##_coeffs[j*3+5];  \
+            arm_pid_init_##suffix(&fut_d, 1);                           \
+            arm_pid_init_##suffix(&fut_q, 1);                           \
+            arm_pid_init_##suffix(&ref_d, 1);                           \
+            arm_pid_init_##suffix(&ref_q, 1);                           \
+                                                                        \
+            JTEST_DUMP_STRF("Block Size: %d\n",                         \
+                            (int)CLARKE_PARK_BLOCK_LEN);                \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_clarke_park_pid_##suffix(                           \
+                    &fut_d, &fut_q,                                     \
+                    pA, pB, pSin, pCos, pDRef, pQRef,                   \
+                    (type *) controller_output_fut,                     \
+                    (type *) controller_output_f32_fut,                 \
+                    CLARKE_PARK_BLOCK_LEN));                            \
+                                                                        \
+            for (i = 0; i < CLARKE_PARK_BLOCK_LEN; i++)                 \
+            {                                                           \
+                arm_clarke_##suffix(pA[i], pB[i], &alpha, &beta);       \
+                arm_park_##suffix(alpha, beta, &d, &q,                  \
+                                  pSin[i], pCos[i]);                    \
+                ((type *) controller_output_ref)[i] =                   \
+                    arm_pid_##suffix(&ref_d,                            \
+                        CLARKE_PARK_PID_ERROR_##suffix(pDRef[i], d));   \
+                ((type *) controller_output_f32_ref)[i] =               \
+                    arm_pid_##suffix(&ref_q,                            \
+                        CLARKE_PARK_PID_ERROR_##suffix(pQRef[i], q));   \
+            }                                                           \
+                                                                        \
+            CLARKE_PARK_COMPARE_INTERFACE(type);                        \
+            TEST_ASSERT_BUFFERS_EQUAL(ref_d.state, fut_d.state,         \
+                                      sizeof(ref_d.state));             \
+            TEST_ASSERT_BUFFERS_EQUAL(ref_q.state, fut_q.state,         \
+                                      sizeof(ref_q.state));             \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CLARKE_PARK_PID_TEST(f32, float32_t);
+CLARKE_PARK_PID_TEST(q31, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(clarke_park_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_clarke_block_f32_test);
+    JTEST_TEST_CALL(arm_clarke_block_q31_test);
+    JTEST_TEST_CALL(arm_inv_clarke_block_f32_test);
+    JTEST_TEST_CALL(arm_inv_clarke_block_q31_test);
+    JTEST_TEST_CALL(arm_park_block_f32_test);
+    JTEST_TEST_CALL(arm_park_block_q31_test);
+    JTEST_TEST_CALL(arm_inv_park_block_f32_test);
+    JTEST_TEST_CALL(arm_inv_park_block_q31_test);
+    JTEST_TEST_CALL(arm_clarke_park_pid_f32_test);
+    JTEST_TEST_CALL(arm_clarke_park_pid_q31_test);
+}
@@ -64,6 +64,148 @@ ARM_PID_TEST(f32,float32_t);
 ARM_PID_TEST(q31,q31_t);
 ARM_PID_TEST(q15,q15_t);
 
+/**
+ *  Define a JTEST_TEST_t for the function arm_pid_block_xxx function having
+ *  suffix. The outputs and the final state must be bit exact with
+ *  arm_pid_xxx called once per sample.
+ */
+#define ARM_PID_BLOCK_TEST(suffix,type)                                 \
+    JTEST_DEFINE_TEST(arm_pid_block_##suffix##_test,                    \
+                      arm_pid_block_##suffix)                           \
+    {                                                                   \
+            uint32_t i,j;                                               \
+                                                                        \
+            arm_pid_instance_##suffix fut_pid_inst = { 0 };             \
+            arm_pid_instance_##suffix ref_pid_inst = { 0 };             \
+                                                                        \
+            for(i=0;i<CONTROLLER_MAX_COEFFS_LEN/3;i++)                  \
+            {                                                           \
+                fut_pid_inst.Kp = controller_##suffix##_coeffs[i*3+0];  \
+                fut_pid_inst.Ki = controller_##suffix##_coeffs[i*3+1];  \
+                fut_pid_inst.Kd = controller_##suffix##_coeffs[i*3+2];  \
+                ref_pid_inst.Kp = controller_##suffix##_coeffs[i*3+0];  \
+                ref_pid_inst.Ki = controller_##suffix##_coeffs[i*3+1];  \
+                ref_pid_inst.Kd = controller_##suffix##_coeffs[i*3+2];  \
+                                                                        \
+                arm_pid_init_##suffix(&fut_pid_inst, 1);                \
+                arm_pid_init_##suffix(&ref_pid_inst, 1);                \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Block Size: %d\n",                     \
+                                (int)CONTROLLER_MAX_LEN);               \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_pid_block_##suffix(&fut_pid_inst,               \
+                        (type*)controller_##suffix##_inputs,            \
+                        (type*)controller_output_fut,                   \
+                        CONTROLLER_MAX_LEN));                           \
+                                                                        \
+                for(j=0;j<CONTROLLER_MAX_LEN;j++)                       \
+                {                                                       \
+                   *((type*)controller_output_ref + j) =                \
+                        arm_pid_##suffix(&ref_pid_inst,                 \
+                        controller_##suffix##_inputs[j]);               \
+                }                                                       \
+                                                                        \
+                /* Test correctness */                                  \
+                TEST_ASSERT_BUFFERS_EQUAL(                              \
+                    controller_output_ref,                              \
+                    controller_output_fut,                              \
+                    CONTROLLER_MAX_LEN * sizeof(type));                 \
+                TEST_ASSERT_BUFFERS_EQUAL(                              \
+                    ref_pid_inst.state,                                 \
+                    fut_pid_inst.state,                                 \
+                    sizeof(ref_pid_inst.state));                        \
+            }                                                           \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+    }
+
+/**
+ *  Number of axes used to test arm_pid_multi_xxx. It is odd so that the
+ *  remaining axis is exercised.
+ */
+#define CONTROLLER_PID_AXES 3
+
+/**
+ *  Define a JTEST_TEST_t for the function arm_pid_multi_xxx function having
+ *  suffix. Each axis must be bit exact with arm_pid_xxx called once per
+ *  sample.
+ */
+#define ARM_PID_MULTI_TEST(suffix,type)                                 \
+    JTEST_DEFINE_TEST(arm_pid_multi_##suffix##_test,                    \
+                      arm_pid_multi_##suffix)                           \
+    {                                                                   \
+            uint32_t i,j,k;                                             \
+            uint32_t axisLen = CONTROLLER_MAX_LEN / CONTROLLER_PID_AXES;\
+                                                                        \
+            arm_pid_instance_##suffix fut_pid_inst[CONTROLLER_PID_AXES];\
+            arm_pid_instance_##suffix ref_pid_inst;                     \
+                                                                        \
+            for(i=0;i<CONTROLLER_MAX_COEFFS_LEN/3-CONTROLLER_PID_AXES;i++)\
+            {                                                           \
+                for(k=0;k<CONTROLLER_PID_AXES;k++)                      \
+                {                                                       \
+                    fut_pid_inst[k].Kp =                                \
+                        controller_##suffix##_coeffs[(i+k)*3+0];        \
+                    fut_pid_inst[k].Ki =                                \
+                        controller_##suffix##_coeffs[(i+k)*3+1];        \
+                    fut_pid_inst[k].Kd =                                \
+                        controller_##suffix##_coeffs[(i+k)*3+2];        \
+                    arm_pid_init_##suffix(&fut_pid_inst[k], 1);         \
+                }                                                       \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                      \
+                                "Axes: %d\n",                           \
+                                (int)axisLen,                           \
+                                (int)CONTROLLER_PID_AXES);              \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_pid_multi_##suffix(fut_pid_inst,                \
+                        CONTROLLER_PID_AXES,                            \
+                        (type*)controller_##suffix##_inputs,            \
+                        (type*)controller_output_fut,                   \
+                        axisLen));                                      \
+                                                                        \
+                for(k=0;k<CONTROLLER_PID_AXES;k++)                      \
+                {                                                       \
+                    /* Same gains as the axis, with a cleared state */   \
+                    ref_pid_inst = fut_pid_inst[k];                     \
+                    arm_pid_reset_##suffix(&ref_pid_inst);              \
+                                                                        \
+                    for(j=0;j<axisLen;j++)                              \
+                    {                                                   \
+                        *((type*)controller_output_ref + k*axisLen + j) = \
+                            arm_pid_##suffix(&ref_pid_inst,             \
+                            controller_##suffix##_inputs[k*axisLen+j]); \
+                    }                                                   \
+                                                                        \
+                    TEST_ASSERT_BUFFERS_EQUAL(                          \
+                        ref_pid_inst.state,                             \
+                        fut_pid_inst[k].state,                          \
+                        sizeof(ref_pid_inst.state));                    \
+                }                                                       \
+                                                                        \
+                /* Test correctness */                                  \
+                TEST_ASSERT_BUFFERS_EQUAL(                              \
+                    controller_output_ref,                              \
+                    controller_output_fut,                              \
+                    CONTROLLER_PID_AXES * axisLen * sizeof(type));      \
+            }                                                           \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+    }
+
+ARM_PID_BLOCK_TEST(f32,float32_t);
+ARM_PID_BLOCK_TEST(q31,q31_t);
+ARM_PID_BLOCK_TEST(q15,q15_t);
+
+ARM_PID_MULTI_TEST(f32,float32_t);
+ARM_PID_MULTI_TEST(q31,q31_t);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -76,4 +218,9 @@ JTEST_DEFINE_GROUP(pid_tests)
     JTEST_TEST_CALL(arm_pid_f32_test);
     JTEST_TEST_CALL(arm_pid_q31_test);
     JTEST_TEST_CALL(arm_pid_q15_test);
+    JTEST_TEST_CALL(arm_pid_block_f32_test);
+    JTEST_TEST_CALL(arm_pid_block_q31_test);
+    JTEST_TEST_CALL(arm_pid_block_q15_test);
+    JTEST_TEST_CALL(arm_pid_multi_f32_test);
+    JTEST_TEST_CALL(arm_pid_multi_q31_test);
 }
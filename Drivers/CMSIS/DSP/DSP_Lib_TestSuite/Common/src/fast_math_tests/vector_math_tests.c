@@ -0,0 +1,430 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*
+  The vector functions are run on dense deterministic sweeps of their input
+  range and compared to the double precision C library.  The floating-point
+  errors are measured in ULP of the correctly rounded result and the
+  fixed-point errors are absolute errors.  The bounds are the ones given in
+  the documentation of the functions.
+*/
+
+#define VECTOR_MATH_LEN FAST_MATH_MAX_LEN
+
+/* Error in ULP of a float32_t result */
+static float64_t vector_math_ulp(
+    float64_t ref,
+    float32_t out)
+{
+    float32_t rounded = (float32_t) ref;
+    int exponent;
+
+    if (isnan(rounded) || isnan(out))
+    {
+        return (isnan(rounded) && isnan(out)) ? 0.0 : HUGE_VAL;
+    }
+
+    if (isinf(rounded) || isinf(out))
+    {
+        return (rounded == out) ? 0.0 : HUGE_VAL;
+    }
+
+    if (rounded == 0.0f)
+    {
+        return fabs(out - ref) / ldexp(1.0, -149);
+    }
+
+    frexp(rounded, &exponent);
+
+    return fabs(out - ref) / ldexp(1.0, exponent - 24);
+}
+
+/* Saturating conversions of the test inputs */
+static q31_t vector_math_to_q31(float64_t x)
+{
+    x = floor(x * 2147483648.0 + 0.5);
+
+    return (q31_t) ((x > 2147483647.0) ? 2147483647.0 : ((x < -2147483648.0) ? -2147483648.0 : x));
+}
+
+static q15_t vector_math_to_q15(float64_t x)
+{
+    x = floor(x * 32768.0 + 0.5);
+
+    return (q15_t) ((x > 32767.0) ? 32767.0 : ((x < -32768.0) ? -32768.0 : x));
+}
+
+/*
+  Floating-point test template.  Arguments are: function name, input of
+  sample i as a function of t = i / VECTOR_MATH_LEN, reference as a function
+  of the input x and the maximum error in ULP.
+*/
+#define VECTOR_MATH_F32_DEFINE_TEST(fn, in_expr, ref_expr, max_ulp)     \
+    JTEST_DEFINE_TEST(arm_##fn##_f32_test, arm_##fn##_f32)              \
+    {                                                                   \
+        float32_t * pIn = fast_math_output_f32_ref;                     \
+        float32_t * pOut = fast_math_output_f32_fut;                    \
+        float64_t t, x, err, maxErr = 0.0;                              \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < VECTOR_MATH_LEN; i++)                           \
+        {                                                               \
+            t = (float64_t) i / VECTOR_MATH_LEN;                        \
+            pIn[i] = (float32_t) (in_expr);                             \
+        }                                                               \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_##fn##_f32(pIn, pOut, VECTOR_MATH_LEN));                \
+                                                                        \
+        for (i = 0; i < VECTOR_MATH_LEN; i++)                           \
+        {                                                               \
+            x = pIn[i];                                                 \
+            err = vector_math_ulp(ref_expr, pOut[i]);                   \
+            maxErr = (err > maxErr) ? err : maxErr;                     \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: %f ULP\n", maxErr);                 \
+                                                                        \
+        if (maxErr > (max_ulp))                                         \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        /* In place */                                                  \
+        arm_##fn##_f32(pIn, pIn, VECTOR_MATH_LEN);                      \
+                                                                        \
+        TEST_ASSERT_BUFFERS_EQUAL(pIn, pOut,                            \
+                                  VECTOR_MATH_LEN * sizeof(float32_t)); \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*
+  Fixed-point test template.  Arguments are: function name, type suffix,
+  input of sample i as a function of t = i / VECTOR_MATH_LEN in the format of
+  the function, number of fractional bits of the input and of the output,
+  reference as a function of the input x and the base 2 logarithm of the
+  maximum absolute error.
+*/
+#define VECTOR_MATH_FX_DEFINE_TEST(fn, suffix, in_expr, in_bits, out_bits, \
+                                   ref_expr, max_err_log2)              \
+    JTEST_DEFINE_TEST(arm_##fn##_##suffix##_test, arm_##fn##_##suffix)  \
+    {                                                                   \
+        suffix##_t * pIn = (suffix##_t *) fast_math_output_ref;         \
+        suffix##_t * pOut = (suffix##_t *) fast_math_output_fut;        \
+        float64_t t, x, err, maxErr = 0.0;                              \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < VECTOR_MATH_LEN; i++)                           \
+        {                                                               \
+            t = (float64_t) i / VECTOR_MATH_LEN;                        \
+            pIn[i] = vector_math_to_##suffix(                           \
+                ldexp(in_expr, (int) (sizeof(suffix##_t) * 8 - 1) - in_bits)); \
+        }                                                               \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_##fn##_##suffix(pIn, pOut, VECTOR_MATH_LEN));           \
+                                                                        \
+        for (i = 0; i < VECTOR_MATH_LEN; i++)                           \
+        {                                                               \
+            x = ldexp((float64_t) pIn[i], -(in_bits));                  \
+            err = fabs(ldexp((float64_t) pOut[i], -(out_bits)) - (ref_expr)); \
+            maxErr = (err > maxErr) ? err : maxErr;                     \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: 2^%f\n", log2(maxErr));             \
+                                                                        \
+        if (maxErr > ldexp(1.0, max_err_log2))                          \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+VECTOR_MATH_F32_DEFINE_TEST(vexp, -87.0 + 175.0 * t, exp(x), 1.0);
+VECTOR_MATH_F32_DEFINE_TEST(vlog, exp(-80.0 + 160.0 * t), log(x), 1.0);
+VECTOR_MATH_F32_DEFINE_TEST(vtanh, -12.0 + 24.0 * t, tanh(x), 2.0);
+VECTOR_MATH_F32_DEFINE_TEST(vsigmoid, -20.0 + 40.0 * t, 1.0 / (1.0 + exp(-x)), 3.0);
+VECTOR_MATH_F32_DEFINE_TEST(vsqrt, 1000.0 * t * t, sqrt(x), 1.0);
+
+/*
+  The exponential inputs are denser near 0, where the outputs are large.  The
+  outputs saturate to the largest value below 1.
+*/
+VECTOR_MATH_FX_DEFINE_TEST(vexp, q31, 0.01 - 24.0 * (1.0 - t) * (1.0 - t), 26, 31,
+                           (x >= 0.0) ? 1.0 : exp(x), -22);
+VECTOR_MATH_FX_DEFINE_TEST(vexp, q15, 0.01 - 12.0 * (1.0 - t) * (1.0 - t), 11, 15,
+                           (x >= 0.0) ? 1.0 : exp(x), -15);
+VECTOR_MATH_FX_DEFINE_TEST(vlog, q31, exp2(-31.0 * (1.0 - t)), 31, 26, log(x), -20);
+VECTOR_MATH_FX_DEFINE_TEST(vlog, q15, exp2(-15.0 * (1.0 - t)), 15, 11, log(x), -11);
+VECTOR_MATH_FX_DEFINE_TEST(vtanh, q31, -8.0 + 16.0 * t, 28, 31, tanh(x), -29);
+VECTOR_MATH_FX_DEFINE_TEST(vtanh, q15, -8.0 + 16.0 * t, 12, 15, tanh(x), -14);
+VECTOR_MATH_FX_DEFINE_TEST(vsigmoid, q31, -8.0 + 16.0 * t, 28, 31, 1.0 / (1.0 + exp(-x)), -28);
+VECTOR_MATH_FX_DEFINE_TEST(vsigmoid, q15, -8.0 + 16.0 * t, 12, 15, 1.0 / (1.0 + exp(-x)), -13);
+VECTOR_MATH_FX_DEFINE_TEST(vsqrt, q31, t, 31, 31, sqrt(x), -27);
+VECTOR_MATH_FX_DEFINE_TEST(vsqrt, q15, t, 15, 15, sqrt(x), -12);
+
+/* Points on circles of radii from 1e-3 to 1e3 */
+JTEST_DEFINE_TEST(arm_atan2_f32_test, arm_atan2_f32)
+{
+    float32_t * pY = fast_math_output_f32_ref;
+    float32_t * pX = fast_math_output_f32_fut;
+    float32_t * pOut = fast_math_output_fut;
+    float64_t a, r, err, maxErr = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < VECTOR_MATH_LEN; i++)
+    {
+        a = 2.0 * PI * i / VECTOR_MATH_LEN;
+        r = pow(10.0, -3.0 + 6.0 * (i % 37) / 37.0);
+        pY[i] = (float32_t) (r * sin(a));
+        pX[i] = (float32_t) (r * cos(a));
+    }
+
+    JTEST_COUNT_CYCLES(
+        arm_atan2_f32(pY, pX, pOut, VECTOR_MATH_LEN));
+
+    for (i = 0; i < VECTOR_MATH_LEN; i++)
+    {
+        err = vector_math_ulp(atan2(pY[i], pX[i]), pOut[i]);
+        maxErr = (err > maxErr) ? err : maxErr;
+    }
+
+    JTEST_DUMP_STRF("Max Error: %f ULP\n", maxErr);
+
+    if (maxErr > 3.0)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Fixed-point four-quadrant arc tangent test template.  Arguments are: type
+  suffix, number of fractional bits of the output and base 2 logarithm of the
+  maximum absolute error.
+*/
+#define VECTOR_MATH_ATAN2_DEFINE_TEST(suffix, out_bits, max_err_log2)   \
+    JTEST_DEFINE_TEST(arm_atan2_##suffix##_test, arm_atan2_##suffix)    \
+    {                                                                   \
+        suffix##_t * pY = (suffix##_t *) fast_math_output_ref;          \
+        suffix##_t * pX = (suffix##_t *) fast_math_output_f32_ref;      \
+        suffix##_t * pOut = (suffix##_t *) fast_math_output_fut;        \
+        float64_t a, r, err, maxErr = 0.0;                              \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < VECTOR_MATH_LEN; i++)                           \
+        {                                                               \
+            a = 2.0 * PI * i / VECTOR_MATH_LEN;                         \
+            r = 0.01 + 0.98 * (i % 37) / 37.0;                          \
+            pY[i] = vector_math_to_##suffix(r * sin(a));                \
+            pX[i] = vector_math_to_##suffix(r * cos(a));                \
+        }                                                               \
+                                                                        \
+        /* Both coordinates zero */                                     \
+        pY[0] = 0;                                                      \
+        pX[0] = 0;                                                      \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_atan2_##suffix(pY, pX, pOut, VECTOR_MATH_LEN));         \
+                                                                        \
+        for (i = 0; i < VECTOR_MATH_LEN; i++)                           \
+        {                                                               \
+            err = fabs(ldexp((float64_t) pOut[i], -(out_bits)) -        \
+                       atan2((float64_t) pY[i], (float64_t) pX[i]));    \
+            maxErr = (err > maxErr) ? err : maxErr;                     \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: 2^%f\n", log2(maxErr));             \
+                                                                        \
+        if (maxErr > ldexp(1.0, max_err_log2))                          \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+VECTOR_MATH_ATAN2_DEFINE_TEST(q31, 29, -21);
+VECTOR_MATH_ATAN2_DEFINE_TEST(q15, 13, -13);
+
+/* Zeros, infinities and NaNs */
+JTEST_DEFINE_TEST(arm_vector_math_special_f32_test, arm_vexp_f32)
+{
+    float32_t in[6];
+    float32_t inX[6];
+    float32_t out[6];
+
+    in[0] = 100.0f;
+    in[1] = -110.0f;
+    in[2] = INFINITY;
+    in[3] = -INFINITY;
+    in[4] = NAN;
+    arm_vexp_f32(in, out, 5);
+
+    TEST_ASSERT_EQUAL(out[0], INFINITY);
+    TEST_ASSERT_EQUAL(out[1], 0.0f);
+    TEST_ASSERT_EQUAL(out[2], INFINITY);
+    TEST_ASSERT_EQUAL(out[3], 0.0f);
+    TEST_ASSERT_EQUAL(isnan(out[4]) != 0, 1);
+
+    in[0] = 0.0f;
+    in[1] = -1.0f;
+    in[2] = INFINITY;
+    in[3] = NAN;
+    in[4] = 1.0e-40f;
+    in[5] = 1.0f;
+    arm_vlog_f32(in, out, 6);
+
+    TEST_ASSERT_EQUAL(out[0], -INFINITY);
+    TEST_ASSERT_EQUAL(isnan(out[1]) != 0, 1);
+    TEST_ASSERT_EQUAL(out[2], INFINITY);
+    TEST_ASSERT_EQUAL(isnan(out[3]) != 0, 1);
+    TEST_ASSERT_EQUAL(vector_math_ulp(log(in[4]), out[4]) <= 1.0, 1);
+    TEST_ASSERT_EQUAL(out[5], 0.0f);
+
+    in[0] = 0.0f;
+    inX[0] = -1.0f;
+    in[1] = 1.0f;
+    inX[1] = 0.0f;
+    in[2] = -INFINITY;
+    inX[2] = INFINITY;
+    in[3] = NAN;
+    inX[3] = 1.0f;
+    arm_atan2_f32(in, inX, out, 4);
+
+    TEST_ASSERT_EQUAL(out[0], PI);
+    TEST_ASSERT_EQUAL(out[1], PI / 2.0f);
+    TEST_ASSERT_EQUAL(out[2], -PI / 4.0f);
+    TEST_ASSERT_EQUAL(isnan(out[3]) != 0, 1);
+
+    return JTEST_TEST_PASSED;
+}
+
+/* Cycles of the vector functions and of loops calling the C library */
+JTEST_DEFINE_TEST(arm_vector_math_f32_benchmark_test, arm_vexp_f32)
+{
+    float32_t * pX = fast_math_output_f32_ref;
+    float32_t * pY = fast_math_output_f32_fut;
+    float32_t * pOut = fast_math_output_fut;
+    uint32_t i, vectorCycles, scalarCycles;
+
+    for (i = 0; i < VECTOR_MATH_LEN; i++)
+    {
+        pX[i] = (float32_t) (0.01 + 10.0 * i / VECTOR_MATH_LEN);
+        pY[i] = (float32_t) (-5.0 + 10.0 * i / VECTOR_MATH_LEN);
+    }
+
+    JTEST_MEASURE_CYCLES(vectorCycles, arm_vexp_f32(pY, pOut, VECTOR_MATH_LEN));
+    JTEST_MEASURE_CYCLES(scalarCycles,
+                         for (i = 0; i < VECTOR_MATH_LEN; i++)
+                         {
+                             pOut[i] = expf(pY[i]);
+                         });
+
+    JTEST_DUMP_STRF("Block Size: %d\n"
+                    "arm_vexp_f32 Cycles: %d\n"
+                    "expf Cycles: %d\n",
+                    (int)VECTOR_MATH_LEN, (int)vectorCycles, (int)scalarCycles);
+
+    JTEST_MEASURE_CYCLES(vectorCycles, arm_vlog_f32(pX, pOut, VECTOR_MATH_LEN));
+    JTEST_MEASURE_CYCLES(scalarCycles,
+                         for (i = 0; i < VECTOR_MATH_LEN; i++)
+                         {
+                             pOut[i] = logf(pX[i]);
+                         });
+
+    JTEST_DUMP_STRF("arm_vlog_f32 Cycles: %d\n"
+                    "logf Cycles: %d\n",
+                    (int)vectorCycles, (int)scalarCycles);
+
+    JTEST_MEASURE_CYCLES(vectorCycles, arm_atan2_f32(pY, pX, pOut, VECTOR_MATH_LEN));
+    JTEST_MEASURE_CYCLES(scalarCycles,
+                         for (i = 0; i < VECTOR_MATH_LEN; i++)
+                         {
+                             pOut[i] = atan2f(pY[i], pX[i]);
+                         });
+
+    JTEST_DUMP_STRF("arm_atan2_f32 Cycles: %d\n"
+                    "atan2f Cycles: %d\n",
+                    (int)vectorCycles, (int)scalarCycles);
+
+    JTEST_MEASURE_CYCLES(vectorCycles, arm_vtanh_f32(pY, pOut, VECTOR_MATH_LEN));
+    JTEST_MEASURE_CYCLES(scalarCycles,
+                         for (i = 0; i < VECTOR_MATH_LEN; i++)
+                         {
+                             pOut[i] = tanhf(pY[i]);
+                         });
+
+    JTEST_DUMP_STRF("arm_vtanh_f32 Cycles: %d\n"
+                    "tanhf Cycles: %d\n",
+                    (int)vectorCycles, (int)scalarCycles);
+
+    JTEST_MEASURE_CYCLES(vectorCycles, arm_vsigmoid_f32(pY, pOut, VECTOR_MATH_LEN));
+    JTEST_MEASURE_CYCLES(scalarCycles,
+                         for (i = 0; i < VECTOR_MATH_LEN; i++)
+                         {
+                             pOut[i] = 1.0f / (1.0f + expf(-pY[i]));
+                         });
+
+    JTEST_DUMP_STRF("arm_vsigmoid_f32 Cycles: %d\n"
+                    "expf Sigmoid Cycles: %d\n",
+                    (int)vectorCycles, (int)scalarCycles);
+
+    JTEST_MEASURE_CYCLES(vectorCycles, arm_vsqrt_f32(pX, pOut, VECTOR_MATH_LEN));
+    JTEST_MEASURE_CYCLES(scalarCycles,
+                         for (i = 0; i < VECTOR_MATH_LEN; i++)
+                         {
+                             pOut[i] = sqrtf(pX[i]);
+                         });
+
+    JTEST_DUMP_STRF("arm_vsqrt_f32 Cycles: %d\n"
+                    "sqrtf Cycles: %d\n",
+                    (int)vectorCycles, (int)scalarCycles);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(vector_math_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_vexp_f32_test);
+    JTEST_TEST_CALL(arm_vexp_q31_test);
+    JTEST_TEST_CALL(arm_vexp_q15_test);
+
+    JTEST_TEST_CALL(arm_vlog_f32_test);
+    JTEST_TEST_CALL(arm_vlog_q31_test);
+    JTEST_TEST_CALL(arm_vlog_q15_test);
+
+    JTEST_TEST_CALL(arm_atan2_f32_test);
+    JTEST_TEST_CALL(arm_atan2_q31_test);
+    JTEST_TEST_CALL(arm_atan2_q15_test);
+
+    JTEST_TEST_CALL(arm_vtanh_f32_test);
+    JTEST_TEST_CALL(arm_vtanh_q31_test);
+    JTEST_TEST_CALL(arm_vtanh_q15_test);
+
+    JTEST_TEST_CALL(arm_vsigmoid_f32_test);
+    JTEST_TEST_CALL(arm_vsigmoid_q31_test);
+    JTEST_TEST_CALL(arm_vsigmoid_q15_test);
+
+    JTEST_TEST_CALL(arm_vsqrt_f32_test);
+    JTEST_TEST_CALL(arm_vsqrt_q31_test);
+    JTEST_TEST_CALL(arm_vsqrt_q15_test);
+
+    JTEST_TEST_CALL(arm_vector_math_special_f32_test);
+    JTEST_TEST_CALL(arm_vector_math_f32_benchmark_test);
+}
@@ -215,6 +215,89 @@ JTEST_DEFINE_TEST(arm_biquad_cascade_df2T_f64_test,
 }
 
 
+/*
+  Half-precision DF1 biquad test.  The inputs are rounded to half precision and
+  the reference is the floating-point cascade of the rounded inputs with the same
+  coefficients.  Each block is filtered in two calls to check the state kept
+  between them.  The shared test coefficients have a gain that exceeds the
+  half-precision range, so the stages are low-pass sections with poles of
+  radius 0.5 and unit DC gain.
+*/
+#define BIQUAD_F16_SNR_THRESHOLD 55
+#define BIQUAD_F16_MAX_SAMPLES   (2 * FILTERING_MAX_BLOCKSIZE)
+
+static float16_t biquad_f16_inputs[BIQUAD_F16_MAX_SAMPLES];
+static float16_t biquad_f16_outputs[BIQUAD_F16_MAX_SAMPLES];
+static float16_t biquad_f16_state[4 * FILTERING_MAX_NUMSTAGES];
+static float32_t biquad_f16_coeffs[5 * FILTERING_MAX_NUMSTAGES];
+
+JTEST_DEFINE_TEST(arm_biquad_cascade_df1_f16_test,
+                  arm_biquad_cascade_df1_f16)
+{
+   arm_biquad_casd_df1_inst_f16 biquad_inst_fut = { 0 };
+   arm_biquad_casd_df1_inst_f32 biquad_inst_ref = { 0 };
+   float32_t a1, a2;
+   uint32_t i;
+
+   for (i = 0; i < FILTERING_MAX_NUMSTAGES; i++)
+   {
+      a1 = arm_cos_f32(0.3f + 0.02f * (float32_t) i);
+      a2 = -0.25f;
+
+      biquad_f16_coeffs[5 * i + 0] = 1.0f - a1 - a2;
+      biquad_f16_coeffs[5 * i + 1] = 0.0f;
+      biquad_f16_coeffs[5 * i + 2] = 0.0f;
+      biquad_f16_coeffs[5 * i + 3] = a1;
+      biquad_f16_coeffs[5 * i + 4] = a2;
+   }
+
+   for (i = 0; i < BIQUAD_F16_MAX_SAMPLES; i++)
+   {
+      filtering_output_f32_fut[i] = filtering_f32_inputs[i];
+   }
+
+   arm_float_to_f16(filtering_output_f32_fut, biquad_f16_inputs, BIQUAD_F16_MAX_SAMPLES);
+   arm_f16_to_float(biquad_f16_inputs, filtering_input_lms, BIQUAD_F16_MAX_SAMPLES);
+
+   TEMPLATE_DO_ARR_DESC(
+         blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+         ,
+      TEMPLATE_DO_ARR_DESC(
+            numstages_idx, uint16_t, numStages, filtering_numstages
+            ,
+            /* Display test parameter values */
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Number of Stages: %d\n",
+                            (int)blockSize,
+                            (int)numStages);
+
+            arm_biquad_cascade_df1_init_f16(&biquad_inst_fut, numStages,
+                                            biquad_f16_coeffs, biquad_f16_state);
+
+            JTEST_COUNT_CYCLES(
+                  arm_biquad_cascade_df1_f16(&biquad_inst_fut, biquad_f16_inputs,
+                                             biquad_f16_outputs, blockSize));
+
+            arm_biquad_cascade_df1_f16(&biquad_inst_fut, biquad_f16_inputs + blockSize,
+                                       biquad_f16_outputs + blockSize, blockSize);
+
+            arm_biquad_cascade_df1_init_f32(&biquad_inst_ref, numStages,
+                                            biquad_f16_coeffs, filtering_pState);
+
+            ref_biquad_cascade_df1_f32(&biquad_inst_ref, filtering_input_lms,
+                                       filtering_output_f32_ref, 2 * blockSize);
+
+            arm_f16_to_float(biquad_f16_outputs, filtering_output_f32_fut,
+                             2 * blockSize);
+
+            TEST_ASSERT_SNR(filtering_output_f32_ref,
+                            filtering_output_f32_fut,
+                            2 * blockSize,
+                            BIQUAD_F16_SNR_THRESHOLD)));
+
+   return JTEST_TEST_PASSED;
+}
+
 BIQUAD_DEFINE_TEST(f32,arm_biquad_casd_df1_inst_f32, df1,float32_t);
 BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_df2T_instance_f32,df2T,float32_t);
 BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_stereo_df2T_instance_f32,stereo_df2T,float32_t);
@@ -233,6 +316,7 @@ JTEST_DEFINE_GROUP(biquad_tests)
       To skip a test, comment it out.
     */
    JTEST_TEST_CALL(arm_biquad_cascade_df1_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df1_f16_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_stereo_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f64_test);
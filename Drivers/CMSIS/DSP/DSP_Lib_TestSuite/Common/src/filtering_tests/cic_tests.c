@@ -0,0 +1,547 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Cascaded Integrator-Comb Filters */
+/*--------------------------------------------------------------------------------*/
+
+#define CIC_MAX_ORDER    8
+#define CIC_MAX_TAPS     (4 * 255 + 1)
+#define CIC_INPUT_LENGTH 1024
+
+/* Order and rate change factor of the decimator tests */
+static const uint16_t cic_decimate_configs[][2] =
+{
+    { 1,   2 },
+    { 3,   8 },
+    { 5,  16 },
+    { 4,  10 },
+    { 4, 255 },
+    { 2,   1 }
+};
+
+#define CIC_NUM_DECIMATE_CONFIGS \
+    (sizeof(cic_decimate_configs) / sizeof(cic_decimate_configs[0]))
+
+/* Order and rate change factor of the interpolator tests */
+static const uint16_t cic_interpolate_configs[][2] =
+{
+    { 1,   4 },
+    { 3,   8 },
+    { 5,  16 },
+    { 4,  10 }
+};
+
+#define CIC_NUM_INTERPOLATE_CONFIGS \
+    (sizeof(cic_interpolate_configs) / sizeof(cic_interpolate_configs[0]))
+
+/* Irregular block sizes used to check that the decimator keeps its phase */
+static const uint32_t cic_chunk_sizes[] = { 7, 1, 30, 255, 3, 64 };
+
+#define CIC_NUM_CHUNK_SIZES (sizeof(cic_chunk_sizes) / sizeof(cic_chunk_sizes[0]))
+
+static q31_t cic_input[CIC_INPUT_LENGTH];
+static q31_t cic_output[CIC_INPUT_LENGTH];
+static q31_t cic_output_ref[CIC_INPUT_LENGTH];
+static q31_t cic_stuffed[CIC_INPUT_LENGTH];
+static q63_t cic_state[2 * CIC_MAX_ORDER];
+static int64_t cic_taps[CIC_MAX_TAPS];
+
+/*
+  Input with full scale samples, so that the integrators wrap around.
+*/
+static void cic_make_input(void)
+{
+    arm_scale_f32((float32_t *) filtering_f32_inputs, 1.0f / 200.0f,
+                  filtering_output_f32_ref, CIC_INPUT_LENGTH);
+    arm_float_to_q31(filtering_output_f32_ref, cic_input, CIC_INPUT_LENGTH);
+}
+
+/*
+  Impulse response of the CIC filter, order moving sums of length R.  Returns
+  the number of taps, order*(R-1)+1.
+*/
+static uint32_t cic_make_taps(uint16_t order, uint16_t R)
+{
+    uint32_t length = 1U;
+    uint32_t s, n, k;
+    int64_t sum;
+
+    cic_taps[0] = 1;
+
+    for (s = 0; s < order; s++)
+    {
+        /* Moving sum of length R, in place from the last tap */
+        for (n = length + R - 1U; n-- > 0; )
+        {
+            sum = 0;
+            for (k = 0; k < R && k <= n; k++)
+            {
+                if (n - k < length)
+                {
+                    sum += cic_taps[n - k];
+                }
+            }
+
+            cic_taps[n] = sum;
+        }
+
+        length += R - 1U;
+    }
+
+    return length;
+}
+
+/*
+  Direct convolution with the impulse response of the filter.  The sum is
+  evaluated modulo 2^64, like in the filter, and is exact because the result
+  fits in 64 bits.
+*/
+static q31_t cic_ref_output(
+    const q31_t * pSrc,
+    uint32_t n,
+    uint32_t numTaps,
+    uint32_t shift)
+{
+    uint64_t sum = 0;
+    uint32_t k;
+
+    for (k = 0; k < numTaps && k <= n; k++)
+    {
+        sum += (uint64_t) cic_taps[k] * (uint64_t) (int64_t) pSrc[n - k];
+    }
+
+    return (q31_t) ((int64_t) sum >> shift);
+}
+
+static uint32_t cic_count_mismatches(
+    const q31_t * pA,
+    const q31_t * pB,
+    uint32_t length)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < length; i++)
+    {
+        if (pA[i] != pB[i])
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+JTEST_DEFINE_TEST(arm_cic_init_q31_test,
+                  arm_cic_decimate_init_q31)
+{
+    arm_cic_decimate_instance_q31 dec_inst;
+    arm_cic_interpolate_instance_q31 int_inst;
+    arm_pdm_to_pcm_instance_q31 pdm_inst;
+
+    TEST_ASSERT_EQUAL(arm_cic_decimate_init_q31(&dec_inst, 0, 16, cic_state),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_cic_decimate_init_q31(&dec_inst, 3, 0, cic_state),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    /* The gain R^order must not exceed 2^32 */
+    TEST_ASSERT_EQUAL(arm_cic_decimate_init_q31(&dec_inst, 5, 128, cic_state),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_cic_decimate_init_q31(&dec_inst, 4, 256, cic_state),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(dec_inst.shift, 32);
+
+    TEST_ASSERT_EQUAL(arm_cic_decimate_init_q31(&dec_inst, 3, 10, cic_state),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(dec_inst.shift, 10);
+
+    /* The interpolator gain is R^(order-1) */
+    TEST_ASSERT_EQUAL(arm_cic_interpolate_init_q31(&int_inst, 5, 128, cic_state),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(int_inst.shift, 28);
+    TEST_ASSERT_EQUAL(arm_cic_interpolate_init_q31(&int_inst, 6, 128, cic_state),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    /* 8*blockSize must be a multiple of R*M */
+    TEST_ASSERT_EQUAL(arm_pdm_to_pcm_init_q31(&pdm_inst, 4, 16, 16, 2,
+                                              cic_output, cic_state,
+                                              cic_output_ref, cic_input, 6),
+                      ARM_MATH_LENGTH_ERROR);
+    TEST_ASSERT_EQUAL(arm_pdm_to_pcm_init_q31(&pdm_inst, 4, 16, 16, 2,
+                                              cic_output, cic_state,
+                                              cic_output_ref, cic_input, 2),
+                      ARM_MATH_LENGTH_ERROR);
+    TEST_ASSERT_EQUAL(arm_pdm_to_pcm_init_q31(&pdm_inst, 4, 16, 16, 2,
+                                              cic_output, cic_state,
+                                              cic_output_ref, cic_input, 4),
+                      ARM_MATH_SUCCESS);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The decimator output must match the direct convolution with the impulse
+  response of the filter bit for bit, also when the input is processed in
+  blocks that are not a multiple of the decimation factor.
+*/
+JTEST_DEFINE_TEST(arm_cic_decimate_q31_test,
+                  arm_cic_decimate_q31)
+{
+    arm_cic_decimate_instance_q31 cic_inst;
+    uint16_t order, R;
+    uint32_t c, m, n, numTaps, outCnt, chunk;
+
+    cic_make_input();
+
+    for (c = 0; c < CIC_NUM_DECIMATE_CONFIGS; c++)
+    {
+        order = cic_decimate_configs[c][0];
+        R = cic_decimate_configs[c][1];
+
+        JTEST_DUMP_STRF("Order: %d\n"
+                        "Decimation Factor: %d\n",
+                        (int)order,
+                        (int)R);
+
+        numTaps = cic_make_taps(order, R);
+
+        TEST_ASSERT_EQUAL(arm_cic_decimate_init_q31(&cic_inst, order, R,
+                                                    cic_state),
+                          ARM_MATH_SUCCESS);
+
+        JTEST_COUNT_CYCLES(
+            outCnt = arm_cic_decimate_q31(&cic_inst, cic_input, cic_output,
+                                          CIC_INPUT_LENGTH));
+
+        TEST_ASSERT_EQUAL(outCnt, CIC_INPUT_LENGTH / R);
+
+        for (m = 0; m < outCnt; m++)
+        {
+            cic_output_ref[m] = cic_ref_output(cic_input, m * R + R - 1U,
+                                               numTaps, cic_inst.shift);
+        }
+
+        TEST_ASSERT_EQUAL(cic_count_mismatches(cic_output, cic_output_ref,
+                                               outCnt), 0);
+
+        /* Same input in irregular blocks */
+        arm_cic_decimate_init_q31(&cic_inst, order, R, cic_state);
+
+        outCnt = 0;
+        for (n = 0, chunk = 0; n < CIC_INPUT_LENGTH; n += cic_chunk_sizes[chunk],
+                 chunk = (chunk + 1U) % CIC_NUM_CHUNK_SIZES)
+        {
+            outCnt += arm_cic_decimate_q31(
+                &cic_inst, cic_input + n, cic_output + outCnt,
+                (n + cic_chunk_sizes[chunk] <= CIC_INPUT_LENGTH) ?
+                cic_chunk_sizes[chunk] : CIC_INPUT_LENGTH - n);
+        }
+
+        TEST_ASSERT_EQUAL(outCnt, CIC_INPUT_LENGTH / R);
+        TEST_ASSERT_EQUAL(cic_count_mismatches(cic_output, cic_output_ref,
+                                               outCnt), 0);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The interpolator output must match the direct convolution of the zero
+  stuffed input with the impulse response of the filter bit for bit.
+*/
+JTEST_DEFINE_TEST(arm_cic_interpolate_q31_test,
+                  arm_cic_interpolate_q31)
+{
+    arm_cic_interpolate_instance_q31 cic_inst;
+    uint16_t order, R;
+    uint32_t c, n, numTaps, blockSize;
+
+    cic_make_input();
+
+    for (c = 0; c < CIC_NUM_INTERPOLATE_CONFIGS; c++)
+    {
+        order = cic_interpolate_configs[c][0];
+        R = cic_interpolate_configs[c][1];
+        blockSize = CIC_INPUT_LENGTH / R;
+
+        JTEST_DUMP_STRF("Order: %d\n"
+                        "Interpolation Factor: %d\n",
+                        (int)order,
+                        (int)R);
+
+        numTaps = cic_make_taps(order, R);
+
+        TEST_ASSERT_EQUAL(arm_cic_interpolate_init_q31(&cic_inst, order, R,
+                                                       cic_state),
+                          ARM_MATH_SUCCESS);
+
+        /* Two calls, to check the state kept between blocks */
+        JTEST_COUNT_CYCLES(
+            arm_cic_interpolate_q31(&cic_inst, cic_input, cic_output,
+                                    blockSize / 2U));
+
+        arm_cic_interpolate_q31(&cic_inst, cic_input + blockSize / 2U,
+                                cic_output + (blockSize / 2U) * R,
+                                blockSize - blockSize / 2U);
+
+        /* Zero stuffed input */
+        memset(cic_stuffed, 0, sizeof(cic_stuffed));
+        for (n = 0; n < blockSize; n++)
+        {
+            cic_stuffed[n * R] = cic_input[n];
+        }
+
+        for (n = 0; n < blockSize * R; n++)
+        {
+            cic_output_ref[n] = cic_ref_output(cic_stuffed, n,
+                                               numTaps, cic_inst.shift);
+        }
+
+        TEST_ASSERT_EQUAL(cic_count_mismatches(cic_output, cic_output_ref,
+                                               blockSize * R), 0);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Compensation filter for a 5th order CIC decimator by 32, followed by a
+  decimation by 2.  The cascade must be flat within 0.5 dB up to 0.2 of the
+  CIC output rate and attenuate by 35 dB above 0.3, where the images of the
+  final decimation fold into the passband.
+*/
+#define CIC_COMP_ORDER     5
+#define CIC_COMP_R         32
+#define CIC_COMP_M         2
+#define CIC_COMP_NUMTAPS   64
+#define CIC_COMP_PASS      0.2f
+#define CIC_COMP_STOP      0.3f
+#define CIC_COMP_RIPPLE_DB 0.5f
+#define CIC_COMP_ATTEN_DB  35.0f
+
+static float32_t cic_comp_coeffs[CIC_COMP_NUMTAPS];
+
+JTEST_DEFINE_TEST(arm_cic_compensation_f32_test,
+                  arm_cic_compensation_f32)
+{
+    float32_t f, re, im, gain, cic, db;
+    float32_t ripple = 0.0f, atten = -1000.0f;
+    uint32_t i, n;
+
+    TEST_ASSERT_EQUAL(arm_cic_compensation_f32(CIC_COMP_ORDER, CIC_COMP_R,
+                                               0.3f, 0.2f, cic_comp_coeffs,
+                                               CIC_COMP_NUMTAPS),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_cic_compensation_f32(CIC_COMP_ORDER, CIC_COMP_R,
+                                               0.2f, 0.6f, cic_comp_coeffs,
+                                               CIC_COMP_NUMTAPS),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    TEST_ASSERT_EQUAL(arm_cic_compensation_f32(CIC_COMP_ORDER, CIC_COMP_R,
+                                               CIC_COMP_PASS, CIC_COMP_STOP,
+                                               cic_comp_coeffs,
+                                               CIC_COMP_NUMTAPS),
+                      ARM_MATH_SUCCESS);
+
+    for (i = 0; i <= 500; i++)
+    {
+        f = 0.001f * i;
+
+        re = 0.0f;
+        im = 0.0f;
+        for (n = 0; n < CIC_COMP_NUMTAPS; n++)
+        {
+            re += cic_comp_coeffs[n] * cosf(2.0f * PI * f * n);
+            im -= cic_comp_coeffs[n] * sinf(2.0f * PI * f * n);
+        }
+
+        gain = sqrtf(re * re + im * im);
+        cic = (i == 0) ? 1.0f :
+            powf(fabsf(sinf(PI * f) / (CIC_COMP_R * sinf(PI * f / CIC_COMP_R))),
+                 CIC_COMP_ORDER);
+        db = 20.0f * log10f(gain * cic + 1.0e-30f);
+
+        if ((f <= CIC_COMP_PASS) && (fabsf(db) > ripple))
+        {
+            ripple = fabsf(db);
+        }
+
+        if ((f >= CIC_COMP_STOP) && (db > atten))
+        {
+            atten = db;
+        }
+    }
+
+    JTEST_DUMP_STRF("Passband Ripple: %d mdB\n"
+                    "Stopband Attenuation: %d dB\n",
+                    (int)(ripple * 1000.0f),
+                    (int)(-atten));
+
+    TEST_ASSERT_EQUAL(ripple < CIC_COMP_RIPPLE_DB, 1);
+    TEST_ASSERT_EQUAL(-atten > CIC_COMP_ATTEN_DB, 1);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  A sine wave of amplitude 0.5 is converted to PDM by a second order
+  sigma-delta modulator at 64 times the PCM rate, and back to PCM by a 5th
+  order CIC decimator by 32 and the compensation filter above decimating by 2.
+  The amplitude of a sine fitted to the PCM output must be within 0.1 dB and
+  the residual must be 60 dB below the sine.  For comparison the cycles of a
+  single arm_fir_decimate_q31() stage on the unpacked PDM samples are dumped,
+  with a filter of 8 taps per output sample.
+*/
+#define CIC_PDM_BYTES      2048
+#define CIC_PDM_BLOCK      64
+#define CIC_PDM_AMPLITUDE  0.5f
+#define CIC_PDM_FREQ       0.0371f      /* Normalized to the PCM rate */
+#define CIC_PDM_SKIP       64
+#define CIC_PDM_SNR        60.0f
+#define CIC_PDM_FIR_TAPS   (8 * CIC_COMP_R * CIC_COMP_M)
+
+#define CIC_PDM_PCM_LENGTH (8 * CIC_PDM_BYTES / (CIC_COMP_R * CIC_COMP_M))
+#define CIC_PDM_CIC_BLOCK  (8 * CIC_PDM_BLOCK / CIC_COMP_R)
+
+static uint8_t cic_pdm[CIC_PDM_BYTES];
+static q31_t cic_pdm_coeffs[CIC_PDM_FIR_TAPS];
+static q31_t cic_pdm_state[CIC_PDM_FIR_TAPS + 8 * CIC_PDM_BLOCK];
+static q31_t cic_pdm_scratch[8 * CIC_PDM_BLOCK];
+
+JTEST_DEFINE_TEST(arm_pdm_to_pcm_q31_test,
+                  arm_pdm_to_pcm_q31)
+{
+    arm_pdm_to_pcm_instance_q31 pdm_inst;
+    arm_fir_decimate_instance_q31 fir_inst;
+    float32_t x, y, i1 = 0.0f, i2 = 0.0f;
+    float32_t s, c, ss = 0.0f, cc = 0.0f, sc = 0.0f, ys = 0.0f, yc = 0.0f;
+    float32_t a, b, det, e, res = 0.0f, amp, snr;
+    uint32_t n, k, bit, pdmCycles = 0, firCycles = 0, cycles;
+    uint8_t byte;
+
+    /* Second order sigma-delta modulator */
+    for (n = 0, k = 0; n < CIC_PDM_BYTES; n++)
+    {
+        byte = 0;
+        for (bit = 0; bit < 8; bit++, k++)
+        {
+            x = CIC_PDM_AMPLITUDE *
+                sinf(2.0f * PI * CIC_PDM_FREQ * k / (CIC_COMP_R * CIC_COMP_M));
+            y = (i2 >= 0.0f) ? 1.0f : -1.0f;
+            i1 += x - y;
+            i2 += i1 - y;
+            byte = (uint8_t) ((byte << 1) | (y > 0.0f));
+        }
+
+        cic_pdm[n] = byte;
+    }
+
+    TEST_ASSERT_EQUAL(arm_cic_compensation_f32(CIC_COMP_ORDER, CIC_COMP_R,
+                                               CIC_COMP_PASS, CIC_COMP_STOP,
+                                               cic_comp_coeffs,
+                                               CIC_COMP_NUMTAPS),
+                      ARM_MATH_SUCCESS);
+    arm_float_to_q31(cic_comp_coeffs, cic_pdm_coeffs, CIC_COMP_NUMTAPS);
+
+    TEST_ASSERT_EQUAL(arm_pdm_to_pcm_init_q31(&pdm_inst, CIC_COMP_ORDER,
+                                              CIC_COMP_R, CIC_COMP_NUMTAPS,
+                                              CIC_COMP_M, cic_pdm_coeffs,
+                                              cic_state, cic_pdm_state,
+                                              cic_pdm_scratch, CIC_PDM_BLOCK),
+                      ARM_MATH_SUCCESS);
+
+    for (n = 0; n < CIC_PDM_BYTES; n += CIC_PDM_BLOCK)
+    {
+        JTEST_MEASURE_CYCLES(cycles,
+                             arm_pdm_to_pcm_q31(&pdm_inst, cic_pdm + n,
+                                                cic_output + n / CIC_PDM_BLOCK *
+                                                (CIC_PDM_CIC_BLOCK / CIC_COMP_M),
+                                                CIC_PDM_BLOCK));
+        pdmCycles += cycles;
+    }
+
+    /* Least squares fit of a sine at the test frequency */
+    for (n = CIC_PDM_SKIP; n < CIC_PDM_PCM_LENGTH; n++)
+    {
+        y = (float32_t) cic_output[n] / 2147483648.0f;
+        s = sinf(2.0f * PI * CIC_PDM_FREQ * n);
+        c = cosf(2.0f * PI * CIC_PDM_FREQ * n);
+        ss += s * s;
+        cc += c * c;
+        sc += s * c;
+        ys += y * s;
+        yc += y * c;
+    }
+
+    det = ss * cc - sc * sc;
+    a = (ys * cc - yc * sc) / det;
+    b = (yc * ss - ys * sc) / det;
+
+    for (n = CIC_PDM_SKIP; n < CIC_PDM_PCM_LENGTH; n++)
+    {
+        y = (float32_t) cic_output[n] / 2147483648.0f;
+        e = y - a * sinf(2.0f * PI * CIC_PDM_FREQ * n) -
+            b * cosf(2.0f * PI * CIC_PDM_FREQ * n);
+        res += e * e;
+    }
+
+    amp = sqrtf(a * a + b * b);
+    snr = 10.0f * log10f(0.5f * amp * amp * (CIC_PDM_PCM_LENGTH - CIC_PDM_SKIP) /
+                         (res + 1.0e-30f));
+
+    /* Single FIR decimation stage on the unpacked PDM samples */
+    arm_fir_decimate_init_q31(&fir_inst, CIC_PDM_FIR_TAPS, CIC_COMP_R * CIC_COMP_M,
+                              cic_pdm_coeffs, cic_pdm_state, 8 * CIC_PDM_BLOCK);
+
+    for (n = 0; n < CIC_PDM_BYTES; n += CIC_PDM_BLOCK)
+    {
+        for (k = 0; k < 8 * CIC_PDM_BLOCK; k++)
+        {
+            cic_pdm_scratch[k] = (cic_pdm[n + k / 8] & (0x80 >> (k % 8))) ?
+                0x7FFFFFFF : (q31_t) 0x80000001;
+        }
+
+        JTEST_MEASURE_CYCLES(cycles,
+                             arm_fir_decimate_q31(&fir_inst, cic_pdm_scratch,
+                                                  cic_output_ref,
+                                                  8 * CIC_PDM_BLOCK));
+        firCycles += cycles;
+    }
+
+    JTEST_DUMP_STRF("Amplitude: %d/10000\n"
+                    "SNR: %d dB\n",
+                    (int)(amp * 10000.0f),
+                    (int)snr);
+    JTEST_DUMP_STRF("arm_pdm_to_pcm_q31 Cycles: %d\n"
+                    "arm_fir_decimate_q31 Cycles: %d\n",
+                    (int)pdmCycles,
+                    (int)firCycles);
+
+    TEST_ASSERT_EQUAL(fabsf(20.0f * log10f(amp / CIC_PDM_AMPLITUDE)) < 0.1f, 1);
+    TEST_ASSERT_EQUAL(snr > CIC_PDM_SNR, 1);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cic_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_cic_init_q31_test);
+    JTEST_TEST_CALL(arm_cic_decimate_q31_test);
+    JTEST_TEST_CALL(arm_cic_interpolate_q31_test);
+    JTEST_TEST_CALL(arm_cic_compensation_f32_test);
+    JTEST_TEST_CALL(arm_pdm_to_pcm_q31_test);
+}
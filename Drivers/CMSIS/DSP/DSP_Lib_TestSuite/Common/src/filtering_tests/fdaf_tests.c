@@ -0,0 +1,354 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Partitioned Frequency-Domain Adaptive Filter */
+/*--------------------------------------------------------------------------------*/
+
+#define FDAF_MAX_NUMTAPS  1024
+#define FDAF_MAX_BLOCKLEN 128
+#define FDAF_MAX_LENGTH   (8192 + FDAF_MAX_BLOCKLEN)
+
+/* Filter length and block length of the identification test */
+static const uint16_t fdaf_configs[][2] =
+{
+    {  32, 16 },
+    {  64, 16 },
+    { 256, 64 },
+    { 512, 128 }
+};
+
+#define FDAF_NUM_CONFIGS (sizeof(fdaf_configs) / sizeof(fdaf_configs[0]))
+
+#define FDAF_PATH_SNR_THRESHOLD   60
+#define FDAF_OUTPUT_SNR_THRESHOLD 99
+
+static float32_t fdaf_input[FDAF_MAX_LENGTH];
+static float32_t fdaf_ref[FDAF_MAX_LENGTH];
+static float32_t fdaf_err[FDAF_MAX_LENGTH];
+static float32_t fdaf_out[FDAF_MAX_BLOCKLEN];
+static float32_t fdaf_path[FDAF_MAX_NUMTAPS];
+static float32_t fdaf_taps[FDAF_MAX_NUMTAPS];
+static float32_t fdaf_coeffs[2 * FDAF_MAX_NUMTAPS];
+static float32_t fdaf_state[2 * FDAF_MAX_NUMTAPS + 7 * FDAF_MAX_BLOCKLEN + 1];
+static float32_t fdaf_frame[2 * FDAF_MAX_BLOCKLEN];
+static float32_t lms_coeffs[FDAF_MAX_NUMTAPS];
+static float32_t lms_state[FDAF_MAX_NUMTAPS + FDAF_MAX_BLOCKLEN];
+
+/* Uniform noise in [-1 1), the same sequence on every target */
+static float32_t fdaf_rand(uint32_t * pSeed)
+{
+    *pSeed = *pSeed * 1664525U + 1013904223U;
+
+    return (float32_t) (int32_t) *pSeed / 2147483648.0f;
+}
+
+/*
+  Unknown system: a random impulse response that decays by 60 dB over its
+  length, as an echo path.  The input is white noise, or a first order
+  autoregressive process when pole is not 0, and the reference input is the
+  output of the unknown system.
+*/
+static void fdaf_make_signals(
+    uint16_t numTaps,
+    uint32_t length,
+    float32_t pole)
+{
+    uint32_t seed = 1U;
+    uint32_t n, k;
+    float32_t sum;
+
+    for (k = 0; k < numTaps; k++)
+    {
+        fdaf_path[k] = fdaf_rand(&seed) * expf(-6.9f * (float32_t) k / numTaps);
+    }
+
+    for (n = 0; n < length; n++)
+    {
+        fdaf_input[n] = fdaf_rand(&seed) * (1.0f - pole) +
+            ((n > 0) ? pole * fdaf_input[n - 1] : 0.0f);
+    }
+
+    for (n = 0; n < length; n++)
+    {
+        sum = 0.0f;
+        for (k = 0; k < numTaps && k <= n; k++)
+        {
+            sum += fdaf_path[k] * fdaf_input[n - k];
+        }
+
+        fdaf_ref[n] = sum;
+    }
+}
+
+/* Echo return loss enhancement in dB over the last count samples */
+static float32_t fdaf_erle(uint32_t length, uint32_t count)
+{
+    float32_t pRef, pErr;
+
+    arm_power_f32(fdaf_ref + length - count, count, &pRef);
+    arm_power_f32(fdaf_err + length - count, count, &pErr);
+
+    return 10.0f * log10f(pRef / (pErr + 1.0e-30f));
+}
+
+/* Time-domain taps of the adaptive filter, from the spectra of the partitions */
+static void fdaf_get_taps(
+    arm_fdaf_instance_f32 * S,
+    float32_t * pTaps)
+{
+    uint32_t p;
+    uint32_t frameLen = 2U * S->blockLen;
+
+    for (p = 0; p < S->numPartitions; p++)
+    {
+        arm_copy_f32(S->pCoeffs + p * frameLen, fdaf_frame, frameLen);
+        arm_rfft_fast_inplace_f32(&S->rfft, fdaf_frame, 1U);
+        arm_copy_f32(fdaf_frame, pTaps + p * S->blockLen, S->blockLen);
+    }
+}
+
+JTEST_DEFINE_TEST(arm_fdaf_init_f32_test,
+                  arm_fdaf_init_f32)
+{
+    arm_fdaf_instance_f32 fdaf_inst = { 0 };
+
+    /* numTaps must be a nonzero multiple of blockLen */
+    TEST_ASSERT_EQUAL(arm_fdaf_init_f32(&fdaf_inst, 48, 32, fdaf_coeffs,
+                                        fdaf_state, 0.5f, 0.9f),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_fdaf_init_f32(&fdaf_inst, 0, 32, fdaf_coeffs,
+                                        fdaf_state, 0.5f, 0.9f),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    /* 2*blockLen must be a real FFT length */
+    TEST_ASSERT_EQUAL(arm_fdaf_init_f32(&fdaf_inst, 48, 24, fdaf_coeffs,
+                                        fdaf_state, 0.5f, 0.9f),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_fdaf_init_f32(&fdaf_inst, 0, 0, fdaf_coeffs,
+                                        fdaf_state, 0.5f, 0.9f),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    TEST_ASSERT_EQUAL(arm_fdaf_init_f32(&fdaf_inst, 96, 32, fdaf_coeffs,
+                                        fdaf_state, 0.5f, 0.9f),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(fdaf_inst.numPartitions, 3);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The filter identifies the unknown system from white noise.  The taps of the
+  adapted filter must match the system, then the adaptation is stopped and the
+  output of one more block must match the direct convolution with these taps,
+  which checks the overlap-save and the order of the partitions.
+*/
+JTEST_DEFINE_TEST(arm_fdaf_f32_test,
+                  arm_fdaf_f32)
+{
+    arm_fdaf_instance_f32 fdaf_inst = { 0 };
+    uint16_t numTaps, blockLen;
+    uint32_t c, n, k, length;
+    float32_t sum;
+
+    for (c = 0; c < FDAF_NUM_CONFIGS; c++)
+    {
+        numTaps = fdaf_configs[c][0];
+        blockLen = fdaf_configs[c][1];
+        length = 16U * numTaps;
+
+        JTEST_DUMP_STRF("Number of Taps: %d\n"
+                        "Block Length: %d\n",
+                        (int)numTaps,
+                        (int)blockLen);
+
+        fdaf_make_signals(numTaps, length + blockLen, 0.0f);
+
+        TEST_ASSERT_EQUAL(
+            arm_fdaf_init_f32(&fdaf_inst, numTaps, blockLen, fdaf_coeffs,
+                              fdaf_state, 1.0f,
+                              1.0f - blockLen / (4.0f * numTaps)),
+            ARM_MATH_SUCCESS);
+
+        JTEST_COUNT_CYCLES(
+            arm_fdaf_f32(&fdaf_inst, fdaf_input, fdaf_ref,
+                         fdaf_out, fdaf_err, blockLen));
+
+        for (n = blockLen; n < length; n += blockLen)
+        {
+            arm_fdaf_f32(&fdaf_inst, fdaf_input + n, fdaf_ref + n,
+                         fdaf_out, fdaf_err + n, blockLen);
+        }
+
+        fdaf_get_taps(&fdaf_inst, fdaf_taps);
+
+        TEST_ASSERT_SNR(fdaf_path, fdaf_taps, numTaps,
+                        FDAF_PATH_SNR_THRESHOLD);
+
+        /* Filter one more block with the adapted taps */
+        fdaf_inst.mu = 0.0f;
+
+        arm_fdaf_f32(&fdaf_inst, fdaf_input + length, fdaf_ref + length,
+                     fdaf_out, fdaf_err, blockLen);
+
+        for (n = 0; n < blockLen; n++)
+        {
+            sum = 0.0f;
+            for (k = 0; k < numTaps; k++)
+            {
+                sum += fdaf_taps[k] * fdaf_input[length + n - k];
+            }
+
+            filtering_output_f32_ref[n] = sum;
+        }
+
+        TEST_ASSERT_SNR(filtering_output_f32_ref, fdaf_out, blockLen,
+                        FDAF_OUTPUT_SNR_THRESHOLD);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Convergence and cycles of the FDAF, arm_lms_norm_f32() and
+  arm_lms_norm_block_f32() with the step size of arm_signal_converge_example,
+  first on the 32 taps and blocks of 32 samples of the example, then on a 1024
+  taps echo path with blocks of 128 samples.  The ERLE over the last filter
+  length is dumped with the cycles of the whole run.  On white noise the FDAF
+  and the block filter must converge about as fast as the normalized LMS
+  filter, on colored noise the FDAF must converge faster because its step size
+  is normalized in each bin.
+*/
+#define FDAF_CONVERGE_MU 0.5f
+
+/* Filter length, block length, number of blocks and pole of the input */
+static const float32_t fdaf_converge_configs[][4] =
+{
+    {   32.0f,  32.0f, 48.0f, 0.0f },
+    { 1024.0f, 128.0f, 64.0f, 0.0f },
+    { 1024.0f, 128.0f, 64.0f, 0.9f }
+};
+
+#define FDAF_NUM_CONVERGE_CONFIGS \
+    (sizeof(fdaf_converge_configs) / sizeof(fdaf_converge_configs[0]))
+
+JTEST_DEFINE_TEST(arm_fdaf_f32_converge_test,
+                  arm_fdaf_f32)
+{
+    arm_fdaf_instance_f32 fdaf_inst = { 0 };
+    arm_lms_norm_instance_f32 lms_inst = { 0 };
+    uint16_t numTaps, blockLen, fdafBlockLen;
+    uint32_t c, n, length;
+    uint32_t fdafCycles, lmsCycles, blockLmsCycles, cycles;
+    float32_t pole, fdafErle, lmsErle, blockErle;
+
+    for (c = 0; c < FDAF_NUM_CONVERGE_CONFIGS; c++)
+    {
+        numTaps = (uint16_t) fdaf_converge_configs[c][0];
+        blockLen = (uint16_t) fdaf_converge_configs[c][1];
+        length = (uint32_t) fdaf_converge_configs[c][2] * blockLen;
+        pole = fdaf_converge_configs[c][3];
+
+        /* The FDAF needs at least 2 partitions for the example filter */
+        fdafBlockLen = (blockLen < numTaps) ? blockLen : numTaps / 2U;
+
+        fdaf_make_signals(numTaps, length, pole);
+
+        /* Partitioned frequency-domain adaptive filter */
+        arm_fdaf_init_f32(&fdaf_inst, numTaps, fdafBlockLen, fdaf_coeffs,
+                          fdaf_state, FDAF_CONVERGE_MU,
+                          1.0f - fdafBlockLen / (4.0f * numTaps));
+
+        fdafCycles = 0;
+        for (n = 0; n < length; n += blockLen)
+        {
+            JTEST_MEASURE_CYCLES(cycles,
+                                 arm_fdaf_f32(&fdaf_inst, fdaf_input + n,
+                                              fdaf_ref + n, fdaf_out,
+                                              fdaf_err + n, blockLen));
+            fdafCycles += cycles;
+        }
+
+        fdafErle = fdaf_erle(length, numTaps);
+
+        /* Normalized LMS filter */
+        arm_fill_f32(0.0f, lms_coeffs, numTaps);
+        arm_lms_norm_init_f32(&lms_inst, numTaps, lms_coeffs, lms_state,
+                              FDAF_CONVERGE_MU, blockLen);
+
+        lmsCycles = 0;
+        for (n = 0; n < length; n += blockLen)
+        {
+            JTEST_MEASURE_CYCLES(cycles,
+                                 arm_lms_norm_f32(&lms_inst, fdaf_input + n,
+                                                  fdaf_ref + n, fdaf_out,
+                                                  fdaf_err + n, blockLen));
+            lmsCycles += cycles;
+        }
+
+        lmsErle = fdaf_erle(length, numTaps);
+
+        /* Block normalized LMS filter, updated every 4 samples */
+        arm_fill_f32(0.0f, lms_coeffs, numTaps);
+        arm_lms_norm_init_f32(&lms_inst, numTaps, lms_coeffs, lms_state,
+                              FDAF_CONVERGE_MU, 4U);
+
+        blockLmsCycles = 0;
+        for (n = 0; n < length; n += 4U)
+        {
+            JTEST_MEASURE_CYCLES(cycles,
+                                 arm_lms_norm_block_f32(&lms_inst, fdaf_input + n,
+                                                        fdaf_ref + n, fdaf_out,
+                                                        fdaf_err + n, 4U));
+            blockLmsCycles += cycles;
+        }
+
+        blockErle = fdaf_erle(length, numTaps);
+
+        JTEST_DUMP_STRF("Number of Taps: %d\n"
+                        "Block Size: %d\n"
+                        "Input Pole: %d/10\n",
+                        (int)numTaps,
+                        (int)blockLen,
+                        (int)(pole * 10.0f));
+        JTEST_DUMP_STRF("arm_fdaf_f32 ERLE: %d dB Cycles: %d\n"
+                        "arm_lms_norm_f32 ERLE: %d dB Cycles: %d\n",
+                        (int)fdafErle, (int)fdafCycles,
+                        (int)lmsErle, (int)lmsCycles);
+        JTEST_DUMP_STRF("arm_lms_norm_block_f32 ERLE: %d dB Cycles: %d\n",
+                        (int)blockErle, (int)blockLmsCycles);
+
+        if (pole == 0.0f)
+        {
+            TEST_ASSERT_EQUAL(fdafErle > lmsErle - 10.0f, 1);
+            TEST_ASSERT_EQUAL(blockErle > lmsErle - 10.0f, 1);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(fdafErle > lmsErle + 10.0f, 1);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fdaf_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fdaf_init_f32_test);
+    JTEST_TEST_CALL(arm_fdaf_f32_test);
+    JTEST_TEST_CALL(arm_fdaf_f32_converge_test);
+}
@@ -7,11 +7,16 @@ JTEST_DEFINE_GROUP(filtering_tests)
       To skip a test, comment it out.
     */
     JTEST_GROUP_CALL(biquad_tests);
+    JTEST_GROUP_CALL(cic_tests);
     JTEST_GROUP_CALL(conv_tests);
     JTEST_GROUP_CALL(correlate_tests);
+    JTEST_GROUP_CALL(fdaf_tests);
     JTEST_GROUP_CALL(fir_tests);
     JTEST_GROUP_CALL(iir_tests);
     JTEST_GROUP_CALL(lms_tests);
+    JTEST_GROUP_CALL(median_tests);
+    JTEST_GROUP_CALL(resample_tests);
+    JTEST_GROUP_CALL(xcorr_tests);
 
     return;
 }
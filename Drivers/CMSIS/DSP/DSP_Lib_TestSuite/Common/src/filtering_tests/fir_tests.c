@@ -339,6 +339,296 @@
             return JTEST_TEST_PASSED;                                   \
    }
 
+/**
+ *  The circular state filters are fed 3*blockSize samples in calls of
+ *  blockSize, 1 and 2*blockSize-1 samples, so that the write position takes
+ *  many values and the last call is split into several passes.  The reference
+ *  filters the whole stream in one call.  Both state arrays live in
+ *  filtering_pState, the circular one at FIR_CIRC_STATE_OFFSET.
+ */
+#define FIR_CIRC_STATE_OFFSET 200
+#define FIR_CIRC_NUM_CHUNKS   3
+
+#define FIR_CIRC_DEFINE_TEST(suffix, output_type)                       \
+   JTEST_DEFINE_TEST(arm_fir_circ_##suffix##_test,                      \
+         arm_fir_circ_##suffix)                                         \
+   {                                                                    \
+      arm_fir_circ_instance_##suffix fir_inst_fut = { 0 };              \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                   \
+      uint32_t chunks[FIR_CIRC_NUM_CHUNKS];                             \
+      uint32_t done, c;                                                 \
+                                                                        \
+      TEMPLATE_DO_ARR_DESC(                                             \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes    \
+            ,                                                           \
+         TEMPLATE_DO_ARR_DESC(                                          \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps        \
+               ,                                                        \
+               chunks[0] = blockSize;                                   \
+               chunks[1] = 1;                                           \
+               chunks[2] = 2 * blockSize - 1;                           \
+                                                                        \
+               /* Display test parameter values */                      \
+               JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                               "Number of Taps: %d\n",                  \
+                               (int)blockSize,                          \
+                               (int)numTaps);                           \
+                                                                        \
+               /* Initialize the FIR Instances */                       \
+               arm_fir_circ_init_##suffix(                              \
+                     &fir_inst_fut, numTaps,                            \
+                     (output_type*)filtering_coeffs_##suffix,           \
+                     (output_type*)filtering_pState                     \
+                     + FIR_CIRC_STATE_OFFSET, blockSize);               \
+                                                                        \
+               for (c = 0, done = 0; c < FIR_CIRC_NUM_CHUNKS; c++)      \
+               {                                                        \
+                  JTEST_COUNT_CYCLES(                                   \
+                        arm_fir_circ_##suffix(                          \
+                              &fir_inst_fut,                            \
+                              (output_type *) filtering_##suffix##_inputs \
+                              + done,                                   \
+                              (output_type *) filtering_output_fut      \
+                              + done,                                   \
+                              chunks[c]));                              \
+                                                                        \
+                  done += chunks[c];                                    \
+               }                                                        \
+                                                                        \
+               arm_fir_init_##suffix(                                   \
+                     &fir_inst_ref, numTaps,                            \
+                     (output_type*)filtering_coeffs_##suffix,           \
+                     (void *) filtering_pState, done);                  \
+                                                                        \
+               ref_fir_##suffix(                                        \
+                     &fir_inst_ref,                                     \
+                     (void *) filtering_##suffix##_inputs,              \
+                     (void *) filtering_output_ref,                     \
+                     done);                                             \
+                                                                        \
+               FILTERING_SNR_COMPARE_INTERFACE(                         \
+                     done,                                              \
+                     output_type)));                                    \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+   }
+
+JTEST_DEFINE_TEST(arm_fir_decimate_circ_f32_test,
+                  arm_fir_decimate_circ_f32)
+{
+   arm_fir_decimate_circ_instance_f32 fir_inst_fut = { 0 };
+   arm_fir_decimate_instance_f32 fir_inst_ref = { 0 };
+
+   TEMPLATE_DO_ARR_DESC(
+         blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+         ,
+      TEMPLATE_DO_ARR_DESC(
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps
+            ,
+         TEMPLATE_DO_ARR_DESC(
+               M_idx, uint8_t, M, filtering_Ms
+               ,
+               if (blockSize % M == 0)
+               {
+                  /* Display test parameter values */
+                  JTEST_DUMP_STRF("Block Size: %d\n"
+                                  "Number of Taps: %d\n"
+                                  "Decimation Factor: %d\n",
+                                  (int)blockSize,
+                                  (int)numTaps,
+                                  (int)M);
+
+                  /* Initialize the FIR Instances */
+                  TEST_ASSERT_EQUAL(
+                        arm_fir_decimate_circ_init_f32(
+                              &fir_inst_fut, numTaps, M,
+                              (float32_t *)filtering_coeffs_f32,
+                              filtering_pState + FIR_CIRC_STATE_OFFSET,
+                              blockSize),
+                        ARM_MATH_SUCCESS);
+
+                  /* One block, then two blocks processed in two passes */
+                  JTEST_COUNT_CYCLES(
+                        arm_fir_decimate_circ_f32(
+                              &fir_inst_fut,
+                              (float32_t *) filtering_f32_inputs,
+                              filtering_output_fut,
+                              blockSize));
+
+                  arm_fir_decimate_circ_f32(
+                        &fir_inst_fut,
+                        (float32_t *) filtering_f32_inputs + blockSize,
+                        filtering_output_fut + blockSize / M,
+                        2 * blockSize);
+
+                  arm_fir_decimate_init_f32(
+                        &fir_inst_ref, numTaps, M,
+                        (float32_t *)filtering_coeffs_f32,
+                        filtering_pState, 3 * blockSize);
+
+                  ref_fir_decimate_f32(
+                        &fir_inst_ref,
+                        (float32_t *) filtering_f32_inputs,
+                        filtering_output_ref,
+                        3 * blockSize);
+
+                  FILTERING_SNR_COMPARE_INTERFACE(
+                        3 * blockSize / M,
+                        float32_t);
+               })));
+
+   /* The block size must be a multiple of the decimation factor */
+   TEST_ASSERT_EQUAL(
+         arm_fir_decimate_circ_init_f32(
+               &fir_inst_fut, 4, 2,
+               (float32_t *)filtering_coeffs_f32,
+               filtering_pState, 7),
+         ARM_MATH_LENGTH_ERROR);
+
+   return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Small blocks through a long filter: the cycles of one call to the FIR
+ *  filter, which moves numTaps-1 state samples, are dumped next to the cycles
+ *  of the filter with circular state.  The outputs of a few calls must match.
+ */
+#define FIR_CIRC_BENCH_NUMTAPS 64
+#define FIR_CIRC_BENCH_CALLS   4
+
+static const uint32_t fir_circ_bench_blocksizes[] =
+{
+   1, 4, 8, 16, 32
+};
+
+#define FIR_CIRC_BENCH_NUM_BLOCKSIZES \
+   (sizeof(fir_circ_bench_blocksizes) / sizeof(uint32_t))
+
+JTEST_DEFINE_TEST(arm_fir_circ_f32_benchmark_test,
+                  arm_fir_circ_f32)
+{
+   arm_fir_instance_f32 fir_inst = { 0 };
+   arm_fir_circ_instance_f32 fir_circ_inst = { 0 };
+   uint32_t b, c, blockSize, firCycles = 0, circCycles = 0;
+
+   for (b = 0; b < FIR_CIRC_BENCH_NUM_BLOCKSIZES; b++)
+   {
+      blockSize = fir_circ_bench_blocksizes[b];
+
+      arm_fir_init_f32(&fir_inst, FIR_CIRC_BENCH_NUMTAPS,
+                       (float32_t *)filtering_coeffs_f32,
+                       filtering_pState, blockSize);
+
+      arm_fir_circ_init_f32(&fir_circ_inst, FIR_CIRC_BENCH_NUMTAPS,
+                            (float32_t *)filtering_coeffs_f32,
+                            filtering_pState + FIR_CIRC_STATE_OFFSET,
+                            blockSize);
+
+      for (c = 0; c < FIR_CIRC_BENCH_CALLS; c++)
+      {
+         JTEST_MEASURE_CYCLES(firCycles,
+                              arm_fir_f32(&fir_inst,
+                                          (float32_t *) filtering_f32_inputs + c * blockSize,
+                                          filtering_output_ref + c * blockSize,
+                                          blockSize));
+
+         JTEST_MEASURE_CYCLES(circCycles,
+                              arm_fir_circ_f32(&fir_circ_inst,
+                                               (float32_t *) filtering_f32_inputs + c * blockSize,
+                                               filtering_output_fut + c * blockSize,
+                                               blockSize));
+      }
+
+      JTEST_DUMP_STRF("Block Size: %d\n"
+                      "Number of Taps: %d\n"
+                      "arm_fir_f32 Cycles: %d\n"
+                      "arm_fir_circ_f32 Cycles: %d\n",
+                      (int)blockSize,
+                      (int)FIR_CIRC_BENCH_NUMTAPS,
+                      (int)firCycles,
+                      (int)circCycles);
+
+      FILTERING_SNR_COMPARE_INTERFACE(
+            FIR_CIRC_BENCH_CALLS * blockSize,
+            float32_t);
+   }
+
+   return JTEST_TEST_PASSED;
+}
+
+/*
+  Half-precision FIR test.  The coefficients and the inputs, scaled to [-1 1), are
+  rounded to half precision and the reference is the floating-point FIR of the
+  rounded values.  Each block is filtered in two calls to check the state kept
+  between them.
+*/
+#define FIR_F16_SNR_THRESHOLD 60
+#define FIR_F16_MAX_SAMPLES   (2 * FILTERING_MAX_BLOCKSIZE)
+
+static float16_t fir_f16_coeffs[FILTERING_MAX_NUMTAPS];
+static float16_t fir_f16_inputs[FIR_F16_MAX_SAMPLES];
+static float16_t fir_f16_outputs[FIR_F16_MAX_SAMPLES];
+static float16_t fir_f16_state[FIR_F16_MAX_SAMPLES + FILTERING_MAX_NUMTAPS];
+static float32_t fir_f16_coeffs_ref[FILTERING_MAX_NUMTAPS];
+static float32_t fir_f16_state_ref[FIR_F16_MAX_SAMPLES + FILTERING_MAX_NUMTAPS];
+
+JTEST_DEFINE_TEST(arm_fir_f16_test,
+                  arm_fir_f16)
+{
+   arm_fir_instance_f16 fir_inst_fut = { 0 };
+   arm_fir_instance_f32 fir_inst_ref = { 0 };
+   uint32_t i;
+
+   for (i = 0; i < FIR_F16_MAX_SAMPLES; i++)
+   {
+      filtering_output_f32_fut[i] = filtering_f32_inputs[i] / 256.0f;
+   }
+
+   arm_float_to_f16(filtering_output_f32_fut, fir_f16_inputs, FIR_F16_MAX_SAMPLES);
+   arm_f16_to_float(fir_f16_inputs, filtering_input_lms, FIR_F16_MAX_SAMPLES);
+
+   arm_float_to_f16((float32_t *) filtering_coeffs_f32, fir_f16_coeffs, FILTERING_MAX_NUMTAPS);
+   arm_f16_to_float(fir_f16_coeffs, fir_f16_coeffs_ref, FILTERING_MAX_NUMTAPS);
+
+   TEMPLATE_DO_ARR_DESC(
+         blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+         ,
+      TEMPLATE_DO_ARR_DESC(
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps
+            ,
+            /* Display test parameter values */
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Number of Taps: %d\n",
+                            (int)blockSize,
+                            (int)numTaps);
+
+            arm_fir_init_f16(&fir_inst_fut, numTaps, fir_f16_coeffs,
+                             fir_f16_state, blockSize);
+
+            JTEST_COUNT_CYCLES(
+                  arm_fir_f16(&fir_inst_fut, fir_f16_inputs,
+                              fir_f16_outputs, blockSize));
+
+            arm_fir_f16(&fir_inst_fut, fir_f16_inputs + blockSize,
+                        fir_f16_outputs + blockSize, blockSize);
+
+            arm_fir_init_f32(&fir_inst_ref, numTaps, fir_f16_coeffs_ref,
+                             fir_f16_state_ref, 2 * blockSize);
+
+            ref_fir_f32(&fir_inst_ref, filtering_input_lms,
+                        filtering_output_f32_ref, 2 * blockSize);
+
+            arm_f16_to_float(fir_f16_outputs, filtering_output_f32_fut,
+                             2 * blockSize);
+
+            TEST_ASSERT_SNR(filtering_output_f32_ref,
+                            filtering_output_f32_fut,
+                            2 * blockSize,
+                            FIR_F16_SNR_THRESHOLD)));
+
+   return JTEST_TEST_PASSED;
+}
+
 FIR_DEFINE_TEST(f32,,float32_t);
 FIR_DEFINE_TEST(q31,,q31_t);
 FIR_DEFINE_TEST(q15,,q15_t);
@@ -365,6 +655,11 @@ FIR_SPARSE_DEFINE_TEST(q31,q31_t);
 FIR_SPARSE2_DEFINE_TEST(q15,q15_t);
 FIR_SPARSE2_DEFINE_TEST(q7,q7_t);
 
+FIR_CIRC_DEFINE_TEST(f32,float32_t);
+FIR_CIRC_DEFINE_TEST(q31,q31_t);
+FIR_CIRC_DEFINE_TEST(q15,q15_t);
+FIR_CIRC_DEFINE_TEST(q7,q7_t);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -380,6 +675,7 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_q7_test);
    JTEST_TEST_CALL(arm_fir_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_fast_q15_test);
+   JTEST_TEST_CALL(arm_fir_f16_test);
 
    JTEST_TEST_CALL(arm_fir_lattice_f32_test);
    JTEST_TEST_CALL(arm_fir_lattice_q31_test);
@@ -399,4 +695,11 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_sparse_q31_test);
    JTEST_TEST_CALL(arm_fir_sparse_q15_test);
    JTEST_TEST_CALL(arm_fir_sparse_q7_test);
+
+   JTEST_TEST_CALL(arm_fir_circ_f32_test);
+   JTEST_TEST_CALL(arm_fir_circ_q31_test);
+   JTEST_TEST_CALL(arm_fir_circ_q15_test);
+   JTEST_TEST_CALL(arm_fir_circ_q7_test);
+   JTEST_TEST_CALL(arm_fir_decimate_circ_f32_test);
+   JTEST_TEST_CALL(arm_fir_circ_f32_benchmark_test);
 }
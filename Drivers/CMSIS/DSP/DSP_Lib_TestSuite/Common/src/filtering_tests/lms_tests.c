@@ -9,6 +9,7 @@
 
 static const float32_t mu_f32 = 0.00854f;//1.0f;
 static const float32_t mu2_f32 = 1.0f;
+static const float32_t mu_block_f32 = 0.25f;
 static const q31_t mu_q31 = 0x7fffffff;
 static const q15_t mu_q15 = 0x7fff;
 
@@ -200,6 +201,158 @@ LMS_DEFINE_TEST(f32,_norm,float32_t, mu2_f32);
 LMS_WITH_POSTSHIFT_DEFINE_TEST(q31,_norm,q31_t);
 LMS_WITH_POSTSHIFT_DEFINE_TEST(q15,_norm,q15_t);
 
+/*
+  Reference of the block LMS filters.  The outputs of a block use the same
+  coefficients and the coefficients are updated at the end of the block with the
+  sum of the updates of its samples.  The normalized version divides the step by
+  the energy of the last numTaps samples, tracked as in ref_lms_norm_f32().
+*/
+static void ref_lms_block_f32(
+   float32_t * pSrc,
+   float32_t * pRef,
+   float32_t * pOut,
+   float32_t * pCoeffs,
+   uint16_t numTaps,
+   float32_t mu,
+   uint32_t blockLen,
+   uint32_t length,
+   uint32_t normalize)
+{
+   float32_t energy = 0.0f;
+   float32_t sum, w, x;
+   uint32_t start, end, n, k;
+
+   for (start = 0; start < length; start = end)
+   {
+      end = (start + blockLen < length) ? start + blockLen : length;
+
+      for (n = start; n < end; n++)
+      {
+         /* Coefficients are in time reversed order */
+         sum = 0.0f;
+         for (k = 0; k < numTaps; k++)
+         {
+            x = (n + k + 1 >= numTaps) ? pSrc[n + k + 1 - numTaps] : 0.0f;
+            sum += pCoeffs[k] * x;
+         }
+
+         pOut[n] = sum;
+         pOut[length + n] = pRef[n] - sum;
+
+         x = (n >= numTaps) ? pSrc[n - numTaps] : 0.0f;
+         energy -= x * x;
+         energy += pSrc[n] * pSrc[n];
+      }
+
+      w = normalize ? mu / (energy + 0.000000119209289f) : mu;
+
+      for (k = 0; k < numTaps; k++)
+      {
+         sum = 0.0f;
+         for (n = start; n < end; n++)
+         {
+            x = (n + k + 1 >= numTaps) ? pSrc[n + k + 1 - numTaps] : 0.0f;
+            sum += pOut[length + n] * x;
+         }
+
+         pCoeffs[k] += w * sum;
+      }
+   }
+}
+
+/* Adaptation block lengths of the block LMS tests, 1 is the sample by sample LMS */
+static const uint32_t lms_block_lens[] = { 1, 4, 13 };
+
+#define LMS_BLOCK_NUM_LENS (sizeof(lms_block_lens) / sizeof(uint32_t))
+
+/*
+  Block LMS test template.  The signal is processed in calls of blockLen
+  samples, the last call is shorter when blockLen does not divide the length.
+  The output and the error are compared with the reference.
+*/
+#define LMS_BLOCK_DEFINE_TEST(config_suffix, mu, normalize)                            \
+   JTEST_DEFINE_TEST(arm_lms##config_suffix##_block_f32_test,                          \
+         arm_lms##config_suffix##_block_f32)                                           \
+   {                                                                                   \
+      arm_lms##config_suffix##_instance_f32 lms_inst_fut = { 0 };                      \
+      arm_fir_instance_f32 fir_inst = { 0 };                                           \
+      uint32_t i, j, n, blockLen;                                                      \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            blocksize_idx, uint32_t, blockSize, lms_blocksizes                         \
+            ,                                                                          \
+         TEMPLATE_DO_ARR_DESC(                                                         \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps                       \
+               ,                                                                       \
+               for (j = 0; j < LMS_BLOCK_NUM_LENS; j++)                                \
+               {                                                                       \
+                  blockLen = lms_block_lens[j];                                        \
+                                                                                       \
+                  /* The reference input is the FIR output of the input */             \
+                  arm_fir_init_f32(                                                    \
+                        &fir_inst, numTaps,                                            \
+                        (float32_t*)filtering_coeffs_f32,                              \
+                        (void *) filtering_pState, blockSize);                         \
+                                                                                       \
+                  ref_fir_f32(                                                         \
+                        &fir_inst,                                                     \
+                        (void *) filtering_f32_inputs,                                 \
+                        (void *) filtering_input_lms,                                  \
+                        blockSize);                                                    \
+                                                                                       \
+                  for(i=0;i<blockSize;i++)                                             \
+                  {                                                                    \
+                     /* scaled down so that lms will converge */                       \
+                     filtering_input_lms[i] = filtering_input_lms[i] / 200.0f;         \
+                     filtering_output_f32_fut[i] = filtering_f32_inputs[i] / 200.0f;   \
+                  }                                                                    \
+                                                                                       \
+                  /* Display test parameter values */                                  \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                                   \
+                                  "Number of Taps: %d\n"                               \
+                                  "Adaptation Block: %d\n",                            \
+                                  (int)blockSize,                                      \
+                                  (int)numTaps,                                        \
+                                  (int)blockLen);                                      \
+                                                                                       \
+                  /* Initialize the LMS Instance */                                    \
+                  arm_fill_f32(0.0f, filtering_coeffs_lms, numTaps);                   \
+                  arm_lms##config_suffix##_init_f32(                                   \
+                        &lms_inst_fut, numTaps, filtering_coeffs_lms,                  \
+                        (void *) filtering_pState, mu, blockLen);                      \
+                                                                                       \
+                  JTEST_COUNT_CYCLES(                                                  \
+                     for (n = 0; n < blockSize; n += blockLen)                         \
+                     {                                                                 \
+                        arm_lms##config_suffix##_block_f32(                            \
+                              &lms_inst_fut,                                           \
+                              filtering_output_f32_fut + n,                            \
+                              filtering_input_lms + n,                                 \
+                              filtering_output_fut + n,                                \
+                              filtering_output_fut + blockSize + n,                    \
+                              (blockSize - n < blockLen) ? blockSize - n : blockLen);  \
+                     });                                                               \
+                                                                                       \
+                  arm_fill_f32(0.0f, filtering_coeffs_lms, numTaps);                   \
+                  ref_lms_block_f32(                                                   \
+                        filtering_output_f32_fut,                                      \
+                        filtering_input_lms,                                           \
+                        filtering_output_ref,                                          \
+                        filtering_coeffs_lms,                                          \
+                        numTaps, mu, blockLen, blockSize, normalize);                  \
+                                                                                       \
+                  /* Output followed by the error */                                   \
+                  FILTERING_SNR_COMPARE_INTERFACE(                                     \
+                        2 * blockSize,                                                 \
+                        float32_t);                                                    \
+               }));                                                                    \
+                                                                                       \
+      return JTEST_TEST_PASSED;                                                        \
+   }
+
+LMS_BLOCK_DEFINE_TEST(, mu_f32, 0);
+LMS_BLOCK_DEFINE_TEST(_norm, mu_block_f32, 1);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -216,4 +369,7 @@ JTEST_DEFINE_GROUP(lms_tests)
    JTEST_TEST_CALL(arm_lms_norm_f32_test);
    JTEST_TEST_CALL(arm_lms_norm_q31_test);
    JTEST_TEST_CALL(arm_lms_norm_q15_test);
+
+   JTEST_TEST_CALL(arm_lms_block_f32_test);
+   JTEST_TEST_CALL(arm_lms_norm_block_f32_test);
 }
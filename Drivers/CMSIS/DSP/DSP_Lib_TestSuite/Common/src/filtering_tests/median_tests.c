@@ -0,0 +1,304 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <stdlib.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Median and Running Minimum and Maximum Filters */
+/*--------------------------------------------------------------------------------*/
+
+#define MEDIAN_MAX_WINDOW 101
+#define MEDIAN_LENGTH     1024
+
+/* Windows of the median filter tests, the first ones use the selection networks */
+static const uint16_t median_windows[] = { 1, 3, 5, 7, 9, 11, 15, 31, 101 };
+
+#define MEDIAN_NUM_WINDOWS (sizeof(median_windows) / sizeof(median_windows[0]))
+
+/* Windows of the running minimum and maximum tests */
+static const uint16_t minmax_windows[] = { 1, 2, 5, 16, 101 };
+
+#define MINMAX_NUM_WINDOWS (sizeof(minmax_windows) / sizeof(minmax_windows[0]))
+
+/* Irregular block sizes, to check the state kept between calls */
+static const uint32_t median_chunk_sizes[] = { 7, 1, 30, 255, 3, 64 };
+
+#define MEDIAN_NUM_CHUNK_SIZES \
+    (sizeof(median_chunk_sizes) / sizeof(median_chunk_sizes[0]))
+
+static float32_t median_input_f32[MEDIAN_LENGTH];
+static float32_t median_window_f32[MEDIAN_MAX_WINDOW];
+static int32_t median_index[2 * MEDIAN_MAX_WINDOW];
+static uint16_t median_queue[2 * MEDIAN_MAX_WINDOW];
+static float32_t median_fut_f32[2 * MEDIAN_LENGTH];
+static float32_t median_ref_f32[2 * MEDIAN_LENGTH];
+
+/*
+  Test input scaled to [-1 1).  The second input is quantized to 7 levels,
+  so that the windows hold many equal samples.
+*/
+static void median_make_input(uint32_t quantize)
+{
+    uint32_t i;
+
+    for (i = 0; i < MEDIAN_LENGTH; i++)
+    {
+        median_input_f32[i] = filtering_f32_inputs[i] / 256.0f;
+
+        if (quantize)
+        {
+            median_input_f32[i] =
+                (float32_t) (int32_t) (median_input_f32[i] * 4.0f) / 4.0f;
+        }
+    }
+}
+
+/* Sort comparison of qsort() for each data type */
+#define MEDIAN_DEFINE_COMPARE(type)                                                     \
+    static int median_compare_##type(const void * a, const void * b)                    \
+    {                                                                                   \
+        type x = *(const type *) a;                                                     \
+        type y = *(const type *) b;                                                     \
+                                                                                        \
+        return (x > y) - (x < y);                                                       \
+    }
+
+MEDIAN_DEFINE_COMPARE(float32_t)
+MEDIAN_DEFINE_COMPARE(q31_t)
+MEDIAN_DEFINE_COMPARE(q15_t)
+
+/*
+  The median filter output must be equal to the median of a sorted copy of
+  each window, with zeros before the first sample, for any block size.
+*/
+#define MEDIAN_DEFINE_TEST(suffix, type, from_f32)                                      \
+    JTEST_DEFINE_TEST(arm_median_filter_##suffix##_test,                                \
+                      arm_median_filter_##suffix)                                       \
+    {                                                                                   \
+        arm_median_filter_instance_##suffix median_inst;                                \
+        type * pInput = (type *) median_fut_f32;                                        \
+        type * pFut = pInput + MEDIAN_LENGTH;                                           \
+        type * pRef = (type *) median_ref_f32;                                          \
+        type * pWin = (type *) median_ref_f32 + MEDIAN_LENGTH;                          \
+        type state[MEDIAN_MAX_WINDOW];                                                  \
+        uint32_t quantize, w, n, k, chunk, mismatches;                                  \
+        uint32_t refCycles;                                                             \
+        uint16_t windowLen;                                                             \
+                                                                                        \
+        for (quantize = 0; quantize < 2; quantize++)                                    \
+        {                                                                               \
+            median_make_input(quantize);                                                \
+            from_f32(median_input_f32, pInput, MEDIAN_LENGTH);                          \
+                                                                                        \
+            for (w = 0; w < MEDIAN_NUM_WINDOWS; w++)                                    \
+            {                                                                           \
+                windowLen = median_windows[w];                                          \
+                                                                                        \
+                /* Reference: qsort() of each window */                                 \
+                JTEST_MEASURE_CYCLES(refCycles,                                         \
+                    for (n = 0; n < MEDIAN_LENGTH; n++)                                 \
+                    {                                                                   \
+                        for (k = 0; k < windowLen; k++)                                 \
+                        {                                                               \
+                            pWin[k] = (n >= k) ? pInput[n - k] : 0;                     \
+                        }                                                               \
+                                                                                        \
+                        qsort(pWin, windowLen, sizeof(type), median_compare_##type);    \
+                        pRef[n] = pWin[windowLen / 2];                                  \
+                    });                                                                 \
+                                                                                        \
+                JTEST_DUMP_STRF("Window Length: %d\n"                                   \
+                                "Quantized Input: %d\n"                                 \
+                                "qsort Cycles: %d\n",                                   \
+                                (int)windowLen,                                         \
+                                (int)quantize,                                          \
+                                (int)refCycles);                                        \
+                                                                                        \
+                TEST_ASSERT_EQUAL(                                                      \
+                    arm_median_filter_init_##suffix(&median_inst, windowLen, state,     \
+                                                    median_index),                      \
+                    ARM_MATH_SUCCESS);                                                  \
+                                                                                        \
+                JTEST_COUNT_CYCLES(                                                     \
+                    arm_median_filter_##suffix(&median_inst, pInput, pFut,              \
+                                               MEDIAN_LENGTH));                         \
+                                                                                        \
+                mismatches = 0;                                                         \
+                for (n = 0; n < MEDIAN_LENGTH; n++)                                     \
+                {                                                                       \
+                    mismatches += (pFut[n] != pRef[n]);                                 \
+                }                                                                       \
+                                                                                        \
+                TEST_ASSERT_EQUAL(mismatches, 0);                                       \
+                                                                                        \
+                /* Same input in irregular blocks */                                    \
+                arm_median_filter_init_##suffix(&median_inst, windowLen, state,         \
+                                                median_index);                          \
+                                                                                        \
+                for (n = 0, chunk = 0; n < MEDIAN_LENGTH;                               \
+                     n += median_chunk_sizes[chunk],                                    \
+                         chunk = (chunk + 1U) % MEDIAN_NUM_CHUNK_SIZES)                 \
+                {                                                                       \
+                    arm_median_filter_##suffix(                                         \
+                        &median_inst, pInput + n, pFut + n,                             \
+                        (n + median_chunk_sizes[chunk] <= MEDIAN_LENGTH) ?              \
+                        median_chunk_sizes[chunk] : MEDIAN_LENGTH - n);                 \
+                }                                                                       \
+                                                                                        \
+                mismatches = 0;                                                         \
+                for (n = 0; n < MEDIAN_LENGTH; n++)                                     \
+                {                                                                       \
+                    mismatches += (pFut[n] != pRef[n]);                                 \
+                }                                                                       \
+                                                                                        \
+                TEST_ASSERT_EQUAL(mismatches, 0);                                       \
+            }                                                                           \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+/*
+  The running minimum and maximum must be equal to those of each window, with
+  zeros before the first sample, for any block size.
+*/
+#define MINMAX_DEFINE_TEST(suffix, type, from_f32)                                      \
+    JTEST_DEFINE_TEST(arm_running_minmax_##suffix##_test,                               \
+                      arm_running_minmax_##suffix)                                      \
+    {                                                                                   \
+        arm_running_minmax_instance_##suffix minmax_inst;                               \
+        type * pInput = (type *) median_fut_f32;                                        \
+        type * pMin = pInput + MEDIAN_LENGTH;                                           \
+        type * pMax = (type *) median_ref_f32;                                          \
+        type state[MEDIAN_MAX_WINDOW];                                                  \
+        type x, lo, hi;                                                                 \
+        uint32_t quantize, w, n, k, chunk, mismatches;                                  \
+        uint16_t windowLen;                                                             \
+                                                                                        \
+        for (quantize = 0; quantize < 2; quantize++)                                    \
+        {                                                                               \
+            median_make_input(quantize);                                                \
+            from_f32(median_input_f32, pInput, MEDIAN_LENGTH);                          \
+                                                                                        \
+            for (w = 0; w < MINMAX_NUM_WINDOWS; w++)                                    \
+            {                                                                           \
+                windowLen = minmax_windows[w];                                          \
+                                                                                        \
+                JTEST_DUMP_STRF("Window Length: %d\n"                                   \
+                                "Quantized Input: %d\n",                                \
+                                (int)windowLen,                                         \
+                                (int)quantize);                                         \
+                                                                                        \
+                TEST_ASSERT_EQUAL(                                                      \
+                    arm_running_minmax_init_##suffix(&minmax_inst, windowLen, state,    \
+                                                     median_queue),                     \
+                    ARM_MATH_SUCCESS);                                                  \
+                                                                                        \
+                /* Alternate between one call and irregular blocks */                   \
+                if (quantize == 0)                                                      \
+                {                                                                       \
+                    JTEST_COUNT_CYCLES(                                                 \
+                        arm_running_minmax_##suffix(&minmax_inst, pInput, pMin, pMax,   \
+                                                    MEDIAN_LENGTH));                    \
+                }                                                                       \
+                else                                                                    \
+                {                                                                       \
+                    for (n = 0, chunk = 0; n < MEDIAN_LENGTH;                           \
+                         n += median_chunk_sizes[chunk],                                \
+                             chunk = (chunk + 1U) % MEDIAN_NUM_CHUNK_SIZES)             \
+                    {                                                                   \
+                        arm_running_minmax_##suffix(                                    \
+                            &minmax_inst, pInput + n, pMin + n, pMax + n,               \
+                            (n + median_chunk_sizes[chunk] <= MEDIAN_LENGTH) ?          \
+                            median_chunk_sizes[chunk] : MEDIAN_LENGTH - n);             \
+                    }                                                                   \
+                }                                                                       \
+                                                                                        \
+                mismatches = 0;                                                         \
+                for (n = 0; n < MEDIAN_LENGTH; n++)                                     \
+                {                                                                       \
+                    lo = pInput[n];                                                     \
+                    hi = pInput[n];                                                     \
+                    for (k = 1; k < windowLen; k++)                                     \
+                    {                                                                   \
+                        x = (n >= k) ? pInput[n - k] : 0;                               \
+                        lo = (x < lo) ? x : lo;                                         \
+                        hi = (x > hi) ? x : hi;                                         \
+                    }                                                                   \
+                                                                                        \
+                    mismatches += (pMin[n] != lo) + (pMax[n] != hi);                    \
+                }                                                                       \
+                                                                                        \
+                TEST_ASSERT_EQUAL(mismatches, 0);                                       \
+            }                                                                           \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+/* Conversion of the test input, a copy for the floating-point filters */
+#define median_copy_f32(pSrc, pDst, length) arm_copy_f32(pSrc, pDst, length)
+
+MEDIAN_DEFINE_TEST(f32, float32_t, median_copy_f32);
+MEDIAN_DEFINE_TEST(q31, q31_t, arm_float_to_q31);
+MEDIAN_DEFINE_TEST(q15, q15_t, arm_float_to_q15);
+
+MINMAX_DEFINE_TEST(f32, float32_t, median_copy_f32);
+MINMAX_DEFINE_TEST(q31, q31_t, arm_float_to_q31);
+MINMAX_DEFINE_TEST(q15, q15_t, arm_float_to_q15);
+
+JTEST_DEFINE_TEST(arm_median_filter_init_f32_test,
+                  arm_median_filter_init_f32)
+{
+    arm_median_filter_instance_f32 median_inst;
+    arm_running_minmax_instance_f32 minmax_inst;
+
+    /* The window must be odd */
+    TEST_ASSERT_EQUAL(arm_median_filter_init_f32(&median_inst, 4,
+                                                 median_window_f32,
+                                                 median_index),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_median_filter_init_f32(&median_inst, 0,
+                                                 median_window_f32,
+                                                 median_index),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    /* The heap indices are only needed above 9 samples */
+    TEST_ASSERT_EQUAL(arm_median_filter_init_f32(&median_inst, 9,
+                                                 median_window_f32, NULL),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_median_filter_init_f32(&median_inst, 11,
+                                                 median_window_f32, NULL),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    TEST_ASSERT_EQUAL(arm_running_minmax_init_f32(&minmax_inst, 0,
+                                                  median_window_f32,
+                                                  median_queue),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(median_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_median_filter_init_f32_test);
+    JTEST_TEST_CALL(arm_median_filter_f32_test);
+    JTEST_TEST_CALL(arm_median_filter_q31_test);
+    JTEST_TEST_CALL(arm_median_filter_q15_test);
+
+    JTEST_TEST_CALL(arm_running_minmax_f32_test);
+    JTEST_TEST_CALL(arm_running_minmax_q31_test);
+    JTEST_TEST_CALL(arm_running_minmax_q15_test);
+}
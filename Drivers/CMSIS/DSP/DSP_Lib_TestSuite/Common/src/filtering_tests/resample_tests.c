@@ -0,0 +1,233 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/**
+ *  The resampler is checked against the reference FIR interpolator followed
+ *  by keeping every M-th output.  The function under test processes the block
+ *  in two calls so that the position carried between calls is exercised.
+ */
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_interpolate_instance_##suffix fir_inst_ref = { 0 };             \
+      uint32_t outCnt, refCnt, i, split;                                      \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                     "Number of Taps: %d\n"                   \
+                                     "Upsample factor: %d\n"                  \
+                                     "Downsample factor: %d\n",               \
+                                     (int)blockSize,                          \
+                                     (int)numTaps,                            \
+                                     (int)L,                                  \
+                                     (int)M);                                 \
+                                                                              \
+                     /* Initialize the FIR Instances */                       \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_fut, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     split = blockSize / 2;                                   \
+                                                                              \
+                     JTEST_COUNT_CYCLES(                                      \
+                           outCnt = arm_fir_resample_##suffix(                \
+                                 &fir_inst_fut,                               \
+                                 (void *) filtering_##suffix##_inputs,        \
+                                 (void *) filtering_output_fut,               \
+                                 split));                                     \
+                                                                              \
+                     outCnt += arm_fir_resample_##suffix(                     \
+                           &fir_inst_fut,                                     \
+                           (output_type *) filtering_##suffix##_inputs        \
+                           + split,                                           \
+                           (output_type *) filtering_output_fut + outCnt,     \
+                           blockSize - split);                                \
+                                                                              \
+                     arm_fir_interpolate_init_##suffix(                       \
+                           &fir_inst_ref, L, numTaps,                         \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     ref_fir_interpolate_##suffix(                            \
+                           &fir_inst_ref,                                     \
+                           (void *) filtering_##suffix##_inputs,              \
+                           (void *) filtering_output_ref,                     \
+                           blockSize);                                        \
+                                                                              \
+                     /* Keep every M-th interpolated sample */                \
+                     refCnt = (blockSize * L + M - 1) / M;                    \
+                     for (i = 0; i < refCnt; i++)                             \
+                     {                                                        \
+                        ((output_type *) filtering_output_ref)[i] =           \
+                           ((output_type *) filtering_output_ref)[i * M];     \
+                     }                                                        \
+                                                                              \
+                     TEST_ASSERT_EQUAL(refCnt, outCnt);                       \
+                                                                              \
+                     FILTERING_SNR_COMPARE_INTERFACE(                         \
+                           refCnt,                                            \
+                           output_type)))));                                  \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+FIR_RESAMPLE_DEFINE_TEST(f32, float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q31, q31_t);
+FIR_RESAMPLE_DEFINE_TEST(q15, q15_t);
+
+/**
+ *  The Farrow resampler reproduces cubic polynomials exactly, up to its delay
+ *  of two input samples.  The input is a cubic sampled on a slow time axis and
+ *  each output is compared with the cubic evaluated at the output position.
+ */
+#define FARROW_BLOCK_LEN   32
+#define FARROW_NUM_BLOCKS  4
+#define FARROW_DELAY       2.0
+
+static float64_t farrow_cubic(float64_t k)
+{
+   float64_t u = k / (FARROW_BLOCK_LEN * FARROW_NUM_BLOCKS);
+
+   return 0.2 + 0.3 * u - 0.6 * u * u + 0.4 * u * u * u;
+}
+
+static const float32_t farrow_steps[] =
+{
+   0.37f, 1.0f, 1.6f, 0.9999f
+};
+
+#define FARROW_NUM_STEPS (sizeof(farrow_steps) / sizeof(float32_t))
+
+/* Convert the cubic to the input type */
+#define FARROW_TO_f32(x) ((float32_t) (x))
+#define FARROW_TO_q31(x) ((q31_t) ((x) * 2147483648.0))
+
+/* Convert an output sample to float */
+#define FARROW_FROM_f32(y) (y)
+#define FARROW_FROM_q31(y) ((float32_t) (y) / 2147483648.0f)
+
+/* Convert the step to the instance format */
+#define FARROW_STEP_f32(s) (s)
+#define FARROW_STEP_q31(s) ((q31_t) ((s) * 16777216.0f))
+
+/* Step actually used by the instance, as a double */
+#define FARROW_STEP_VALUE_f32(s) ((float64_t) (s))
+#define FARROW_STEP_VALUE_q31(s) ((float64_t) (s) / 16777216.0)
+
+#define FARROW_RESAMPLE_DEFINE_TEST(suffix, output_type)                      \
+   JTEST_DEFINE_TEST(arm_farrow_resample_##suffix##_test,                     \
+         arm_farrow_resample_##suffix)                                        \
+   {                                                                          \
+      arm_farrow_resample_instance_##suffix inst = { 0 };                     \
+      output_type * pIn = (output_type *) filtering_output_ref;               \
+      output_type * pOut = (output_type *) filtering_output_fut;              \
+      uint32_t s, b, i, outCnt, total, first;                                 \
+      float64_t t;                                                            \
+                                                                              \
+      for (s = 0; s < FARROW_NUM_STEPS; s++)                                  \
+      {                                                                       \
+         JTEST_DUMP_STRF("Block Size: %d\n"                                   \
+                         "Step: %f\n",                                        \
+                         (int)FARROW_BLOCK_LEN,                               \
+                         (double)farrow_steps[s]);                            \
+                                                                              \
+         for (i = 0; i < FARROW_BLOCK_LEN * FARROW_NUM_BLOCKS; i++)           \
+         {                                                                    \
+            pIn[i] = FARROW_TO_##suffix(farrow_cubic((float64_t) i));         \
+         }                                                                    \
+                                                                              \
+         arm_farrow_resample_init_##suffix(                                   \
+               &inst, FARROW_STEP_##suffix(farrow_steps[s]),                  \
+               (void *) filtering_pState, FARROW_BLOCK_LEN);                  \
+                                                                              \
+         t = 0.0;                                                             \
+         total = 0;                                                           \
+         first = 0;                                                           \
+                                                                              \
+         for (b = 0; b < FARROW_NUM_BLOCKS; b++)                              \
+         {                                                                    \
+            /* Let the clock drift from the third block on */                 \
+            if (b == 2)                                                       \
+            {                                                                 \
+               inst.step = FARROW_STEP_##suffix(farrow_steps[s] * 1.001f);    \
+            }                                                                 \
+                                                                              \
+            JTEST_COUNT_CYCLES(                                               \
+                  outCnt = arm_farrow_resample_##suffix(                      \
+                        &inst,                                                \
+                        pIn + b * FARROW_BLOCK_LEN,                           \
+                        pOut + total,                                         \
+                        FARROW_BLOCK_LEN));                                   \
+                                                                              \
+            for (i = 0; i < outCnt; i++)                                      \
+            {                                                                 \
+               /* Skip the outputs that depend on the zero initial state */   \
+               if (t < FARROW_DELAY + 1.0)                                    \
+               {                                                              \
+                  first++;                                                    \
+               }                                                              \
+                                                                              \
+               filtering_output_f32_ref[total + i] =                          \
+                  (float32_t) farrow_cubic(t - FARROW_DELAY);                 \
+               filtering_output_f32_fut[total + i] =                          \
+                  FARROW_FROM_##suffix(pOut[total + i]);                      \
+                                                                              \
+               t += FARROW_STEP_VALUE_##suffix(inst.step);                    \
+            }                                                                 \
+                                                                              \
+            total += outCnt;                                                  \
+         }                                                                    \
+                                                                              \
+         /* All of the input must have been consumed */                       \
+         TEST_ASSERT_EQUAL(                                                   \
+               (t >= FARROW_BLOCK_LEN * FARROW_NUM_BLOCKS), 1);               \
+                                                                              \
+         TEST_ASSERT_SNR(                                                     \
+               filtering_output_f32_ref + first,                              \
+               filtering_output_f32_fut + first,                              \
+               total - first,                                                 \
+               FILTERING_SNR_THRESHOLD_q31_t);                                \
+      }                                                                       \
+                                                                              \
+      return JTEST_TEST_PASSED;                                               \
+   }
+
+FARROW_RESAMPLE_DEFINE_TEST(f32, float32_t);
+FARROW_RESAMPLE_DEFINE_TEST(q31, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(resample_tests)
+{
+   /*
+     To skip a test, comment it out.
+   */
+   JTEST_TEST_CALL(arm_fir_resample_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_q15_test);
+   JTEST_TEST_CALL(arm_farrow_resample_f32_test);
+   JTEST_TEST_CALL(arm_farrow_resample_q31_test);
+}
@@ -0,0 +1,326 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Lag-Limited and Generalized Cross-Correlation */
+/*--------------------------------------------------------------------------------*/
+
+#define XCORR_MAX_LENGTH 4096
+#define XCORR_MAX_LAGS   (2 * 70 + 1)
+
+/* Lengths of the sequences and lag range of the direct correlation tests */
+static const int32_t xcorr_lag_configs[][4] =
+{
+    {    1,    1,   0,  0 },
+    {   16,   16, -20, 20 },
+    {  100,   37, -40, 70 },
+    {   37,  100, -70, 40 },
+    {  256,  256, -64, 64 },
+    { 4096, 4096, -64, 64 }
+};
+
+#define XCORR_NUM_LAG_CONFIGS \
+    (sizeof(xcorr_lag_configs) / sizeof(xcorr_lag_configs[0]))
+
+/* FFT length, largest lag and block size of the FFT-based tests */
+static const uint16_t xcorr_gcc_configs[][3] =
+{
+    {   64, 16,   48 },
+    {  512, 64,  448 },
+    { 4096, 64, 4032 }
+};
+
+#define XCORR_NUM_GCC_CONFIGS \
+    (sizeof(xcorr_gcc_configs) / sizeof(xcorr_gcc_configs[0]))
+
+/* Delays of the PHAT test in half samples, odd values are fractional */
+static const int32_t xcorr_delays[] = { 0, 34, -46, 126, 11, -3 };
+
+#define XCORR_NUM_DELAYS (sizeof(xcorr_delays) / sizeof(xcorr_delays[0]))
+
+static float32_t xcorr_a[XCORR_MAX_LENGTH];
+static float32_t xcorr_b[XCORR_MAX_LENGTH + XCORR_MAX_LAGS];
+static float32_t xcorr_state[3 * XCORR_MAX_LENGTH];
+static float32_t xcorr_fut[XCORR_MAX_LAGS];
+static float32_t xcorr_ref[XCORR_MAX_LAGS];
+
+/* Uniform noise in [-1 1), the same sequence on every target */
+static float32_t xcorr_rand(uint32_t * pSeed)
+{
+    *pSeed = *pSeed * 1664525U + 1013904223U;
+
+    return (float32_t) (int32_t) *pSeed / 2147483648.0f;
+}
+
+static void xcorr_make_inputs(void)
+{
+    uint32_t seed = 1U;
+    uint32_t n;
+
+    for (n = 0; n < XCORR_MAX_LENGTH; n++)
+    {
+        xcorr_a[n] = xcorr_rand(&seed);
+        xcorr_b[n] = xcorr_rand(&seed);
+    }
+}
+
+/* Direct correlation in double precision */
+static void ref_correlate_lag(
+    float32_t * pSrcA,
+    int32_t srcALen,
+    float32_t * pSrcB,
+    int32_t srcBLen,
+    int32_t minLag,
+    int32_t maxLag,
+    float32_t * pDst)
+{
+    int32_t lag, n;
+    float64_t sum;
+
+    for (lag = minLag; lag <= maxLag; lag++)
+    {
+        sum = 0.0;
+        for (n = 0; n < srcBLen; n++)
+        {
+            if ((n + lag >= 0) && (n + lag < srcALen))
+            {
+                sum += (float64_t) pSrcA[n + lag] * pSrcB[n];
+            }
+        }
+
+        *pDst++ = (float32_t) sum;
+    }
+}
+
+JTEST_DEFINE_TEST(arm_correlate_lag_f32_test,
+                  arm_correlate_lag_f32)
+{
+    int32_t srcALen, srcBLen, minLag, maxLag;
+    uint32_t c;
+
+    xcorr_make_inputs();
+
+    for (c = 0; c < XCORR_NUM_LAG_CONFIGS; c++)
+    {
+        srcALen = xcorr_lag_configs[c][0];
+        srcBLen = xcorr_lag_configs[c][1];
+        minLag = xcorr_lag_configs[c][2];
+        maxLag = xcorr_lag_configs[c][3];
+
+        JTEST_DUMP_STRF("Lengths: %d %d\n"
+                        "Lags: %d to %d\n",
+                        (int)srcALen,
+                        (int)srcBLen,
+                        (int)minLag,
+                        (int)maxLag);
+
+        JTEST_COUNT_CYCLES(
+            arm_correlate_lag_f32(xcorr_a, srcALen, xcorr_b, srcBLen,
+                                  minLag, maxLag, xcorr_fut));
+
+        ref_correlate_lag(xcorr_a, srcALen, xcorr_b, srcBLen,
+                          minLag, maxLag, xcorr_ref);
+
+        TEST_ASSERT_SNR(xcorr_ref, xcorr_fut, maxLag - minLag + 1,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_gcc_phat_init_f32_test,
+                  arm_gcc_phat_init_f32)
+{
+    arm_gcc_phat_instance_f32 gcc_inst;
+
+    /* Not a real FFT length */
+    TEST_ASSERT_EQUAL(arm_gcc_phat_init_f32(&gcc_inst, 100, 8, 1,
+                                            xcorr_state),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    /* The positive and negative lags would overlap */
+    TEST_ASSERT_EQUAL(arm_gcc_phat_init_f32(&gcc_inst, 64, 32, 1,
+                                            xcorr_state),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    TEST_ASSERT_EQUAL(arm_gcc_phat_init_f32(&gcc_inst, 64, 31, 1,
+                                            xcorr_state),
+                      ARM_MATH_SUCCESS);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Without weighting, the FFT-based correlation of zero-padded blocks must
+  match the direct correlation over the same lags.
+*/
+JTEST_DEFINE_TEST(arm_gcc_phat_f32_test,
+                  arm_gcc_phat_f32)
+{
+    arm_gcc_phat_instance_f32 gcc_inst;
+    uint16_t fftLen, maxLag, blockSize;
+    uint32_t c;
+
+    xcorr_make_inputs();
+
+    for (c = 0; c < XCORR_NUM_GCC_CONFIGS; c++)
+    {
+        fftLen = xcorr_gcc_configs[c][0];
+        maxLag = xcorr_gcc_configs[c][1];
+        blockSize = xcorr_gcc_configs[c][2];
+
+        JTEST_DUMP_STRF("FFT Length: %d\n"
+                        "Max Lag: %d\n",
+                        (int)fftLen,
+                        (int)maxLag);
+
+        TEST_ASSERT_EQUAL(arm_gcc_phat_init_f32(&gcc_inst, fftLen, maxLag, 0,
+                                                xcorr_state),
+                          ARM_MATH_SUCCESS);
+
+        JTEST_COUNT_CYCLES(
+            arm_gcc_phat_f32(&gcc_inst, xcorr_a, xcorr_b, blockSize,
+                             xcorr_fut));
+
+        ref_correlate_lag(xcorr_a, blockSize, xcorr_b, blockSize,
+                          -maxLag, maxLag, xcorr_ref);
+
+        TEST_ASSERT_SNR(xcorr_ref, xcorr_fut, 2 * maxLag + 1,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Delay estimate: the first block is the second one delayed by a number of
+  half samples, with a half sample obtained by averaging two samples, plus
+  noise 20 dB below the signal.  The PHAT peak must be within 0.1 sample of
+  the delay.
+*/
+JTEST_DEFINE_TEST(arm_gcc_phat_f32_delay_test,
+                  arm_gcc_phat_f32)
+{
+    arm_gcc_phat_instance_f32 gcc_inst;
+    uint32_t seed = 2U;
+    uint32_t d, n;
+    int32_t delay, whole;
+    float32_t lag, value;
+
+    xcorr_make_inputs();
+
+    /* Longer second block, so that it can be delayed either way */
+    for (n = XCORR_MAX_LENGTH; n < XCORR_MAX_LENGTH + XCORR_MAX_LAGS; n++)
+    {
+        xcorr_b[n] = xcorr_rand(&seed);
+    }
+
+    TEST_ASSERT_EQUAL(arm_gcc_phat_init_f32(&gcc_inst, 4096, 64, 1,
+                                            xcorr_state),
+                      ARM_MATH_SUCCESS);
+
+    for (d = 0; d < XCORR_NUM_DELAYS; d++)
+    {
+        delay = xcorr_delays[d];
+        whole = (delay >= 0) ? (delay / 2) : -((1 - delay) / 2);
+
+        JTEST_DUMP_STRF("Delay: %d half samples\n",
+                        (int)delay);
+
+        /* b + 70 is the undelayed signal, a[n] = b[70 + n - delay/2] */
+        for (n = 0; n < 4032; n++)
+        {
+            xcorr_a[n] = xcorr_b[70 + n - whole];
+
+            if ((delay & 1) != 0)
+            {
+                xcorr_a[n] = 0.5f * (xcorr_a[n] + xcorr_b[69 + n - whole]);
+            }
+
+            xcorr_a[n] += 0.1f * xcorr_rand(&seed);
+        }
+
+        JTEST_COUNT_CYCLES(
+            arm_gcc_phat_f32(&gcc_inst, xcorr_a, xcorr_b + 70, 4032,
+                             xcorr_fut));
+
+        arm_correlate_peak_f32(xcorr_fut, 129, -64, &lag, &value);
+
+        JTEST_DUMP_STRF("Estimated Delay: %f\n",
+                        (double)lag);
+
+        if ((fabsf(lag - 0.5f * delay) > 0.1f) || (value < 0.1f))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The interpolation is exact on a parabola.  A maximum at either end is not
+  interpolated.
+*/
+JTEST_DEFINE_TEST(arm_correlate_peak_f32_test,
+                  arm_correlate_peak_f32)
+{
+    static const float32_t centers[] = { 3.3f, -0.5f, 0.0f, 3.49f, -4.2f, -5.0f, 4.0f };
+    uint32_t c, k;
+    float32_t lag, value;
+
+    for (c = 0; c < sizeof(centers) / sizeof(centers[0]); c++)
+    {
+        for (k = 0; k < 10; k++)
+        {
+            xcorr_fut[k] = 2.0f - 0.1f * ((k - 5.0f) - centers[c]) *
+                ((k - 5.0f) - centers[c]);
+        }
+
+        arm_correlate_peak_f32(xcorr_fut, 10, -5, &lag, &value);
+
+        if ((fabsf(lag - centers[c]) > 1e-4f) || (fabsf(value - 2.0f) > 1e-4f))
+        {
+            JTEST_DUMP_STRF("Center: %f Lag: %f Value: %f\n",
+                            (double)centers[c],
+                            (double)lag,
+                            (double)value);
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    /* Maximum at the last value */
+    for (k = 0; k < 10; k++)
+    {
+        xcorr_fut[k] = (float32_t) k;
+    }
+
+    arm_correlate_peak_f32(xcorr_fut, 10, -5, &lag, &value);
+    TEST_ASSERT_EQUAL(lag, 4.0f);
+    TEST_ASSERT_EQUAL(value, 9.0f);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(xcorr_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_correlate_lag_f32_test);
+    JTEST_TEST_CALL(arm_gcc_phat_init_f32_test);
+    JTEST_TEST_CALL(arm_gcc_phat_f32_test);
+    JTEST_TEST_CALL(arm_gcc_phat_f32_delay_test);
+    JTEST_TEST_CALL(arm_correlate_peak_f32_test);
+}
@@ -0,0 +1,159 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "interpolation_test_data.h"
+
+/**
+ * Comparison SNR threshold for the floating-point function, which uses a
+ * different table indexing than the scalar function.
+ */
+#define BILINEAR_INTERP_SNR_THRESHOLD_float32_t 100
+
+/**
+ *  Query points on the square test grid, in 12.20 format.  The last row and
+ *  column are skipped because the scalar functions read outside of the table
+ *  there, so the comparison only covers points where both agree.
+ */
+static q31_t bilinear_interp_x_q31[INTERPOLATION_MAX_LEN];
+static q31_t bilinear_interp_y_q31[INTERPOLATION_MAX_LEN];
+static float32_t bilinear_interp_x_f32[INTERPOLATION_MAX_LEN];
+static float32_t bilinear_interp_y_f32[INTERPOLATION_MAX_LEN];
+
+static q31_t bilinear_interp_skip_last(q31_t v)
+{
+    if ((v >> 20) == (INTERPOLATION_GRID_LEN - 1))
+    {
+        v += (2 << 20);
+    }
+    return v;
+}
+
+static void bilinear_interp_init_points(void)
+{
+    uint32_t i;
+    q31_t x;
+
+    for (i = 0; i < INTERPOLATION_MAX_LEN; i++)
+    {
+        /* Map [-8, 72) onto [-2, 18) so points cover the grid and its border */
+        x = (q31_t) (((uint32_t) interpolation_x_q31[i] + (8U << 20)) % (20U << 20))
+            - (2 << 20);
+
+        bilinear_interp_x_q31[i] = bilinear_interp_skip_last(x);
+        bilinear_interp_y_q31[i] =
+            bilinear_interp_skip_last(interpolation_y_q31[i]);
+
+        bilinear_interp_x_f32[i] = (float32_t) bilinear_interp_x_q31[i] / 1048576.0f;
+        bilinear_interp_y_f32[i] = (float32_t) bilinear_interp_y_q31[i] / 1048576.0f;
+    }
+}
+
+/**
+ *  Define a JTEST_TEST_t for arm_bilinear_interp_block_xxx, which must be bit
+ *  exact with the scalar arm_bilinear_interp_xxx for every query point.
+ */
+#define BILINEAR_INTERP_BLOCK_TEST(suffix, type)                            \
+    JTEST_DEFINE_TEST(arm_bilinear_interp_block_##suffix##_test,            \
+                      arm_bilinear_interp_block_##suffix)                   \
+    {                                                                       \
+        uint32_t i;                                                         \
+        arm_bilinear_interp_instance_##suffix S =                           \
+            {INTERPOLATION_GRID_LEN, INTERPOLATION_GRID_LEN,                \
+             interpolation_table_##suffix};                                 \
+                                                                            \
+        bilinear_interp_init_points();                                      \
+                                                                            \
+        JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                        "Grid Size: %d\n",                                  \
+                        (int)INTERPOLATION_MAX_LEN,                         \
+                        (int)INTERPOLATION_GRID_LEN);                       \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            arm_bilinear_interp_block_##suffix(                             \
+                &S,                                                         \
+                bilinear_interp_x_q31,                                      \
+                bilinear_interp_y_q31,                                      \
+                (type *) interpolation_output_fut,                          \
+                INTERPOLATION_MAX_LEN));                                    \
+                                                                            \
+        for (i = 0; i < INTERPOLATION_MAX_LEN; i++)                         \
+        {                                                                   \
+            ((type *) interpolation_output_ref)[i] =                        \
+                arm_bilinear_interp_##suffix(                               \
+                    &S,                                                     \
+                    bilinear_interp_x_q31[i],                               \
+                    bilinear_interp_y_q31[i]);                              \
+        }                                                                   \
+                                                                            \
+        TEST_ASSERT_BUFFERS_EQUAL(                                          \
+            interpolation_output_ref,                                       \
+            interpolation_output_fut,                                       \
+            INTERPOLATION_MAX_LEN * sizeof(type));                          \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+BILINEAR_INTERP_BLOCK_TEST(q31, q31_t);
+BILINEAR_INTERP_BLOCK_TEST(q15, q15_t);
+BILINEAR_INTERP_BLOCK_TEST(q7, q7_t);
+
+JTEST_DEFINE_TEST(arm_bilinear_interp_block_f32_test,
+                  arm_bilinear_interp_block_f32)
+{
+    uint32_t i;
+    float32_t X, Y;
+    arm_bilinear_interp_instance_f32 S =
+        {INTERPOLATION_GRID_LEN, INTERPOLATION_GRID_LEN,
+         interpolation_table_f32};
+
+    bilinear_interp_init_points();
+
+    JTEST_DUMP_STRF("Block Size: %d\n"
+                    "Grid Size: %d\n",
+                    (int)INTERPOLATION_MAX_LEN,
+                    (int)INTERPOLATION_GRID_LEN);
+
+    JTEST_COUNT_CYCLES(
+        arm_bilinear_interp_block_f32(
+            &S,
+            bilinear_interp_x_f32,
+            bilinear_interp_y_f32,
+            interpolation_output_f32_fut,
+            INTERPOLATION_MAX_LEN));
+
+    /* The scalar function indexes the table from one */
+    for (i = 0; i < INTERPOLATION_MAX_LEN; i++)
+    {
+        X = bilinear_interp_x_f32[i];
+        Y = bilinear_interp_y_f32[i];
+
+        interpolation_output_f32_ref[i] =
+            ((X < 0.0f) || (Y < 0.0f)) ? 0.0f :
+            arm_bilinear_interp_f32(&S, X + 1.0f, Y + 1.0f);
+    }
+
+    TEST_ASSERT_SNR(
+        interpolation_output_f32_ref,
+        interpolation_output_f32_fut,
+        INTERPOLATION_MAX_LEN,
+        BILINEAR_INTERP_SNR_THRESHOLD_float32_t);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(bilinear_interp_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_bilinear_interp_block_f32_test);
+    JTEST_TEST_CALL(arm_bilinear_interp_block_q31_test);
+    JTEST_TEST_CALL(arm_bilinear_interp_block_q15_test);
+    JTEST_TEST_CALL(arm_bilinear_interp_block_q7_test);
+}
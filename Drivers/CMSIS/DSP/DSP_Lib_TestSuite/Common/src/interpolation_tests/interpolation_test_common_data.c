@@ -0,0 +1,62 @@
+#include "interpolation_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Input/Output Buffers */
+/*--------------------------------------------------------------------------------*/
+
+float32_t interpolation_output_fut[INTERPOLATION_MAX_LEN] = {0};
+float32_t interpolation_output_ref[INTERPOLATION_MAX_LEN] = {0};
+float32_t interpolation_output_f32_fut[INTERPOLATION_MAX_LEN] = {0};
+float32_t interpolation_output_f32_ref[INTERPOLATION_MAX_LEN] = {0};
+float32_t interpolation_x_f32[INTERPOLATION_MAX_LEN] = {0};
+float32_t interpolation_y_f32[INTERPOLATION_MAX_LEN] = {0};
+q31_t interpolation_x_q31[INTERPOLATION_MAX_LEN] = {0};
+q31_t interpolation_y_q31[INTERPOLATION_MAX_LEN] = {0};
+
+/*--------------------------------------------------------------------------------*/
+/* Tables */
+/*--------------------------------------------------------------------------------*/
+
+/* The same buffers back the 1-D tables (first INTERPOLATION_TABLE_LEN values)
+ * and the INTERPOLATION_GRID_LEN x INTERPOLATION_GRID_LEN 2-D tables. */
+float32_t interpolation_table_f32[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN] = {0};
+q31_t interpolation_table_q31[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN] = {0};
+q15_t interpolation_table_q15[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN] = {0};
+q7_t interpolation_table_q7[INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN] = {0};
+
+/*--------------------------------------------------------------------------------*/
+/* Initialization */
+/*--------------------------------------------------------------------------------*/
+
+void interpolation_test_init(void)
+{
+    uint32_t i;
+    uint32_t seed = 0x1234567;
+
+    /* Smooth table with a pseudo-random component, kept inside [-0.9, 0.9]. */
+    for (i = 0; i < INTERPOLATION_GRID_LEN * INTERPOLATION_GRID_LEN; i++)
+    {
+        float32_t v;
+
+        seed = seed * 1664525U + 1013904223U;
+        v = 0.6f * arm_sin_f32(0.37f * (float32_t) i)
+            + 0.3f * ((float32_t) (seed >> 8) / 16777216.0f - 0.5f);
+
+        interpolation_table_f32[i] = v;
+        interpolation_table_q31[i] = (q31_t) (v * 2147483648.0f);
+        interpolation_table_q15[i] = (q15_t) (v * 32768.0f);
+        interpolation_table_q7[i]  = (q7_t)  (v * 128.0f);
+    }
+
+    /* Query points in table units, covering both sides of the table range. */
+    for (i = 0; i < INTERPOLATION_MAX_LEN; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        interpolation_x_q31[i] = (q31_t) (seed % (80U << 20)) - (8 << 20);
+        seed = seed * 1664525U + 1013904223U;
+        interpolation_y_q31[i] = (q31_t) (seed % (20U << 20)) - (2 << 20);
+
+        interpolation_x_f32[i] = (float32_t) interpolation_x_q31[i] / 1048576.0f;
+        interpolation_y_f32[i] = (float32_t) interpolation_y_q31[i] / 1048576.0f;
+    }
+}
@@ -0,0 +1,15 @@
+#include "jtest.h"
+#include "interpolation_tests.h"
+#include "interpolation_test_data.h"
+
+JTEST_DEFINE_GROUP(interpolation_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    interpolation_test_init();
+
+    JTEST_GROUP_CALL(linear_interp_tests);
+    JTEST_GROUP_CALL(bilinear_interp_tests);
+    return;
+}
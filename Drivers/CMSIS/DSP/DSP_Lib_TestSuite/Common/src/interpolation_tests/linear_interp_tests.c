@@ -0,0 +1,312 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "interpolation_test_data.h"
+
+/**
+ * Comparison SNR threshold for the floating-point functions, which do not
+ * follow the rounding of the scalar function exactly.
+ */
+#define INTERPOLATION_SNR_THRESHOLD_float32_t 100
+
+/**
+ *  Reference for the floating-point functions: the scalar function inside the
+ *  table, saturated to the end values outside.
+ */
+static float32_t ref_linear_interp_f32(
+    arm_linear_interp_instance_f32 * S,
+    float32_t x)
+{
+    float32_t t = (x - S->x1) / S->xSpacing;
+
+    if (t < 0.0f)
+    {
+        return S->pYData[0];
+    }
+    if (t >= (float32_t) (S->nValues - 1))
+    {
+        return S->pYData[S->nValues - 1];
+    }
+    return arm_linear_interp_f32(S, x);
+}
+
+/**
+ *  Start and step pairs, in 12.20 format, used by the stride tests.  They
+ *  cover increasing, decreasing and constant query points starting on either
+ *  side of the table.
+ */
+static const q31_t linear_interp_stride_params[] =
+{
+    -(5 << 20),              0x00005000,
+    (70 << 20),             -0x00009000,
+    (3 << 20) + 123,         0x00040000,
+    -(1 << 20),              0x00000000,
+    (10 << 20) + 0x7FFFF,    0x00000000,
+    (80 << 20),              0x00100000,
+    (30 << 20),             -0x00080001,
+};
+
+#define LINEAR_INTERP_STRIDE_PARAMS_LEN                 \
+    (sizeof(linear_interp_stride_params) / sizeof(q31_t) / 2)
+
+/**
+ *  Define a JTEST_TEST_t for arm_linear_interp_block_xxx, which must be bit
+ *  exact with the scalar arm_linear_interp_xxx for every query point.
+ */
+#define LINEAR_INTERP_BLOCK_TEST(suffix, type)                              \
+    JTEST_DEFINE_TEST(arm_linear_interp_block_##suffix##_test,              \
+                      arm_linear_interp_block_##suffix)                     \
+    {                                                                       \
+        uint32_t i;                                                         \
+                                                                            \
+        JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                        "Table Size: %d\n",                                 \
+                        (int)INTERPOLATION_MAX_LEN,                         \
+                        (int)INTERPOLATION_TABLE_LEN);                      \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            arm_linear_interp_block_##suffix(                               \
+                interpolation_table_##suffix,                               \
+                INTERPOLATION_TABLE_LEN,                                    \
+                interpolation_x_q31,                                        \
+                (type *) interpolation_output_fut,                          \
+                INTERPOLATION_MAX_LEN));                                    \
+                                                                            \
+        for (i = 0; i < INTERPOLATION_MAX_LEN; i++)                         \
+        {                                                                   \
+            ((type *) interpolation_output_ref)[i] =                        \
+                arm_linear_interp_##suffix(                                 \
+                    interpolation_table_##suffix,                           \
+                    interpolation_x_q31[i],                                 \
+                    INTERPOLATION_TABLE_LEN);                               \
+        }                                                                   \
+                                                                            \
+        TEST_ASSERT_BUFFERS_EQUAL(                                          \
+            interpolation_output_ref,                                       \
+            interpolation_output_fut,                                       \
+            INTERPOLATION_MAX_LEN * sizeof(type));                          \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/**
+ *  Define a JTEST_TEST_t for arm_linear_interp_stride_xxx, which must be bit
+ *  exact with the scalar arm_linear_interp_xxx evaluated on the same grid.
+ */
+#define LINEAR_INTERP_STRIDE_TEST(suffix, type)                             \
+    JTEST_DEFINE_TEST(arm_linear_interp_stride_##suffix##_test,             \
+                      arm_linear_interp_stride_##suffix)                    \
+    {                                                                       \
+        uint32_t i, p;                                                      \
+        q31_t xStart, xStep;                                                \
+                                                                            \
+        for (p = 0; p < LINEAR_INTERP_STRIDE_PARAMS_LEN; p++)               \
+        {                                                                   \
+            xStart = linear_interp_stride_params[2 * p];                    \
+            xStep = linear_interp_stride_params[2 * p + 1];                 \
+                                                                            \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Start: 0x%08X\n"                               \
+                            "Step: 0x%08X\n",                               \
+                            (int)INTERPOLATION_MAX_LEN,                     \
+                            (unsigned)xStart,                               \
+                            (unsigned)xStep);                               \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_linear_interp_stride_##suffix(                          \
+                    interpolation_table_##suffix,                           \
+                    INTERPOLATION_TABLE_LEN,                                \
+                    xStart, xStep,                                          \
+                    (type *) interpolation_output_fut,                      \
+                    INTERPOLATION_MAX_LEN));                                \
+                                                                            \
+            for (i = 0; i < INTERPOLATION_MAX_LEN; i++)                     \
+            {                                                               \
+                ((type *) interpolation_output_ref)[i] =                    \
+                    arm_linear_interp_##suffix(                             \
+                        interpolation_table_##suffix,                       \
+                        xStart + (q31_t) i * xStep,                         \
+                        INTERPOLATION_TABLE_LEN);                           \
+            }                                                               \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                interpolation_output_ref,                                   \
+                interpolation_output_fut,                                   \
+                INTERPOLATION_MAX_LEN * sizeof(type));                      \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+LINEAR_INTERP_BLOCK_TEST(q31, q31_t);
+LINEAR_INTERP_BLOCK_TEST(q15, q15_t);
+LINEAR_INTERP_BLOCK_TEST(q7, q7_t);
+
+LINEAR_INTERP_STRIDE_TEST(q31, q31_t);
+LINEAR_INTERP_STRIDE_TEST(q15, q15_t);
+LINEAR_INTERP_STRIDE_TEST(q7, q7_t);
+
+JTEST_DEFINE_TEST(arm_linear_interp_block_f32_test,
+                  arm_linear_interp_block_f32)
+{
+    uint32_t i;
+    arm_linear_interp_instance_f32 S =
+        {INTERPOLATION_TABLE_LEN, -2.0f, 0.5f, interpolation_table_f32};
+
+    JTEST_DUMP_STRF("Block Size: %d\n"
+                    "Table Size: %d\n",
+                    (int)INTERPOLATION_MAX_LEN,
+                    (int)INTERPOLATION_TABLE_LEN);
+
+    /* Query points in table units are mapped to the x axis of the instance. */
+    for (i = 0; i < INTERPOLATION_MAX_LEN; i++)
+    {
+        interpolation_output_f32_ref[i] =
+            S.x1 + S.xSpacing * interpolation_x_f32[i];
+    }
+
+    JTEST_COUNT_CYCLES(
+        arm_linear_interp_block_f32(
+            &S,
+            interpolation_output_f32_ref,
+            interpolation_output_f32_fut,
+            INTERPOLATION_MAX_LEN));
+
+    for (i = 0; i < INTERPOLATION_MAX_LEN; i++)
+    {
+        interpolation_output_ref[i] =
+            ref_linear_interp_f32(&S, interpolation_output_f32_ref[i]);
+    }
+
+    TEST_ASSERT_SNR(
+        interpolation_output_ref,
+        interpolation_output_f32_fut,
+        INTERPOLATION_MAX_LEN,
+        INTERPOLATION_SNR_THRESHOLD_float32_t);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_linear_interp_stride_f32_test,
+                  arm_linear_interp_stride_f32)
+{
+    uint32_t i, p;
+    float32_t xStart, xStep;
+    arm_linear_interp_instance_f32 S =
+        {INTERPOLATION_TABLE_LEN, -2.0f, 0.5f, interpolation_table_f32};
+
+    for (p = 0; p < LINEAR_INTERP_STRIDE_PARAMS_LEN; p++)
+    {
+        xStart = S.x1 + S.xSpacing *
+            ((float32_t) linear_interp_stride_params[2 * p] / 1048576.0f);
+        xStep = S.xSpacing *
+            ((float32_t) linear_interp_stride_params[2 * p + 1] / 1048576.0f);
+
+        JTEST_DUMP_STRF("Block Size: %d\n",
+                        (int)INTERPOLATION_MAX_LEN);
+
+        JTEST_COUNT_CYCLES(
+            arm_linear_interp_stride_f32(
+                &S, xStart, xStep,
+                interpolation_output_f32_fut,
+                INTERPOLATION_MAX_LEN));
+
+        for (i = 0; i < INTERPOLATION_MAX_LEN; i++)
+        {
+            interpolation_output_f32_ref[i] =
+                ref_linear_interp_f32(&S, xStart + (float32_t) i * xStep);
+        }
+
+        TEST_ASSERT_SNR(
+            interpolation_output_f32_ref,
+            interpolation_output_f32_fut,
+            INTERPOLATION_MAX_LEN,
+            INTERPOLATION_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Long resampling of a 4096 entry identity table, where every output must
+ *  stay close to the scalar function at xStart + n * xStep.  The steps are
+ *  in table entries.
+ */
+#define LINEAR_INTERP_LONG_TABLE_LEN 4096
+#define LINEAR_INTERP_LONG_BLOCK_LEN 4095
+#define LINEAR_INTERP_LONG_MAX_ERROR 1e-3f
+
+static const float32_t linear_interp_long_steps[] = { 0.9999f, 0.3f, 0.1f, 1.0f / 3.0f };
+
+static float32_t linear_interp_long_table[LINEAR_INTERP_LONG_TABLE_LEN];
+static float32_t linear_interp_long_output[LINEAR_INTERP_LONG_BLOCK_LEN];
+
+JTEST_DEFINE_TEST(arm_linear_interp_stride_f32_long_test,
+                  arm_linear_interp_stride_f32)
+{
+    uint32_t i, p;
+    float32_t xStep, error;
+    arm_linear_interp_instance_f32 S =
+        {LINEAR_INTERP_LONG_TABLE_LEN, 0.0f, 1.0f, linear_interp_long_table};
+
+    for (i = 0; i < LINEAR_INTERP_LONG_TABLE_LEN; i++)
+    {
+        linear_interp_long_table[i] = (float32_t) i;
+    }
+
+    for (p = 0; p < sizeof(linear_interp_long_steps) / sizeof(float32_t); p++)
+    {
+        xStep = linear_interp_long_steps[p];
+
+        JTEST_DUMP_STRF("Block Size: %d\n"
+                        "Step: %f\n",
+                        (int)LINEAR_INTERP_LONG_BLOCK_LEN,
+                        (double)xStep);
+
+        JTEST_COUNT_CYCLES(
+            arm_linear_interp_stride_f32(
+                &S, 0.0f, xStep,
+                linear_interp_long_output,
+                LINEAR_INTERP_LONG_BLOCK_LEN));
+
+        for (i = 0; i < LINEAR_INTERP_LONG_BLOCK_LEN; i++)
+        {
+            error = linear_interp_long_output[i] -
+                ref_linear_interp_f32(&S, (float32_t) i * xStep);
+
+            if ((error > LINEAR_INTERP_LONG_MAX_ERROR) ||
+                (error < -LINEAR_INTERP_LONG_MAX_ERROR))
+            {
+                JTEST_DUMP_STRF("Output %d is off by %f\n",
+                                (int)i,
+                                (double)error);
+                return JTEST_TEST_FAILED;
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(linear_interp_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_linear_interp_block_f32_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_q31_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_q15_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_q7_test);
+
+    JTEST_TEST_CALL(arm_linear_interp_stride_f32_test);
+    JTEST_TEST_CALL(arm_linear_interp_stride_f32_long_test);
+    JTEST_TEST_CALL(arm_linear_interp_stride_q31_test);
+    JTEST_TEST_CALL(arm_linear_interp_stride_q15_test);
+    JTEST_TEST_CALL(arm_linear_interp_stride_q7_test);
+}
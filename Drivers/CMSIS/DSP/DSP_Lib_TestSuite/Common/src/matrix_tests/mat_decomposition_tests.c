@@ -0,0 +1,546 @@
+#include "jtest.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*
+  The decompositions are checked by multiplying the factors back together and
+  comparing the product to the input, the solvers by multiplying the solution by
+  the triangular matrix.  The inputs are built from a smooth deterministic matrix
+  B of full rank: B * B' + I is positive definite, B + B' is indefinite.  The sizes
+  cover the 6-state filters the decompositions are aimed at.
+*/
+
+#define MAT_DECOMP_MAX_DIM 8
+#define MAT_DECOMP_MAX_ELTS (MAT_DECOMP_MAX_DIM * MAT_DECOMP_MAX_DIM)
+#define MAT_DECOMP_NUM_RHS 3
+
+#define MAT_DECOMP_SNR_THRESHOLD_f32 100
+#define MAT_DECOMP_SNR_THRESHOLD_f64 250
+
+static const uint16_t mat_decomp_dims[] =
+{
+    1, 2, 3, 4, 6, 8
+};
+
+#define MAT_DECOMP_NUM_DIMS (sizeof(mat_decomp_dims) / sizeof(uint16_t))
+
+/* QR sizes, rows and columns */
+static const uint16_t mat_qr_dims[][2] =
+{
+    {1, 1}, {3, 2}, {4, 4}, {6, 3}, {6, 6}, {8, 5}
+};
+
+#define MAT_QR_NUM_DIMS (sizeof(mat_qr_dims) / sizeof(mat_qr_dims[0]))
+
+static float64_t mat_decomp_a[MAT_DECOMP_MAX_ELTS];
+static float64_t mat_decomp_b[MAT_DECOMP_MAX_ELTS];
+static float64_t mat_decomp_c[MAT_DECOMP_MAX_ELTS];
+static float64_t mat_decomp_ref[MAT_DECOMP_MAX_ELTS];
+static float64_t mat_decomp_fut[MAT_DECOMP_MAX_ELTS];
+static float32_t mat_decomp_ref_f32[MAT_DECOMP_MAX_ELTS];
+static float32_t mat_decomp_fut_f32[MAT_DECOMP_MAX_ELTS];
+static float32_t mat_decomp_aux_f32[MAT_DECOMP_MAX_ELTS];
+static float32_t mat_decomp_cmp_f32[MAT_DECOMP_MAX_ELTS];
+static float32_t mat_decomp_tau[MAT_DECOMP_MAX_DIM];
+static uint16_t mat_decomp_perm[MAT_DECOMP_MAX_DIM];
+
+/* There is no arm_mat_init_f64() */
+static void mat_decomp_init_f64(
+    arm_matrix_instance_f64 * S,
+    uint16_t nRows,
+    uint16_t nColumns,
+    float64_t * pData)
+{
+    S->numRows = nRows;
+    S->numCols = nColumns;
+    S->pData = pData;
+}
+
+#define mat_decomp_init_f32 arm_mat_init_f32
+
+/* Deterministic full rank matrix of numRows x numCols */
+static float64_t mat_decomp_elt(uint32_t i, uint32_t j)
+{
+    return sin(1.3 * i + 0.7 * j * j + 0.1) + ((i == j) ? 1.5 : 0.0);
+}
+
+/* A = B * B' + I if positive, B + B' otherwise, of size n x n, in double precision */
+static void mat_decomp_symmetric(float64_t * pDst, uint32_t n, uint32_t positive)
+{
+    uint32_t i, j, k;
+    float64_t sum;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            if (positive)
+            {
+                sum = (i == j) ? 1.0 : 0.0;
+
+                for (k = 0; k < n; k++)
+                {
+                    sum += mat_decomp_elt(i, k) * mat_decomp_elt(j, k);
+                }
+            }
+            else
+            {
+                sum = mat_decomp_elt(i, j) + mat_decomp_elt(j, i);
+            }
+
+            pDst[i * n + j] = sum;
+        }
+    }
+}
+
+/* C = A * B or A * B' (transB), with A m x k */
+static void mat_decomp_mult(
+    const float64_t * pA,
+    const float64_t * pB,
+    float64_t * pC,
+    uint32_t m,
+    uint32_t k,
+    uint32_t n,
+    uint32_t transB)
+{
+    uint32_t i, j, l;
+    float64_t sum;
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            sum = 0.0;
+
+            for (l = 0; l < k; l++)
+            {
+                sum += pA[i * k + l] * ((transB) ? pB[j * k + l] : pB[l * n + j]);
+            }
+
+            pC[i * n + j] = sum;
+        }
+    }
+}
+
+static void mat_decomp_to_f64(const float32_t * pSrc, float64_t * pDst, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        pDst[i] = (float64_t) pSrc[i];
+    }
+}
+
+static void mat_decomp_to_f32(const float64_t * pSrc, float32_t * pDst, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        pDst[i] = (float32_t) pSrc[i];
+    }
+}
+
+/* Compares a double precision product to the float32 input it should reproduce */
+#define MAT_DECOMP_ASSERT_F32(pProduct, pInput, numElts)                \
+    do                                                                  \
+    {                                                                   \
+        mat_decomp_to_f32(pProduct, mat_decomp_cmp_f32, numElts);       \
+        TEST_ASSERT_SNR(pInput, mat_decomp_cmp_f32, numElts,            \
+                        MAT_DECOMP_SNR_THRESHOLD_f32);                  \
+    } while (0)
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_f32_test, arm_mat_cholesky_f32)
+{
+    arm_matrix_instance_f32 src, dst;
+    uint32_t d, n, i, j;
+
+    for (d = 0; d < MAT_DECOMP_NUM_DIMS; d++)
+    {
+        n = mat_decomp_dims[d];
+
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);
+
+        mat_decomp_symmetric(mat_decomp_a, n, 1);
+        mat_decomp_to_f32(mat_decomp_a, mat_decomp_ref_f32, n * n);
+
+        /* In place */
+        memcpy(mat_decomp_fut_f32, mat_decomp_ref_f32, n * n * sizeof(float32_t));
+        arm_mat_init_f32(&src, n, n, mat_decomp_fut_f32);
+
+        JTEST_COUNT_CYCLES(
+            TEST_ASSERT_EQUAL(arm_mat_cholesky_f32(&src, &src), ARM_MATH_SUCCESS));
+
+        for (i = 0; i < n; i++)
+        {
+            TEST_ASSERT_EQUAL(mat_decomp_fut_f32[i * n + i] > 0.0f, 1);
+
+            for (j = i + 1; j < n; j++)
+            {
+                TEST_ASSERT_EQUAL(mat_decomp_fut_f32[i * n + j], 0.0f);
+            }
+        }
+
+        mat_decomp_to_f64(mat_decomp_fut_f32, mat_decomp_b, n * n);
+        mat_decomp_mult(mat_decomp_b, mat_decomp_b, mat_decomp_c, n, n, n, 1);
+
+        MAT_DECOMP_ASSERT_F32(mat_decomp_c, mat_decomp_ref_f32, n * n);
+
+        /* Shifting the spectrum below zero is detected */
+        for (i = 0; i < n; i++)
+        {
+            mat_decomp_ref_f32[i * n + i] -= 100.0f;
+        }
+
+        arm_mat_init_f32(&src, n, n, mat_decomp_ref_f32);
+        arm_mat_init_f32(&dst, n, n, mat_decomp_fut_f32);
+
+        TEST_ASSERT_EQUAL(arm_mat_cholesky_f32(&src, &dst), ARM_MATH_DECOMPOSITION_FAILURE);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_f64_test, arm_mat_cholesky_f64)
+{
+    arm_matrix_instance_f64 src, dst;
+    uint32_t d, n;
+
+    for (d = 0; d < MAT_DECOMP_NUM_DIMS; d++)
+    {
+        n = mat_decomp_dims[d];
+
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);
+
+        mat_decomp_symmetric(mat_decomp_a, n, 1);
+
+        mat_decomp_init_f64(&src, n, n, mat_decomp_a);
+        mat_decomp_init_f64(&dst, n, n, mat_decomp_b);
+
+        JTEST_COUNT_CYCLES(
+            TEST_ASSERT_EQUAL(arm_mat_cholesky_f64(&src, &dst), ARM_MATH_SUCCESS));
+
+        mat_decomp_mult(mat_decomp_b, mat_decomp_b, mat_decomp_c, n, n, n, 1);
+
+        TEST_ASSERT_DBL_SNR(mat_decomp_a, mat_decomp_c, n * n,
+                            MAT_DECOMP_SNR_THRESHOLD_f64);
+
+        /* The indefinite matrix is rejected */
+        mat_decomp_symmetric(mat_decomp_a, n, 0);
+        mat_decomp_a[0] = -1.0;
+
+        TEST_ASSERT_EQUAL(arm_mat_cholesky_f64(&src, &dst), ARM_MATH_DECOMPOSITION_FAILURE);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_ldlt_f32_test, arm_mat_ldlt_f32)
+{
+    arm_matrix_instance_f32 src, l, dm;
+    uint32_t d, n, i, j, k, rank, positive;
+    float32_t * pL = mat_decomp_fut_f32;
+    float32_t * pD = mat_decomp_aux_f32;
+    float64_t sum;
+
+    for (d = 0; d < MAT_DECOMP_NUM_DIMS; d++)
+    {
+        n = mat_decomp_dims[d];
+
+        /* Indefinite, then rank deficient positive semi-definite */
+        for (positive = 0; positive < 2; positive++)
+        {
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n"
+                            "Semi-definite: %d\n",
+                            (int)n, (int)n, (int)positive);
+
+            if (positive)
+            {
+                /* A = C * C' with C of n x rank */
+                rank = (n + 1) / 2;
+
+                for (i = 0; i < n; i++)
+                {
+                    for (j = 0; j < n; j++)
+                    {
+                        sum = 0.0;
+
+                        for (k = 0; k < rank; k++)
+                        {
+                            sum += mat_decomp_elt(i, k) * mat_decomp_elt(j, k);
+                        }
+
+                        mat_decomp_a[i * n + j] = sum;
+                    }
+                }
+            }
+            else
+            {
+                rank = n;
+                mat_decomp_symmetric(mat_decomp_a, n, 0);
+            }
+
+            mat_decomp_to_f32(mat_decomp_a, mat_decomp_ref_f32, n * n);
+
+            /* The upper triangle of the input is not read */
+            memcpy(pL, mat_decomp_ref_f32, n * n * sizeof(float32_t));
+
+            for (i = 0; i < n; i++)
+            {
+                for (j = i + 1; j < n; j++)
+                {
+                    pL[i * n + j] = 1000.0f;
+                }
+            }
+
+            arm_mat_init_f32(&src, n, n, pL);
+            arm_mat_init_f32(&l, n, n, pL);
+            arm_mat_init_f32(&dm, n, n, pD);
+
+            JTEST_COUNT_CYCLES(
+                TEST_ASSERT_EQUAL(arm_mat_ldlt_f32(&src, &l, &dm, mat_decomp_perm),
+                                  ARM_MATH_SUCCESS));
+
+            /* The number of non-zero pivots is the rank */
+            for (i = 0; i < n; i++)
+            {
+                TEST_ASSERT_EQUAL(pL[i * n + i], 1.0f);
+                TEST_ASSERT_EQUAL(fabsf(pD[i * n + i]) > 1e-4f, (i < rank));
+            }
+
+            /* (L * D * L')(i,j) = A(pp[i],pp[j]) */
+            for (i = 0; i < n; i++)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    sum = 0.0;
+
+                    for (k = 0; k < n; k++)
+                    {
+                        sum += (float64_t) pL[i * n + k] * pD[k * n + k] * pL[j * n + k];
+                    }
+
+                    mat_decomp_c[mat_decomp_perm[i] * n + mat_decomp_perm[j]] = sum;
+                }
+            }
+
+            MAT_DECOMP_ASSERT_F32(mat_decomp_c, mat_decomp_ref_f32, n * n);
+        }
+    }
+
+    /* No LDLT exists without 2x2 pivots */
+    mat_decomp_ref_f32[0] = 0.0f;
+    mat_decomp_ref_f32[1] = 1.0f;
+    mat_decomp_ref_f32[2] = 1.0f;
+    mat_decomp_ref_f32[3] = 0.0f;
+
+    arm_mat_init_f32(&src, 2, 2, mat_decomp_ref_f32);
+    arm_mat_init_f32(&l, 2, 2, pL);
+    arm_mat_init_f32(&dm, 2, 2, pD);
+
+    TEST_ASSERT_EQUAL(arm_mat_ldlt_f32(&src, &l, &dm, mat_decomp_perm),
+                      ARM_MATH_DECOMPOSITION_FAILURE);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_qr_f32_test, arm_mat_qr_f32)
+{
+    arm_matrix_instance_f32 src, r, q;
+    uint32_t d, m, n, i, j;
+    float32_t * pR = mat_decomp_fut_f32;
+    float32_t * pQ = mat_decomp_aux_f32;
+    float32_t * pA = mat_decomp_ref_f32;
+
+    for (d = 0; d < MAT_QR_NUM_DIMS; d++)
+    {
+        m = mat_qr_dims[d][0];
+        n = mat_qr_dims[d][1];
+
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)m, (int)n);
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                pA[i * n + j] = (float32_t) mat_decomp_elt(i, j);
+            }
+        }
+
+        /* In place */
+        memcpy(pR, pA, m * n * sizeof(float32_t));
+
+        arm_mat_init_f32(&src, m, n, pR);
+        arm_mat_init_f32(&r, m, n, pR);
+        arm_mat_init_f32(&q, m, m, pQ);
+
+        JTEST_COUNT_CYCLES(
+            TEST_ASSERT_EQUAL(arm_mat_qr_f32(&src, 1e-10f, &r, &q, mat_decomp_tau),
+                              ARM_MATH_SUCCESS));
+
+        /* Q * triu(R) */
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                mat_decomp_b[i * n + j] = (j >= i) ? pR[i * n + j] : 0.0;
+            }
+        }
+
+        mat_decomp_to_f64(pQ, mat_decomp_a, m * m);
+        mat_decomp_mult(mat_decomp_a, mat_decomp_b, mat_decomp_c, m, m, n, 0);
+
+        MAT_DECOMP_ASSERT_F32(mat_decomp_c, pA, m * n);
+
+        /* Q' * Q = I, compared through I + Q' * Q */
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < m; j++)
+            {
+                mat_decomp_b[i * m + j] = mat_decomp_a[j * m + i];
+                mat_decomp_fut[i * m + j] = (i == j) ? 2.0 : 1.0;
+            }
+        }
+
+        mat_decomp_mult(mat_decomp_b, mat_decomp_a, mat_decomp_c, m, m, m, 0);
+
+        for (i = 0; i < m * m; i++)
+        {
+            mat_decomp_c[i] += 1.0;
+        }
+
+        mat_decomp_to_f32(mat_decomp_fut, pA, m * m);
+        MAT_DECOMP_ASSERT_F32(mat_decomp_c, pA, m * m);
+
+        /* Without Q, R is unchanged */
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                pA[i * n + j] = (float32_t) mat_decomp_elt(i, j);
+            }
+        }
+
+        arm_mat_init_f32(&src, m, n, pA);
+
+        memcpy(pQ, pR, m * n * sizeof(float32_t));
+
+        TEST_ASSERT_EQUAL(arm_mat_qr_f32(&src, 1e-10f, &r, NULL, mat_decomp_tau),
+                          ARM_MATH_SUCCESS);
+
+        TEST_ASSERT_BUFFERS_EQUAL(pQ, pR, m * n * sizeof(float32_t));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Triangular solver test template.  Arguments are: function suffix (f32/f64),
+  matrix type and triangle (lower/upper).  The triangular matrix is the Cholesky
+  factor of a positive definite matrix, transposed for the upper solver, and the
+  system is solved in place.
+*/
+#define MAT_SOLVE_DEFINE_TEST(suffix, type, triangle)                           \
+    JTEST_DEFINE_TEST(arm_mat_solve_##triangle##_triangular_##suffix##_test,    \
+                      arm_mat_solve_##triangle##_triangular_##suffix)           \
+    {                                                                           \
+        arm_matrix_instance_##suffix t, x;                                      \
+        arm_matrix_instance_f64 chol;                                           \
+        type pT[MAT_DECOMP_MAX_ELTS];                                           \
+        type pX[MAT_DECOMP_MAX_DIM * MAT_DECOMP_NUM_RHS];                       \
+        uint32_t d, n, i, j, k, upper = (#triangle[0] == 'u');                  \
+        float64_t sum;                                                          \
+                                                                                \
+        for (d = 0; d < MAT_DECOMP_NUM_DIMS; d++)                               \
+        {                                                                       \
+            n = mat_decomp_dims[d];                                             \
+                                                                                \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);      \
+                                                                                \
+            mat_decomp_symmetric(mat_decomp_a, n, 1);                           \
+            mat_decomp_init_f64(&chol, n, n, mat_decomp_a);                     \
+            arm_mat_cholesky_f64(&chol, &chol);                                 \
+                                                                                \
+            for (i = 0; i < n; i++)                                             \
+            {                                                                   \
+                for (j = 0; j < n; j++)                                         \
+                {                                                               \
+                    pT[i * n + j] = (type) ((upper) ? mat_decomp_a[j * n + i] : \
+                                                      mat_decomp_a[i * n + j]); \
+                }                                                               \
+                                                                                \
+                for (j = 0; j < MAT_DECOMP_NUM_RHS; j++)                        \
+                {                                                               \
+                    mat_decomp_ref[i * MAT_DECOMP_NUM_RHS + j] =                \
+                        cos(0.9 * i - 1.7 * j);                                 \
+                    pX[i * MAT_DECOMP_NUM_RHS + j] =                            \
+                        (type) mat_decomp_ref[i * MAT_DECOMP_NUM_RHS + j];      \
+                }                                                               \
+            }                                                                   \
+                                                                                \
+            mat_decomp_init_##suffix(&t, n, n, pT);                             \
+            mat_decomp_init_##suffix(&x, n, MAT_DECOMP_NUM_RHS, pX);            \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                TEST_ASSERT_EQUAL(                                              \
+                    arm_mat_solve_##triangle##_triangular_##suffix(&t, &x, &x), \
+                    ARM_MATH_SUCCESS));                                         \
+                                                                                \
+            /* T * X = A */                                                     \
+            for (i = 0; i < n; i++)                                             \
+            {                                                                   \
+                for (j = 0; j < MAT_DECOMP_NUM_RHS; j++)                        \
+                {                                                               \
+                    sum = 0.0;                                                  \
+                                                                                \
+                    for (k = 0; k < n; k++)                                     \
+                    {                                                           \
+                        sum += (float64_t) pT[i * n + k] *                      \
+                               pX[k * MAT_DECOMP_NUM_RHS + j];                  \
+                    }                                                           \
+                                                                                \
+                    mat_decomp_fut[i * MAT_DECOMP_NUM_RHS + j] = sum;           \
+                }                                                               \
+            }                                                                   \
+                                                                                \
+            TEST_ASSERT_DBL_SNR(mat_decomp_ref, mat_decomp_fut,                 \
+                                n * MAT_DECOMP_NUM_RHS,                         \
+                                MAT_DECOMP_SNR_THRESHOLD_##suffix);             \
+                                                                                \
+            /* A zero on the diagonal is detected */                            \
+            pT[(n - 1) * n + n - 1] = 0;                                        \
+                                                                                \
+            TEST_ASSERT_EQUAL(                                                  \
+                arm_mat_solve_##triangle##_triangular_##suffix(&t, &x, &x),     \
+                ARM_MATH_SINGULAR);                                             \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MAT_SOLVE_DEFINE_TEST(f32, float32_t, lower);
+MAT_SOLVE_DEFINE_TEST(f32, float32_t, upper);
+MAT_SOLVE_DEFINE_TEST(f64, float64_t, lower);
+MAT_SOLVE_DEFINE_TEST(f64, float64_t, upper);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_decomposition_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f32_test);
+    JTEST_TEST_CALL(arm_mat_qr_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f64_test);
+}
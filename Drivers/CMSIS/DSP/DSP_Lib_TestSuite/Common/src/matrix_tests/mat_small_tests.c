@@ -0,0 +1,242 @@
+#include "jtest.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*
+  The fixed-size kernels are compared to the reference functions on the
+  matrix instances of the same data, for all the sizes from 2x2 to 6x6.  The
+  sweep benchmark dumps the cycles of the generic functions next to the cycles
+  of the kernels.
+*/
+
+#define MAT_SMALL_MIN_DIM 2
+#define MAT_SMALL_MAX_DIM 6
+#define MAT_SMALL_MAX_ELTS (MAT_SMALL_MAX_DIM * MAT_SMALL_MAX_DIM)
+#define MAT_SMALL_NUM_DIMS (MAT_SMALL_MAX_DIM - MAT_SMALL_MIN_DIM + 1)
+
+typedef void (*mat_small_binary_fn)(const float32_t *, const float32_t *, float32_t *);
+typedef arm_status (*mat_small_inverse_fn)(const float32_t *, float32_t *);
+
+static const mat_small_binary_fn mat_small_mult_fns[MAT_SMALL_NUM_DIMS] =
+{
+    arm_mat_mult_2x2_f32, arm_mat_mult_3x3_f32, arm_mat_mult_4x4_f32,
+    arm_mat_mult_5x5_f32, arm_mat_mult_6x6_f32
+};
+
+static const mat_small_binary_fn mat_small_mult_trans_fns[MAT_SMALL_NUM_DIMS] =
+{
+    arm_mat_mult_trans_2x2_f32, arm_mat_mult_trans_3x3_f32, arm_mat_mult_trans_4x4_f32,
+    arm_mat_mult_trans_5x5_f32, arm_mat_mult_trans_6x6_f32
+};
+
+static const mat_small_binary_fn mat_small_vec_mult_fns[MAT_SMALL_NUM_DIMS] =
+{
+    arm_mat_vec_mult_2x2_f32, arm_mat_vec_mult_3x3_f32, arm_mat_vec_mult_4x4_f32,
+    arm_mat_vec_mult_5x5_f32, arm_mat_vec_mult_6x6_f32
+};
+
+static const mat_small_binary_fn mat_small_add_fns[MAT_SMALL_NUM_DIMS] =
+{
+    arm_mat_add_2x2_f32, arm_mat_add_3x3_f32, arm_mat_add_4x4_f32,
+    arm_mat_add_5x5_f32, arm_mat_add_6x6_f32
+};
+
+static const mat_small_inverse_fn mat_small_inverse_fns[MAT_SMALL_NUM_DIMS] =
+{
+    arm_mat_inverse_2x2_f32, arm_mat_inverse_3x3_f32, arm_mat_inverse_4x4_f32,
+    arm_mat_inverse_5x5_f32, arm_mat_inverse_6x6_f32
+};
+
+static float32_t mat_small_a[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_b[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_t[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_fut[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_ref[MAT_SMALL_MAX_ELTS];
+
+/* Well conditioned deterministic inputs of size n x n */
+static void mat_small_inputs(uint32_t n)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            mat_small_a[i * n + j] = (float32_t) (sin(1.1 * i + 0.4 * j * j + 0.3) +
+                                                  ((i == j) ? 2.0 : 0.0));
+            mat_small_b[i * n + j] = (float32_t) cos(0.7 * i - 1.9 * j);
+        }
+    }
+}
+
+/*
+  Binary kernel test template.  Arguments are: operation name and the
+  reference computation, which reads the instances srcA and srcB and writes
+  the instance ref.
+*/
+#define MAT_SMALL_DEFINE_TEST(op, ref_call)                                     \
+    JTEST_DEFINE_TEST(arm_mat_##op##_small_f32_test,                            \
+                      arm_mat_##op##_NxN_f32)                                   \
+    {                                                                           \
+        arm_matrix_instance_f32 srcA, srcB, tmp, ref;                           \
+        uint32_t n, numOut;                                                     \
+                                                                                \
+        for (n = MAT_SMALL_MIN_DIM; n <= MAT_SMALL_MAX_DIM; n++)                \
+        {                                                                       \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);      \
+                                                                                \
+            mat_small_inputs(n);                                                \
+                                                                                \
+            arm_mat_init_f32(&srcA, n, n, mat_small_a);                         \
+            arm_mat_init_f32(&srcB, n, n, mat_small_b);                         \
+            arm_mat_init_f32(&tmp, n, n, mat_small_t);                          \
+            arm_mat_init_f32(&ref, n, n, mat_small_ref);                        \
+            numOut = n * n;                                                     \
+                                                                                \
+            ref_call;                                                           \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                mat_small_##op##_fns[n - MAT_SMALL_MIN_DIM](                    \
+                    mat_small_a, mat_small_b, mat_small_fut));                  \
+                                                                                \
+            TEST_ASSERT_SNR(mat_small_ref, mat_small_fut, numOut,               \
+                            MATRIX_SNR_THRESHOLD);                              \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MAT_SMALL_DEFINE_TEST(mult,
+                      ref_mat_mult_f32(&srcA, &srcB, &ref));
+
+MAT_SMALL_DEFINE_TEST(mult_trans,
+                      ref_mat_trans_f32(&srcB, &tmp);
+                      ref_mat_mult_f32(&srcA, &tmp, &ref));
+
+/* The vector is the first row of the second input */
+MAT_SMALL_DEFINE_TEST(vec_mult,
+                      srcB.numRows = 1;
+                      tmp.numCols = 1;
+                      ref.numCols = 1;
+                      ref_mat_trans_f32(&srcB, &tmp);
+                      ref_mat_mult_f32(&srcA, &tmp, &ref);
+                      numOut = n);
+
+MAT_SMALL_DEFINE_TEST(add,
+                      ref_mat_add_f32(&srcA, &srcB, &ref));
+
+JTEST_DEFINE_TEST(arm_mat_inverse_small_f32_test, arm_mat_inverse_NxN_f32)
+{
+    arm_matrix_instance_f32 src, ref;
+    uint32_t n;
+
+    for (n = MAT_SMALL_MIN_DIM; n <= MAT_SMALL_MAX_DIM; n++)
+    {
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);
+
+        mat_small_inputs(n);
+
+        /* ref_mat_inverse_f32() modifies its input */
+        memcpy(mat_small_t, mat_small_a, n * n * sizeof(float32_t));
+
+        arm_mat_init_f32(&src, n, n, mat_small_t);
+        arm_mat_init_f32(&ref, n, n, mat_small_ref);
+
+        ref_mat_inverse_f32(&src, &ref);
+
+        JTEST_COUNT_CYCLES(
+            TEST_ASSERT_EQUAL(
+                mat_small_inverse_fns[n - MAT_SMALL_MIN_DIM](mat_small_a, mat_small_fut),
+                ARM_MATH_SUCCESS));
+
+        TEST_ASSERT_SNR(mat_small_ref, mat_small_fut, n * n, MATRIX_SNR_THRESHOLD);
+
+        /* In place */
+        TEST_ASSERT_EQUAL(
+            mat_small_inverse_fns[n - MAT_SMALL_MIN_DIM](mat_small_a, mat_small_a),
+            ARM_MATH_SUCCESS);
+
+        TEST_ASSERT_BUFFERS_EQUAL(mat_small_a, mat_small_fut, n * n * sizeof(float32_t));
+
+        /* A zero row */
+        mat_small_inputs(n);
+        memset(mat_small_a + n, 0, n * sizeof(float32_t));
+
+        TEST_ASSERT_EQUAL(
+            mat_small_inverse_fns[n - MAT_SMALL_MIN_DIM](mat_small_a, mat_small_fut),
+            ARM_MATH_SINGULAR);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/* Cycles of the generic functions and of the kernels, for all the sizes */
+JTEST_DEFINE_TEST(arm_mat_small_f32_benchmark_test, arm_mat_mult_NxN_f32)
+{
+    arm_matrix_instance_f32 srcA, srcB, dst;
+    uint32_t n, genericCycles, kernelCycles;
+
+    for (n = MAT_SMALL_MIN_DIM; n <= MAT_SMALL_MAX_DIM; n++)
+    {
+        mat_small_inputs(n);
+
+        arm_mat_init_f32(&srcA, n, n, mat_small_a);
+        arm_mat_init_f32(&srcB, n, n, mat_small_b);
+        arm_mat_init_f32(&dst, n, n, mat_small_fut);
+
+        JTEST_MEASURE_CYCLES(genericCycles, arm_mat_mult_f32(&srcA, &srcB, &dst));
+        JTEST_MEASURE_CYCLES(kernelCycles,
+                             mat_small_mult_fns[n - MAT_SMALL_MIN_DIM](
+                                 mat_small_a, mat_small_b, mat_small_fut));
+
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n"
+                        "arm_mat_mult_f32 Cycles: %d\n"
+                        "arm_mat_mult_NxN_f32 Cycles: %d\n",
+                        (int)n, (int)n, (int)genericCycles, (int)kernelCycles);
+
+        JTEST_MEASURE_CYCLES(genericCycles, arm_mat_add_f32(&srcA, &srcB, &dst));
+        JTEST_MEASURE_CYCLES(kernelCycles,
+                             mat_small_add_fns[n - MAT_SMALL_MIN_DIM](
+                                 mat_small_a, mat_small_b, mat_small_fut));
+
+        JTEST_DUMP_STRF("arm_mat_add_f32 Cycles: %d\n"
+                        "arm_mat_add_NxN_f32 Cycles: %d\n",
+                        (int)genericCycles, (int)kernelCycles);
+
+        /* arm_mat_inverse_f32() modifies its input */
+        memcpy(mat_small_t, mat_small_a, n * n * sizeof(float32_t));
+        arm_mat_init_f32(&srcB, n, n, mat_small_t);
+
+        JTEST_MEASURE_CYCLES(genericCycles, arm_mat_inverse_f32(&srcB, &dst));
+        JTEST_MEASURE_CYCLES(kernelCycles,
+                             mat_small_inverse_fns[n - MAT_SMALL_MIN_DIM](
+                                 mat_small_a, mat_small_fut));
+
+        JTEST_DUMP_STRF("arm_mat_inverse_f32 Cycles: %d\n"
+                        "arm_mat_inverse_NxN_f32 Cycles: %d\n",
+                        (int)genericCycles, (int)kernelCycles);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_small_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_mult_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_trans_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_add_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_inverse_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_small_f32_benchmark_test);
+}
@@ -0,0 +1,418 @@
+#include "jtest.h"
+#include "support_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "arm_batch.h"
+#include "arm_const_structs.h"
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "support_templates.h"
+#include "type_abbrev.h"
+#include <string.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Multi-Threaded Batch Processing */
+/*--------------------------------------------------------------------------------*/
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+#define BATCH_MAX_TASKS    100
+#define BATCH_CHANNELS     7
+#define BATCH_BLOCK        64
+#define BATCH_FIR_TAPS     29
+#define BATCH_BIQUAD       3
+#define BATCH_FFT_LEN      256
+
+static const uint32_t batch_threads[] = { 1, 3, 8 };
+static const uint32_t batch_tasks[] = { 0, 1, 2, 5, BATCH_MAX_TASKS };
+
+#define BATCH_NUM_THREADS (sizeof(batch_threads) / sizeof(batch_threads[0]))
+#define BATCH_NUM_TASKS   (sizeof(batch_tasks) / sizeof(batch_tasks[0]))
+
+static uint32_t batch_runs[BATCH_MAX_TASKS];
+static float32_t batch_src[BATCH_CHANNELS * 2 * BATCH_FFT_LEN];
+static float32_t batch_tmp[BATCH_CHANNELS * 2 * BATCH_FFT_LEN];
+static float32_t batch_fut[BATCH_CHANNELS * 2 * BATCH_FFT_LEN];
+static float32_t batch_ref[BATCH_CHANNELS * 2 * BATCH_FFT_LEN];
+static float32_t batch_coeffs[BATCH_FIR_TAPS];
+static float32_t batch_fir_state[2][BATCH_CHANNELS][BATCH_FIR_TAPS + BATCH_BLOCK - 1];
+static float32_t batch_biquad_state[2][BATCH_CHANNELS][2 * BATCH_BIQUAD];
+static arm_fir_instance_f32 batch_fir[2][BATCH_CHANNELS];
+static arm_biquad_cascade_df2T_instance_f32 batch_biquad[2][BATCH_CHANNELS];
+
+/* Stable low-pass sections, different for each stage */
+static float32_t batch_biquad_coeffs[5 * BATCH_BIQUAD] =
+{
+    0.2929f, 0.5858f, 0.2929f, 0.0000f, -0.1716f,
+    0.0976f, 0.1953f, 0.0976f, 0.9428f, -0.3333f,
+    0.4208f, 0.8416f, 0.4208f, -0.5193f, -0.1639f
+};
+
+/* Uniform noise in [-1 1), the same sequence on every target */
+static float32_t batch_rand(uint32_t * pSeed)
+{
+    *pSeed = *pSeed * 1664525U + 1013904223U;
+
+    return (float32_t) (int32_t) *pSeed / 2147483648.0f;
+}
+
+static void batch_make_inputs(uint32_t seed)
+{
+    uint32_t n;
+
+    for (n = 0; n < BATCH_CHANNELS * 2 * BATCH_FFT_LEN; n++)
+    {
+        batch_src[n] = batch_rand(&seed);
+    }
+
+    for (n = 0; n < BATCH_FIR_TAPS; n++)
+    {
+        batch_coeffs[n] = batch_rand(&seed) / BATCH_FIR_TAPS;
+    }
+}
+
+/* Counts the runs of each index and checks the scratch buffer */
+static void batch_count_task(
+    void * pArg,
+    uint32_t index,
+    float32_t * pScratch)
+{
+    uint32_t * pRuns = (uint32_t *) pArg;
+
+    pRuns[index] += (pScratch != NULL) ? 1U : 1000U;
+}
+
+JTEST_DEFINE_TEST(arm_batch_init_test,
+                  arm_batch_init)
+{
+    arm_batch_instance batch_inst;
+
+    TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, 0, 16, 0),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    /* A pool can be released and initialized again */
+    TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, 4, 16, 1),
+                      ARM_MATH_SUCCESS);
+    arm_batch_deinit(&batch_inst);
+
+    TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, 2, 0, 0),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(batch_inst.pWorkers[1].pScratch, NULL);
+    arm_batch_deinit(&batch_inst);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Every index must run exactly once, including with fewer tasks than threads,
+  and several batches must run on the same pool.
+*/
+JTEST_DEFINE_TEST(arm_batch_run_test,
+                  arm_batch_run)
+{
+    arm_batch_instance batch_inst;
+    uint32_t t, k, n, repeat;
+
+    for (t = 0; t < BATCH_NUM_THREADS; t++)
+    {
+        TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, batch_threads[t], 16, 0),
+                          ARM_MATH_SUCCESS);
+
+        for (repeat = 0; repeat < 20; repeat++)
+        {
+            for (k = 0; k < BATCH_NUM_TASKS; k++)
+            {
+                memset(batch_runs, 0, sizeof(batch_runs));
+
+                arm_batch_run(&batch_inst, batch_count_task, batch_runs,
+                              batch_tasks[k]);
+
+                for (n = 0; n < BATCH_MAX_TASKS; n++)
+                {
+                    if (batch_runs[n] != ((n < batch_tasks[k]) ? 1U : 0U))
+                    {
+                        JTEST_DUMP_STRF("Threads: %d Tasks: %d Index: %d Runs: %d\n",
+                                        (int)batch_threads[t],
+                                        (int)batch_tasks[k],
+                                        (int)n,
+                                        (int)batch_runs[n]);
+                        arm_batch_deinit(&batch_inst);
+                        return JTEST_TEST_FAILED;
+                    }
+                }
+            }
+        }
+
+        arm_batch_deinit(&batch_inst);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_batch_first_touch_test,
+                  arm_batch_first_touch)
+{
+    arm_batch_instance batch_inst;
+    uint32_t n;
+
+    TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, 3, 0, 0),
+                      ARM_MATH_SUCCESS);
+
+    arm_fill_f32(1.0f, batch_fut, BATCH_CHANNELS * BATCH_BLOCK + 1);
+
+    arm_batch_first_touch(&batch_inst, batch_fut, BATCH_BLOCK, BATCH_CHANNELS);
+
+    arm_batch_deinit(&batch_inst);
+
+    for (n = 0; n < BATCH_CHANNELS * BATCH_BLOCK; n++)
+    {
+        TEST_ASSERT_EQUAL(batch_fut[n], 0.0f);
+    }
+
+    /* Past the last channel */
+    TEST_ASSERT_EQUAL(batch_fut[n], 1.0f);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The channels of the batch functions must be bit-exact with the channels
+  processed one after the other.  Two blocks are filtered, so that the
+  state of each channel is carried over.
+*/
+JTEST_DEFINE_TEST(arm_batch_fir_f32_test,
+                  arm_batch_fir_f32)
+{
+    arm_batch_instance batch_inst;
+    uint32_t t, c, block;
+
+    batch_make_inputs(1U);
+
+    for (t = 0; t < BATCH_NUM_THREADS; t++)
+    {
+        JTEST_DUMP_STRF("Threads: %d\n",
+                        (int)batch_threads[t]);
+
+        TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, batch_threads[t], 0, 0),
+                          ARM_MATH_SUCCESS);
+
+        for (c = 0; c < BATCH_CHANNELS; c++)
+        {
+            arm_fir_init_f32(&batch_fir[0][c], BATCH_FIR_TAPS, batch_coeffs,
+                             batch_fir_state[0][c], BATCH_BLOCK);
+            arm_fir_init_f32(&batch_fir[1][c], BATCH_FIR_TAPS, batch_coeffs,
+                             batch_fir_state[1][c], BATCH_BLOCK);
+        }
+
+        for (block = 0; block < 2; block++)
+        {
+            JTEST_COUNT_CYCLES(
+                arm_batch_fir_f32(&batch_inst, batch_fir[0],
+                                  batch_src + block * BATCH_CHANNELS * BATCH_BLOCK,
+                                  batch_fut, BATCH_CHANNELS, BATCH_BLOCK));
+
+            for (c = 0; c < BATCH_CHANNELS; c++)
+            {
+                arm_fir_f32(&batch_fir[1][c],
+                            batch_src + (block * BATCH_CHANNELS + c) * BATCH_BLOCK,
+                            batch_ref + c * BATCH_BLOCK, BATCH_BLOCK);
+            }
+
+            if (memcmp(batch_fut, batch_ref,
+                       BATCH_CHANNELS * BATCH_BLOCK * sizeof(float32_t)) != 0)
+            {
+                arm_batch_deinit(&batch_inst);
+                return JTEST_TEST_FAILED;
+            }
+        }
+
+        arm_batch_deinit(&batch_inst);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_batch_biquad_cascade_df2T_f32_test,
+                  arm_batch_biquad_cascade_df2T_f32)
+{
+    arm_batch_instance batch_inst;
+    uint32_t t, c, block;
+
+    batch_make_inputs(2U);
+
+    for (t = 0; t < BATCH_NUM_THREADS; t++)
+    {
+        JTEST_DUMP_STRF("Threads: %d\n",
+                        (int)batch_threads[t]);
+
+        TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, batch_threads[t], 0, 0),
+                          ARM_MATH_SUCCESS);
+
+        for (c = 0; c < BATCH_CHANNELS; c++)
+        {
+            arm_biquad_cascade_df2T_init_f32(&batch_biquad[0][c], BATCH_BIQUAD,
+                                             batch_biquad_coeffs,
+                                             batch_biquad_state[0][c]);
+            arm_biquad_cascade_df2T_init_f32(&batch_biquad[1][c], BATCH_BIQUAD,
+                                             batch_biquad_coeffs,
+                                             batch_biquad_state[1][c]);
+        }
+
+        for (block = 0; block < 2; block++)
+        {
+            JTEST_COUNT_CYCLES(
+                arm_batch_biquad_cascade_df2T_f32(
+                    &batch_inst, batch_biquad[0],
+                    batch_src + block * BATCH_CHANNELS * BATCH_BLOCK,
+                    batch_fut, BATCH_CHANNELS, BATCH_BLOCK));
+
+            for (c = 0; c < BATCH_CHANNELS; c++)
+            {
+                arm_biquad_cascade_df2T_f32(
+                    &batch_biquad[1][c],
+                    batch_src + (block * BATCH_CHANNELS + c) * BATCH_BLOCK,
+                    batch_ref + c * BATCH_BLOCK, BATCH_BLOCK);
+            }
+
+            if (memcmp(batch_fut, batch_ref,
+                       BATCH_CHANNELS * BATCH_BLOCK * sizeof(float32_t)) != 0)
+            {
+                arm_batch_deinit(&batch_inst);
+                return JTEST_TEST_FAILED;
+            }
+        }
+
+        arm_batch_deinit(&batch_inst);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_batch_cfft_f32_test,
+                  arm_batch_cfft_f32)
+{
+    arm_batch_instance batch_inst;
+    uint32_t t, c;
+    uint8_t ifftFlag;
+
+    batch_make_inputs(3U);
+
+    for (t = 0; t < BATCH_NUM_THREADS; t++)
+    {
+        TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, batch_threads[t], 0, 0),
+                          ARM_MATH_SUCCESS);
+
+        for (ifftFlag = 0; ifftFlag < 2; ifftFlag++)
+        {
+            JTEST_DUMP_STRF("Threads: %d\n"
+                            "Inverse: %d\n",
+                            (int)batch_threads[t],
+                            (int)ifftFlag);
+
+            memcpy(batch_fut, batch_src, sizeof(batch_src));
+            memcpy(batch_ref, batch_src, sizeof(batch_src));
+
+            JTEST_COUNT_CYCLES(
+                arm_batch_cfft_f32(&batch_inst, &arm_cfft_sR_f32_len256,
+                                   batch_fut, BATCH_CHANNELS, ifftFlag, 1));
+
+            for (c = 0; c < BATCH_CHANNELS; c++)
+            {
+                arm_cfft_f32(&arm_cfft_sR_f32_len256,
+                             batch_ref + c * 2 * BATCH_FFT_LEN, ifftFlag, 1);
+            }
+
+            if (memcmp(batch_fut, batch_ref, sizeof(batch_src)) != 0)
+            {
+                arm_batch_deinit(&batch_inst);
+                return JTEST_TEST_FAILED;
+            }
+        }
+
+        arm_batch_deinit(&batch_inst);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_batch_rfft_fast_f32_test,
+                  arm_batch_rfft_fast_f32)
+{
+    arm_batch_instance batch_inst;
+    arm_rfft_fast_instance_f32 rfft_inst;
+    uint32_t t, c;
+    uint8_t ifftFlag;
+
+    batch_make_inputs(4U);
+
+    TEST_ASSERT_EQUAL(arm_rfft_fast_init_f32(&rfft_inst, BATCH_FFT_LEN),
+                      ARM_MATH_SUCCESS);
+
+    for (t = 0; t < BATCH_NUM_THREADS; t++)
+    {
+        TEST_ASSERT_EQUAL(arm_batch_init(&batch_inst, batch_threads[t],
+                                         BATCH_FFT_LEN, 0),
+                          ARM_MATH_SUCCESS);
+
+        for (ifftFlag = 0; ifftFlag < 2; ifftFlag++)
+        {
+            JTEST_DUMP_STRF("Threads: %d\n"
+                            "Inverse: %d\n",
+                            (int)batch_threads[t],
+                            (int)ifftFlag);
+
+            memcpy(batch_tmp, batch_src, sizeof(batch_src));
+
+            JTEST_COUNT_CYCLES(
+                arm_batch_rfft_fast_f32(&batch_inst, &rfft_inst, batch_tmp,
+                                        batch_fut, BATCH_CHANNELS, ifftFlag));
+
+            /* The input is left unchanged */
+            if (memcmp(batch_tmp, batch_src, sizeof(batch_src)) != 0)
+            {
+                arm_batch_deinit(&batch_inst);
+                return JTEST_TEST_FAILED;
+            }
+
+            for (c = 0; c < BATCH_CHANNELS; c++)
+            {
+                arm_rfft_fast_f32(&rfft_inst, batch_tmp + c * BATCH_FFT_LEN,
+                                  batch_ref + c * BATCH_FFT_LEN, ifftFlag);
+            }
+
+            if (memcmp(batch_fut, batch_ref,
+                       BATCH_CHANNELS * BATCH_FFT_LEN * sizeof(float32_t)) != 0)
+            {
+                arm_batch_deinit(&batch_inst);
+                return JTEST_TEST_FAILED;
+            }
+        }
+
+        arm_batch_deinit(&batch_inst);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(batch_tests)
+{
+    /*
+      To skip a test, comment it out.
+      The batch functions are only available on POSIX hosts.
+    */
+#if defined (ARM_BATCH_AVAILABLE)
+    JTEST_TEST_CALL(arm_batch_init_test);
+    JTEST_TEST_CALL(arm_batch_run_test);
+    JTEST_TEST_CALL(arm_batch_first_touch_test);
+    JTEST_TEST_CALL(arm_batch_fir_f32_test);
+    JTEST_TEST_CALL(arm_batch_biquad_cascade_df2T_f32_test);
+    JTEST_TEST_CALL(arm_batch_cfft_f32_test);
+    JTEST_TEST_CALL(arm_batch_rfft_fast_f32_test);
+#endif
+}
@@ -0,0 +1,407 @@
+#include "jtest.h"
+#include "support_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "arm_const_structs.h"
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "support_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Implementation Plans */
+/*--------------------------------------------------------------------------------*/
+
+#define PLAN_MAX_ENTRIES 8
+#define PLAN_CONV_LEN    64
+#define PLAN_FIR_TAPS    32
+#define PLAN_FIR_BLOCK   64
+#define PLAN_MAT_SIZE    8
+#define PLAN_FFT_LEN     256
+
+static arm_plan_entry plan_entries[PLAN_MAX_ENTRIES];
+static arm_plan_entry plan_entries2[PLAN_MAX_ENTRIES];
+static uint32_t plan_words[ARM_PLAN_EXPORT_WORDS(PLAN_MAX_ENTRIES)];
+
+static q15_t plan_a_q15[2 * PLAN_FFT_LEN];
+static q15_t plan_b_q15[2 * PLAN_FFT_LEN];
+static q15_t plan_fut_q15[2 * PLAN_FFT_LEN];
+static q15_t plan_ref_q15[2 * PLAN_FFT_LEN];
+static q15_t plan_scratch1[3 * PLAN_CONV_LEN];
+static q15_t plan_scratch2[PLAN_CONV_LEN];
+/* arm_fir_fast_q15() reads a few samples past the end of its state */
+static q15_t plan_fir_state[PLAN_FIR_TAPS + PLAN_FIR_BLOCK + 4];
+static float32_t plan_src_f32[2 * PLAN_FFT_LEN];
+static float32_t plan_buf_f32[2 * PLAN_FFT_LEN];
+static float32_t plan_ref_f32[2 * PLAN_FFT_LEN];
+
+/*
+  Scripted cycle counter: the implementations are timed in a fixed order, two
+  reads per run, so the n-th timed implementation costs plan_costs[n] cycles.
+  This makes the selection independent of the speed of the test target.
+*/
+static const uint32_t * plan_costs;
+static uint32_t plan_reads;
+static uint32_t plan_time;
+
+static uint32_t plan_timer(void)
+{
+    plan_reads++;
+
+    if ((plan_reads & 1U) == 0U)
+    {
+        plan_time += plan_costs[(plan_reads - 1U) / (2U * ARM_PLAN_NUM_RUNS)];
+    }
+
+    return plan_time;
+}
+
+static void plan_set_costs(const uint32_t * pCosts)
+{
+    plan_costs = pCosts;
+    plan_reads = 0;
+}
+
+/* Uniform noise in [-1 1), the same sequence on every target */
+static float32_t plan_rand(uint32_t * pSeed)
+{
+    *pSeed = *pSeed * 1664525U + 1013904223U;
+
+    return (float32_t) (int32_t) *pSeed / 2147483648.0f;
+}
+
+/* Q15 noise with the given amplitude in plan_a_q15 and plan_b_q15 */
+static void plan_make_q15(float32_t amplitude)
+{
+    uint32_t seed = 1U;
+    uint32_t n;
+
+    for (n = 0; n < 2 * PLAN_FFT_LEN; n++)
+    {
+        plan_a_q15[n] = (q15_t) (amplitude * plan_rand(&seed) * 32767.0f);
+        plan_b_q15[n] = (q15_t) (amplitude * plan_rand(&seed) * 32767.0f);
+    }
+}
+
+/*
+  On small inputs all the convolutions give the same results and the one
+  reported fastest is selected.  On full scale inputs the fast versions
+  overflow and only the exact ones are accepted.
+*/
+JTEST_DEFINE_TEST(arm_plan_tune_conv_q15_test,
+                  arm_plan_tune_conv_q15)
+{
+    static const uint32_t costs[] = { 400, 300, 200, 100 };
+    arm_plan_instance plan;
+    uint32_t n;
+
+    arm_plan_init(&plan, plan_entries, PLAN_MAX_ENTRIES, plan_timer, 0.0f);
+
+    plan_make_q15(1.0f / 64.0f);
+    plan_set_costs(costs);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_conv_q15(&plan, plan_a_q15, PLAN_CONV_LEN,
+                               plan_b_q15, PLAN_CONV_LEN / 2,
+                               plan_fut_q15, plan_ref_q15,
+                               plan_scratch1, plan_scratch2),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CONV_Q15, PLAN_CONV_LEN,
+                                      PLAN_CONV_LEN / 2),
+                      ARM_PLAN_VARIANT_FAST_OPT);
+    TEST_ASSERT_EQUAL(plan.pEntries[0].cycles, 100);
+
+    plan_make_q15(1.0f);
+    plan_set_costs(costs);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_conv_q15(&plan, plan_a_q15, PLAN_CONV_LEN,
+                               plan_b_q15, PLAN_CONV_LEN / 2,
+                               plan_fut_q15, plan_ref_q15,
+                               plan_scratch1, plan_scratch2),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(plan.numEntries, 1);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CONV_Q15, PLAN_CONV_LEN,
+                                      PLAN_CONV_LEN / 2),
+                      ARM_PLAN_VARIANT_OPT);
+
+    /* The dispatched convolution gives the exact results */
+    JTEST_COUNT_CYCLES(
+        arm_plan_conv_q15(&plan, plan_a_q15, PLAN_CONV_LEN,
+                          plan_b_q15, PLAN_CONV_LEN / 2, plan_fut_q15,
+                          plan_scratch1, plan_scratch2));
+    arm_conv_q15(plan_a_q15, PLAN_CONV_LEN, plan_b_q15, PLAN_CONV_LEN / 2,
+                 plan_ref_q15);
+
+    for (n = 0; n < PLAN_CONV_LEN + PLAN_CONV_LEN / 2 - 1; n++)
+    {
+        TEST_ASSERT_EQUAL(plan_fut_q15[n], plan_ref_q15[n]);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_plan_tune_fir_q15_test,
+                  arm_plan_tune_fir_q15)
+{
+    static const uint32_t fastCosts[] = { 100, 50 };
+    static const uint32_t slowCosts[] = { 50, 100 };
+    arm_plan_instance plan;
+    arm_fir_instance_q15 fir;
+    uint32_t n;
+
+    arm_plan_init(&plan, plan_entries, PLAN_MAX_ENTRIES, plan_timer, 0.0f);
+    plan_make_q15(1.0f / 16.0f);
+
+    TEST_ASSERT_EQUAL(arm_fir_init_q15(&fir, PLAN_FIR_TAPS, plan_b_q15,
+                                       plan_fir_state, PLAN_FIR_BLOCK),
+                      ARM_MATH_SUCCESS);
+
+    plan_set_costs(slowCosts);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_fir_q15(&plan, &fir, plan_a_q15, plan_fut_q15,
+                              plan_ref_q15, PLAN_FIR_BLOCK),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_FIR_Q15, PLAN_FIR_TAPS,
+                                      PLAN_FIR_BLOCK),
+                      ARM_PLAN_VARIANT_DEFAULT);
+
+    plan_set_costs(fastCosts);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_fir_q15(&plan, &fir, plan_a_q15, plan_fut_q15,
+                              plan_ref_q15, PLAN_FIR_BLOCK),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_FIR_Q15, PLAN_FIR_TAPS,
+                                      PLAN_FIR_BLOCK),
+                      ARM_PLAN_VARIANT_FAST);
+
+    /* The state is cleared after tuning, two blocks through the plan */
+    arm_plan_fir_q15(&plan, &fir, plan_a_q15, plan_fut_q15, PLAN_FIR_BLOCK);
+    JTEST_COUNT_CYCLES(
+        arm_plan_fir_q15(&plan, &fir, plan_a_q15 + PLAN_FIR_BLOCK,
+                         plan_fut_q15 + PLAN_FIR_BLOCK, PLAN_FIR_BLOCK));
+
+    arm_fill_q15(0, plan_fir_state, PLAN_FIR_TAPS + PLAN_FIR_BLOCK - 1);
+    arm_fir_q15(&fir, plan_a_q15, plan_ref_q15, PLAN_FIR_BLOCK);
+    arm_fir_q15(&fir, plan_a_q15 + PLAN_FIR_BLOCK,
+                plan_ref_q15 + PLAN_FIR_BLOCK, PLAN_FIR_BLOCK);
+
+    for (n = 0; n < 2 * PLAN_FIR_BLOCK; n++)
+    {
+        TEST_ASSERT_EQUAL(plan_fut_q15[n], plan_ref_q15[n]);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_plan_tune_mat_mult_q15_test,
+                  arm_plan_tune_mat_mult_q15)
+{
+    static const uint32_t costs[] = { 100, 50 };
+    arm_plan_instance plan;
+    arm_matrix_instance_q15 srcA, srcB, dst, wrong;
+    arm_status status;
+
+    arm_plan_init(&plan, plan_entries, PLAN_MAX_ENTRIES, plan_timer, 0.001f);
+    plan_make_q15(1.0f / 4.0f);
+
+    arm_mat_init_q15(&srcA, PLAN_MAT_SIZE / 2, PLAN_MAT_SIZE, plan_a_q15);
+    arm_mat_init_q15(&srcB, PLAN_MAT_SIZE, PLAN_MAT_SIZE, plan_b_q15);
+    arm_mat_init_q15(&dst, PLAN_MAT_SIZE / 2, PLAN_MAT_SIZE, plan_fut_q15);
+    arm_mat_init_q15(&wrong, PLAN_MAT_SIZE, PLAN_MAT_SIZE, plan_fut_q15);
+
+    plan_set_costs(costs);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_mat_mult_q15(&plan, &srcA, &srcB, &wrong, plan_ref_q15,
+                                   plan_scratch1),
+        ARM_MATH_SIZE_MISMATCH);
+    TEST_ASSERT_EQUAL(plan.numEntries, 0);
+
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_mat_mult_q15(&plan, &srcA, &srcB, &dst, plan_ref_q15,
+                                   plan_scratch1),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(
+        arm_plan_lookup(&plan, ARM_PLAN_MAT_MULT_Q15,
+                        ((PLAN_MAT_SIZE / 2) << 16) | PLAN_MAT_SIZE,
+                        PLAN_MAT_SIZE),
+        ARM_PLAN_VARIANT_FAST);
+
+    JTEST_COUNT_CYCLES(
+        status = arm_plan_mat_mult_q15(&plan, &srcA, &srcB, &dst,
+                                       plan_scratch1));
+    TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Radix-4 is only tried for powers of 4, so for 128 points the second timed
+  implementation is radix-2.  The plain FFTs differ from the mixed radix one
+  by rounding only.
+*/
+JTEST_DEFINE_TEST(arm_plan_tune_cfft_f32_test,
+                  arm_plan_tune_cfft_f32)
+{
+    static const uint32_t costs[] = { 300, 100, 200 };
+    arm_plan_instance plan;
+    uint32_t seed = 3U;
+    uint32_t n;
+
+    for (n = 0; n < 2 * PLAN_FFT_LEN; n++)
+    {
+        plan_src_f32[n] = plan_rand(&seed);
+    }
+
+    /* Only the exact results are accepted */
+    arm_plan_init(&plan, plan_entries, PLAN_MAX_ENTRIES, plan_timer, 0.0f);
+    plan_set_costs(costs);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_cfft_f32(&plan, &arm_cfft_sR_f32_len256, plan_src_f32,
+                               plan_buf_f32, plan_ref_f32, 0),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CFFT_F32, 256, 0),
+                      ARM_PLAN_VARIANT_DEFAULT);
+
+    arm_plan_init(&plan, plan_entries, PLAN_MAX_ENTRIES, plan_timer, 1e-5f);
+    plan_set_costs(costs);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_cfft_f32(&plan, &arm_cfft_sR_f32_len256, plan_src_f32,
+                               plan_buf_f32, plan_ref_f32, 0),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CFFT_F32, 256, 0),
+                      ARM_PLAN_VARIANT_RADIX4);
+
+    plan_set_costs(costs);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_cfft_f32(&plan, &arm_cfft_sR_f32_len128, plan_src_f32,
+                               plan_buf_f32, plan_ref_f32, 1),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CFFT_F32, 128, 1),
+                      ARM_PLAN_VARIANT_RADIX2);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CFFT_F32, 128, 0),
+                      ARM_PLAN_VARIANT_DEFAULT);
+
+    /* Both directions through the plan */
+    arm_copy_f32(plan_src_f32, plan_buf_f32, 2 * PLAN_FFT_LEN);
+    arm_copy_f32(plan_src_f32, plan_ref_f32, 2 * PLAN_FFT_LEN);
+
+    JTEST_COUNT_CYCLES(
+        arm_plan_cfft_f32(&plan, &arm_cfft_sR_f32_len256, plan_buf_f32, 0));
+    arm_cfft_f32(&arm_cfft_sR_f32_len256, plan_ref_f32, 0, 1);
+
+    TEST_ASSERT_SNR(plan_ref_f32, plan_buf_f32, 2 * PLAN_FFT_LEN, 120);
+
+    arm_copy_f32(plan_src_f32, plan_buf_f32, 256);
+    arm_copy_f32(plan_src_f32, plan_ref_f32, 256);
+
+    arm_plan_cfft_f32(&plan, &arm_cfft_sR_f32_len128, plan_buf_f32, 1);
+    arm_cfft_f32(&arm_cfft_sR_f32_len128, plan_ref_f32, 1, 1);
+
+    TEST_ASSERT_SNR(plan_ref_f32, plan_buf_f32, 256, 120);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Entries, export and import: a plan survives a round trip through its words,
+  and damaged or truncated words are rejected.
+*/
+JTEST_DEFINE_TEST(arm_plan_import_test,
+                  arm_plan_import)
+{
+    arm_plan_instance plan, loaded;
+    uint32_t n;
+
+    /* Without a cycle counter the default implementation is recorded */
+    arm_plan_init(&plan, plan_entries, 3, NULL, 1.0f);
+    plan_make_q15(1.0f / 64.0f);
+    TEST_ASSERT_EQUAL(
+        arm_plan_tune_conv_q15(&plan, plan_a_q15, 16, plan_b_q15, 8,
+                               plan_fut_q15, plan_ref_q15,
+                               plan_scratch1, plan_scratch2),
+        ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&plan, ARM_PLAN_CONV_Q15, 16, 8),
+                      ARM_PLAN_VARIANT_DEFAULT);
+
+    /* Implementations that the operation does not have */
+    TEST_ASSERT_EQUAL(arm_plan_record(&plan, ARM_PLAN_CONV_Q15, 16, 8,
+                                      ARM_PLAN_VARIANT_RADIX4, 0),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(arm_plan_record(&plan, ARM_PLAN_NUM_OPS, 16, 8,
+                                      ARM_PLAN_VARIANT_DEFAULT, 0),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    TEST_ASSERT_EQUAL(arm_plan_record(&plan, ARM_PLAN_FIR_Q15, 32, 64,
+                                      ARM_PLAN_VARIANT_FAST, 1234),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_record(&plan, ARM_PLAN_CFFT_F32, 1024, 1,
+                                      ARM_PLAN_VARIANT_RADIX2, 5678),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(arm_plan_record(&plan, ARM_PLAN_CFFT_F32, 512, 1,
+                                      ARM_PLAN_VARIANT_RADIX2, 5678),
+                      ARM_MATH_LENGTH_ERROR);
+    TEST_ASSERT_EQUAL(plan.numEntries, 3);
+
+    TEST_ASSERT_EQUAL(arm_plan_export(&plan, plan_words,
+                                      ARM_PLAN_EXPORT_WORDS(3) - 1),
+                      ARM_MATH_LENGTH_ERROR);
+    TEST_ASSERT_EQUAL(arm_plan_export(&plan, plan_words,
+                                      ARM_PLAN_EXPORT_WORDS(3)),
+                      ARM_MATH_SUCCESS);
+
+    /* Round trip */
+    arm_plan_init(&loaded, plan_entries2, PLAN_MAX_ENTRIES, NULL, 0.0f);
+    TEST_ASSERT_EQUAL(arm_plan_import(&loaded, plan_words,
+                                      ARM_PLAN_EXPORT_WORDS(3)),
+                      ARM_MATH_SUCCESS);
+    TEST_ASSERT_EQUAL(loaded.numEntries, 3);
+
+    for (n = 0; n < 3; n++)
+    {
+        TEST_ASSERT_EQUAL(plan_entries2[n].op, plan_entries[n].op);
+        TEST_ASSERT_EQUAL(plan_entries2[n].variant, plan_entries[n].variant);
+        TEST_ASSERT_EQUAL(plan_entries2[n].len1, plan_entries[n].len1);
+        TEST_ASSERT_EQUAL(plan_entries2[n].len2, plan_entries[n].len2);
+        TEST_ASSERT_EQUAL(plan_entries2[n].cycles, plan_entries[n].cycles);
+    }
+
+    TEST_ASSERT_EQUAL(arm_plan_lookup(&loaded, ARM_PLAN_CFFT_F32, 1024, 1),
+                      ARM_PLAN_VARIANT_RADIX2);
+
+    /* Truncated, damaged and swapped words */
+    arm_plan_init(&loaded, plan_entries2, PLAN_MAX_ENTRIES, NULL, 0.0f);
+    TEST_ASSERT_EQUAL(arm_plan_import(&loaded, plan_words,
+                                      ARM_PLAN_EXPORT_WORDS(3) - 1),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    plan_words[4] ^= 1U;
+    TEST_ASSERT_EQUAL(arm_plan_import(&loaded, plan_words,
+                                      ARM_PLAN_EXPORT_WORDS(3)),
+                      ARM_MATH_ARGUMENT_ERROR);
+    plan_words[4] ^= 1U;
+
+    n = plan_words[3];
+    plan_words[3] = plan_words[4];
+    plan_words[4] = n;
+    TEST_ASSERT_EQUAL(arm_plan_import(&loaded, plan_words,
+                                      ARM_PLAN_EXPORT_WORDS(3)),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(loaded.numEntries, 0);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(plan_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_plan_tune_conv_q15_test);
+    JTEST_TEST_CALL(arm_plan_tune_fir_q15_test);
+    JTEST_TEST_CALL(arm_plan_tune_mat_mult_q15_test);
+    JTEST_TEST_CALL(arm_plan_tune_cfft_f32_test);
+    JTEST_TEST_CALL(arm_plan_import_test);
+}
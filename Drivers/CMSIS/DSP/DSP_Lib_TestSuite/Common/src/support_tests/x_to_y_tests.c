@@ -6,6 +6,7 @@
 #include "test_templates.h"
 #include "support_templates.h"
 #include "type_abbrev.h"
+#include <string.h>
 
 /* Aliases to play nicely with templates. */
 #define arm_f32_to_q31 arm_float_to_q31
@@ -53,6 +54,110 @@ JTEST_ARM_X_TO_Y_TEST(q7, f32);
 JTEST_ARM_X_TO_Y_TEST(q7, q31);
 JTEST_ARM_X_TO_Y_TEST(q7, q15);
 
+/*--------------------------------------------------------------------------------*/
+/* Half-precision Conversions */
+/*--------------------------------------------------------------------------------*/
+
+/* Rounding cases of the float to half-precision conversion and the expected bits */
+static const float32_t f16_round_inputs[] =
+{
+    0.0f, -0.0f, 1.0f, -2.0f, 0.333333333f,
+    65504.0f, 65519.0f, 65520.0f, -1.0e5f,
+    1.0f + 1.0f / 2048.0f,                      /* tie, rounds down to even */
+    1.0f + 3.0f / 2048.0f,                      /* tie, rounds up to even */
+    6.103515625e-05f,                           /* smallest normal */
+    5.9604644775390625e-08f,                    /* smallest subnormal */
+    2.98023223876953125e-08f,                   /* half of it, rounds to zero */
+    4.5e-08f, 1.0e-10f, 3.0e-05f
+};
+
+static const uint16_t f16_round_bits[] =
+{
+    0x0000, 0x8000, 0x3C00, 0xC000, 0x3555,
+    0x7BFF, 0x7BFF, 0x7C00, 0xFC00,
+    0x3C00,
+    0x3C02,
+    0x0400,
+    0x0001,
+    0x0000,
+    0x0001, 0x0000, 0x01F7
+};
+
+#define F16_NUM_ROUND_CASES (sizeof(f16_round_bits) / sizeof(f16_round_bits[0]))
+#define F16_CHUNK 256
+
+static float16_t f16_values[F16_CHUNK];
+static float16_t f16_values2[F16_CHUNK];
+static float32_t f16_floats[F16_CHUNK];
+
+JTEST_DEFINE_TEST(arm_f32_to_f16_test, arm_float_to_f16)
+{
+    uint16_t bits;
+    uint32_t i;
+
+    JTEST_COUNT_CYCLES(
+        arm_float_to_f16((float32_t *) f16_round_inputs, f16_values, F16_NUM_ROUND_CASES));
+
+    for (i = 0; i < F16_NUM_ROUND_CASES; i++)
+    {
+        memcpy(&bits, &f16_values[i], sizeof(bits));
+
+        if (bits != f16_round_bits[i])
+        {
+            JTEST_DUMP_STRF("Input: %e Bits: 0x%04x Expected: 0x%04x\n",
+                            (double) f16_round_inputs[i], (int) bits, (int) f16_round_bits[i]);
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Every half-precision value except NaN converts to single precision and back
+  unchanged, and the conversion is monotonic over the positive values.
+*/
+JTEST_DEFINE_TEST(arm_f16_to_f32_test, arm_f16_to_float)
+{
+    uint16_t bits, bits2;
+    uint32_t base, i;
+    float32_t last = -1.0f;
+
+    for (base = 0; base < 0x10000U; base += F16_CHUNK)
+    {
+        for (i = 0; i < F16_CHUNK; i++)
+        {
+            bits = (uint16_t) (base + i);
+            memcpy(&f16_values[i], &bits, sizeof(bits));
+        }
+
+        arm_f16_to_float(f16_values, f16_floats, F16_CHUNK);
+        arm_float_to_f16(f16_floats, f16_values2, F16_CHUNK);
+
+        for (i = 0; i < F16_CHUNK; i++)
+        {
+            bits = (uint16_t) (base + i);
+
+            /* Skip NaNs */
+            if (((bits & 0x7C00U) == 0x7C00U) && ((bits & 0x03FFU) != 0U))
+            {
+                continue;
+            }
+
+            memcpy(&bits2, &f16_values2[i], sizeof(bits2));
+            TEST_ASSERT_EQUAL(bits2, bits);
+
+            if (bits <= 0x7C00U)
+            {
+                TEST_ASSERT_EQUAL(f16_floats[i] > last, 1);
+                last = f16_floats[i];
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -77,4 +182,7 @@ JTEST_DEFINE_GROUP(x_to_y_tests)
     JTEST_TEST_CALL(arm_q7_to_f32_test);
     JTEST_TEST_CALL(arm_q7_to_q31_test);
     JTEST_TEST_CALL(arm_q7_to_q15_test);
+
+    JTEST_TEST_CALL(arm_f32_to_f16_test);
+    JTEST_TEST_CALL(arm_f16_to_f32_test);
 }
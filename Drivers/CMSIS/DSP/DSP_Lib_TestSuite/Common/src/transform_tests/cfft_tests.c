@@ -96,6 +96,276 @@
     } while (0)
 
 
+/*
+  Block floating-point CFFT test template. Arguments are: inverse-transform flag,
+  function suffix (q15/q31) and the output type (q15_t, q31_t).  The input is
+  8 bits below full scale, where the fixed scaling of arm_cfft_q15/q31() loses
+  most of the precision.  The reference is the floating-point CFFT of the same
+  input and the output is scaled by the returned exponent before the comparison.
+*/
+#define CFFT_BFP_SNR_THRESHOLD_q31_t 120
+#define CFFT_BFP_SNR_THRESHOLD_q15_t 50
+
+#define CFFT_BFP_TEST_BODY(ifft_flag, suffix, output_type)                              \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_instance_f32 cfft_inst_ref = {0};                                      \
+        float32_t scale;                                                                \
+        int32_t exponent;                                                               \
+        uint32_t i;                                                                     \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,           \
+            transform_cfft_##suffix##_structs                                           \
+            ,                                                                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_##suffix##_inputs,                                        \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(output_type) *                                                   \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            for (i = 0; i < 2U * cfft_inst_ptr->fftLen; i++)                            \
+            {                                                                           \
+                ((output_type *) transform_fft_inplace_input_fut)[i] >>= 8;             \
+            }                                                                           \
+                                                                                        \
+            TEST_CONVERT_TO_FLOAT(                                                      \
+                (output_type *) transform_fft_inplace_input_fut,                        \
+                transform_fft_input_ref,                                                \
+                2U * cfft_inst_ptr->fftLen,                                             \
+                output_type);                                                           \
+                                                                                        \
+                /* Display parameter values */                                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                                      \
+                                "Inverse-transform flag: %d\n",                         \
+                                (int)cfft_inst_ptr->fftLen,                             \
+                                (int)ifft_flag);                                        \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                exponent = arm_cfft_bfp_##suffix(cfft_inst_ptr,                         \
+                             (void *) transform_fft_inplace_input_fut,                  \
+                             ifft_flag,              /* IFFT Flag */                    \
+                             1));            /* Bitreverse flag */                      \
+                                                                                        \
+            cfft_inst_ref.fftLen = cfft_inst_ptr->fftLen;                               \
+            ref_cfft_f32(&cfft_inst_ref,                                                \
+                         transform_fft_input_ref,                                       \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            /* Undo the block exponent, the reference CIFFT includes 1/fftLen */        \
+            scale = (exponent >= 0) ?                                                   \
+                (float32_t) (1U << exponent) :                                          \
+                1.0f / (float32_t) (1U << -exponent);                                   \
+            scale = (ifft_flag) ? scale / (float32_t) cfft_inst_ptr->fftLen : scale;    \
+                                                                                        \
+            TEST_CONVERT_TO_FLOAT(                                                      \
+                (output_type *) transform_fft_inplace_input_fut,                        \
+                transform_fft_output_f32_fut,                                           \
+                2U * cfft_inst_ptr->fftLen,                                             \
+                output_type);                                                           \
+                                                                                        \
+            for (i = 0; i < 2U * cfft_inst_ptr->fftLen; i++)                            \
+            {                                                                           \
+                transform_fft_output_f32_fut[i] *= scale;                               \
+            }                                                                           \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TEST_ASSERT_SNR(                                                            \
+                transform_fft_input_ref,                                                \
+                transform_fft_output_f32_fut,                                           \
+                2U * cfft_inst_ptr->fftLen,                                             \
+                CFFT_BFP_SNR_THRESHOLD_##output_type));                                 \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
+/*
+  Split and strided floating-point CFFT test template.  Arguments are:
+  inverse-transform flag and the distance between consecutive complex samples.
+  A stride of 0 selects arm_cfft_split_f32() with the real parts followed by the
+  imaginary parts.  The samples skipped by the strided transform are filled with
+  a marker and checked to be left untouched.
+*/
+#define CFFT_SPLIT_MARKER 12345.0f
+
+#define CFFT_SPLIT_TEST_BODY(ifft_flag, stride_arg)                                     \
+    do                                                                                  \
+    {                                                                                   \
+        uint32_t i, n, fftLen;                                                          \
+        /* A variable, so that the marker loops do not compare against a constant 0 */  \
+        uint32_t stride = (stride_arg);                                                 \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_f32 *, cfft_inst_ptr,                \
+            transform_cfft_f32_structs                                                  \
+            ,                                                                           \
+            fftLen = cfft_inst_ptr->fftLen;                                             \
+                                                                                        \
+            memcpy(transform_fft_input_ref, transform_fft_f32_inputs,                   \
+                   2U * fftLen * sizeof(float32_t));                                    \
+                                                                                        \
+            for (i = 0; i < 2U * fftLen * ((stride) ? (stride) : 1U); i++)              \
+            {                                                                           \
+                transform_fft_input_fut[i] = CFFT_SPLIT_MARKER;                         \
+            }                                                                           \
+                                                                                        \
+            for (n = 0; n < fftLen; n++)                                                \
+            {                                                                           \
+                if (stride)                                                             \
+                {                                                                       \
+                    transform_fft_input_fut[2U * n * (stride)] =                        \
+                        transform_fft_f32_inputs[2U * n];                               \
+                    transform_fft_input_fut[2U * n * (stride) + 1U] =                   \
+                        transform_fft_f32_inputs[2U * n + 1U];                          \
+                }                                                                       \
+                else                                                                    \
+                {                                                                       \
+                    transform_fft_input_fut[n] = transform_fft_f32_inputs[2U * n];      \
+                    transform_fft_input_fut[fftLen + n] =                               \
+                        transform_fft_f32_inputs[2U * n + 1U];                          \
+                }                                                                       \
+            }                                                                           \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n"                              \
+                            "Stride: %d\n",                                             \
+                            (int)fftLen,                                                \
+                            (int)ifft_flag,                                             \
+                            (int)stride);                                               \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            if (stride)                                                                 \
+            {                                                                           \
+                JTEST_COUNT_CYCLES(                                                     \
+                    arm_cfft_strided_f32(cfft_inst_ptr,                                 \
+                                         transform_fft_input_fut,                       \
+                                         stride,                                        \
+                                         ifft_flag,      /* IFFT Flag */                \
+                                         1));            /* Bitreverse flag */          \
+            }                                                                           \
+            else                                                                        \
+            {                                                                           \
+                JTEST_COUNT_CYCLES(                                                     \
+                    arm_cfft_split_f32(cfft_inst_ptr,                                   \
+                                       transform_fft_input_fut,                         \
+                                       transform_fft_input_fut + fftLen,                \
+                                       ifft_flag,        /* IFFT Flag */                \
+                                       1));              /* Bitreverse flag */          \
+            }                                                                           \
+                                                                                        \
+            ref_cfft_f32(cfft_inst_ptr,                                                 \
+                         transform_fft_input_ref,                                       \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            /* Gather the output in interleaved order */                                \
+            for (n = 0; n < fftLen; n++)                                                \
+            {                                                                           \
+                if (stride)                                                             \
+                {                                                                       \
+                    transform_fft_output_f32_fut[2U * n] =                              \
+                        transform_fft_input_fut[2U * n * (stride)];                     \
+                    transform_fft_output_f32_fut[2U * n + 1U] =                         \
+                        transform_fft_input_fut[2U * n * (stride) + 1U];                \
+                                                                                        \
+                    for (i = 2U; i < 2U * (stride); i++)                                \
+                    {                                                                   \
+                        TEST_ASSERT_EQUAL(                                              \
+                            transform_fft_input_fut[2U * n * (stride) + i],             \
+                            CFFT_SPLIT_MARKER);                                         \
+                    }                                                                   \
+                }                                                                       \
+                else                                                                    \
+                {                                                                       \
+                    transform_fft_output_f32_fut[2U * n] = transform_fft_input_fut[n];  \
+                    transform_fft_output_f32_fut[2U * n + 1U] =                         \
+                        transform_fft_input_fut[fftLen + n];                            \
+                }                                                                       \
+            }                                                                           \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TEST_ASSERT_SNR(                                                            \
+                transform_fft_input_ref,                                                \
+                transform_fft_output_f32_fut,                                           \
+                2U * fftLen,                                                            \
+                TRANSFORM_SNR_THRESHOLD_float32_t));                                    \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
+/*
+  Half-precision CFFT test template. Argument is the inverse-transform flag.  The
+  input is scaled down so that the forward spectrum stays in the half-precision
+  range, rounded to half precision and the reference is the floating-point CFFT
+  of the rounded input.
+*/
+#define CFFT_F16_INPUT_SCALE   128.0f
+#define CFFT_F16_SNR_THRESHOLD 55
+
+#define CFFT_F16_TEST_BODY(ifft_flag)                                                   \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_instance_f32 cfft_inst_ref = {0};                                      \
+        float32_t *pIn = transform_fft_input_fut;                                       \
+        float16_t *pData = (float16_t *) transform_fft_inplace_input_fut;               \
+        uint32_t i;                                                                     \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_f16 *, cfft_inst_ptr,                \
+            transform_cfft_f16_structs                                                  \
+            ,                                                                           \
+                                                                                        \
+            for (i = 0; i < 2U * cfft_inst_ptr->fftLen; i++)                            \
+            {                                                                           \
+                pIn[i] = transform_fft_f32_inputs[i] / CFFT_F16_INPUT_SCALE;            \
+            }                                                                           \
+                                                                                        \
+            arm_float_to_f16(pIn, pData, 2U * cfft_inst_ptr->fftLen);                   \
+            arm_f16_to_float(pData, transform_fft_input_ref,                            \
+                             2U * cfft_inst_ptr->fftLen);                               \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)cfft_inst_ptr->fftLen,                                 \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_f16(cfft_inst_ptr,                                             \
+                             pData,                                                     \
+                             ifft_flag,              /* IFFT Flag */                    \
+                             1));            /* Bitreverse flag */                      \
+                                                                                        \
+            cfft_inst_ref.fftLen = cfft_inst_ptr->fftLen;                               \
+            ref_cfft_f32(&cfft_inst_ref,                                                \
+                         transform_fft_input_ref,                                       \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            arm_f16_to_float(pData, transform_fft_output_f32_fut,                       \
+                             2U * cfft_inst_ptr->fftLen);                               \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TEST_ASSERT_SNR(                                                            \
+                transform_fft_input_ref,                                                \
+                transform_fft_output_f32_fut,                                           \
+                2U * cfft_inst_ptr->fftLen,                                             \
+                CFFT_F16_SNR_THRESHOLD));                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
 /* Test declarations */
 JTEST_DEFINE_TEST(cfft_f32_test, cfft_f32)
 {
@@ -127,6 +397,56 @@ JTEST_DEFINE_TEST(cfft_q15_ifft_test, cfft_q15)
     CFFT_TEST_BODY((uint8_t) 1, q15, q15_t);
 }
 
+JTEST_DEFINE_TEST(cfft_bfp_q31_test, cfft_bfp_q31)
+{
+    CFFT_BFP_TEST_BODY((uint8_t) 0, q31, q31_t);
+}
+
+JTEST_DEFINE_TEST(cfft_bfp_q31_ifft_test, cfft_bfp_q31)
+{
+    CFFT_BFP_TEST_BODY((uint8_t) 1, q31, q31_t);
+}
+
+JTEST_DEFINE_TEST(cfft_bfp_q15_test, cfft_bfp_q15)
+{
+    CFFT_BFP_TEST_BODY((uint8_t) 0, q15, q15_t);
+}
+
+JTEST_DEFINE_TEST(cfft_bfp_q15_ifft_test, cfft_bfp_q15)
+{
+    CFFT_BFP_TEST_BODY((uint8_t) 1, q15, q15_t);
+}
+
+JTEST_DEFINE_TEST(cfft_f16_test, cfft_f16)
+{
+    CFFT_F16_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_f16_ifft_test, cfft_f16)
+{
+    CFFT_F16_TEST_BODY((uint8_t) 1);
+}
+
+JTEST_DEFINE_TEST(cfft_split_f32_test, cfft_split_f32)
+{
+    CFFT_SPLIT_TEST_BODY((uint8_t) 0, 0U);
+}
+
+JTEST_DEFINE_TEST(cfft_split_f32_ifft_test, cfft_split_f32)
+{
+    CFFT_SPLIT_TEST_BODY((uint8_t) 1, 0U);
+}
+
+JTEST_DEFINE_TEST(cfft_strided_f32_test, cfft_strided_f32)
+{
+    CFFT_SPLIT_TEST_BODY((uint8_t) 0, 3U);
+}
+
+JTEST_DEFINE_TEST(cfft_strided_f32_ifft_test, cfft_strided_f32)
+{
+    CFFT_SPLIT_TEST_BODY((uint8_t) 1, 3U);
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -141,4 +461,19 @@ JTEST_DEFINE_GROUP(cfft_tests)
 
     JTEST_TEST_CALL(cfft_q15_test);
     JTEST_TEST_CALL(cfft_q15_ifft_test);
+
+    JTEST_TEST_CALL(cfft_bfp_q31_test);
+    JTEST_TEST_CALL(cfft_bfp_q31_ifft_test);
+
+    JTEST_TEST_CALL(cfft_bfp_q15_test);
+    JTEST_TEST_CALL(cfft_bfp_q15_ifft_test);
+
+    JTEST_TEST_CALL(cfft_f16_test);
+    JTEST_TEST_CALL(cfft_f16_ifft_test);
+
+    JTEST_TEST_CALL(cfft_split_f32_test);
+    JTEST_TEST_CALL(cfft_split_f32_ifft_test);
+
+    JTEST_TEST_CALL(cfft_strided_f32_test);
+    JTEST_TEST_CALL(cfft_strided_f32_ifft_test);
 }
@@ -0,0 +1,388 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Goertzel */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Target frequencies, normalised to the sampling rate.  They include DC, the
+  Nyquist frequency and frequencies that are not DFT bins.  The count is odd
+  so that the remainder loops are exercised.
+*/
+static const float32_t goertzel_freqs[] =
+{
+    0.0f, 0.0173f, 0.1f, 0.25f, 0.3337f, 0.4921f, 0.5f
+};
+
+#define GOERTZEL_NUM_FREQS (sizeof(goertzel_freqs) / sizeof(float32_t))
+
+#define GOERTZEL_SNR_THRESHOLD_float32_t 80
+#define GOERTZEL_SNR_THRESHOLD_q31_t     70
+
+/*
+  Frequency in radians per sample of the coefficients of bin k and the sign
+  of the odd samples.  The coefficient is lambda = -4*sin(w/2)^2 for f32 and
+  sin(w/2) in 1.31 format for q31, a negative sign mirrors w to pi - w.
+*/
+#define GOERTZEL_OMEGA_f32(c, k)                                        \
+    goertzel_omega(-(c)[2 * (k)] / 4.0, (c)[2 * (k) + 1] < 0)
+#define GOERTZEL_OMEGA_q31(c, k)                                        \
+    goertzel_omega(pow((c)[2 * (k)] / 2147483648.0, 2), (c)[2 * (k) + 1] < 0)
+
+/* Scale of the output, the q31 function returns the power in 2.62 format */
+#define GOERTZEL_SCALE_f32(shift) ((void) (shift), 1.0f)
+#define GOERTZEL_SCALE_q31(shift) ((float32_t) ((uint64_t) 2U << (2 * (shift))))
+
+/* Only the q31 function returns a shift */
+#define GOERTZEL_SHIFT_f32(fn_call) ((fn_call), 0U)
+#define GOERTZEL_SHIFT_q31(fn_call) (fn_call)
+
+/* Frequency of the test in the init format */
+#define GOERTZEL_FREQ_f32(f) (f)
+#define GOERTZEL_FREQ_q31(f) ((q31_t) ((f) * 2147483648.0))
+
+/* Frequency from sin(w/2)^2 and the mirror flag */
+static float64_t goertzel_omega(float64_t sin2, int mirror)
+{
+    float64_t w = 2.0 * asin(sqrt((sin2 > 1.0) ? 1.0 : sin2));
+
+    return mirror ? (PI - w) : w;
+}
+
+/* Reference power of the block at w */
+static float32_t goertzel_ref_power(
+    float32_t * pSrc,
+    uint32_t blockSize,
+    float64_t w)
+{
+    float64_t re = 0.0, im = 0.0;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++)
+    {
+        re += pSrc[n] * cos(w * n);
+        im -= pSrc[n] * sin(w * n);
+    }
+
+    return (float32_t) (re * re + im * im);
+}
+
+/*
+  Goertzel test template.  Arguments are: function suffix (f32/q31), input
+  type and output type.  The reference is the DFT at the frequency of the actual
+  coefficients, so the test checks the recursion and not the accuracy of the
+  trigonometric approximations.  The q31 output is scaled back up by the
+  returned shift.
+*/
+#define GOERTZEL_DEFINE_TEST(suffix, input_type, output_type)           \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                     \
+                      arm_goertzel_##suffix)                            \
+    {                                                                   \
+        arm_goertzel_instance_##suffix goertzel_inst_fut;               \
+        input_type freqs[GOERTZEL_NUM_FREQS];                           \
+        input_type coeffs[2 * GOERTZEL_NUM_FREQS];                      \
+        output_type * pOut = (output_type *) transform_fft_output_fut;  \
+        uint32_t shift = 0, i;                                          \
+        float32_t scale;                                                \
+                                                                        \
+        for (i = 0; i < GOERTZEL_NUM_FREQS; i++)                        \
+        {                                                               \
+            freqs[i] = GOERTZEL_FREQ_##suffix(goertzel_freqs[i]);       \
+        }                                                               \
+                                                                        \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_goertzel_init_##suffix(&goertzel_inst_fut,              \
+                                       GOERTZEL_NUM_FREQS,              \
+                                       freqs, coeffs),                  \
+            ARM_MATH_SUCCESS);                                          \
+                                                                        \
+        /* Go through all block sizes */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Number of Frequencies: %d\n",              \
+                            (int)fftlen,                                \
+                            (int)GOERTZEL_NUM_FREQS);                   \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                shift = GOERTZEL_SHIFT_##suffix(                        \
+                    arm_goertzel_##suffix(                              \
+                        &goertzel_inst_fut,                             \
+                        (input_type *) transform_fft_##suffix##_inputs, \
+                        pOut,                                           \
+                        fftlen)));                                      \
+                                                                        \
+            TEST_CONVERT_TO_FLOAT(                                      \
+                (input_type *) transform_fft_##suffix##_inputs,         \
+                transform_fft_input_ref,                                \
+                fftlen,                                                 \
+                input_type);                                            \
+                                                                        \
+            for (i = 0; i < GOERTZEL_NUM_FREQS; i++)                    \
+            {                                                           \
+                transform_fft_output_ref[i] = goertzel_ref_power(       \
+                    transform_fft_input_ref, fftlen,                    \
+                    GOERTZEL_OMEGA_##suffix(coeffs, i));                \
+            }                                                           \
+                                                                        \
+            TEST_CONVERT_TO_FLOAT(pOut, transform_fft_output_f32_fut,   \
+                                  GOERTZEL_NUM_FREQS, output_type);     \
+                                                                        \
+            scale = GOERTZEL_SCALE_##suffix(shift);                     \
+                                                                        \
+            for (i = 0; i < GOERTZEL_NUM_FREQS; i++)                    \
+            {                                                           \
+                transform_fft_output_f32_fut[i] *= scale;               \
+            }                                                           \
+                                                                        \
+            /* Test correctness */                                      \
+            TEST_ASSERT_SNR(                                            \
+                transform_fft_output_ref,                               \
+                transform_fft_output_f32_fut,                           \
+                GOERTZEL_NUM_FREQS,                                     \
+                GOERTZEL_SNR_THRESHOLD_##input_type));                  \
+                                                                        \
+        /* Out of range frequencies are rejected */                     \
+        freqs[0] = GOERTZEL_FREQ_##suffix(-0.25f);                      \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_goertzel_init_##suffix(&goertzel_inst_fut,              \
+                                       GOERTZEL_NUM_FREQS,              \
+                                       freqs, coeffs),                  \
+            ARM_MATH_ARGUMENT_ERROR);                                   \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+GOERTZEL_DEFINE_TEST(f32, float32_t, float32_t);
+GOERTZEL_DEFINE_TEST(q31, q31_t, q63_t);
+
+/*
+  Goertzel against the fast RFFT.  For each block size, the cost of a full
+  power spectrum with arm_rfft_fast_f32() and arm_cmplx_mag_squared_f32() is
+  compared with arm_goertzel_f32() for a growing number of bins.  The number
+  of bins from which the full spectrum is cheaper is displayed; the results
+  are only meaningful on the target.
+*/
+JTEST_DEFINE_TEST(arm_goertzel_f32_crossover_test,
+                  arm_goertzel_f32)
+{
+    arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};
+    arm_goertzel_instance_f32 goertzel_inst_fut;
+    float32_t * pCoeffs = transform_fft_output_f32_fut;
+    float32_t * pFreqs = transform_fft_output_f32_ref;
+    uint32_t rfftCycles, goertzelCycles, numBins, crossover, i;
+
+    TEMPLATE_DO_ARR_DESC(
+        fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens
+        ,
+        arm_rfft_fast_init_f32(&rfft_inst_fut, fftlen);
+
+        memcpy(transform_fft_input_fut, transform_fft_f32_inputs,
+               fftlen * sizeof(float32_t));
+
+        JTEST_MEASURE_CYCLES(
+            rfftCycles,
+            arm_rfft_fast_f32(&rfft_inst_fut, transform_fft_input_fut,
+                              transform_fft_output_ref, 0);
+            arm_cmplx_mag_squared_f32(transform_fft_output_ref,
+                                      transform_fft_output_fut,
+                                      fftlen / 2));
+
+        /* All the bins of the spectrum, up to the Nyquist frequency */
+        for (i = 0; i <= fftlen / 2U; i++)
+        {
+            pFreqs[i] = (float32_t) i / fftlen;
+        }
+
+        crossover = 0;
+
+        /* Stop at the crossover, the cost of more bins is predictable */
+        for (numBins = 1;
+             (numBins <= fftlen / 2U + 1U) && (crossover == 0);
+             numBins *= 2U)
+        {
+            arm_goertzel_init_f32(&goertzel_inst_fut, numBins, pFreqs, pCoeffs);
+
+            JTEST_MEASURE_CYCLES(
+                goertzelCycles,
+                arm_goertzel_f32(&goertzel_inst_fut, transform_fft_f32_inputs,
+                                 transform_fft_output_fut, fftlen));
+
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Number of Bins: %d\n"
+                            "Goertzel Cycles: %d\n"
+                            "RFFT Cycles: %d\n",
+                            (int)fftlen,
+                            (int)numBins,
+                            (int)goertzelCycles,
+                            (int)rfftCycles);
+
+            if ((crossover == 0) && (goertzelCycles >= rfftCycles))
+            {
+                crossover = numBins;
+            }
+        }
+
+        JTEST_DUMP_STRF("Block Size: %d\n"
+                        "Crossover Number of Bins: %d\n",
+                        (int)fftlen,
+                        (int)crossover));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Sliding DFT */
+/*--------------------------------------------------------------------------------*/
+
+static const uint16_t sdft_window_lens[] =
+{
+    16, 100, 256
+};
+
+#define SDFT_NUM_WINDOW_LENS (sizeof(sdft_window_lens) / sizeof(uint16_t))
+
+static const float32_t sdft_dampings[] =
+{
+    1.0f, 0.999f
+};
+
+#define SDFT_NUM_DAMPINGS (sizeof(sdft_dampings) / sizeof(float32_t))
+
+static const uint32_t sdft_chunks[] =
+{
+    1, 37, 5, 128
+};
+
+#define SDFT_NUM_CHUNKS (sizeof(sdft_chunks) / sizeof(uint32_t))
+
+#define SDFT_NUM_BINS 5
+
+#define SDFT_SNR_THRESHOLD 80
+
+/*
+  Reference bins of the last windowLen samples before pSrc[end], oldest
+  sample first, with the exponential weighting of the damping factor.
+*/
+static void sdft_ref_bins(
+    float32_t * pSrc,
+    uint32_t end,
+    uint32_t windowLen,
+    const uint16_t * pBinIndex,
+    float64_t r,
+    float32_t * pDst)
+{
+    float64_t re, im, w, x;
+    uint32_t k, m;
+
+    for (k = 0; k < SDFT_NUM_BINS; k++)
+    {
+        re = 0.0;
+        im = 0.0;
+
+        for (m = 0; m < windowLen; m++)
+        {
+            /* The samples before the start of the stream are zero */
+            x = (end + m >= windowLen) ? pSrc[end + m - windowLen] : 0.0;
+            x *= pow(r, windowLen - 1 - m);
+            w = 2.0 * PI * pBinIndex[k] * m / windowLen;
+            re += x * cos(w);
+            im -= x * sin(w);
+        }
+
+        pDst[2 * k] = (float32_t) re;
+        pDst[2 * k + 1] = (float32_t) im;
+    }
+}
+
+JTEST_DEFINE_TEST(arm_sdft_f32_test,
+                  arm_sdft_f32)
+{
+    arm_sdft_instance_f32 sdft_inst_fut;
+    uint16_t bins[SDFT_NUM_BINS];
+    uint32_t l, d, done, chunk, c, windowLen;
+
+    for (l = 0; l < SDFT_NUM_WINDOW_LENS; l++)
+    {
+        windowLen = sdft_window_lens[l];
+
+        /* DC, first bins, a middle bin and the last bin */
+        bins[0] = 0;
+        bins[1] = 1;
+        bins[2] = 3;
+        bins[3] = windowLen / 2;
+        bins[4] = windowLen - 1;
+
+        for (d = 0; d < SDFT_NUM_DAMPINGS; d++)
+        {
+            JTEST_DUMP_STRF("Window Length: %d\n"
+                            "Damping: %f\n",
+                            (int)windowLen,
+                            (double)sdft_dampings[d]);
+
+            TEST_ASSERT_EQUAL(
+                arm_sdft_init_f32(&sdft_inst_fut, windowLen, SDFT_NUM_BINS,
+                                  bins, sdft_dampings[d],
+                                  transform_fft_input_fut),
+                ARM_MATH_SUCCESS);
+
+            done = 0;
+            c = 0;
+
+            /* Feed three windows of input, check the bins after every chunk */
+            while (done < 3U * windowLen)
+            {
+                chunk = sdft_chunks[c++ % SDFT_NUM_CHUNKS];
+                chunk = (chunk < 3U * windowLen - done) ?
+                    chunk : 3U * windowLen - done;
+
+                JTEST_COUNT_CYCLES(
+                    arm_sdft_f32(&sdft_inst_fut,
+                                 transform_fft_f32_inputs + done,
+                                 transform_fft_output_fut,
+                                 chunk));
+
+                done += chunk;
+
+                sdft_ref_bins(transform_fft_f32_inputs, done, windowLen,
+                              bins, sdft_dampings[d],
+                              transform_fft_output_ref);
+
+                TEST_ASSERT_SNR(
+                    transform_fft_output_ref,
+                    transform_fft_output_fut,
+                    2 * SDFT_NUM_BINS,
+                    SDFT_SNR_THRESHOLD);
+            }
+        }
+
+        /* Bins must be below the window length */
+        bins[4] = windowLen;
+        TEST_ASSERT_EQUAL(
+            arm_sdft_init_f32(&sdft_inst_fut, windowLen, SDFT_NUM_BINS,
+                              bins, 1.0f, transform_fft_input_fut),
+            ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(goertzel_tests)
+{
+    JTEST_TEST_CALL(arm_goertzel_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_q31_test);
+    JTEST_TEST_CALL(arm_goertzel_f32_crossover_test);
+    JTEST_TEST_CALL(arm_sdft_f32_test);
+}
@@ -0,0 +1,365 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*
+  The MFCC functions are compared to a double precision pipeline with a
+  direct DFT, a dense mel filterbank rebuilt from the sparse tables and a
+  direct DCT-II.  The generated filterbank is checked against triangles
+  computed in double precision.  The benchmark dumps the cycles of the sparse
+  filterbank next to the dense matrix multiplication it replaces.
+*/
+
+#define MFCC_MAX_FFT_LEN 512
+#define MFCC_MAX_MEL 40
+#define MFCC_NUM_DCT 13
+#define MFCC_SAMPLE_RATE 16000.0f
+#define MFCC_F_MIN 20.0f
+#define MFCC_F_MAX 8000.0f
+#define MFCC_PRE_EMPHASIS 0.97f
+
+#define MFCC_SNR_THRESHOLD_f32 80
+#define MFCC_SNR_THRESHOLD_q15 30
+
+static const uint16_t mfcc_fftlens[] = { 256, 512 };
+static const uint16_t mfcc_nbmels[] = { 20, 40 };
+
+#define MFCC_NUM_FFTLENS (sizeof(mfcc_fftlens) / sizeof(uint16_t))
+#define MFCC_NUM_NBMELS (sizeof(mfcc_nbmels) / sizeof(uint16_t))
+
+static float32_t mfcc_window_f32[MFCC_MAX_FFT_LEN];
+static float32_t mfcc_coefs_f32[MFCC_MAX_FFT_LEN + 2];
+static float32_t mfcc_dct_f32[MFCC_NUM_DCT * MFCC_MAX_MEL];
+static q15_t mfcc_window_q15[MFCC_MAX_FFT_LEN];
+static q15_t mfcc_coefs_q15[MFCC_MAX_FFT_LEN + 2];
+static q15_t mfcc_dct_q15[MFCC_NUM_DCT * MFCC_MAX_MEL];
+static uint16_t mfcc_pos[MFCC_MAX_MEL];
+static uint16_t mfcc_lengths[MFCC_MAX_MEL];
+static float32_t mfcc_ref[MFCC_NUM_DCT];
+static float32_t mfcc_fut[MFCC_NUM_DCT];
+
+/* Builds the tables of both types, returns the number of filter coefficients */
+static uint32_t mfcc_tables(
+    uint16_t fftLen,
+    uint16_t nbMel)
+{
+    uint32_t numCoefs;
+
+    arm_window_f32(ARM_WINDOW_HAMMING, mfcc_window_f32, fftLen);
+    numCoefs = arm_mfcc_filterbank_f32(MFCC_SAMPLE_RATE, fftLen, nbMel,
+                                       MFCC_F_MIN, MFCC_F_MAX,
+                                       mfcc_pos, mfcc_lengths, mfcc_coefs_f32);
+    arm_mfcc_dct_f32(mfcc_dct_f32, MFCC_NUM_DCT, nbMel);
+
+    arm_float_to_q15(mfcc_window_f32, mfcc_window_q15, fftLen);
+    arm_float_to_q15(mfcc_coefs_f32, mfcc_coefs_q15, numCoefs);
+    arm_float_to_q15(mfcc_dct_f32, mfcc_dct_q15, MFCC_NUM_DCT * nbMel);
+
+    return numCoefs;
+}
+
+/* Reference MFCC of one frame in double precision */
+static void mfcc_ref_f32(
+    const float32_t * pSrc,
+    const float32_t * pWindow,
+    const float32_t * pCoefs,
+    float32_t preEmphasis,
+    uint16_t fftLen,
+    uint16_t nbMel,
+    float32_t * pDst)
+{
+    float64_t frame[MFCC_MAX_FFT_LEN];
+    float64_t power[MFCC_MAX_FFT_LEN / 2 + 1];
+    float64_t logMel[MFCC_MAX_MEL];
+    float64_t re, im, scale;
+    uint32_t n, k, m;
+
+    for (n = 0; n < fftLen; n++)
+    {
+        frame[n] = ((float64_t) pSrc[n] -
+                    preEmphasis * (float64_t) pSrc[(n > 0) ? n - 1 : 0]) * pWindow[n];
+    }
+
+    for (k = 0; k <= fftLen / 2U; k++)
+    {
+        re = 0.0;
+        im = 0.0;
+
+        for (n = 0; n < fftLen; n++)
+        {
+            re += frame[n] * cos(2.0 * PI * ((k * n) % fftLen) / fftLen);
+            im -= frame[n] * sin(2.0 * PI * ((k * n) % fftLen) / fftLen);
+        }
+
+        power[k] = re * re + im * im;
+    }
+
+    for (m = 0; m < nbMel; m++)
+    {
+        logMel[m] = 0.0;
+
+        for (k = 0; k < mfcc_lengths[m]; k++)
+        {
+            logMel[m] += power[mfcc_pos[m] + k] * *pCoefs++;
+        }
+
+        logMel[m] = log((logMel[m] > ldexp(1.0, -24)) ? logMel[m] : ldexp(1.0, -24));
+    }
+
+    for (k = 0; k < MFCC_NUM_DCT; k++)
+    {
+        scale = sqrt(((k == 0) ? 1.0 : 2.0) / nbMel);
+        re = 0.0;
+
+        for (m = 0; m < nbMel; m++)
+        {
+            re += logMel[m] * cos(PI * k * (2.0 * m + 1.0) / (2.0 * nbMel));
+        }
+
+        pDst[k] = (float32_t) (scale * re);
+    }
+}
+
+JTEST_DEFINE_TEST(arm_mfcc_init_f32_test, arm_mfcc_init_f32)
+{
+    arm_mfcc_instance_f32 mfcc_inst_fut;
+
+    /* Unsupported FFT length */
+    TEST_ASSERT_EQUAL(
+        arm_mfcc_init_f32(&mfcc_inst_fut, 100, 20, 13, MFCC_PRE_EMPHASIS,
+                          mfcc_window_f32, mfcc_pos, mfcc_lengths,
+                          mfcc_coefs_f32, mfcc_dct_f32),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    /* The mel energies must fit after the power spectrum */
+    TEST_ASSERT_EQUAL(
+        arm_mfcc_init_f32(&mfcc_inst_fut, 64, 32, 13, MFCC_PRE_EMPHASIS,
+                          mfcc_window_f32, mfcc_pos, mfcc_lengths,
+                          mfcc_coefs_f32, mfcc_dct_f32),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    /* More outputs than filters */
+    TEST_ASSERT_EQUAL(
+        arm_mfcc_init_f32(&mfcc_inst_fut, 256, 12, 13, MFCC_PRE_EMPHASIS,
+                          mfcc_window_f32, mfcc_pos, mfcc_lengths,
+                          mfcc_coefs_f32, mfcc_dct_f32),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    TEST_ASSERT_EQUAL(
+        arm_mfcc_init_f32(&mfcc_inst_fut, 64, 31, 13, MFCC_PRE_EMPHASIS,
+                          mfcc_window_f32, mfcc_pos, mfcc_lengths,
+                          mfcc_coefs_f32, mfcc_dct_f32),
+        ARM_MATH_SUCCESS);
+
+    return JTEST_TEST_PASSED;
+}
+
+/* The sparse filterbank is compared to triangles computed in double precision */
+JTEST_DEFINE_TEST(arm_mfcc_filterbank_f32_test, arm_mfcc_filterbank_f32)
+{
+    float64_t melMin, melStep, left, center, right, f, w;
+    uint32_t i, j, m, k, c, numCoefs;
+
+    for (i = 0; i < MFCC_NUM_FFTLENS; i++)
+    {
+        for (j = 0; j < MFCC_NUM_NBMELS; j++)
+        {
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Mel Filters: %d\n",
+                            (int)mfcc_fftlens[i], (int)mfcc_nbmels[j]);
+
+            numCoefs = mfcc_tables(mfcc_fftlens[i], mfcc_nbmels[j]);
+
+            TEST_ASSERT_EQUAL(numCoefs <= mfcc_fftlens[i] + 2U, 1);
+
+            melMin = 1127.0 * log(1.0 + MFCC_F_MIN / 700.0);
+            melStep = (1127.0 * log(1.0 + MFCC_F_MAX / 700.0) - melMin) / (mfcc_nbmels[j] + 1);
+            c = 0;
+
+            for (m = 0; m < mfcc_nbmels[j]; m++)
+            {
+                left = 700.0 * (exp((melMin + m * melStep) / 1127.0) - 1.0);
+                center = 700.0 * (exp((melMin + (m + 1) * melStep) / 1127.0) - 1.0);
+                right = 700.0 * (exp((melMin + (m + 2) * melStep) / 1127.0) - 1.0);
+
+                for (k = 0; k <= mfcc_fftlens[i] / 2U; k++)
+                {
+                    f = k * MFCC_SAMPLE_RATE / mfcc_fftlens[i];
+                    w = (f <= center) ? (f - left) / (center - left) : (right - f) / (right - center);
+                    w = (w > 0.0) ? w : 0.0;
+
+                    if ((k >= mfcc_pos[m]) && (k < mfcc_pos[m] + mfcc_lengths[m]))
+                    {
+                        TEST_ASSERT_EQUAL(fabs(mfcc_coefs_f32[c] - w) < 1.0e-4, 1);
+                        c++;
+                    }
+                    else
+                    {
+                        /* Coefficients left out of the tables are zero */
+                        TEST_ASSERT_EQUAL(w < 1.0e-4, 1);
+                    }
+                }
+            }
+
+            TEST_ASSERT_EQUAL(c, numCoefs);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  MFCC test template.  Arguments are: function suffix (f32/q15), input type,
+  output type and the scale of the fractional output.
+*/
+#define MFCC_DEFINE_TEST(suffix, input_type, output_type, out_scale)    \
+    JTEST_DEFINE_TEST(arm_mfcc_##suffix##_test,                         \
+                      arm_mfcc_##suffix)                                \
+    {                                                                   \
+        arm_mfcc_instance_##suffix mfcc_inst_fut;                       \
+        input_type * pIn = (input_type *) transform_fft_##suffix##_inputs; \
+        float32_t * pInRef = transform_fft_input_ref;                   \
+        float32_t * pWindowRef = transform_fft_output_f32_ref;          \
+        float32_t * pCoefsRef = transform_fft_output_f32_fut;           \
+        output_type * pOut = (output_type *) transform_fft_output_fut;  \
+        output_type * pTmp = (output_type *) transform_fft_input_fut;   \
+        input_type preEmphasis;                                         \
+        float32_t preEmphasisRef;                                       \
+        uint32_t i, j, k, numCoefs;                                     \
+                                                                        \
+        for (i = 0; i < MFCC_NUM_FFTLENS; i++)                          \
+        {                                                               \
+            for (j = 0; j < MFCC_NUM_NBMELS; j++)                       \
+            {                                                           \
+                JTEST_DUMP_STRF("Block Size: %d\n"                      \
+                                "Mel Filters: %d\n",                    \
+                                (int)mfcc_fftlens[i], (int)mfcc_nbmels[j]); \
+                                                                        \
+                numCoefs = mfcc_tables(mfcc_fftlens[i], mfcc_nbmels[j]); \
+                                                                        \
+                /* The reference uses the tables of the function */     \
+                TEST_CONVERT_TO_FLOAT(mfcc_window_##suffix, pWindowRef, \
+                                      mfcc_fftlens[i], input_type);     \
+                TEST_CONVERT_TO_FLOAT(mfcc_coefs_##suffix, pCoefsRef,   \
+                                      numCoefs, input_type);            \
+                TEST_CONVERT_TO_FLOAT(pIn, pInRef, mfcc_fftlens[i], input_type); \
+                                                                        \
+                preEmphasisRef = MFCC_PRE_EMPHASIS;                     \
+                TEST_CONVERT_FLOAT_TO(&preEmphasisRef, &preEmphasis, 1, input_type); \
+                TEST_CONVERT_TO_FLOAT(&preEmphasis, &preEmphasisRef, 1, input_type); \
+                                                                        \
+                TEST_ASSERT_EQUAL(                                      \
+                    arm_mfcc_init_##suffix(                             \
+                        &mfcc_inst_fut, mfcc_fftlens[i], mfcc_nbmels[j], \
+                        MFCC_NUM_DCT, preEmphasis,                      \
+                        mfcc_window_##suffix, mfcc_pos, mfcc_lengths,   \
+                        mfcc_coefs_##suffix, mfcc_dct_##suffix),        \
+                    ARM_MATH_SUCCESS);                                  \
+                                                                        \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_mfcc_##suffix(&mfcc_inst_fut, pIn, pOut, pTmp)); \
+                                                                        \
+                mfcc_ref_f32(pInRef, pWindowRef, pCoefsRef, preEmphasisRef, \
+                             mfcc_fftlens[i], mfcc_nbmels[j], mfcc_ref); \
+                                                                        \
+                for (k = 0; k < MFCC_NUM_DCT; k++)                      \
+                {                                                       \
+                    mfcc_fut[k] = (float32_t) pOut[k] / (out_scale);    \
+                }                                                       \
+                                                                        \
+                /* Test correctness */                                  \
+                TEST_ASSERT_SNR(mfcc_ref, mfcc_fut, MFCC_NUM_DCT,       \
+                                MFCC_SNR_THRESHOLD_##suffix);           \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+MFCC_DEFINE_TEST(f32, float32_t, float32_t, 1.0f);
+MFCC_DEFINE_TEST(q15, q15_t, q31_t, 1048576.0f);
+
+/* Cycles of the sparse filterbank and of the dense matrix multiplication */
+JTEST_DEFINE_TEST(arm_mfcc_filterbank_f32_benchmark_test, arm_mfcc_f32)
+{
+    arm_mfcc_instance_f32 mfcc_inst_fut;
+    arm_matrix_instance_f32 dense, power, mel;
+    float32_t * pDense = transform_fft_output_ref;
+    float32_t * pPower = transform_fft_input_ref;
+    float32_t * pMel = transform_fft_output_f32_fut;
+    const float32_t * pCoefs;
+    uint16_t fftLen = 256;
+    uint16_t nbMel = 40;
+    uint32_t numBins = fftLen / 2U + 1U;
+    uint32_t m, k, sparseCycles, denseCycles, mfccCycles;
+
+    mfcc_tables(fftLen, nbMel);
+
+    /* Dense filterbank matrix built from the sparse tables */
+    pCoefs = mfcc_coefs_f32;
+
+    for (m = 0; m < nbMel; m++)
+    {
+        for (k = 0; k < numBins; k++)
+        {
+            pDense[m * numBins + k] =
+                ((k >= mfcc_pos[m]) && (k < mfcc_pos[m] + mfcc_lengths[m])) ? *pCoefs++ : 0.0f;
+        }
+    }
+
+    for (k = 0; k < numBins; k++)
+    {
+        pPower[k] = transform_fft_f32_inputs[k] * transform_fft_f32_inputs[k];
+    }
+
+    arm_mat_init_f32(&dense, nbMel, numBins, pDense);
+    arm_mat_init_f32(&power, numBins, 1, pPower);
+    arm_mat_init_f32(&mel, nbMel, 1, pMel);
+
+    JTEST_MEASURE_CYCLES(denseCycles, arm_mat_mult_f32(&dense, &power, &mel));
+
+    JTEST_MEASURE_CYCLES(sparseCycles,
+                         pCoefs = mfcc_coefs_f32;
+                         for (m = 0; m < nbMel; m++)
+                         {
+                             arm_dot_prod_f32(pPower + mfcc_pos[m], (float32_t *) pCoefs,
+                                              mfcc_lengths[m], pMel + m);
+                             pCoefs += mfcc_lengths[m];
+                         });
+
+    arm_mfcc_init_f32(&mfcc_inst_fut, fftLen, nbMel, MFCC_NUM_DCT, MFCC_PRE_EMPHASIS,
+                      mfcc_window_f32, mfcc_pos, mfcc_lengths,
+                      mfcc_coefs_f32, mfcc_dct_f32);
+
+    JTEST_MEASURE_CYCLES(mfccCycles,
+                         arm_mfcc_f32(&mfcc_inst_fut, transform_fft_f32_inputs,
+                                      mfcc_fut, transform_fft_input_fut));
+
+    JTEST_DUMP_STRF("Block Size: %d\n"
+                    "Mel Filters: %d\n",
+                    (int)fftLen, (int)nbMel);
+
+    JTEST_DUMP_STRF("Dense Filterbank Cycles: %d\n"
+                    "Sparse Filterbank Cycles: %d\n"
+                    "arm_mfcc_f32 Cycles: %d\n",
+                    (int)denseCycles, (int)sparseCycles, (int)mfccCycles);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mfcc_tests)
+{
+    JTEST_TEST_CALL(arm_mfcc_init_f32_test);
+    JTEST_TEST_CALL(arm_mfcc_filterbank_f32_test);
+    JTEST_TEST_CALL(arm_mfcc_f32_test);
+    JTEST_TEST_CALL(arm_mfcc_q15_test);
+    JTEST_TEST_CALL(arm_mfcc_filterbank_f32_benchmark_test);
+}
@@ -64,6 +64,243 @@ FFT fast function test template. Arguments are: function configuration suffix
 RFFT_FAST_DEFINE_TEST(forward, 0U);
 RFFT_FAST_DEFINE_TEST(inverse, 1U);
 
+/*
+  In-place fast RFFT test template. Arguments are: function configuration suffix
+  and inverse-transform flag.  The input is copied to the output buffer of the
+  function under test, which is transformed in place.
+*/
+#define RFFT_FAST_INPLACE_DEFINE_TEST(config_suffix, ifft_flag)         \
+    JTEST_DEFINE_TEST(arm_rfft_fast_inplace_f32_##config_suffix##_test, \
+                      arm_rfft_fast_inplace_f32)                        \
+    {                                                                   \
+        arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};         \
+        arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};         \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+                                                                        \
+            /* Initialize the RFFT and CFFT Instances */                \
+            arm_rfft_fast_init_f32(                                     \
+                &rfft_inst_fut, fftlen);                                \
+                                                                        \
+            arm_rfft_fast_init_f32(                                     \
+                &rfft_inst_ref, fftlen);                                \
+                                                                        \
+            memcpy(transform_fft_output_fut,                            \
+                   transform_fft_f32_inputs,                            \
+                   fftlen * sizeof(float32_t));                         \
+                                                                        \
+            memcpy(transform_fft_input_ref,                             \
+                   transform_fft_f32_inputs,                            \
+                   fftlen * sizeof(float32_t));                         \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                         (int)fftlen,                                   \
+                         (int)ifft_flag);                               \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_rfft_fast_inplace_f32(                              \
+                    &rfft_inst_fut,                                     \
+                    (void *) transform_fft_output_fut,                  \
+                    ifft_flag));                                        \
+                                                                        \
+            ref_rfft_fast_f32(                                          \
+                &rfft_inst_ref,                                         \
+                (void *) transform_fft_input_ref,                       \
+                (void *) transform_fft_output_ref,                      \
+                ifft_flag);                                             \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                            \
+                fftlen,                                                 \
+                float32_t));                                            \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+RFFT_FAST_INPLACE_DEFINE_TEST(forward, 0U);
+RFFT_FAST_INPLACE_DEFINE_TEST(inverse, 1U);
+
+/*
+  Fixed-point fast RFFT test template. Arguments are: function suffix (q15/q31),
+  function configuration suffix, inverse-transform flag and the input and output
+  type.  The reference is the floating-point fast RFFT of the converted input,
+  the output of the function under test is scaled up by the returned number of
+  bits before the comparison.  The inverse inputs are downshifted by one bit to
+  leave headroom for the merge stage.
+*/
+#define RFFT_FAST_Q_DEFINE_TEST(suffix, config_suffix,                  \
+                                ifft_flag, output_type)                 \
+    JTEST_DEFINE_TEST(arm_rfft_fast_##suffix##_##config_suffix##_test,  \
+                      arm_rfft_fast_##suffix)                           \
+    {                                                                   \
+        arm_rfft_fast_instance_##suffix rfft_inst_fut = {0};            \
+        arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};         \
+        uint32_t scale, i;                                              \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+                                                                        \
+            /* Initialize the RFFT Instances */                         \
+            arm_rfft_fast_init_##suffix(                                \
+                &rfft_inst_fut, fftlen);                                \
+                                                                        \
+            arm_rfft_fast_init_f32(                                     \
+                &rfft_inst_ref, fftlen);                                \
+                                                                        \
+            memcpy(transform_fft_input_fut,                             \
+                   transform_fft_##suffix##_inputs,                     \
+                   fftlen * sizeof(output_type));                       \
+                                                                        \
+            if (ifft_flag)                                              \
+            {                                                           \
+                for (i = 0; i < fftlen; i++)                            \
+                {                                                       \
+                    ((output_type *) transform_fft_input_fut)[i] >>= 1; \
+                }                                                       \
+            }                                                           \
+                                                                        \
+            TEST_CONVERT_TO_FLOAT(                                      \
+                (output_type *) transform_fft_input_fut,                \
+                transform_fft_input_ref,                                \
+                fftlen,                                                 \
+                output_type);                                           \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                         (int)fftlen,                                   \
+                         (int)ifft_flag);                               \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                scale = arm_rfft_fast_##suffix(                         \
+                    &rfft_inst_fut,                                     \
+                    (void *) transform_fft_input_fut,                   \
+                    (void *) transform_fft_output_fut,                  \
+                    ifft_flag));                                        \
+                                                                        \
+            ref_rfft_fast_f32(                                          \
+                &rfft_inst_ref,                                         \
+                transform_fft_input_ref,                                \
+                transform_fft_output_ref,                               \
+                ifft_flag);                                             \
+                                                                        \
+            /* The forward transform is scaled by 1/fftLen */           \
+            TEST_ASSERT_EQUAL(                                          \
+                scale,                                                  \
+                (ifft_flag) ? 0U : (uint32_t) (31 - __CLZ(fftlen)));    \
+                                                                        \
+            TEST_CONVERT_TO_FLOAT(                                      \
+                (output_type *) transform_fft_output_fut,               \
+                transform_fft_output_f32_fut,                           \
+                fftlen,                                                 \
+                output_type);                                           \
+                                                                        \
+            for (i = 0; i < fftlen; i++)                                \
+            {                                                           \
+                transform_fft_output_f32_fut[i] *=                      \
+                    (float32_t) (1U << scale);                          \
+            }                                                           \
+                                                                        \
+            /* Test correctness */                                      \
+            TEST_ASSERT_SNR(                                            \
+                transform_fft_output_ref,                               \
+                transform_fft_output_f32_fut,                           \
+                fftlen,                                                 \
+                TRANSFORM_SNR_THRESHOLD_##output_type));                \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+RFFT_FAST_Q_DEFINE_TEST(q31, forward, 0U, q31_t);
+RFFT_FAST_Q_DEFINE_TEST(q15, forward, 0U, q15_t);
+RFFT_FAST_Q_DEFINE_TEST(q31, inverse, 1U, q31_t);
+RFFT_FAST_Q_DEFINE_TEST(q15, inverse, 1U, q15_t);
+
+/*
+  Half-precision fast RFFT test template. Arguments are: function configuration
+  suffix and inverse-transform flag.  The input is scaled down so that the
+  spectrum stays in the half-precision range and rounded to half precision, the
+  reference is the floating-point fast RFFT of the rounded input.
+*/
+#define RFFT_FAST_F16_INPUT_SCALE   128.0f
+#define RFFT_FAST_F16_SNR_THRESHOLD 55
+
+#define RFFT_FAST_F16_DEFINE_TEST(config_suffix, ifft_flag)             \
+    JTEST_DEFINE_TEST(arm_rfft_fast_f16_##config_suffix##_test,         \
+                      arm_rfft_fast_f16)                                \
+    {                                                                   \
+        arm_rfft_fast_instance_f16 rfft_inst_fut = {0};                 \
+        arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};         \
+        float16_t *pIn = (float16_t *) transform_fft_input_fut;         \
+        float16_t *pOut = (float16_t *) transform_fft_output_fut;       \
+        uint32_t i;                                                     \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+                                                                        \
+            /* Initialize the RFFT Instances */                         \
+            TEST_ASSERT_EQUAL(                                          \
+                arm_rfft_fast_init_f16(&rfft_inst_fut, fftlen),         \
+                ARM_MATH_SUCCESS);                                      \
+                                                                        \
+            arm_rfft_fast_init_f32(                                     \
+                &rfft_inst_ref, fftlen);                                \
+                                                                        \
+            for (i = 0; i < fftlen; i++)                                \
+            {                                                           \
+                transform_fft_output_f32_fut[i] =                       \
+                    transform_fft_f32_inputs[i] / RFFT_FAST_F16_INPUT_SCALE;\
+            }                                                           \
+                                                                        \
+            arm_float_to_f16(transform_fft_output_f32_fut, pIn, fftlen);\
+            arm_f16_to_float(pIn, transform_fft_input_ref, fftlen);     \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                         (int)fftlen,                                   \
+                         (int)ifft_flag);                               \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_rfft_fast_f16(                                      \
+                    &rfft_inst_fut,                                     \
+                    pIn,                                                \
+                    pOut,                                               \
+                    ifft_flag));                                        \
+                                                                        \
+            ref_rfft_fast_f32(                                          \
+                &rfft_inst_ref,                                         \
+                transform_fft_input_ref,                                \
+                transform_fft_output_ref,                               \
+                ifft_flag);                                             \
+                                                                        \
+            arm_f16_to_float(pOut, transform_fft_output_f32_fut, fftlen);\
+                                                                        \
+            /* Test correctness */                                      \
+            TEST_ASSERT_SNR(                                            \
+                transform_fft_output_ref,                               \
+                transform_fft_output_f32_fut,                           \
+                fftlen,                                                 \
+                RFFT_FAST_F16_SNR_THRESHOLD));                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+RFFT_FAST_F16_DEFINE_TEST(forward, 0U);
+RFFT_FAST_F16_DEFINE_TEST(inverse, 1U);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -72,4 +309,12 @@ JTEST_DEFINE_GROUP(rfft_fast_tests)
 {
     JTEST_TEST_CALL(arm_rfft_fast_f32_forward_test);
     JTEST_TEST_CALL(arm_rfft_fast_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_inplace_f32_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_inplace_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q31_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q15_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q31_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q15_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_f16_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_f16_inverse_test);
 }
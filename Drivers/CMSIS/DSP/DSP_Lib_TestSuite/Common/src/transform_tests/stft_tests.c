@@ -0,0 +1,222 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*
+  The STFT is fed with 2*fftLen samples in irregular chunks, so that frames
+  start and end in the middle of a chunk and the input ring wraps at every
+  position.  The reference windows each frame of the whole input stream with
+  a window computed in double precision and takes the power of the reference
+  fast RFFT.
+*/
+
+static const uint32_t stft_chunks[] =
+{
+    1, 29, 256, 3, 700
+};
+
+#define STFT_NUM_CHUNKS (sizeof(stft_chunks) / sizeof(uint32_t))
+
+static const arm_window_type stft_windows[] =
+{
+    ARM_WINDOW_HANN, ARM_WINDOW_HAMMING, ARM_WINDOW_BLACKMAN
+};
+
+#define STFT_NUM_WINDOWS (sizeof(stft_windows) / sizeof(arm_window_type))
+
+/* Reference periodic window */
+static void stft_ref_window(
+    arm_window_type type,
+    float32_t * pDst,
+    uint32_t fftLen)
+{
+    uint32_t n;
+    float64_t c1, c2;
+
+    for (n = 0; n < fftLen; n++)
+    {
+        c1 = cos(2.0 * PI * n / fftLen);
+        c2 = cos(4.0 * PI * n / fftLen);
+
+        switch (type)
+        {
+        case ARM_WINDOW_HAMMING:
+            pDst[n] = (float32_t) (0.54 - 0.46 * c1);
+            break;
+
+        case ARM_WINDOW_BLACKMAN:
+            pDst[n] = (float32_t) (0.42 - 0.5 * c1 + 0.08 * c2);
+            break;
+
+        default:
+            pDst[n] = (float32_t) (0.5 - 0.5 * c1);
+            break;
+        }
+    }
+}
+
+/* Reference power spectra of all the frames of a stream, returns the number of frames */
+static uint32_t stft_ref_f32(
+    float32_t * pSrc,
+    float32_t * pWindow,
+    uint32_t fftLen,
+    uint32_t hopSize,
+    uint32_t numSamples,
+    float32_t * pDst)
+{
+    arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};
+    float32_t * pFrame = transform_fft_input_ref;
+    float32_t * pSpec = transform_fft_output_f32_ref;
+    uint32_t end, i, numFrames = 0;
+
+    arm_rfft_fast_init_f32(&rfft_inst_ref, fftLen);
+
+    for (end = fftLen; end <= numSamples; end += hopSize)
+    {
+        for (i = 0; i < fftLen; i++)
+        {
+            pFrame[i] = pSrc[end - fftLen + i] * pWindow[i];
+        }
+
+        ref_rfft_fast_f32(&rfft_inst_ref, pFrame, pSpec, 0);
+
+        pDst[0] = pSpec[0] * pSpec[0];
+        pDst[fftLen / 2] = pSpec[1] * pSpec[1];
+
+        for (i = 1; i < fftLen / 2; i++)
+        {
+            pDst[i] = pSpec[2 * i] * pSpec[2 * i] + pSpec[2 * i + 1] * pSpec[2 * i + 1];
+        }
+
+        pDst += fftLen / 2 + 1;
+        numFrames++;
+    }
+
+    return numFrames;
+}
+
+/*
+  STFT test template.  Arguments are: function suffix (f32/q15), input type,
+  output type and the number of bits by which the fractional output is
+  scaled down (0 for f32, 2 for the 3.29 power of the q15 function).  The
+  output of the q15 function is the power divided by fftLen*fftLen.
+*/
+#define STFT_DEFINE_TEST(suffix, input_type, output_type, out_shift)    \
+    JTEST_DEFINE_TEST(arm_stft_##suffix##_test,                         \
+                      arm_stft_##suffix)                                \
+    {                                                                   \
+        arm_stft_instance_##suffix stft_inst_fut;                       \
+        input_type * pWinFut = (input_type *) transform_fft_output_f32_fut; \
+        input_type * pStream = (input_type *) transform_fft_##suffix##_inputs; \
+        output_type * pOut = (output_type *) transform_fft_output_fut;  \
+        float32_t * pWinRef;                                            \
+        float32_t * pStreamRef;                                         \
+        uint32_t numFrames, refFrames, done, chunk, c, w, h, i, hopSize; \
+        float32_t scale;                                                \
+                                                                        \
+        /* A hop of 0 is rejected */                                    \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_stft_init_##suffix(&stft_inst_fut, 256, 0,              \
+                                   pWinFut,                             \
+                                   (input_type *) transform_fft_input_fut), \
+            ARM_MATH_ARGUMENT_ERROR);                                   \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+            pWinRef = transform_fft_output_f32_fut + fftlen;            \
+            pStreamRef = transform_fft_output_f32_fut + 2 * fftlen;     \
+            scale = (float32_t) (1U << out_shift) *                     \
+                    ((out_shift) ? (float32_t) fftlen * fftlen : 1.0f); \
+                                                                        \
+            TEST_CONVERT_TO_FLOAT(pStream, pStreamRef,                  \
+                                  2 * fftlen, input_type);              \
+                                                                        \
+            for (w = 0; w < STFT_NUM_WINDOWS; w++)                      \
+            {                                                           \
+                arm_window_##suffix(stft_windows[w], pWinFut, fftlen);  \
+                stft_ref_window(stft_windows[w], pWinRef, fftlen);      \
+                                                                        \
+                for (h = 2; h <= 4; h += 2)                             \
+                {                                                       \
+                    hopSize = fftlen / h;                               \
+                                                                        \
+                    /* Display parameter values */                      \
+                    JTEST_DUMP_STRF("Block Size: %d\n"                  \
+                                    "Hop Size: %d\n"                    \
+                                    "Window: %d\n",                     \
+                                    (int)fftlen,                        \
+                                    (int)hopSize,                       \
+                                    (int)stft_windows[w]);              \
+                                                                        \
+                    TEST_ASSERT_EQUAL(                                  \
+                        arm_stft_init_##suffix(                         \
+                            &stft_inst_fut, fftlen, hopSize, pWinFut,   \
+                            (input_type *) transform_fft_input_fut),    \
+                        ARM_MATH_SUCCESS);                              \
+                                                                        \
+                    numFrames = 0;                                      \
+                    done = 0;                                           \
+                    c = 0;                                              \
+                                                                        \
+                    while (done < 2U * fftlen)                          \
+                    {                                                   \
+                        chunk = stft_chunks[c++ % STFT_NUM_CHUNKS];     \
+                        chunk = (chunk < 2U * fftlen - done) ?          \
+                            chunk : 2U * fftlen - done;                 \
+                                                                        \
+                        JTEST_COUNT_CYCLES(                             \
+                            numFrames += arm_stft_##suffix(             \
+                                &stft_inst_fut,                         \
+                                pStream + done,                         \
+                                pOut + numFrames * (fftlen / 2 + 1),    \
+                                chunk));                                \
+                                                                        \
+                        done += chunk;                                  \
+                    }                                                   \
+                                                                        \
+                    refFrames = stft_ref_f32(                           \
+                        pStreamRef, pWinRef, fftlen, hopSize,           \
+                        2 * fftlen, transform_fft_output_ref);          \
+                                                                        \
+                    TEST_ASSERT_EQUAL(numFrames, refFrames);            \
+                                                                        \
+                    /* Convert the output in place and restore its scale */ \
+                    TEST_CONVERT_TO_FLOAT(                              \
+                        pOut, transform_fft_output_fut,                 \
+                        numFrames * (fftlen / 2 + 1), output_type);     \
+                                                                        \
+                    for (i = 0; i < numFrames * (fftlen / 2 + 1); i++)  \
+                    {                                                   \
+                        transform_fft_output_fut[i] *= scale;           \
+                    }                                                   \
+                                                                        \
+                    /* Test correctness */                              \
+                    TEST_ASSERT_SNR(                                    \
+                        transform_fft_output_ref,                       \
+                        transform_fft_output_fut,                       \
+                        numFrames * (fftlen / 2 + 1),                   \
+                        TRANSFORM_SNR_THRESHOLD_##input_type);          \
+                }                                                       \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+STFT_DEFINE_TEST(f32, float32_t, float32_t, 0);
+STFT_DEFINE_TEST(q15, q15_t, q31_t, 2);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stft_tests)
+{
+    JTEST_TEST_CALL(arm_stft_f32_test);
+    JTEST_TEST_CALL(arm_stft_q15_test);
+}
@@ -3309,3 +3309,23 @@ ARR_DESC_DEFINE(const arm_cfft_instance_q15 *,
                     /* &arm_cfft_sR_q15_len2048, */
                     /* &arm_cfft_sR_q15_len4096 */
                     ));
+
+/*--------------------------------------------------------------------------------*/
+/* CFFT_f16 Structs */
+/*--------------------------------------------------------------------------------*/
+
+/* Uses radix2 lengths */
+ARR_DESC_DEFINE(const arm_cfft_instance_f16 *,
+                transform_cfft_f16_structs,
+                5,
+                CURLY(
+                    &arm_cfft_sR_f16_len16,
+                    &arm_cfft_sR_f16_len32,
+                    &arm_cfft_sR_f16_len64,
+                    &arm_cfft_sR_f16_len128,
+                    &arm_cfft_sR_f16_len256/*,
+                       &arm_cfft_sR_f16_len512, */
+                    /* &arm_cfft_sR_f16_len1024, */
+                    /* &arm_cfft_sR_f16_len2048, */
+                    /* &arm_cfft_sR_f16_len4096 */
+                    ));
@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch.h
+ * Description:  Multi-threaded batch processing of independent channels on a host.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_BATCH_H
+#define _ARM_BATCH_H
+
+#include "arm_math.h"
+
+/*
+ * The batch functions use POSIX threads and are only built on hosts,
+ * the source files are empty for the Cortex-M targets.
+ */
+#if defined (__unix__) || defined (__APPLE__)
+  #define ARM_BATCH_AVAILABLE
+#endif
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+#include <pthread.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Task run by the pool for each index.
+   * @param[in] pArg      argument given to arm_batch_run().
+   * @param[in] index     index of the task.
+   * @param[in] pScratch  scratch buffer of the thread that runs the task.
+   */
+  typedef void (*arm_batch_task)(
+  void * pArg,
+  uint32_t index,
+  float32_t * pScratch);
+
+  struct arm_batch_instance_s;
+
+  /**
+   * @brief Worker of a batch pool, aligned on a cache line so that the workers do not share one.
+   */
+  typedef struct
+  {
+    pthread_mutex_t lock;                /**< protects the task range. */
+    uint32_t begin;                      /**< first task left to the worker. */
+    uint32_t end;                        /**< end of the tasks left to the worker. */
+    float32_t *pScratch;                 /**< scratch buffer, allocated by the worker thread. */
+    pthread_t thread;                    /**< thread of the worker, unused for worker 0. */
+    uint32_t id;                         /**< index of the worker. */
+    struct arm_batch_instance_s *pPool;  /**< pool of the worker. */
+  } __attribute__ ((aligned (64))) arm_batch_worker;
+
+  /**
+   * @brief Instance structure for a batch pool.
+   */
+  typedef struct arm_batch_instance_s
+  {
+    uint32_t numThreads;                 /**< number of workers, including the calling thread. */
+    uint32_t scratchSize;                /**< number of values of each scratch buffer. */
+    uint8_t pinThreads;                  /**< nonzero to bind each worker to a processor. */
+    arm_batch_worker *pWorkers;          /**< points to the workers. */
+    pthread_mutex_t lock;                /**< protects the fields below. */
+    pthread_cond_t start;                /**< signals a new batch to the workers. */
+    pthread_cond_t done;                 /**< signals the end of the work of all workers. */
+    uint32_t generation;                 /**< number of batches started. */
+    uint32_t active;                     /**< number of worker threads still working. */
+    uint8_t stop;                        /**< nonzero to terminate the worker threads. */
+    arm_batch_task task;                 /**< task of the current batch. */
+    void *pArg;                          /**< argument of the current batch. */
+  } arm_batch_instance;
+
+
+  /**
+   * @brief Initialization function for a batch pool.
+   * @param[out] S            points to an instance of the batch pool structure.
+   * @param[in]  numThreads   number of workers, including the calling thread.
+   * @param[in]  scratchSize  number of float32_t values of the scratch buffer of each worker.
+   * @param[in]  pinThreads   nonzero to bind each worker to a processor.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the threads or the buffers
+   *             cannot be created.
+   */
+  arm_status arm_batch_init(
+  arm_batch_instance * S,
+  uint32_t numThreads,
+  uint32_t scratchSize,
+  uint8_t pinThreads);
+
+
+  /**
+   * @brief Terminates the threads of a batch pool and frees its buffers.
+   * @param[in,out] S  points to an instance of the batch pool structure.
+   */
+  void arm_batch_deinit(
+  arm_batch_instance * S);
+
+
+  /**
+   * @brief Runs tasks 0 to numTasks-1 on the pool and waits for them.
+   * @param[in,out] S         points to an instance of the batch pool structure.
+   * @param[in]     task      task to run.
+   * @param[in]     pArg      argument of the task.
+   * @param[in]     numTasks  number of tasks.
+   */
+  void arm_batch_run(
+  arm_batch_instance * S,
+  arm_batch_task task,
+  void * pArg,
+  uint32_t numTasks);
+
+
+  /**
+   * @brief Runs the tasks of a worker, then steals tasks from the other workers.
+   * @param[in,out] pWorker  points to the worker.
+   */
+  void arm_batch_work(
+  arm_batch_worker * pWorker);
+
+
+  /**
+   * @brief Clears channel buffers from the workers that will process them.
+   * @param[in,out] S            points to an instance of the batch pool structure.
+   * @param[out]    pBuf         points to the buffer of the channels.
+   * @param[in]     channelSize  number of values of each channel.
+   * @param[in]     numChannels  number of channels.
+   */
+  void arm_batch_first_touch(
+  arm_batch_instance * S,
+  float32_t * pBuf,
+  uint32_t channelSize,
+  uint32_t numChannels);
+
+
+  /**
+   * @brief Floating-point FIR filters of independent channels.
+   * @param[in,out] S            points to an instance of the batch pool structure.
+   * @param[in]     pInst        points to the FIR instances, one per channel.
+   * @param[in]     pSrc         points to the input, blockSize values per channel.
+   * @param[out]    pDst         points to the output, blockSize values per channel.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     blockSize    number of samples of each channel.
+   */
+  void arm_batch_fir_f32(
+  arm_batch_instance * S,
+  arm_fir_instance_f32 * pInst,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numChannels,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point transposed direct form II biquad cascades of independent channels.
+   * @param[in,out] S            points to an instance of the batch pool structure.
+   * @param[in]     pInst        points to the biquad instances, one per channel.
+   * @param[in]     pSrc         points to the input, blockSize values per channel.
+   * @param[out]    pDst         points to the output, blockSize values per channel.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     blockSize    number of samples of each channel.
+   */
+  void arm_batch_biquad_cascade_df2T_f32(
+  arm_batch_instance * S,
+  arm_biquad_cascade_df2T_instance_f32 * pInst,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numChannels,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point complex FFTs of independent channels.
+   * @param[in,out] S               points to an instance of the batch pool structure.
+   * @param[in]     pCfft           points to the complex FFT instance shared by the channels.
+   * @param[in,out] p1              points to the data, 2*fftLen values per channel, processed in place.
+   * @param[in]     numChannels     number of channels.
+   * @param[in]     ifftFlag        0 for the forward transform, 1 for the inverse transform.
+   * @param[in]     bitReverseFlag  1 for the output in normal order.
+   */
+  void arm_batch_cfft_f32(
+  arm_batch_instance * S,
+  const arm_cfft_instance_f32 * pCfft,
+  float32_t * p1,
+  uint32_t numChannels,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+
+  /**
+   * @brief Floating-point real FFTs of independent channels, the input is not modified.
+   * @param[in,out] S            points to an instance of the batch pool structure, scratchSize >= fftLen.
+   * @param[in]     pRfft        points to the real FFT instance shared by the channels.
+   * @param[in]     pSrc         points to the input, fftLen values per channel.
+   * @param[out]    pDst         points to the output, fftLen values per channel.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     ifftFlag     0 for the forward transform, 1 for the inverse transform.
+   */
+  void arm_batch_rfft_fast_f32(
+  arm_batch_instance * S,
+  arm_rfft_fast_instance_f32 * pRfft,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numChannels,
+  uint8_t ifftFlag);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
+
+#endif /* _ARM_BATCH_H */
+
+/**
+ *
+ * End of file.
+ */
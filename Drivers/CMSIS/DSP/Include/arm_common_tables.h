@@ -118,4 +118,15 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Tables for Fast Math exponential, logarithm, arc tangent and hyperbolic tangent,
+   the tanh tables carry the arm_ prefix, CMSIS NN has its own tanhTable_q15 */
+extern const q31_t exp2Table_q31[FAST_MATH_TABLE_SIZE + 1];
+extern const q15_t exp2Table_q15[FAST_MATH_TABLE_SIZE + 1];
+extern const q31_t log2Table_q31[FAST_MATH_TABLE_SIZE + 1];
+extern const q15_t log2Table_q15[FAST_MATH_TABLE_SIZE + 1];
+extern const q31_t atanTable_q31[FAST_MATH_TABLE_SIZE + 1];
+extern const q15_t atanTable_q15[FAST_MATH_TABLE_SIZE + 1];
+extern const q31_t arm_tanhTable_q31[FAST_MATH_TABLE_SIZE + 1];
+extern const q15_t arm_tanhTable_q15[FAST_MATH_TABLE_SIZE + 1];
+
 #endif /*  ARM_COMMON_TABLES_H */
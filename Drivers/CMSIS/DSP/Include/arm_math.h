@@ -404,7 +404,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix cannot be decomposed. */
   } arm_status;
 
   /**
@@ -437,6 +438,25 @@ extern "C"
    */
   typedef double float64_t;
 
+  /**
+   * @brief 16-bit floating-point type definition, IEEE 754 binary16.
+   *
+   * It is a storage format: the float16_t functions load, convert to float32_t,
+   * compute in float32_t and round the results back.  The _Float16 type is used
+   * when the compiler provides it, which covers recent host compilers and Arm
+   * compilers.  __fp16 is not used since it cannot be passed to or returned from
+   * functions.  Otherwise, or when ARM_MATH_FLOAT16_SOFT is defined, float16_t
+   * holds the bit pattern in a uint16_t and the conversions are done in software;
+   * values must then be converted with convert_f32_to_f16() and
+   * convert_f16_to_f32() rather than by assignment.
+   */
+#if !defined (ARM_MATH_FLOAT16_SOFT) && defined (__FLT16_MANT_DIG__)
+  typedef _Float16 float16_t;
+  #define ARM_MATH_FLOAT16_NATIVE
+#else
+  typedef uint16_t float16_t;
+#endif
+
   /**
    * @brief definition to read/write two 16 bit values.
    */
@@ -514,6 +534,97 @@ extern "C"
 #endif
 
 
+  /**
+   * @brief Converts a half-precision value to single precision.
+   */
+  CMSIS_INLINE __STATIC_INLINE float32_t convert_f16_to_f32(
+  float16_t x)
+  {
+#if defined (ARM_MATH_FLOAT16_NATIVE)
+    return ((float32_t) x);
+#else
+    union { float32_t f; uint32_t u; } v;
+    uint32_t sign = ((uint32_t) x & 0x8000U) << 16;
+    uint32_t exponent = ((uint32_t) x >> 10) & 0x1FU;
+    uint32_t mantissa = (uint32_t) x & 0x3FFU;
+
+    if (exponent == 0x1FU)
+    {
+      /* Infinity or NaN */
+      v.u = sign | 0x7F800000U | (mantissa << 13);
+    }
+    else if (exponent != 0U)
+    {
+      /* Normal value, rebias the exponent from 15 to 127 */
+      v.u = sign | ((exponent + 112U) << 23) | (mantissa << 13);
+    }
+    else
+    {
+      /* Zero or subnormal value, mantissa * 2^-24 is exact in single precision */
+      v.f = (float32_t) mantissa * 5.9604644775390625e-8f;
+      v.u |= sign;
+    }
+
+    return (v.f);
+#endif
+  }
+
+  /**
+   * @brief Converts a single-precision value to half precision, rounding to nearest even.
+   */
+  CMSIS_INLINE __STATIC_INLINE float16_t convert_f32_to_f16(
+  float32_t x)
+  {
+#if defined (ARM_MATH_FLOAT16_NATIVE)
+    return ((float16_t) x);
+#else
+    union { float32_t f; uint32_t u; } v;
+    uint32_t sign, a, mantissa, shift, rem, half, h;
+
+    v.f = x;
+    sign = (v.u >> 16) & 0x8000U;
+    a = v.u & 0x7FFFFFFFU;
+
+    if (a > 0x7F800000U)
+    {
+      /* NaN, kept quiet */
+      h = 0x7E00U;
+    }
+    else if (a >= 0x477FF000U)
+    {
+      /* 65520 and above round to infinity */
+      h = 0x7C00U;
+    }
+    else if (a >= 0x38800000U)
+    {
+      /* Normal value: round the mantissa to 10 bits and rebias the exponent */
+      a += 0x0FFFU + ((a >> 13) & 1U);
+      h = (a - 0x38000000U) >> 13;
+    }
+    else if (a >= 0x33000000U)
+    {
+      /* Subnormal value: round mantissa * 2^(exponent-126) to an integer */
+      mantissa = (a & 0x7FFFFFU) | 0x800000U;
+      shift = 126U - (a >> 23);
+      h = mantissa >> shift;
+      rem = mantissa & ((1U << shift) - 1U);
+      half = 1U << (shift - 1U);
+
+      if ((rem > half) || ((rem == half) && ((h & 1U) != 0U)))
+      {
+        h++;
+      }
+    }
+    else
+    {
+      /* Below half of the smallest subnormal */
+      h = 0U;
+    }
+
+    return ((float16_t) (sign | h));
+#endif
+  }
+
   /**
    * @brief Clips Q63 to Q31 values.
    */
@@ -1044,6 +1155,16 @@ extern "C"
     float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
   } arm_fir_instance_f32;
 
+  /**
+   * @brief Instance structure for the half-precision FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+    float16_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float16_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_instance_f16;
+
 
   /**
    * @brief Processing function for the Q7 FIR filter.
@@ -1195,6 +1316,205 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the half-precision FIR filter.
+   * @param[in]  S          points to an instance of the half-precision FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_f16(
+  const arm_fir_instance_f16 * S,
+  float16_t * pSrc,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the half-precision FIR filter.
+   * @param[in,out] S          points to an instance of the half-precision FIR filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples that are processed at a time.
+   */
+  void arm_fir_init_f16(
+  arm_fir_instance_f16 * S,
+  uint16_t numTaps,
+  float16_t * pCoeffs,
+  float16_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q7 FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< write position in the circular delay line. */
+    q7_t *pState;             /**< points to the state variable array. The array is of length 2*stateLength. */
+    q7_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q7;
+
+  /**
+   * @brief Instance structure for the Q15 FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< write position in the circular delay line. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length 2*stateLength. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< write position in the circular delay line. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length 2*stateLength. */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< write position in the circular delay line. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length 2*stateLength. */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_f32;
+
+
+  /**
+   * @brief  Processing function for the Q7 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q7 FIR filter with circular state structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q7(
+  arm_fir_circ_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q7 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q7 FIR filter with circular state structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  largest number of samples that are processed in one pass.
+   */
+  void arm_fir_circ_init_q7(
+  arm_fir_circ_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t * pCoeffs,
+  q7_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Processing function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 FIR filter with circular state structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q15(
+  arm_fir_circ_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 FIR filter with circular state structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  largest number of samples that are processed in one pass.
+   */
+  void arm_fir_circ_init_q15(
+  arm_fir_circ_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Processing function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 FIR filter with circular state structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q31(
+  arm_fir_circ_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 FIR filter with circular state structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  largest number of samples that are processed in one pass.
+   */
+  void arm_fir_circ_init_q31(
+  arm_fir_circ_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Processing function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point FIR filter with circular state structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point FIR filter with circular state structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  largest number of samples that are processed in one pass.
+   */
+  void arm_fir_circ_init_f32(
+  arm_fir_circ_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1227,6 +1547,16 @@ extern "C"
     float32_t *pCoeffs;      /**< Points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_casd_df1_inst_f32;
 
+  /**
+   * @brief Instance structure for the half-precision Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float16_t *pState;       /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;      /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_casd_df1_inst_f16;
+
 
   /**
    * @brief Processing function for the Q15 Biquad cascade filter.
@@ -1344,6 +1674,34 @@ extern "C"
   float32_t * pState);
 
 
+  /**
+   * @brief Processing function for the half-precision Biquad cascade filter.
+   * @param[in]  S          points to an instance of the half-precision Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df1_f16(
+  const arm_biquad_casd_df1_inst_f16 * S,
+  float16_t * pSrc,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the half-precision Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the half-precision Biquad cascade structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the floating-point filter coefficients.
+   * @param[in]     pState     points to the half-precision state buffer.
+   */
+  void arm_biquad_cascade_df1_init_f16(
+  arm_biquad_casd_df1_inst_f16 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float16_t * pState);
+
+
   /**
    * @brief Instance structure for the floating-point matrix structure.
    */
@@ -1711,6 +2069,146 @@ extern "C"
   float32_t * pData);
 
 
+  /**
+   * @brief Floating-point matrix multiplication pDst = pSrcA * pSrcB of fixed-size square matrices.
+   */
+  void arm_mat_mult_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point product pDst = pSrcA * pSrcB' of fixed-size square matrices.
+   */
+  void arm_mat_mult_trans_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_trans_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_trans_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_trans_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_trans_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point matrix by vector multiplication pDst = pSrcA * pVec for fixed-size square matrices.
+   */
+  void arm_mat_vec_mult_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+  void arm_mat_vec_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+  void arm_mat_vec_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+  void arm_mat_vec_mult_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+  void arm_mat_vec_mult_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point matrix addition pDst = pSrcA + pSrcB of fixed-size square matrices.
+   */
+  void arm_mat_add_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point inverse of fixed-size square matrices, returns ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_inverse_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  arm_status arm_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  arm_status arm_mat_inverse_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  arm_status arm_mat_inverse_5x5_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  arm_status arm_mat_inverse_6x6_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+
 
   /**
    * @brief Instance structure for the Q15 PID Control.
@@ -1924,9 +2422,23 @@ extern "C"
 
 
   /**
-   * @brief Instance structure for the Q15 CFFT/CIFFT function.
+   * @brief Half-precision vector multiplication.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  typedef struct
+  void arm_mult_f16(
+  float16_t * pSrcA,
+  float16_t * pSrcB,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 CFFT/CIFFT function.
+   */
+  typedef struct
   {
     uint16_t fftLen;                 /**< length of the FFT. */
     uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
@@ -2099,6 +2611,29 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+int32_t arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);
+
+  /**
+   * @brief Instance structure for the half-precision CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const float32_t *pTwiddle;         /**< points to the floating-point Twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } arm_cfft_instance_f16;
+
+void arm_cfft_f16(
+    const arm_cfft_instance_f16 * S,
+    float16_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -2116,6 +2651,12 @@ void arm_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+int32_t arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2133,6 +2674,20 @@ void arm_cfft_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  void arm_cfft_split_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * pRe,
+  float32_t * pIm,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+  void arm_cfft_strided_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint32_t stride,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2229,6 +2784,302 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+void arm_rfft_fast_inplace_f32(
+  arm_rfft_fast_instance_f32 * S,
+  float32_t * p,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q31 fast RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    const arm_cfft_instance_q31 *pCfft;   /**< points to the internal CFFT instance of length fftLenRFFT/2. */
+    uint16_t fftLenRFFT;                  /**< length of the real sequence. */
+    uint16_t twidCoefRModifier;           /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const q31_t *pTwiddleRFFT;            /**< points to the twiddle factor table. */
+  } arm_rfft_fast_instance_q31;
+
+  arm_status arm_rfft_fast_init_q31(
+  arm_rfft_fast_instance_q31 * S,
+  uint16_t fftLen);
+
+  uint32_t arm_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q15 fast RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    const arm_cfft_instance_q15 *pCfft;   /**< points to the internal CFFT instance of length fftLenRFFT/2. */
+    uint16_t fftLenRFFT;                  /**< length of the real sequence. */
+    uint16_t twidCoefRModifier;           /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const q15_t *pTwiddleRFFT;            /**< points to the twiddle factor table. */
+  } arm_rfft_fast_instance_q15;
+
+  arm_status arm_rfft_fast_init_q15(
+  arm_rfft_fast_instance_q15 * S,
+  uint16_t fftLen);
+
+  uint32_t arm_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the half-precision fast RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    const arm_cfft_instance_f16 *pCfft;   /**< points to the internal CFFT instance of length fftLenRFFT/2. */
+    uint16_t fftLenRFFT;                  /**< length of the real sequence. */
+    uint16_t twidCoefRModifier;           /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const float32_t *pTwiddleRFFT;        /**< points to the twiddle factor table. */
+  } arm_rfft_fast_instance_f16;
+
+  arm_status arm_rfft_fast_init_f16(
+  arm_rfft_fast_instance_f16 * S,
+  uint16_t fftLen);
+
+  void arm_rfft_fast_f16(
+  const arm_rfft_fast_instance_f16 * S,
+  float16_t * p,
+  float16_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Window types for the short-time Fourier transform.
+   */
+  typedef enum
+  {
+    ARM_WINDOW_HANN = 0,                 /**< Hann window. */
+    ARM_WINDOW_HAMMING = 1,              /**< Hamming window. */
+    ARM_WINDOW_BLACKMAN = 2              /**< Blackman window. */
+  } arm_window_type;
+
+  void arm_window_f32(
+  arm_window_type type,
+  float32_t * pDst,
+  uint16_t windowLen);
+
+  void arm_window_q15(
+  arm_window_type type,
+  q15_t * pDst,
+  uint16_t windowLen);
+
+  /**
+   * @brief Instance structure for the floating-point STFT function.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT instance of length fftLen. */
+    uint16_t fftLen;                     /**< frame and FFT length. */
+    uint16_t hopSize;                    /**< number of input samples between two frames. */
+    uint16_t writeIndex;                 /**< write position, and oldest sample, in the input ring. */
+    uint16_t count;                      /**< number of input samples until the next frame. */
+    const float32_t *pWindow;            /**< points to the window of fftLen samples. */
+    float32_t *pState;                   /**< points to the input ring followed by the FFT buffers, 3*fftLen samples. */
+  } arm_stft_instance_f32;
+
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState);
+
+  uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 STFT function.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_q15 rfft;     /**< real FFT instance of length fftLen. */
+    uint16_t fftLen;                     /**< frame and FFT length. */
+    uint16_t hopSize;                    /**< number of input samples between two frames. */
+    uint16_t writeIndex;                 /**< write position, and oldest sample, in the input ring. */
+    uint16_t count;                      /**< number of input samples until the next frame. */
+    const q15_t *pWindow;                /**< points to the window of fftLen samples. */
+    q15_t *pState;                       /**< points to the input ring followed by the FFT buffers, 3*fftLen samples. */
+  } arm_stft_instance_q15;
+
+  arm_status arm_stft_init_q15(
+  arm_stft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const q15_t * pWindow,
+  q15_t * pState);
+
+  uint32_t arm_stft_q15(
+  arm_stft_instance_q15 * S,
+  q15_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point MFCC function.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT instance of length fftLen. */
+    uint16_t fftLen;                     /**< frame and FFT length. */
+    uint16_t nbMelFilters;               /**< number of mel filters. */
+    uint16_t nbDctOutputs;               /**< number of cepstral coefficients. */
+    float32_t preEmphasis;               /**< pre-emphasis coefficient. */
+    const float32_t *pWindow;            /**< points to the window of fftLen values. */
+    const uint16_t *pFilterPos;          /**< points to the first bin of each mel filter. */
+    const uint16_t *pFilterLengths;      /**< points to the number of bins of each mel filter. */
+    const float32_t *pFilterCoefs;       /**< points to the coefficients of all the mel filters. */
+    const float32_t *pDctCoefs;          /**< points to the nbDctOutputs x nbMelFilters DCT matrix. */
+  } arm_mfcc_instance_f32;
+
+  arm_status arm_mfcc_init_f32(
+  arm_mfcc_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t nbMelFilters,
+  uint16_t nbDctOutputs,
+  float32_t preEmphasis,
+  const float32_t * pWindow,
+  const uint16_t * pFilterPos,
+  const uint16_t * pFilterLengths,
+  const float32_t * pFilterCoefs,
+  const float32_t * pDctCoefs);
+
+  void arm_mfcc_f32(
+  arm_mfcc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pTmp);
+
+  /**
+   * @brief Instance structure for the Q15 MFCC function.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_q15 rfft;     /**< real FFT instance of length fftLen. */
+    uint16_t fftLen;                     /**< frame and FFT length. */
+    uint16_t nbMelFilters;               /**< number of mel filters. */
+    uint16_t nbDctOutputs;               /**< number of cepstral coefficients. */
+    q15_t preEmphasis;                   /**< pre-emphasis coefficient. */
+    const q15_t *pWindow;                /**< points to the window of fftLen values. */
+    const uint16_t *pFilterPos;          /**< points to the first bin of each mel filter. */
+    const uint16_t *pFilterLengths;      /**< points to the number of bins of each mel filter. */
+    const q15_t *pFilterCoefs;           /**< points to the coefficients of all the mel filters. */
+    const q15_t *pDctCoefs;              /**< points to the nbDctOutputs x nbMelFilters DCT matrix. */
+  } arm_mfcc_instance_q15;
+
+  arm_status arm_mfcc_init_q15(
+  arm_mfcc_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t nbMelFilters,
+  uint16_t nbDctOutputs,
+  q15_t preEmphasis,
+  const q15_t * pWindow,
+  const uint16_t * pFilterPos,
+  const uint16_t * pFilterLengths,
+  const q15_t * pFilterCoefs,
+  const q15_t * pDctCoefs);
+
+  void arm_mfcc_q15(
+  arm_mfcc_instance_q15 * S,
+  q15_t * pSrc,
+  q31_t * pDst,
+  q31_t * pTmp);
+
+  uint32_t arm_mfcc_filterbank_f32(
+  float32_t sampleRate,
+  uint16_t fftLen,
+  uint16_t nbMelFilters,
+  float32_t fMin,
+  float32_t fMax,
+  uint16_t * pFilterPos,
+  uint16_t * pFilterLengths,
+  float32_t * pFilterCoefs);
+
+  void arm_mfcc_dct_f32(
+  float32_t * pDctCoefs,
+  uint16_t nbDctOutputs,
+  uint16_t nbMelFilters);
+
+  /**
+   * @brief Instance structure for the floating-point multi-bin Goertzel function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of target frequencies. */
+    const float32_t *pCoeffs;            /**< points to lambda and the sign of the odd samples for each frequency, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 multi-bin Goertzel function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of target frequencies. */
+    const q31_t *pCoeffs;                /**< points to sin(pi*f) and the sign mask of the odd samples for each frequency, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs);
+
+  void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs);
+
+  uint32_t arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q63_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT function.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                  /**< length of the sliding window. */
+    uint16_t numBins;                    /**< number of tracked bins. */
+    uint16_t stateIndex;                 /**< oldest sample in the delay line. */
+    float32_t damping;                   /**< damping factor r applied to the bins at each sample. */
+    float32_t dampingN;                  /**< r^windowLen, applied to the sample leaving the window. */
+    float32_t *pState;                   /**< points to the delay line, the bins and the twiddles, windowLen+4*numBins values. */
+  } arm_sdft_instance_f32;
+
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t numBins,
+  const uint16_t * pBinIndex,
+  float32_t damping,
+  float32_t * pState);
+
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2381,6 +3232,20 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Half-precision vector addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_add_f16(
+  float16_t * pSrcA,
+  float16_t * pSrcB,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Q7 vector addition.
    * @param[in]  pSrcA      points to the first input vector
@@ -2437,6 +3302,20 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Half-precision vector subtraction.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_sub_f16(
+  float16_t * pSrcA,
+  float16_t * pSrcB,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Q7 vector subtraction.
    * @param[in]  pSrcA      points to the first input vector
@@ -2493,6 +3372,20 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Multiplies a half-precision vector by a scalar.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor to be applied
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_scale_f16(
+  float16_t * pSrc,
+  float32_t scale,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Multiplies a Q7 vector by a scalar.
    * @param[in]  pSrc        points to the input vector
@@ -2603,6 +3496,20 @@ void arm_rfft_fast_f32(
   float32_t * result);
 
 
+  /**
+   * @brief Dot product of half-precision vectors.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     single-precision output result returned here
+   */
+  void arm_dot_prod_f16(
+  float16_t * pSrcA,
+  float16_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result);
+
+
   /**
    * @brief Dot product of Q7 vectors.
    * @param[in]  pSrcA      points to the first input vector
@@ -3408,89 +4315,297 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief Instance structure for the Q15 FIR interpolator.
+   * @brief Instance structure for the floating-point FIR decimator with circular state.
    */
   typedef struct
   {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } arm_fir_interpolate_instance_q15;
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    uint32_t stateLength;       /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;        /**< write position in the circular delay line. */
+    float32_t *pCoeffs;         /**< points to the coefficient array. The array is of length numTaps.*/
+    float32_t *pState;          /**< points to the state variable array. The array is of length 2*stateLength. */
+  } arm_fir_decimate_circ_instance_f32;
+
 
   /**
-   * @brief Instance structure for the Q31 FIR interpolator.
+   * @brief  Processing function for the floating-point FIR decimator with circular state.
+   * @param[in,out] S          points to an instance of the floating-point FIR decimator with circular state structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.  Must be a multiple of M.
+   */
+  void arm_fir_decimate_circ_f32(
+  arm_fir_decimate_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR decimator with circular state.
+   * @param[in,out] S          points to an instance of the floating-point FIR decimator with circular state structure.
+   * @param[in]     numTaps    number of coefficients in the filter.
+   * @param[in]     M          decimation factor.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  largest number of input samples that are processed in one pass.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  arm_status arm_fir_decimate_circ_init_f32(
+  arm_fir_decimate_circ_instance_f32 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
    */
   typedef struct
   {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } arm_fir_interpolate_instance_q31;
+    uint8_t order;              /**< number of integrator and comb stages. */
+    uint8_t shift;              /**< right shift that removes the filter gain R^order. */
+    uint16_t R;                 /**< decimation factor. */
+    uint32_t phase;             /**< number of input samples integrated since the last output. */
+    q63_t *pState;              /**< points to the state variable array. The array is of length 2*order. */
+  } arm_cic_decimate_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point FIR interpolator.
+   * @brief Instance structure for the Q31 CIC interpolator.
    */
   typedef struct
   {
-    uint8_t L;                     /**< upsample factor. */
-    uint16_t phaseLength;          /**< length of each polyphase filter component. */
-    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
-    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
-  } arm_fir_interpolate_instance_f32;
-
+    uint8_t order;              /**< number of comb and integrator stages. */
+    uint8_t shift;              /**< right shift that removes the filter gain R^(order-1). */
+    uint16_t R;                 /**< interpolation factor. */
+    q63_t *pState;              /**< points to the state variable array. The array is of length 2*order. */
+  } arm_cic_interpolate_instance_q31;
 
   /**
-   * @brief Processing function for the Q15 FIR interpolator.
-   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief Instance structure for the PDM to Q31 PCM converter.
    */
-  void arm_fir_interpolate_q15(
-  const arm_fir_interpolate_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    arm_cic_decimate_instance_q31 cic;  /**< CIC decimator stage. */
+    arm_fir_decimate_instance_q31 fir;  /**< droop compensation FIR decimator stage. */
+    q31_t *pScratch;                    /**< points to the CIC output buffer. The array is of length 8*blockSize/R. */
+  } arm_pdm_to_pcm_instance_q31;
 
 
   /**
-   * @brief  Initialization function for the Q15 FIR interpolator.
-   * @param[in,out] S          points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]     L          upsample factor.
-   * @param[in]     numTaps    number of filter coefficients in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficient buffer.
-   * @param[in]     pState     points to the state buffer.
+   * @brief  Processing function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
    * @param[in]     blockSize  number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @return        number of output samples written to <code>pDst</code>.
    */
-  arm_status arm_fir_interpolate_init_q15(
-  arm_fir_interpolate_instance_q15 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
+  uint32_t arm_cic_decimate_q31(
+  arm_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q31 FIR interpolator.
-   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     order      number of integrator and comb stages.
+   * @param[in]     R          decimation factor.
+   * @param[in]     pState     points to the state buffer of length 2*order.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>order</code> or <code>R</code> is zero or the filter gain
+   * <code>R^order</code> exceeds <code>2^32</code>.
+   */
+  arm_status arm_cic_decimate_init_q31(
+  arm_cic_decimate_instance_q31 * S,
+  uint8_t order,
+  uint16_t R,
+  q63_t * pState);
+
+
+  /**
+   * @brief  Processing function for the Q31 CIC interpolator.
+   * @param[in]  S          points to an instance of the Q31 CIC interpolator structure.
    * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
+   * @param[out] pDst       points to the block of output data of length blockSize*R.
    * @param[in]  blockSize  number of input samples to process per call.
    */
-  void arm_fir_interpolate_q31(
-  const arm_fir_interpolate_instance_q31 * S,
+  void arm_cic_interpolate_q31(
+  const arm_cic_interpolate_instance_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the Q31 FIR interpolator.
+   * @brief  Initialization function for the Q31 CIC interpolator.
+   * @param[in,out] S          points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]     order      number of comb and integrator stages.
+   * @param[in]     R          interpolation factor.
+   * @param[in]     pState     points to the state buffer of length 2*order.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>order</code> or <code>R</code> is zero or the filter gain
+   * <code>R^(order-1)</code> exceeds <code>2^32</code>.
+   */
+  arm_status arm_cic_interpolate_init_q31(
+  arm_cic_interpolate_instance_q31 * S,
+  uint8_t order,
+  uint16_t R,
+  q63_t * pState);
+
+
+  /**
+   * @brief  Designs a FIR filter that compensates the passband droop of a CIC decimator.
+   * @param[in]  order      number of stages of the CIC decimator.
+   * @param[in]  R          decimation factor of the CIC decimator.
+   * @param[in]  passFreq   passband edge, normalized to the CIC output rate.
+   * @param[in]  stopFreq   stopband edge, normalized to the CIC output rate.
+   * @param[out] pCoeffs    points to the designed filter coefficients.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @return     The function returns ARM_MATH_SUCCESS if the design is successful or
+   * ARM_MATH_ARGUMENT_ERROR if the parameters are out of range.
+   */
+  arm_status arm_cic_compensation_f32(
+  uint8_t order,
+  uint16_t R,
+  float32_t passFreq,
+  float32_t stopFreq,
+  float32_t * pCoeffs,
+  uint16_t numTaps);
+
+
+  /**
+   * @brief  Converts a 1-bit PDM stream to Q31 PCM samples.
+   * @param[in,out] S          points to an instance of the PDM to PCM converter structure.
+   * @param[in]     pSrc       points to the block of packed PDM data, oldest sample in the MSB.
+   * @param[out]    pDst       points to the block of output data of length 8*blockSize/(R*M).
+   * @param[in]     blockSize  number of PDM bytes to process per call.
+   */
+  void arm_pdm_to_pcm_q31(
+  arm_pdm_to_pcm_instance_q31 * S,
+  uint8_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the PDM to Q31 PCM converter.
+   * @param[in,out] S          points to an instance of the PDM to PCM converter structure.
+   * @param[in]     order      number of stages of the CIC decimator.
+   * @param[in]     R          decimation factor of the CIC decimator.
+   * @param[in]     numTaps    number of coefficients in the compensation filter.
+   * @param[in]     M          decimation factor of the compensation filter.
+   * @param[in]     pCoeffs    points to the compensation filter coefficients.
+   * @param[in]     pCicState  points to the CIC state buffer of length 2*order.
+   * @param[in]     pFirState  points to the compensation filter state buffer of length numTaps+8*blockSize/R-1.
+   * @param[in]     pScratch   points to the buffer for the CIC output of length 8*blockSize/R.
+   * @param[in]     blockSize  number of PDM bytes to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if the CIC parameters are not supported or ARM_MATH_LENGTH_ERROR if
+   * <code>8*blockSize</code> is not a multiple of <code>R*M</code>.
+   */
+  arm_status arm_pdm_to_pcm_init_q31(
+  arm_pdm_to_pcm_instance_q31 * S,
+  uint8_t order,
+  uint16_t R,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t * pCoeffs,
+  q63_t * pCicState,
+  q31_t * pFirState,
+  q31_t * pScratch,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR interpolator.
+   */
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_interpolate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR interpolator.
+   */
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_interpolate_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR interpolator.
+   */
+  typedef struct
+  {
+    uint8_t L;                     /**< upsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
+  } arm_fir_interpolate_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR interpolator.
+   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   */
+  void arm_fir_interpolate_q15(
+  const arm_fir_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR interpolator.
+   * @param[in,out] S          points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_interpolate_init_q15(
+  arm_fir_interpolate_instance_q15 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR interpolator.
+   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   */
+  void arm_fir_interpolate_q31(
+  const arm_fir_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR interpolator.
    * @param[in,out] S          points to an instance of the Q31 FIR interpolator structure.
    * @param[in]     L          upsample factor.
    * @param[in]     numTaps    number of filter coefficients in the filter.
@@ -3543,6 +4658,248 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t phase;                /**< polyphase component of the next output sample. */
+    uint32_t offset;               /**< index of the input sample of the next output in the next block. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                 /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t phase;                /**< polyphase component of the next output sample. */
+    uint32_t offset;               /**< index of the input sample of the next output in the next block. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t phase;                /**< polyphase component of the next output sample. */
+    uint32_t offset;               /**< index of the input sample of the next output in the next block. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief  Processing function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Processing function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Processing function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 Farrow fractional resampler.
+   */
+  typedef struct
+  {
+    q31_t step;                    /**< input samples advanced per output sample, in 8.24 format. */
+    q31_t mu;                      /**< fractional position of the next output sample, in 8.24 format. */
+    uint32_t offset;               /**< index of the input sample of the next output in the next block. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length blockSize+3. */
+  } arm_farrow_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point Farrow fractional resampler.
+   */
+  typedef struct
+  {
+    float32_t step;                /**< input samples advanced per output sample. */
+    float32_t mu;                  /**< fractional position of the next output sample. */
+    uint32_t offset;               /**< index of the input sample of the next output in the next block. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length blockSize+3. */
+  } arm_farrow_resample_instance_f32;
+
+
+  /**
+   * @brief  Processing function for the Q31 Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the Q31 Farrow fractional resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_farrow_resample_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the Q31 Farrow fractional resampler structure.
+   * @param[in]     step       input samples advanced per output sample, in 8.24 format.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>step</code> is not positive.
+   */
+  arm_status arm_farrow_resample_init_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t step,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Processing function for the floating-point Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the floating-point Farrow fractional resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_farrow_resample_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the floating-point Farrow fractional resampler structure.
+   * @param[in]     step       input samples advanced per output sample.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>step</code> is not positive.
+   */
+  arm_status arm_farrow_resample_init_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t step,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3991,6 +5348,24 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for floating-point block LMS filter.
+   * @param[in]  S          points to an instance of the floating-point LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process, the coefficients are updated once per block.
+   */
+  void arm_lms_block_f32(
+  const arm_lms_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 LMS filter.
    */
@@ -4143,6 +5518,24 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for floating-point block normalized LMS filter.
+   * @param[in,out] S          points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data.
+   * @param[out]    pErr       points to the block of error data.
+   * @param[in]     blockSize  number of samples to process, the coefficients are updated once per block.
+   */
+  void arm_lms_norm_block_f32(
+  arm_lms_norm_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q31 normalized LMS filter.
    */
@@ -4252,9 +5645,66 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief Correlation of floating-point sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
+   * @brief Instance structure for the floating-point partitioned frequency-domain adaptive filter.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT instance of length 2*blockLen. */
+    uint16_t numTaps;                    /**< number of filter coefficients, a multiple of blockLen. */
+    uint16_t blockLen;                   /**< block and partition length. */
+    uint16_t numPartitions;              /**< number of partitions, numTaps/blockLen. */
+    uint16_t head;                       /**< slot of the newest input spectrum in the delay line. */
+    float32_t mu;                        /**< step size that controls filter coefficient updates. */
+    float32_t alpha;                     /**< forgetting factor of the input power estimate. */
+    float32_t alphaN;                    /**< alpha to the power of the number of processed blocks. */
+    float32_t *pCoeffs;                  /**< points to the spectra of the partitions, 2*numTaps values. */
+    float32_t *pState;                   /**< points to the state buffer, 2*numTaps + 7*blockLen + 1 values. */
+  } arm_fdaf_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point partitioned frequency-domain adaptive filter.
+   * @param[in,out] S          points to an instance of the floating-point FDAF structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data.
+   * @param[out]    pErr       points to the block of error data.
+   * @param[in]     blockSize  number of samples to process, a multiple of blockLen.
+   */
+  void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the floating-point partitioned frequency-domain adaptive filter.
+   * @param[in,out] S          points to an instance of the floating-point FDAF structure.
+   * @param[in]     numTaps    number of filter coefficients, a multiple of blockLen.
+   * @param[in]     blockLen   block and partition length, 2*blockLen is the FFT length.
+   * @param[in]     pCoeffs    points to the buffer of the filter spectra, 2*numTaps values.
+   * @param[in]     pState     points to the state buffer, 2*numTaps + 7*blockLen + 1 values.
+   * @param[in]     mu         step size that controls filter coefficient updates.
+   * @param[in]     alpha      forgetting factor of the input power estimate.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the lengths are not supported.
+   */
+  arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t blockLen,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  float32_t alpha);
+
+
+  /**
+   * @brief Correlation of floating-point sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
    * @param[in]  pSrcB    points to the second input sequence.
    * @param[in]  srcBLen  length of the second input sequence.
    * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
@@ -4405,6 +5855,88 @@ void arm_rfft_fast_f32(
   q7_t * pDst);
 
 
+  /**
+   * @brief Correlation of floating-point sequences over a range of lags.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[in]  minLag   first lag to compute, may be negative.
+   * @param[in]  maxLag   last lag to compute.
+   * @param[out] pDst     points to the block of output data  Length maxLag - minLag + 1.
+   */
+  void arm_correlate_lag_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t minLag,
+  int32_t maxLag,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Instance structure for the floating-point generalized cross-correlation.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT instance of length fftLen. */
+    uint16_t fftLen;                     /**< FFT length. */
+    uint16_t maxLag;                     /**< largest lag, the correlation has 2*maxLag+1 values. */
+    uint8_t phat;                        /**< nonzero to apply the phase transform. */
+    float32_t *pState;                   /**< points to the work buffer, 3*fftLen values. */
+  } arm_gcc_phat_instance_f32;
+
+
+  /**
+   * @brief Generalized cross-correlation of floating-point blocks.
+   * @param[in]  S          points to an instance of the floating-point GCC structure.
+   * @param[in]  pSrcA      points to the first block.
+   * @param[in]  pSrcB      points to the second block.
+   * @param[in]  blockSize  number of samples in each block, at most fftLen.
+   * @param[out] pDst       points to the correlation at lags -maxLag to maxLag.
+   */
+  void arm_gcc_phat_f32(
+  arm_gcc_phat_instance_f32 * S,
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Initialization function for the floating-point generalized cross-correlation.
+   * @param[in,out] S       points to an instance of the floating-point GCC structure.
+   * @param[in]     fftLen  FFT length.
+   * @param[in]     maxLag  largest lag computed, less than fftLen/2.
+   * @param[in]     phat    1 to apply the phase transform, 0 for the plain cross-correlation.
+   * @param[in]     pState  points to the work buffer, 3*fftLen values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the lengths are not supported.
+   */
+  arm_status arm_gcc_phat_init_f32(
+  arm_gcc_phat_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t maxLag,
+  uint8_t phat,
+  float32_t * pState);
+
+
+  /**
+   * @brief Finds the peak of a correlation with sub-sample resolution.
+   * @param[in]  pSrc     points to the correlation values.
+   * @param[in]  numLags  number of correlation values.
+   * @param[in]  minLag   lag of the first correlation value.
+   * @param[out] pLag     lag of the peak.
+   * @param[out] pValue   interpolated value at the peak.
+   */
+  void arm_correlate_peak_f32(
+  float32_t * pSrc,
+  uint32_t numLags,
+  int32_t minLag,
+  float32_t * pLag,
+  float32_t * pValue);
+
+
   /**
    * @brief Instance structure for the floating-point sparse FIR filter.
    */
@@ -4606,6 +6138,279 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window, odd. */
+    uint16_t index;             /**< slot of the oldest sample in the window. */
+    float32_t *pState;          /**< points to the window samples. The array is of length windowLen. */
+    int32_t *pIndex;            /**< points to the heap indices. The array is of length 2*windowLen, unused for windows up to 9 samples. */
+  } arm_median_filter_instance_f32;
+
+
+  /**
+   * @brief Instance structure for the Q31 median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window, odd. */
+    uint16_t index;             /**< slot of the oldest sample in the window. */
+    q31_t *pState;              /**< points to the window samples. The array is of length windowLen. */
+    int32_t *pIndex;            /**< points to the heap indices. The array is of length 2*windowLen, unused for windows up to 9 samples. */
+  } arm_median_filter_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the Q15 median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window, odd. */
+    uint16_t index;             /**< slot of the oldest sample in the window. */
+    q15_t *pState;              /**< points to the window samples. The array is of length windowLen. */
+    int32_t *pIndex;            /**< points to the heap indices. The array is of length 2*windowLen, unused for windows up to 9 samples. */
+  } arm_median_filter_instance_q15;
+
+
+  /**
+   * @brief  Processing function for the floating-point median filter.
+   * @param[in,out] S          points to an instance of the floating-point median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_f32(
+  arm_median_filter_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point median filter.
+   * @param[in,out] S          points to an instance of the floating-point median filter structure.
+   * @param[in]     windowLen  number of samples in the window, odd.
+   * @param[in]     pState     points to the window buffer of length windowLen.
+   * @param[in]     pIndex     points to the heap index buffer of length 2*windowLen, can be NULL for windows up to 9 samples.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is even or <code>pIndex</code> is NULL
+   * for a window of more than 9 samples.
+   */
+  arm_status arm_median_filter_init_f32(
+  arm_median_filter_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState,
+  int32_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the Q31 median filter.
+   * @param[in,out] S          points to an instance of the Q31 median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q31(
+  arm_median_filter_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 median filter.
+   * @param[in,out] S          points to an instance of the Q31 median filter structure.
+   * @param[in]     windowLen  number of samples in the window, odd.
+   * @param[in]     pState     points to the window buffer of length windowLen.
+   * @param[in]     pIndex     points to the heap index buffer of length 2*windowLen, can be NULL for windows up to 9 samples.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is even or <code>pIndex</code> is NULL
+   * for a window of more than 9 samples.
+   */
+  arm_status arm_median_filter_init_q31(
+  arm_median_filter_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  int32_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the Q15 median filter.
+   * @param[in,out] S          points to an instance of the Q15 median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q15(
+  arm_median_filter_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 median filter.
+   * @param[in,out] S          points to an instance of the Q15 median filter structure.
+   * @param[in]     windowLen  number of samples in the window, odd.
+   * @param[in]     pState     points to the window buffer of length windowLen.
+   * @param[in]     pIndex     points to the heap index buffer of length 2*windowLen, can be NULL for windows up to 9 samples.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is even or <code>pIndex</code> is NULL
+   * for a window of more than 9 samples.
+   */
+  arm_status arm_median_filter_init_q15(
+  arm_median_filter_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState,
+  int32_t * pIndex);
+
+
+  /**
+   * @brief Instance structure for the floating-point running minimum and maximum filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window. */
+    uint16_t index;             /**< slot of the oldest sample in the window. */
+    uint16_t minHead;           /**< first entry of the queue of minimum candidates. */
+    uint16_t minTail;           /**< entry past the last one of the queue of minimum candidates. */
+    uint16_t maxHead;           /**< first entry of the queue of maximum candidates. */
+    uint16_t maxTail;           /**< entry past the last one of the queue of maximum candidates. */
+    float32_t *pState;          /**< points to the window samples. The array is of length windowLen. */
+    uint16_t *pQueue;           /**< points to the queues of window slots. The array is of length 2*windowLen. */
+  } arm_running_minmax_instance_f32;
+
+
+  /**
+   * @brief Instance structure for the Q31 running minimum and maximum filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window. */
+    uint16_t index;             /**< slot of the oldest sample in the window. */
+    uint16_t minHead;           /**< first entry of the queue of minimum candidates. */
+    uint16_t minTail;           /**< entry past the last one of the queue of minimum candidates. */
+    uint16_t maxHead;           /**< first entry of the queue of maximum candidates. */
+    uint16_t maxTail;           /**< entry past the last one of the queue of maximum candidates. */
+    q31_t *pState;              /**< points to the window samples. The array is of length windowLen. */
+    uint16_t *pQueue;           /**< points to the queues of window slots. The array is of length 2*windowLen. */
+  } arm_running_minmax_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the Q15 running minimum and maximum filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window. */
+    uint16_t index;             /**< slot of the oldest sample in the window. */
+    uint16_t minHead;           /**< first entry of the queue of minimum candidates. */
+    uint16_t minTail;           /**< entry past the last one of the queue of minimum candidates. */
+    uint16_t maxHead;           /**< first entry of the queue of maximum candidates. */
+    uint16_t maxTail;           /**< entry past the last one of the queue of maximum candidates. */
+    q15_t *pState;              /**< points to the window samples. The array is of length windowLen. */
+    uint16_t *pQueue;           /**< points to the queues of window slots. The array is of length 2*windowLen. */
+  } arm_running_minmax_instance_q15;
+
+
+  /**
+   * @brief  Processing function for the floating-point running minimum and maximum filter.
+   * @param[in,out] S          points to an instance of the floating-point running minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pMin       points to the block of running minimum values.
+   * @param[out]    pMax       points to the block of running maximum values.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_minmax_f32(
+  arm_running_minmax_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMin,
+  float32_t * pMax,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point running minimum and maximum filter.
+   * @param[in,out] S          points to an instance of the floating-point running minimum and maximum structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the window buffer of length windowLen.
+   * @param[in]     pQueue     points to the queue buffer of length 2*windowLen.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is zero.
+   */
+  arm_status arm_running_minmax_init_f32(
+  arm_running_minmax_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState,
+  uint16_t * pQueue);
+
+
+  /**
+   * @brief  Processing function for the Q31 running minimum and maximum filter.
+   * @param[in,out] S          points to an instance of the Q31 running minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pMin       points to the block of running minimum values.
+   * @param[out]    pMax       points to the block of running maximum values.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_minmax_q31(
+  arm_running_minmax_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pMin,
+  q31_t * pMax,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 running minimum and maximum filter.
+   * @param[in,out] S          points to an instance of the Q31 running minimum and maximum structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the window buffer of length windowLen.
+   * @param[in]     pQueue     points to the queue buffer of length 2*windowLen.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is zero.
+   */
+  arm_status arm_running_minmax_init_q31(
+  arm_running_minmax_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  uint16_t * pQueue);
+
+
+  /**
+   * @brief  Processing function for the Q15 running minimum and maximum filter.
+   * @param[in,out] S          points to an instance of the Q15 running minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pMin       points to the block of running minimum values.
+   * @param[out]    pMax       points to the block of running maximum values.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_minmax_q15(
+  arm_running_minmax_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMin,
+  q15_t * pMax,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 running minimum and maximum filter.
+   * @param[in,out] S          points to an instance of the Q15 running minimum and maximum structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the window buffer of length windowLen.
+   * @param[in]     pQueue     points to the queue buffer of length 2*windowLen.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+   * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is zero.
+   */
+  arm_status arm_running_minmax_init_q15(
+  arm_running_minmax_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState,
+  uint16_t * pQueue);
+
+
   /**
    * @brief  Floating-point sin_cos function.
    * @param[in]  theta   input value in degrees
@@ -4896,6 +6701,79 @@ void arm_rfft_fast_f32(
     return (out);
   }
 
+  /**
+   * @brief  Process function for the floating-point PID Control on a block of samples.
+   * @param[in,out] S          points to an instance of the floating-point PID Control structure
+   * @param[in]     pSrc       points to the block of input samples
+   * @param[out]    pDst       points to the block of output samples
+   * @param[in]     blockSize  number of samples to process
+   */
+  void arm_pid_block_f32(
+  arm_pid_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Process function for the Q31 PID Control on a block of samples.
+   * @param[in,out] S          points to an instance of the Q31 PID Control structure
+   * @param[in]     pSrc       points to the block of input samples
+   * @param[out]    pDst       points to the block of output samples
+   * @param[in]     blockSize  number of samples to process
+   */
+  void arm_pid_block_q31(
+  arm_pid_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Process function for the Q15 PID Control on a block of samples.
+   * @param[in,out] S          points to an instance of the Q15 PID Control structure
+   * @param[in]     pSrc       points to the block of input samples
+   * @param[out]    pDst       points to the block of output samples
+   * @param[in]     blockSize  number of samples to process
+   */
+  void arm_pid_block_q15(
+  arm_pid_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Process function for several floating-point PID Controls on blocks of samples.
+   * @param[in,out] S          points to an array of numAxes PID Control instances
+   * @param[in]     numAxes    number of axes
+   * @param[in]     pSrc       points to the input samples, blockSize samples per axis
+   * @param[out]    pDst       points to the output samples, blockSize samples per axis
+   * @param[in]     blockSize  number of samples to process for each axis
+   */
+  void arm_pid_multi_f32(
+  arm_pid_instance_f32 * S,
+  uint32_t numAxes,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Process function for several Q31 PID Controls on blocks of samples.
+   * @param[in,out] S          points to an array of numAxes PID Control instances
+   * @param[in]     numAxes    number of axes
+   * @param[in]     pSrc       points to the input samples, blockSize samples per axis
+   * @param[out]    pDst       points to the output samples, blockSize samples per axis
+   * @param[in]     blockSize  number of samples to process for each axis
+   */
+  void arm_pid_multi_q31(
+  arm_pid_instance_q31 * S,
+  uint32_t numAxes,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @} end of PID group
    */
@@ -4925,6 +6803,115 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  src   points to the instance of the input symmetric positive definite matrix.
+   * @param[out] dst   points to the instance of the output lower triangular matrix, can be the same as src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_DECOMPOSITION_FAILURE
+   * if the input matrix is not positive definite, or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Double precision Cholesky decomposition.
+   * @param[in]  src   points to the instance of the input symmetric positive definite matrix.
+   * @param[out] dst   points to the instance of the output lower triangular matrix, can be the same as src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_DECOMPOSITION_FAILURE
+   * if the input matrix is not positive definite, or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Floating-point LDLT decomposition with diagonal pivoting.
+   * @param[in]  src   points to the instance of the input symmetric matrix.
+   * @param[out] pl    points to the instance of the output unit lower triangular matrix, can be the same as src.
+   * @param[out] pd    points to the instance of the output diagonal matrix.
+   * @param[out] pp    points to the output permutation vector.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_DECOMPOSITION_FAILURE
+   * or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pd,
+  uint16_t * pp);
+
+
+  /**
+   * @brief Floating-point Householder QR decomposition.
+   * @param[in]  src        points to the instance of the input M x N matrix, M >= N.
+   * @param[in]  threshold  norm below which a column is considered already reduced.
+   * @param[out] pOutR      points to the instance of the output M x N matrix R, can be the same as src.
+   * @param[out] pOutQ      points to the instance of the output M x M matrix Q, or NULL.
+   * @param[out] pOutTau    points to the N Householder factors.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * src,
+  const float32_t threshold,
+  arm_matrix_instance_f32 * pOutR,
+  arm_matrix_instance_f32 * pOutQ,
+  float32_t * pOutTau);
+
+
+  /**
+   * @brief Floating-point solver of a lower triangular system.
+   * @param[in]  lt    points to the instance of the lower triangular matrix.
+   * @param[in]  a     points to the instance of the right-hand side matrix.
+   * @param[out] dst   points to the instance of the solution matrix, can be the same as a.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * lt,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point solver of an upper triangular system.
+   * @param[in]  ut    points to the instance of the upper triangular matrix.
+   * @param[in]  a     points to the instance of the right-hand side matrix.
+   * @param[out] dst   points to the instance of the solution matrix, can be the same as a.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Double precision solver of a lower triangular system.
+   * @param[in]  lt    points to the instance of the lower triangular matrix.
+   * @param[in]  a     points to the instance of the right-hand side matrix.
+   * @param[out] dst   points to the instance of the solution matrix, can be the same as a.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * lt,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double precision solver of an upper triangular system.
+   * @param[in]  ut    points to the instance of the upper triangular matrix.
+   * @param[in]  a     points to the instance of the right-hand side matrix.
+   * @param[out] dst   points to the instance of the solution matrix, can be the same as a.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * ut,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst);
+
+
 
   /**
    * @ingroup groupController
@@ -5014,22 +7001,54 @@ void arm_rfft_fast_f32(
   }
 
   /**
-   * @} end of clarke group
-   */
-
-  /**
-   * @brief  Converts the elements of the Q7 vector to Q31 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
+   * @brief  Floating-point Clarke transform of a block of samples.
+   * @param[in]  pIa        points to the block of three-phase coordinates <code>a</code>
+   * @param[in]  pIb        points to the block of three-phase coordinates <code>b</code>
+   * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
    * @param[in]  blockSize  number of samples to process
    */
-  void arm_q7_to_q31(
-  q7_t * pSrc,
-  q31_t * pDst,
+  void arm_clarke_block_f32(
+  float32_t * pIa,
+  float32_t * pIb,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
   uint32_t blockSize);
 
 
-
+  /**
+   * @brief  Q31 Clarke transform of a block of samples.
+   * @param[in]  pIa        points to the block of three-phase coordinates <code>a</code>
+   * @param[in]  pIb        points to the block of three-phase coordinates <code>b</code>
+   * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_clarke_block_q31(
+  q31_t * pIa,
+  q31_t * pIb,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  uint32_t blockSize);
+
+
+  /**
+   * @} end of clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q31 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_q7_to_q31(
+  q7_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+
   /**
    * @ingroup groupController
    */
@@ -5110,6 +7129,38 @@ void arm_rfft_fast_f32(
     *pIb = __QSUB(product2, product1);
   }
 
+  /**
+   * @brief  Floating-point inverse Clarke transform of a block of samples.
+   * @param[in]  pIalpha    points to the block of two-phase orthogonal vector axis alpha
+   * @param[in]  pIbeta     points to the block of two-phase orthogonal vector axis beta
+   * @param[out] pIa        points to the block of output three-phase coordinates <code>a</code>
+   * @param[out] pIb        points to the block of output three-phase coordinates <code>b</code>
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_inv_clarke_block_f32(
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t * pIa,
+  float32_t * pIb,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 inverse Clarke transform of a block of samples.
+   * @param[in]  pIalpha    points to the block of two-phase orthogonal vector axis alpha
+   * @param[in]  pIbeta     points to the block of two-phase orthogonal vector axis beta
+   * @param[out] pIa        points to the block of output three-phase coordinates <code>a</code>
+   * @param[out] pIb        points to the block of output three-phase coordinates <code>b</code>
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_inv_clarke_block_q31(
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t * pIa,
+  q31_t * pIb,
+  uint32_t blockSize);
+
+
   /**
    * @} end of inv_clarke group
    */
@@ -5234,6 +7285,46 @@ void arm_rfft_fast_f32(
     *pIq = __QSUB(product4, product3);
   }
 
+  /**
+   * @brief  Floating-point Park transform of a block of samples.
+   * @param[in]  pIalpha    points to the block of two-phase vector coordinates alpha
+   * @param[in]  pIbeta     points to the block of two-phase vector coordinates beta
+   * @param[out] pId        points to the block of output rotor reference frame d
+   * @param[out] pIq        points to the block of output rotor reference frame q
+   * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+   * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_park_block_f32(
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 Park transform of a block of samples.
+   * @param[in]  pIalpha    points to the block of two-phase vector coordinates alpha
+   * @param[in]  pIbeta     points to the block of two-phase vector coordinates beta
+   * @param[out] pId        points to the block of output rotor reference frame d
+   * @param[out] pIq        points to the block of output rotor reference frame q
+   * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+   * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_park_block_q31(
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t * pId,
+  q31_t * pIq,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize);
+
+
   /**
    * @} end of park group
    */
@@ -5347,11 +7438,132 @@ void arm_rfft_fast_f32(
     *pIbeta = __QADD(product4, product3);
   }
 
+  /**
+   * @brief  Floating-point inverse Park transform of a block of samples.
+   * @param[in]  pId        points to the block of rotor reference frame d
+   * @param[in]  pIq        points to the block of rotor reference frame q
+   * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+   * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+   * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_inv_park_block_f32(
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 inverse Park transform of a block of samples.
+   * @param[in]  pId        points to the block of rotor reference frame d
+   * @param[in]  pIq        points to the block of rotor reference frame q
+   * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+   * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+   * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_inv_park_block_q31(
+  q31_t * pId,
+  q31_t * pIq,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize);
+
+
   /**
    * @} end of Inverse park group
    */
 
 
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup clarke_park_pid Fused Clarke, Park and PID Current Control
+   * Runs the measurement side of a field oriented current loop on a block of samples:
+   * the phase currents go through the Clarke and Park transforms, the d and q currents
+   * are subtracted from their references and each error drives its own PID Control.
+   *
+   * The result is bit exact with chaining the single sample Clarke, Park and PID functions,
+   * but the intermediate currents and controller states are kept in local variables
+   * instead of going through memory for every sample.
+   * The library provides separate functions for Q31 and floating-point data types.
+   */
+
+  /**
+   * @addtogroup clarke_park_pid
+   * @{
+   */
+
+  /**
+   * @brief  Floating-point fused Clarke, Park and PID current control on a block of samples.
+   * @param[in,out] Sd         points to the PID Control instance of the d axis
+   * @param[in,out] Sq         points to the PID Control instance of the q axis
+   * @param[in]     pIa        points to the block of three-phase coordinates <code>a</code>
+   * @param[in]     pIb        points to the block of three-phase coordinates <code>b</code>
+   * @param[in]     pSinVal    points to the block of sine values of rotation angle theta
+   * @param[in]     pCosVal    points to the block of cosine values of rotation angle theta
+   * @param[in]     pIdRef     points to the block of d axis references
+   * @param[in]     pIqRef     points to the block of q axis references
+   * @param[out]    pVd        points to the block of d axis controller outputs
+   * @param[out]    pVq        points to the block of q axis controller outputs
+   * @param[in]     blockSize  number of samples to process
+   */
+  void arm_clarke_park_pid_f32(
+  arm_pid_instance_f32 * Sd,
+  arm_pid_instance_f32 * Sq,
+  float32_t * pIa,
+  float32_t * pIb,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  float32_t * pIdRef,
+  float32_t * pIqRef,
+  float32_t * pVd,
+  float32_t * pVq,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 fused Clarke, Park and PID current control on a block of samples.
+   * @param[in,out] Sd         points to the PID Control instance of the d axis
+   * @param[in,out] Sq         points to the PID Control instance of the q axis
+   * @param[in]     pIa        points to the block of three-phase coordinates <code>a</code>
+   * @param[in]     pIb        points to the block of three-phase coordinates <code>b</code>
+   * @param[in]     pSinVal    points to the block of sine values of rotation angle theta
+   * @param[in]     pCosVal    points to the block of cosine values of rotation angle theta
+   * @param[in]     pIdRef     points to the block of d axis references
+   * @param[in]     pIqRef     points to the block of q axis references
+   * @param[out]    pVd        points to the block of d axis controller outputs
+   * @param[out]    pVq        points to the block of q axis controller outputs
+   * @param[in]     blockSize  number of samples to process
+   */
+  void arm_clarke_park_pid_q31(
+  arm_pid_instance_q31 * Sd,
+  arm_pid_instance_q31 * Sq,
+  q31_t * pIa,
+  q31_t * pIb,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  q31_t * pIdRef,
+  q31_t * pIqRef,
+  q31_t * pVd,
+  q31_t * pVq,
+  uint32_t blockSize);
+
+  /**
+   * @} end of clarke_park_pid group
+   */
+
+
   /**
    * @brief  Converts the elements of the Q31 vector to floating-point vector.
    * @param[in]  pSrc       is input pointer
@@ -5602,87 +7814,404 @@ void arm_rfft_fast_f32(
     }
     index = (x >> 20) & 0xfff;
 
-    if (index >= (nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else
-    {
-      /* 20 bits for the fractional part */
-      /* fract is in 12.20 format */
-      fract = (x & 0x000FFFFF);
+    if (index >= (nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else
+    {
+      /* 20 bits for the fractional part */
+      /* fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
+
+      /* Read two nearest output values from the index and are in 1.7(q7) format */
+      y0 = pYData[index];
+      y1 = pYData[index + 1];
+
+      /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
+      y = ((y0 * (0xFFFFF - fract)));
+
+      /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
+      y += (y1 * fract);
+
+      /* convert y to 1.7(q7) format */
+      return (q7_t) (y >> 20);
+     }
+  }
+
+  /**
+   * @} end of LinearInterpolate group
+   */
+
+  /**
+   * @brief  Floating-point linear interpolation of a block of query points.
+   * @param[in]  S          points to an instance of the floating-point Linear Interpolation structure.
+   * @param[in]  pSrc       points to the block of input x values.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 linear interpolation of a block of query points.
+   * @param[in]  pYData     points to the Q31 Linear Interpolation table.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  pSrc       points to the block of input x values in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_block_q31(
+  q31_t * pYData,
+  uint32_t nValues,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 linear interpolation of a block of query points.
+   * @param[in]  pYData     points to the Q15 Linear Interpolation table.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  pSrc       points to the block of input x values in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_block_q15(
+  q15_t * pYData,
+  uint32_t nValues,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q7 linear interpolation of a block of query points.
+   * @param[in]  pYData     points to the Q7 Linear Interpolation table.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  pSrc       points to the block of input x values in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_block_q7(
+  q7_t * pYData,
+  uint32_t nValues,
+  q31_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point linear interpolation at uniformly spaced query points.
+   * @param[in]  S          points to an instance of the floating-point Linear Interpolation structure.
+   * @param[in]  xStart     first query point.
+   * @param[in]  xStep      distance between consecutive query points.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to produce.
+   */
+  void arm_linear_interp_stride_f32(
+  const arm_linear_interp_instance_f32 * S,
+  float32_t xStart,
+  float32_t xStep,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 linear interpolation at uniformly spaced query points.
+   * @param[in]  pYData     points to the Q31 Linear Interpolation table.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  xStart     first query point in 12.20 format.
+   * @param[in]  xStep      distance between consecutive query points in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to produce.
+   */
+  void arm_linear_interp_stride_q31(
+  q31_t * pYData,
+  uint32_t nValues,
+  q31_t xStart,
+  q31_t xStep,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 linear interpolation at uniformly spaced query points.
+   * @param[in]  pYData     points to the Q15 Linear Interpolation table.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  xStart     first query point in 12.20 format.
+   * @param[in]  xStep      distance between consecutive query points in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to produce.
+   */
+  void arm_linear_interp_stride_q15(
+  q15_t * pYData,
+  uint32_t nValues,
+  q31_t xStart,
+  q31_t xStep,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q7 linear interpolation at uniformly spaced query points.
+   * @param[in]  pYData     points to the Q7 Linear Interpolation table.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  xStart     first query point in 12.20 format.
+   * @param[in]  xStep      distance between consecutive query points in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to produce.
+   */
+  void arm_linear_interp_stride_q7(
+  q7_t * pYData,
+  uint32_t nValues,
+  q31_t xStart,
+  q31_t xStep,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  sin(x).
+   */
+  float32_t arm_sin_f32(
+  float32_t x);
+
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  sin(x).
+   */
+  q31_t arm_sin_q31(
+  q31_t x);
+
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  sin(x).
+   */
+  q15_t arm_sin_q15(
+  q15_t x);
+
+
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  cos(x).
+   */
+  float32_t arm_cos_f32(
+  float32_t x);
+
+
+  /**
+   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  cos(x).
+   */
+  q31_t arm_cos_q31(
+  q31_t x);
+
+
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  cos(x).
+   */
+  q15_t arm_cos_q15(
+  q15_t x);
+
+
+  /**
+   * @brief  floating-point vector exponential.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector exponential.
+   * @param[in]  pSrc       points to the input vector in 6.26 format.
+   * @param[out] pDst       points to the output vector in 1.31 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector exponential.
+   * @param[in]  pSrc       points to the input vector in 5.11 format.
+   * @param[out] pDst       points to the output vector in 1.15 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  floating-point vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector in 1.31 format.
+   * @param[out] pDst       points to the output vector in 6.26 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector in 1.15 format.
+   * @param[out] pDst       points to the output vector in 5.11 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
-      /* Read two nearest output values from the index and are in 1.7(q7) format */
-      y0 = pYData[index];
-      y1 = pYData[index + 1];
+  /**
+   * @brief  floating-point vector four-quadrant arc tangent.
+   * @param[in]  pSrcY      points to the vector of y coordinates.
+   * @param[in]  pSrcX      points to the vector of x coordinates.
+   * @param[out] pDst       points to the output vector of angles in radians.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_atan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-      /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
-      y = ((y0 * (0xFFFFF - fract)));
 
-      /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
-      y += (y1 * fract);
+  /**
+   * @brief  Q31 vector four-quadrant arc tangent.
+   * @param[in]  pSrcY      points to the vector of y coordinates in 1.31 format.
+   * @param[in]  pSrcX      points to the vector of x coordinates in 1.31 format.
+   * @param[out] pDst       points to the output vector of angles in radians in 3.29 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_atan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
 
-      /* convert y to 1.7(q7) format */
-      return (q7_t) (y >> 20);
-     }
-  }
 
   /**
-   * @} end of LinearInterpolate group
+   * @brief  Q15 vector four-quadrant arc tangent.
+   * @param[in]  pSrcY      points to the vector of y coordinates in 1.15 format.
+   * @param[in]  pSrcX      points to the vector of x coordinates in 1.15 format.
+   * @param[out] pDst       points to the output vector of angles in radians in 3.13 format.
+   * @param[in]  blockSize  number of samples in each vector.
    */
+  void arm_atan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
-   * @param[in] x  input value in radians.
-   * @return  sin(x).
+   * @brief  floating-point vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  float32_t arm_sin_f32(
-  float32_t x);
+  void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  sin(x).
+   * @brief  Q31 vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input vector in 4.28 format.
+   * @param[out] pDst       points to the output vector in 1.31 format.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  q31_t arm_sin_q31(
-  q31_t x);
+  void arm_vtanh_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  sin(x).
+   * @brief  Q15 vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input vector in 4.12 format.
+   * @param[out] pDst       points to the output vector in 1.15 format.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  q15_t arm_sin_q15(
-  q15_t x);
+  void arm_vtanh_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
-   * @param[in] x  input value in radians.
-   * @return  cos(x).
+   * @brief  floating-point vector sigmoid.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  float32_t arm_cos_f32(
-  float32_t x);
+  void arm_vsigmoid_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  cos(x).
+   * @brief  Q31 vector sigmoid.
+   * @param[in]  pSrc       points to the input vector in 4.28 format.
+   * @param[out] pDst       points to the output vector in 1.31 format.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  q31_t arm_cos_q31(
-  q31_t x);
+  void arm_vsigmoid_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  cos(x).
+   * @brief  Q15 vector sigmoid.
+   * @param[in]  pSrc       points to the input vector in 4.12 format.
+   * @param[out] pDst       points to the output vector in 1.15 format.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  q15_t arm_cos_q15(
-  q15_t x);
+  void arm_vsigmoid_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
@@ -5775,6 +8304,42 @@ void arm_rfft_fast_f32(
   q15_t in,
   q15_t * pOut);
 
+
+  /**
+   * @brief  floating-point vector square root function.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector square root function.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector square root function.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vsqrt_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @} end of SQRT group
    */
@@ -6588,6 +9153,18 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Converts the elements of the floating-point vector to half-precision vector.
+   * @param[in]  pSrc       points to the floating-point input vector
+   * @param[out] pDst       points to the half-precision output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_float_to_f16(
+  float32_t * pSrc,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Converts the elements of the floating-point vector to Q7 vector.
    * @param[in]  pSrc       points to the floating-point input vector
@@ -6636,6 +9213,18 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief  Converts the elements of the half-precision vector to floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[out] pDst       is output pointer
+   * @param[in]  blockSize  is the number of samples to process
+   */
+  void arm_f16_to_float(
+  float16_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Converts the elements of the Q15 vector to Q31 vector.
    * @param[in]  pSrc       is input pointer
@@ -6660,6 +9249,307 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Operations with several implementations selected by a plan.
+   */
+  typedef enum
+  {
+    ARM_PLAN_CONV_Q15 = 0,            /**< arm_plan_conv_q15(), keyed by srcALen and srcBLen. */
+    ARM_PLAN_FIR_Q15 = 1,             /**< arm_plan_fir_q15(), keyed by numTaps and blockSize. */
+    ARM_PLAN_MAT_MULT_Q15 = 2,        /**< arm_plan_mat_mult_q15(), keyed by numRows*65536+numCols of A and numCols of B. */
+    ARM_PLAN_CFFT_F32 = 3,            /**< arm_plan_cfft_f32(), keyed by fftLen and ifftFlag. */
+    ARM_PLAN_NUM_OPS = 4              /**< number of operations. */
+  } arm_plan_op;
+
+  /**
+   * @brief Implementations that a plan can select.
+   */
+  typedef enum
+  {
+    ARM_PLAN_VARIANT_DEFAULT = 0,     /**< arm_conv_q15(), arm_fir_q15(), arm_mat_mult_q15() or arm_cfft_f32(). */
+    ARM_PLAN_VARIANT_FAST = 1,        /**< arm_conv_fast_q15(), arm_fir_fast_q15() or arm_mat_mult_fast_q15(). */
+    ARM_PLAN_VARIANT_OPT = 2,         /**< arm_conv_opt_q15(). */
+    ARM_PLAN_VARIANT_FAST_OPT = 3,    /**< arm_conv_fast_opt_q15(). */
+    ARM_PLAN_VARIANT_RADIX4 = 4,      /**< arm_cfft_radix4_f32(). */
+    ARM_PLAN_VARIANT_RADIX2 = 5,      /**< arm_cfft_radix2_f32(). */
+    ARM_PLAN_NUM_VARIANTS = 6         /**< number of implementations. */
+  } arm_plan_variant;
+
+  /**
+   * @brief Number of runs of each implementation while tuning, the fastest run is kept.
+   */
+#define ARM_PLAN_NUM_RUNS  3
+
+  /**
+   * @brief Number of 32-bit words of a plan exported with numEntries entries.
+   */
+#define ARM_PLAN_EXPORT_WORDS(numEntries)  (3U + 4U * (numEntries))
+
+  /**
+   * @brief First word of an exported plan, identifies the format.
+   */
+#define ARM_PLAN_MAGIC  0x504C4E31U
+
+  /**
+   * @brief Cycle counter of the application, a free running up counter such as DWT->CYCCNT.
+   */
+  typedef uint32_t (*arm_plan_timer)(void);
+
+  /**
+   * @brief Implementation selected for one operation and size.
+   */
+  typedef struct
+  {
+    uint8_t op;                       /**< operation, one of arm_plan_op. */
+    uint8_t variant;                  /**< selected implementation, one of arm_plan_variant. */
+    uint32_t len1;                    /**< first size key of the operation. */
+    uint32_t len2;                    /**< second size key of the operation. */
+    uint32_t cycles;                  /**< cycles of the selected implementation when it was tuned. */
+  } arm_plan_entry;
+
+  /**
+   * @brief Instance structure for a plan.
+   */
+  typedef struct
+  {
+    uint16_t numEntries;              /**< number of entries recorded. */
+    uint16_t maxEntries;              /**< size of the entry array. */
+    arm_plan_entry *pEntries;         /**< points to the entry array. */
+    arm_plan_timer timer;             /**< cycle counter used for tuning, NULL to disable tuning. */
+    float32_t tolerance;              /**< largest error accepted from an implementation, relative to full scale. */
+  } arm_plan_instance;
+
+
+  /**
+   * @brief Initialization function for a plan.
+   * @param[out] S           points to an instance of the plan structure.
+   * @param[in]  pEntries    points to the entry array.
+   * @param[in]  maxEntries  size of the entry array.
+   * @param[in]  timer       cycle counter used for tuning, may be NULL.
+   * @param[in]  tolerance   largest error accepted from an implementation, relative to full scale.
+   */
+  void arm_plan_init(
+  arm_plan_instance * S,
+  arm_plan_entry * pEntries,
+  uint16_t maxEntries,
+  arm_plan_timer timer,
+  float32_t tolerance);
+
+
+  /**
+   * @brief Records the implementation of an operation for a size.
+   * @param[in,out] S        points to an instance of the plan structure.
+   * @param[in]     op       operation, one of arm_plan_op.
+   * @param[in]     len1     first size key.
+   * @param[in]     len2     second size key.
+   * @param[in]     variant  implementation, one of arm_plan_variant.
+   * @param[in]     cycles   cycles of the implementation, informative.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if the operation has no such
+   *                implementation or ARM_MATH_LENGTH_ERROR if the plan is full.
+   */
+  arm_status arm_plan_record(
+  arm_plan_instance * S,
+  uint8_t op,
+  uint32_t len1,
+  uint32_t len2,
+  uint8_t variant,
+  uint32_t cycles);
+
+
+  /**
+   * @brief Looks up the implementation of an operation for a size.
+   * @param[in] S     points to an instance of the plan structure.
+   * @param[in] op    operation, one of arm_plan_op.
+   * @param[in] len1  first size key.
+   * @param[in] len2  second size key.
+   * @return    the recorded implementation, or ARM_PLAN_VARIANT_DEFAULT if there is none.
+   */
+  uint8_t arm_plan_lookup(
+  const arm_plan_instance * S,
+  uint8_t op,
+  uint32_t len1,
+  uint32_t len2);
+
+
+  /**
+   * @brief Serializes a plan.
+   * @param[in]  S         points to an instance of the plan structure.
+   * @param[out] pDst      points to the output words.
+   * @param[in]  maxWords  size of the output, at least ARM_PLAN_EXPORT_WORDS(numEntries).
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the output is too small.
+   */
+  arm_status arm_plan_export(
+  const arm_plan_instance * S,
+  uint32_t * pDst,
+  uint32_t maxWords);
+
+
+  /**
+   * @brief Loads a serialized plan.
+   * @param[in,out] S         points to an instance of the plan structure.
+   * @param[in]     pSrc      points to the words written by arm_plan_export().
+   * @param[in]     numWords  number of words available.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if the words are not a valid plan
+   *                or ARM_MATH_LENGTH_ERROR if the plan is full.
+   */
+  arm_status arm_plan_import(
+  arm_plan_instance * S,
+  const uint32_t * pSrc,
+  uint32_t numWords);
+
+
+  /**
+   * @brief Selects the fastest accurate Q15 convolution.
+   * @param[in,out] S          points to an instance of the plan structure.
+   * @param[in]     pSrcA      points to a representative first input sequence.
+   * @param[in]     srcALen    length of the first input sequence.
+   * @param[in]     pSrcB      points to a representative second input sequence.
+   * @param[in]     srcBLen    length of the second input sequence.
+   * @param[out]    pDst       points to the output, srcALen+srcBLen-1 values.
+   * @param[out]    pRef       points to the reference output, srcALen+srcBLen-1 values.
+   * @param[in]     pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]     pScratch2  points to scratch buffer of size min(srcALen, srcBLen).
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the plan is full.
+   */
+  arm_status arm_plan_tune_conv_q15(
+  arm_plan_instance * S,
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pRef,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+  /**
+   * @brief Q15 convolution with the implementation selected by a plan.
+   * @param[in]  S          points to an instance of the plan structure.
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[out] pDst       points to the output, srcALen+srcBLen-1 values.
+   * @param[in]  pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2  points to scratch buffer of size min(srcALen, srcBLen).
+   */
+  void arm_plan_conv_q15(
+  const arm_plan_instance * S,
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+  /**
+   * @brief Selects the fastest accurate Q15 FIR filter.
+   * @param[in,out] S          points to an instance of the plan structure.
+   * @param[in,out] pFir       points to an initialized Q15 FIR filter, its state is cleared.
+   * @param[in]     pSrc       points to a representative block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[out]    pRef       points to the reference output, blockSize values.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the plan is full.
+   */
+  arm_status arm_plan_tune_fir_q15(
+  arm_plan_instance * S,
+  arm_fir_instance_q15 * pFir,
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pRef,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q15 FIR filter with the implementation selected by a plan.
+   * @param[in]  S          points to an instance of the plan structure.
+   * @param[in]  pFir       points to an instance of the Q15 FIR filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_plan_fir_q15(
+  const arm_plan_instance * S,
+  arm_fir_instance_q15 * pFir,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Selects the fastest accurate Q15 matrix multiplication.
+   * @param[in,out] S       points to an instance of the plan structure.
+   * @param[in]     pSrcA   points to a representative first input matrix.
+   * @param[in]     pSrcB   points to a representative second input matrix.
+   * @param[out]    pDst    points to the output matrix.
+   * @param[out]    pRef    points to the reference output, as many values as pDst.
+   * @param[in]     pState  points to the scratch buffer of the multiplication.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH if the sizes do not match
+   *                or ARM_MATH_LENGTH_ERROR if the plan is full.
+   */
+  arm_status arm_plan_tune_mat_mult_q15(
+  arm_plan_instance * S,
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pRef,
+  q15_t * pState);
+
+
+  /**
+   * @brief Q15 matrix multiplication with the implementation selected by a plan.
+   * @param[in]  S       points to an instance of the plan structure.
+   * @param[in]  pSrcA   points to the first input matrix.
+   * @param[in]  pSrcB   points to the second input matrix.
+   * @param[out] pDst    points to the output matrix.
+   * @param[in]  pState  points to the scratch buffer of the multiplication.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the sizes do not match.
+   */
+  arm_status arm_plan_mat_mult_q15(
+  const arm_plan_instance * S,
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pState);
+
+
+  /**
+   * @brief Selects the fastest accurate floating-point complex FFT.
+   * @param[in,out] S         points to an instance of the plan structure.
+   * @param[in]     pCfft     points to the arm_cfft_f32() instance of the FFT length.
+   * @param[in]     pSrc      points to a representative input, 2*fftLen values, not modified.
+   * @param[out]    pBuf      points to the work buffer, 2*fftLen values.
+   * @param[out]    pRef      points to the reference output, 2*fftLen values.
+   * @param[in]     ifftFlag  0 for the forward transform, 1 for the inverse transform.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the plan is full.
+   */
+  arm_status arm_plan_tune_cfft_f32(
+  arm_plan_instance * S,
+  const arm_cfft_instance_f32 * pCfft,
+  float32_t * pSrc,
+  float32_t * pBuf,
+  float32_t * pRef,
+  uint8_t ifftFlag);
+
+
+  /**
+   * @brief Floating-point complex FFT with the implementation selected by a plan.
+   * @param[in]     S         points to an instance of the plan structure.
+   * @param[in]     pCfft     points to the arm_cfft_f32() instance of the FFT length.
+   * @param[in,out] p1        points to the complex data buffer, processed in place.
+   * @param[in]     ifftFlag  0 for the forward transform, 1 for the inverse transform.
+   */
+  void arm_plan_cfft_f32(
+  const arm_plan_instance * S,
+  const arm_cfft_instance_f32 * pCfft,
+  float32_t * p1,
+  uint8_t ifftFlag);
+
+
   /**
    * @ingroup groupInterpolation
    */
@@ -7019,6 +9909,70 @@ void arm_rfft_fast_f32(
    */
 
 
+  /**
+   * @brief  Floating-point bilinear interpolation of a block of query points.
+   * @param[in]  S          points to an instance of the interpolation structure.
+   * @param[in]  pX         points to the block of x coordinates.
+   * @param[in]  pY         points to the block of y coordinates.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_bilinear_interp_block_f32(
+  const arm_bilinear_interp_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 bilinear interpolation of a block of query points.
+   * @param[in]  S          points to an instance of the interpolation structure.
+   * @param[in]  pX         points to the block of x coordinates in 12.20 format.
+   * @param[in]  pY         points to the block of y coordinates in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_bilinear_interp_block_q31(
+  const arm_bilinear_interp_instance_q31 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 bilinear interpolation of a block of query points.
+   * @param[in]  S          points to an instance of the interpolation structure.
+   * @param[in]  pX         points to the block of x coordinates in 12.20 format.
+   * @param[in]  pY         points to the block of y coordinates in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_bilinear_interp_block_q15(
+  const arm_bilinear_interp_instance_q15 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q7 bilinear interpolation of a block of query points.
+   * @param[in]  S          points to an instance of the interpolation structure.
+   * @param[in]  pX         points to the block of x coordinates in 12.20 format.
+   * @param[in]  pY         points to the block of y coordinates in 12.20 format.
+   * @param[out] pDst       points to the block of interpolated output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_bilinear_interp_block_q7(
+  const arm_bilinear_interp_instance_q7 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
 /* SMMLAR */
 #define multAcc_32x32_keep32_R(a, x, y) \
     a = (q31_t) (((((q63_t) a) << 32) + ((q63_t) x * y) + 0x80000000LL ) >> 32)
@@ -42,7 +42,7 @@
  *     sum = pSrcA[0]*pSrcB[0] + pSrcA[1]*pSrcB[1] + ... + pSrcA[blockSize-1]*pSrcB[blockSize-1]
  * </pre>
  *
- * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ * There are separate functions for floating-point, half-precision, Q7, Q15, and Q31 data types.
  */
 
 /**
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mult_f16.c
+ * Description:  Half-precision vector multiplication
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicMult
+ * @{
+ */
+
+/**
+ * @brief Half-precision vector multiplication.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs are converted to single precision and the result is rounded once to
+ * half precision.  Results with a magnitude of 65520 or more become infinity.
+ */
+
+void arm_mult_f16(
+  float16_t * pSrcA,
+  float16_t * pSrcB,
+  float16_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+/* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t inA1, inA2, inA3, inA4;              /* temporary input variables */
+  float32_t inB1, inB2, inB3, inB4;              /* temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    /* read four inputs from sourceA and four inputs from sourceB */
+    inA1 = convert_f16_to_f32(*pSrcA);
+    inB1 = convert_f16_to_f32(*pSrcB);
+    inA2 = convert_f16_to_f32(*(pSrcA + 1));
+    inB2 = convert_f16_to_f32(*(pSrcB + 1));
+    inA3 = convert_f16_to_f32(*(pSrcA + 2));
+    inB3 = convert_f16_to_f32(*(pSrcB + 2));
+    inA4 = convert_f16_to_f32(*(pSrcA + 3));
+    inB4 = convert_f16_to_f32(*(pSrcB + 3));
+
+    /* Multiply and store result to destination */
+    *pDst = convert_f32_to_f16(inA1 * inB1);
+    *(pDst + 1) = convert_f32_to_f16(inA2 * inB2);
+    *(pDst + 2) = convert_f32_to_f16(inA3 * inB3);
+    *(pDst + 3) = convert_f32_to_f16(inA4 * inB4);
+
+    /* update pointers to process next samples */
+    pSrcA += 4U;
+    pSrcB += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    /* Multiply and then store the result in the destination buffer. */
+    *pDst++ = convert_f32_to_f16(convert_f16_to_f32(*pSrcA++) * convert_f16_to_f32(*pSrcB++));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicMult group
+ */
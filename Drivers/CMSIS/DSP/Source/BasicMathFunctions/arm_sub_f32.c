@@ -41,7 +41,7 @@
  *     pDst[n] = pSrcA[n] - pSrcB[n],   0 <= n < blockSize.
  * </pre>
  *
- * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ * There are separate functions for floating-point, half-precision, Q7, Q15, and Q31 data types.
  */
 
 /**
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_cfft_f32.c
+ * Description:  Floating-point complex FFTs of independent channels on a multi-threaded pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+typedef struct
+{
+  const arm_cfft_instance_f32 *pCfft;            /* Instance shared by the channels */
+  float32_t *p1;                                 /* Data of the channels */
+  uint8_t ifftFlag;                              /* Direction of the transforms */
+  uint8_t bitReverseFlag;                        /* Order of the output */
+} arm_batch_cfft_args;
+
+static void arm_batch_cfft_task(
+  void * pArg,
+  uint32_t index,
+  float32_t * pScratch)
+{
+  arm_batch_cfft_args *pArgs = (arm_batch_cfft_args *) pArg;
+
+  (void) pScratch;
+
+  arm_cfft_f32(pArgs->pCfft, pArgs->p1 + (size_t) index * 2U * pArgs->pCfft->fftLen,
+               pArgs->ifftFlag, pArgs->bitReverseFlag);
+}
+
+/**
+ * @brief  Floating-point complex FFTs of independent channels.
+ * @param[in,out] S               points to an instance of the batch pool structure.
+ * @param[in]     pCfft           points to the complex FFT instance shared by the channels.
+ * @param[in,out] p1              points to the data, 2*fftLen values per channel, processed in place.
+ * @param[in]     numChannels     number of channels.
+ * @param[in]     ifftFlag        0 for the forward transform, 1 for the inverse transform.
+ * @param[in]     bitReverseFlag  1 for the output in normal order.
+ * @return     none.
+ *
+ * \par Description:
+ * Channel c is the complex sequence starting at p1[2*c*fftLen], transformed
+ * in place with arm_cfft_f32().  The instance only holds constant tables and
+ * is shared by all the workers.
+ */
+void arm_batch_cfft_f32(
+  arm_batch_instance * S,
+  const arm_cfft_instance_f32 * pCfft,
+  float32_t * p1,
+  uint32_t numChannels,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  arm_batch_cfft_args args;                      /* Arguments of the tasks */
+
+  args.pCfft = pCfft;
+  args.p1 = p1;
+  args.ifftFlag = ifftFlag;
+  args.bitReverseFlag = bitReverseFlag;
+
+  arm_batch_run(S, arm_batch_cfft_task, &args, numChannels);
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
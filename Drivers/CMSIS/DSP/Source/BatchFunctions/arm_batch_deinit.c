@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_deinit.c
+ * Description:  Releases a multi-threaded batch pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+#include <stdlib.h>
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+/**
+ * @brief  Terminates the threads of a batch pool and frees its buffers.
+ * @param[in,out] S  points to an instance of the batch pool structure.
+ * @return     none.
+ */
+void arm_batch_deinit(
+  arm_batch_instance * S)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if (S->pWorkers != NULL)
+  {
+    pthread_mutex_lock(&S->lock);
+    S->stop = 1U;
+    pthread_cond_broadcast(&S->start);
+    pthread_mutex_unlock(&S->lock);
+
+    for (i = 1U; i < S->numThreads; i++)
+    {
+      pthread_join(S->pWorkers[i].thread, NULL);
+    }
+
+    for (i = 0U; i < S->numThreads; i++)
+    {
+      free(S->pWorkers[i].pScratch);
+      pthread_mutex_destroy(&S->pWorkers[i].lock);
+    }
+
+    pthread_cond_destroy(&S->done);
+    pthread_cond_destroy(&S->start);
+    pthread_mutex_destroy(&S->lock);
+
+    free(S->pWorkers);
+    S->pWorkers = NULL;
+  }
+
+  S->numThreads = 0U;
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_fir_f32.c
+ * Description:  Floating-point FIR filters of independent channels on a multi-threaded pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+typedef struct
+{
+  arm_fir_instance_f32 *pInst;                   /* Instances of the channels */
+  float32_t *pSrc;                               /* Input of the channels */
+  float32_t *pDst;                               /* Output of the channels */
+  uint32_t blockSize;                            /* Number of samples of each channel */
+} arm_batch_fir_args;
+
+static void arm_batch_fir_task(
+  void * pArg,
+  uint32_t index,
+  float32_t * pScratch)
+{
+  arm_batch_fir_args *pArgs = (arm_batch_fir_args *) pArg;
+  size_t offset = (size_t) index * pArgs->blockSize;
+
+  (void) pScratch;
+
+  arm_fir_f32(&pArgs->pInst[index], pArgs->pSrc + offset, pArgs->pDst + offset,
+              pArgs->blockSize);
+}
+
+/**
+ * @brief  Floating-point FIR filters of independent channels.
+ * @param[in,out] S            points to an instance of the batch pool structure.
+ * @param[in]     pInst        points to the FIR instances, one per channel.
+ * @param[in]     pSrc         points to the input, blockSize values per channel.
+ * @param[out]    pDst         points to the output, blockSize values per channel.
+ * @param[in]     numChannels  number of channels.
+ * @param[in]     blockSize    number of samples of each channel.
+ * @return     none.
+ *
+ * \par Description:
+ * Channel c reads pSrc[c*blockSize] to pSrc[(c+1)*blockSize-1] and writes
+ * the same range of pDst with arm_fir_f32() and the instance pInst[c], whose
+ * state must not be shared with another channel.
+ */
+void arm_batch_fir_f32(
+  arm_batch_instance * S,
+  arm_fir_instance_f32 * pInst,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numChannels,
+  uint32_t blockSize)
+{
+  arm_batch_fir_args args;                       /* Arguments of the tasks */
+
+  args.pInst = pInst;
+  args.pSrc = pSrc;
+  args.pDst = pDst;
+  args.blockSize = blockSize;
+
+  arm_batch_run(S, arm_batch_fir_task, &args, numChannels);
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
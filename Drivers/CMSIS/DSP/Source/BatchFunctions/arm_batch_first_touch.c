@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_first_touch.c
+ * Description:  Places channel buffers near the workers of a multi-threaded pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+#include <string.h>
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+typedef struct
+{
+  float32_t *pBuf;                               /* Buffer of the channels */
+  uint32_t channelSize;                          /* Number of values of each channel */
+} arm_batch_first_touch_args;
+
+static void arm_batch_first_touch_task(
+  void * pArg,
+  uint32_t index,
+  float32_t * pScratch)
+{
+  arm_batch_first_touch_args *pArgs = (arm_batch_first_touch_args *) pArg;
+
+  (void) pScratch;
+
+  memset(pArgs->pBuf + (size_t) index * pArgs->channelSize, 0,
+         pArgs->channelSize * sizeof(float32_t));
+}
+
+/**
+ * @brief  Clears channel buffers from the workers that will process them.
+ * @param[in,out] S            points to an instance of the batch pool structure.
+ * @param[out]    pBuf         points to the buffer of the channels.
+ * @param[in]     channelSize  number of values of each channel.
+ * @param[in]     numChannels  number of channels.
+ * @return     none.
+ *
+ * \par Description:
+ * Channel c is cleared by the worker that owns it at the start of a batch of
+ * numChannels tasks.  On a NUMA host, the pages of a newly allocated buffer
+ * are placed on the node of the thread that first writes them, so the
+ * function should be called before any other write to the buffer.  Buffers
+ * already written are only cleared.
+ */
+void arm_batch_first_touch(
+  arm_batch_instance * S,
+  float32_t * pBuf,
+  uint32_t channelSize,
+  uint32_t numChannels)
+{
+  arm_batch_first_touch_args args;               /* Arguments of the tasks */
+
+  args.pBuf = pBuf;
+  args.channelSize = channelSize;
+
+  arm_batch_run(S, arm_batch_first_touch_task, &args, numChannels);
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
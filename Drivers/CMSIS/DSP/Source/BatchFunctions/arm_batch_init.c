@@ -0,0 +1,283 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_init.c
+ * Description:  Initialization function for a multi-threaded batch pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined (__linux__)
+  #define _GNU_SOURCE                            /* pthread_setaffinity_np() */
+#endif
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Batch Multi-Threaded Batch Processing
+ *
+ * Runs a kernel on many independent channels from a pool of host threads.
+ * The functions are only built on POSIX hosts, where <code>arm_batch.h</code>
+ * defines <code>ARM_BATCH_AVAILABLE</code>; for the Cortex-M targets the
+ * source files are empty.
+ *
+ * Each channel is one task, processed by the single-threaded kernel with its
+ * own instance, so the results are bit-exact with processing the channels one
+ * after the other, whatever the number of threads.
+ *
+ * \par Work Stealing
+ * The tasks of a batch are split into one contiguous range per worker, the
+ * calling thread being worker 0.  A worker takes its tasks from the front of
+ * its range, then takes the remaining tasks from the back of the ranges of the
+ * other workers, so that a slow channel or a preempted thread does not hold up
+ * the batch.
+ *
+ * \par Memory Placement
+ * Each worker allocates and clears its scratch buffer from its own thread, so
+ * that on a NUMA host the pages are placed on the node of the processor that
+ * uses them.  The channel buffers can be placed the same way with
+ * arm_batch_first_touch(), which clears each channel from the worker that
+ * owns it at the start of a batch.  Binding the workers to processors
+ * (<code>pinThreads</code>) keeps them on these nodes; binding is only
+ * supported on Linux and is silently skipped elsewhere.
+ *
+ * \par Scratch Buffers
+ * The task of a channel receives the scratch buffer of the worker running it,
+ * which is only used by one task at a time.
+ */
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+/**
+ * @brief Thread function of the workers 1 to numThreads-1.
+ * @param[in] pParam  points to the worker.
+ * @return    NULL.
+ */
+static void * arm_batch_thread(
+  void * pParam)
+{
+  arm_batch_worker *pWorker = (arm_batch_worker *) pParam;
+  arm_batch_instance *S = pWorker->pPool;
+  uint32_t generation = 0U;                      /* Last batch run by the worker */
+  void *pScratch = NULL;                         /* Scratch buffer */
+
+#if defined (__linux__)
+  cpu_set_t cpus;                                /* Processor of the worker */
+  long numCpus;                                  /* Number of online processors */
+
+  if (S->pinThreads != 0U)
+  {
+    numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (numCpus > 0)
+    {
+      CPU_ZERO(&cpus);
+      CPU_SET(pWorker->id % (uint32_t) numCpus, &cpus);
+      (void) pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+  }
+#endif
+
+  /* Allocate and clear the scratch buffer after the binding, so that its
+     pages are placed near the processor of the worker */
+  if (S->scratchSize != 0U)
+  {
+    if (posix_memalign(&pScratch, 64U, S->scratchSize * sizeof(float32_t)) == 0)
+    {
+      memset(pScratch, 0, S->scratchSize * sizeof(float32_t));
+      pWorker->pScratch = (float32_t *) pScratch;
+    }
+  }
+
+  pthread_mutex_lock(&S->lock);
+
+  /* Signal the end of the initialization */
+  S->active--;
+
+  if (S->active == 0U)
+  {
+    pthread_cond_signal(&S->done);
+  }
+
+  while (S->stop == 0U)
+  {
+    if (S->generation == generation)
+    {
+      pthread_cond_wait(&S->start, &S->lock);
+    }
+    else
+    {
+      generation = S->generation;
+      pthread_mutex_unlock(&S->lock);
+
+      arm_batch_work(pWorker);
+
+      pthread_mutex_lock(&S->lock);
+      S->active--;
+
+      if (S->active == 0U)
+      {
+        pthread_cond_signal(&S->done);
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&S->lock);
+
+  return (NULL);
+}
+
+/**
+ * @brief  Initialization function for a batch pool.
+ * @param[out] S            points to an instance of the batch pool structure.
+ * @param[in]  numThreads   number of workers, including the calling thread.
+ * @param[in]  scratchSize  number of float32_t values of the scratch buffer of each worker.
+ * @param[in]  pinThreads   nonzero to bind each worker to a processor.
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>, or
+ *             <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numThreads</code> is 0
+ *             or if a thread or a buffer cannot be created.
+ *
+ * \par Description:
+ * The function starts numThreads-1 threads, which allocate their scratch
+ * buffers, and returns when all of them are waiting for a batch.  Worker 0 is
+ * the thread calling arm_batch_run(); its scratch buffer is allocated here.
+ * On error the pool is released and must not be used.
+ */
+arm_status arm_batch_init(
+  arm_batch_instance * S,
+  uint32_t numThreads,
+  uint32_t scratchSize,
+  uint8_t pinThreads)
+{
+  arm_status status = ARM_MATH_SUCCESS;          /* Status of the initialization */
+  void *pMem = NULL;                             /* Allocated memory */
+  uint32_t i;                                    /* Loop counter */
+
+  S->numThreads = 0U;
+  S->scratchSize = scratchSize;
+  S->pinThreads = pinThreads;
+  S->pWorkers = NULL;
+  S->generation = 0U;
+  S->active = 0U;
+  S->stop = 0U;
+  S->task = NULL;
+  S->pArg = NULL;
+
+  if (numThreads == 0U)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else if (posix_memalign(&pMem, 64U, numThreads * sizeof(arm_batch_worker)) != 0)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->pWorkers = (arm_batch_worker *) pMem;
+    memset(S->pWorkers, 0, numThreads * sizeof(arm_batch_worker));
+
+    pthread_mutex_init(&S->lock, NULL);
+    pthread_cond_init(&S->start, NULL);
+    pthread_cond_init(&S->done, NULL);
+
+    for (i = 0U; i < numThreads; i++)
+    {
+      pthread_mutex_init(&S->pWorkers[i].lock, NULL);
+      S->pWorkers[i].id = i;
+      S->pWorkers[i].pPool = S;
+    }
+
+    /* Scratch buffer of the calling thread */
+    if (scratchSize != 0U)
+    {
+      pMem = NULL;
+      if (posix_memalign(&pMem, 64U, scratchSize * sizeof(float32_t)) == 0)
+      {
+        memset(pMem, 0, scratchSize * sizeof(float32_t));
+      }
+      S->pWorkers[0].pScratch = (float32_t *) pMem;
+    }
+
+    /* Start the other workers */
+    S->active = numThreads - 1U;
+    S->numThreads = 1U;
+
+    while ((S->numThreads < numThreads) &&
+           (pthread_create(&S->pWorkers[S->numThreads].thread, NULL,
+                           arm_batch_thread, &S->pWorkers[S->numThreads]) == 0))
+    {
+      S->numThreads++;
+    }
+
+    /* Wait for the started workers to allocate their buffers */
+    pthread_mutex_lock(&S->lock);
+
+    S->active -= numThreads - S->numThreads;
+
+    while (S->active != 0U)
+    {
+      pthread_cond_wait(&S->done, &S->lock);
+    }
+
+    pthread_mutex_unlock(&S->lock);
+
+    if (S->numThreads != numThreads)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i = 0U; i < S->numThreads; i++)
+    {
+      if ((scratchSize != 0U) && (S->pWorkers[i].pScratch == NULL))
+      {
+        status = ARM_MATH_ARGUMENT_ERROR;
+      }
+    }
+
+    if (status != ARM_MATH_SUCCESS)
+    {
+      arm_batch_deinit(S);
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
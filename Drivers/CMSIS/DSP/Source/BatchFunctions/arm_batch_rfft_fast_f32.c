@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_rfft_fast_f32.c
+ * Description:  Floating-point real FFTs of independent channels on a multi-threaded pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+typedef struct
+{
+  arm_rfft_fast_instance_f32 *pRfft;             /* Instance shared by the channels */
+  float32_t *pSrc;                               /* Input of the channels */
+  float32_t *pDst;                               /* Output of the channels */
+  uint8_t ifftFlag;                              /* Direction of the transforms */
+} arm_batch_rfft_fast_args;
+
+static void arm_batch_rfft_fast_task(
+  void * pArg,
+  uint32_t index,
+  float32_t * pScratch)
+{
+  arm_batch_rfft_fast_args *pArgs = (arm_batch_rfft_fast_args *) pArg;
+  uint32_t fftLen = pArgs->pRfft->fftLenRFFT;
+  size_t offset = (size_t) index * fftLen;
+
+  /* arm_rfft_fast_f32() overwrites its input, which is copied to the scratch
+     buffer of the worker */
+  arm_copy_f32(pArgs->pSrc + offset, pScratch, fftLen);
+
+  arm_rfft_fast_f32(pArgs->pRfft, pScratch, pArgs->pDst + offset, pArgs->ifftFlag);
+}
+
+/**
+ * @brief  Floating-point real FFTs of independent channels.
+ * @param[in,out] S            points to an instance of the batch pool structure, scratchSize >= fftLen.
+ * @param[in]     pRfft        points to the real FFT instance shared by the channels.
+ * @param[in]     pSrc         points to the input, fftLen values per channel.
+ * @param[out]    pDst         points to the output, fftLen values per channel.
+ * @param[in]     numChannels  number of channels.
+ * @param[in]     ifftFlag     0 for the forward transform, 1 for the inverse transform.
+ * @return     none.
+ *
+ * \par Description:
+ * Channel c reads pSrc[c*fftLen] to pSrc[(c+1)*fftLen-1] and writes the same
+ * range of pDst with arm_rfft_fast_f32().  Unlike arm_rfft_fast_f32(), the
+ * input is not modified: each channel is transformed from a copy in the
+ * scratch buffer of its worker, so the pool must have been initialized with a
+ * scratch buffer of at least fftLen values.  The instance only holds constant
+ * tables and is shared by all the workers.
+ */
+void arm_batch_rfft_fast_f32(
+  arm_batch_instance * S,
+  arm_rfft_fast_instance_f32 * pRfft,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numChannels,
+  uint8_t ifftFlag)
+{
+  arm_batch_rfft_fast_args args;                 /* Arguments of the tasks */
+
+  args.pRfft = pRfft;
+  args.pSrc = pSrc;
+  args.pDst = pDst;
+  args.ifftFlag = ifftFlag;
+
+  arm_batch_run(S, arm_batch_rfft_fast_task, &args, numChannels);
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
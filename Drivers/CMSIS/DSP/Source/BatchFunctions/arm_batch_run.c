@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_run.c
+ * Description:  Runs a batch of tasks on a multi-threaded pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+/**
+ * @brief  Runs tasks 0 to numTasks-1 on the pool and waits for them.
+ * @param[in,out] S         points to an instance of the batch pool structure.
+ * @param[in]     task      task to run.
+ * @param[in]     pArg      argument of the task.
+ * @param[in]     numTasks  number of tasks.
+ * @return     none.
+ *
+ * \par Description:
+ * Worker i is given the tasks i*numTasks/numThreads to
+ * (i+1)*numTasks/numThreads-1, and the calling thread works as worker 0.
+ * The tasks must be independent, they run in any order and concurrently.
+ * A pool runs one batch at a time and must not be used from a task.
+ */
+void arm_batch_run(
+  arm_batch_instance * S,
+  arm_batch_task task,
+  void * pArg,
+  uint32_t numTasks)
+{
+  uint32_t numThreads = S->numThreads;           /* Number of workers */
+  uint32_t i;                                    /* Loop counter */
+
+  if (numTasks != 0U)
+  {
+    S->task = task;
+    S->pArg = pArg;
+
+    /* The workers are idle, their ranges are published by the lock below */
+    for (i = 0U; i < numThreads; i++)
+    {
+      S->pWorkers[i].begin = (uint32_t) (((uint64_t) i * numTasks) / numThreads);
+      S->pWorkers[i].end = (uint32_t) (((uint64_t) (i + 1U) * numTasks) / numThreads);
+    }
+
+    pthread_mutex_lock(&S->lock);
+    S->active = numThreads - 1U;
+    S->generation++;
+    pthread_cond_broadcast(&S->start);
+    pthread_mutex_unlock(&S->lock);
+
+    arm_batch_work(&S->pWorkers[0]);
+
+    /* Wait for the other workers */
+    pthread_mutex_lock(&S->lock);
+
+    while (S->active != 0U)
+    {
+      pthread_cond_wait(&S->done, &S->lock);
+    }
+
+    pthread_mutex_unlock(&S->lock);
+  }
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
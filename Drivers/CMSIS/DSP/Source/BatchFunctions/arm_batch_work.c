@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_batch_work.c
+ * Description:  Work-stealing loop of a worker of a multi-threaded pool.
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: POSIX hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_batch.h"
+
+#if defined (ARM_BATCH_AVAILABLE)
+
+/**
+ * @addtogroup Batch
+ * @{
+ */
+
+/**
+ * @brief  Runs the tasks of a worker, then steals tasks from the other workers.
+ * @param[in,out] pWorker  points to the worker.
+ * @return     none.
+ *
+ * \par Description:
+ * The worker takes its tasks from the front of its range.  When the range is
+ * empty it takes the last task of the range of another worker, starting with
+ * the next one, and returns when all the ranges are empty.
+ */
+void arm_batch_work(
+  arm_batch_worker * pWorker)
+{
+  arm_batch_instance *S = pWorker->pPool;        /* Pool of the worker */
+  uint32_t numThreads = S->numThreads;           /* Number of workers */
+  arm_batch_worker *pVictim;                     /* Worker robbed of a task */
+  uint32_t index = 0U;                           /* Index of the task */
+  uint32_t found = 1U;                           /* Nonzero when a task was taken */
+  uint32_t k;                                    /* Loop counter */
+
+  while (found != 0U)
+  {
+    found = 0U;
+
+    /* Own tasks, from the front */
+    pthread_mutex_lock(&pWorker->lock);
+
+    if (pWorker->begin < pWorker->end)
+    {
+      index = pWorker->begin++;
+      found = 1U;
+    }
+
+    pthread_mutex_unlock(&pWorker->lock);
+
+    /* Tasks of the other workers, from the back */
+    for (k = 1U; (k < numThreads) && (found == 0U); k++)
+    {
+      pVictim = &S->pWorkers[(pWorker->id + k) % numThreads];
+
+      pthread_mutex_lock(&pVictim->lock);
+
+      if (pVictim->begin < pVictim->end)
+      {
+        index = --pVictim->end;
+        found = 1U;
+      }
+
+      pthread_mutex_unlock(&pVictim->lock);
+    }
+
+    if (found != 0U)
+    {
+      S->task(S->pArg, index, pWorker->pScratch);
+    }
+  }
+}
+
+/**
+ * @} end of Batch group
+ */
+
+#endif /* #if defined (ARM_BATCH_AVAILABLE) */
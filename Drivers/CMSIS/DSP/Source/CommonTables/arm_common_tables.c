@@ -22174,3 +22174,778 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
 	-5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411,
 	-2009, -1608, -1206, -804, -402, 0
 };
+
+/**
+ * \par
+ * The table holds 2^(-t) for t in [0 1] and is used by the exponential functions.
+ * \par
+ * Example code for the generation of the Q31 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	exp2Table[n] = pow(2, -n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q31 (Fixed point), round to the nearest integer value
+ * and saturate to the Q31 range:
+ *	exp2Table[n] = round(exp2Table[n] * pow(2, 31));
+ */
+const q31_t exp2Table_q31[FAST_MATH_TABLE_SIZE + 1] = {
+	2147483647L, 2144578345L, 2141676973L, 2138779525L, 2135885998L,
+	2132996386L, 2130110682L, 2127228883L, 2124350982L, 2121476975L,
+	2118606857L, 2115740621L, 2112878262L, 2110019777L, 2107165158L,
+	2104314402L, 2101467502L, 2098624453L, 2095785251L, 2092949891L,
+	2090118366L, 2087290671L, 2084466803L, 2081646755L, 2078830522L,
+	2076018099L, 2073209480L, 2070404662L, 2067603638L, 2064806404L,
+	2062012954L, 2059223283L, 2056437387L, 2053655259L, 2050876895L,
+	2048102290L, 2045331439L, 2042564337L, 2039800978L, 2037041357L,
+	2034285470L, 2031533312L, 2028784876L, 2026040159L, 2023299156L,
+	2020561860L, 2017828268L, 2015098375L, 2012372174L, 2009649662L,
+	2006930832L, 2004215682L, 2001504204L, 1998796395L, 1996092249L,
+	1993391761L, 1990694927L, 1988001742L, 1985312200L, 1982626297L,
+	1979944027L, 1977265386L, 1974590370L, 1971918972L, 1969251188L,
+	1966587013L, 1963926443L, 1961269472L, 1958616096L, 1955966310L,
+	1953320108L, 1950677487L, 1948038440L, 1945402964L, 1942771053L,
+	1940142704L, 1937517909L, 1934896666L, 1932278970L, 1929664814L,
+	1927054196L, 1924447109L, 1921843549L, 1919243512L, 1916646992L,
+	1914053985L, 1911464486L, 1908878490L, 1906295993L, 1903716990L,
+	1901141476L, 1898569446L, 1896000896L, 1893435821L, 1890874216L,
+	1888316077L, 1885761398L, 1883210176L, 1880662405L, 1878118081L,
+	1875577199L, 1873039755L, 1870505744L, 1867975161L, 1865448001L,
+	1862924261L, 1860403934L, 1857887018L, 1855373507L, 1852863396L,
+	1850356681L, 1847853357L, 1845353420L, 1842856865L, 1840363688L,
+	1837873883L, 1835387448L, 1832904376L, 1830424663L, 1827948305L,
+	1825475297L, 1823005635L, 1820539314L, 1818076330L, 1815616678L,
+	1813160354L, 1810707353L, 1808257670L, 1805811301L, 1803368243L,
+	1800928489L, 1798492036L, 1796058879L, 1793629014L, 1791202437L,
+	1788779142L, 1786359126L, 1783942384L, 1781528911L, 1779118704L,
+	1776711757L, 1774308066L, 1771907628L, 1769510437L, 1767116489L,
+	1764725780L, 1762338305L, 1759954060L, 1757573041L, 1755195243L,
+	1752820662L, 1750449294L, 1748081133L, 1745716177L, 1743354420L,
+	1740995858L, 1738640488L, 1736288303L, 1733939301L, 1731593477L,
+	1729250827L, 1726911345L, 1724575029L, 1722241874L, 1719911875L,
+	1717585029L, 1715261330L, 1712940775L, 1710623359L, 1708309079L,
+	1705997930L, 1703689907L, 1701385007L, 1699083225L, 1696784557L,
+	1694489000L, 1692196547L, 1689907196L, 1687620943L, 1685337782L,
+	1683057710L, 1680780723L, 1678506817L, 1676235986L, 1673968228L,
+	1671703538L, 1669441912L, 1667183346L, 1664927835L, 1662675375L,
+	1660425963L, 1658179594L, 1655936265L, 1653695970L, 1651458706L,
+	1649224469L, 1646993254L, 1644765058L, 1642539877L, 1640317706L,
+	1638098541L, 1635882379L, 1633669214L, 1631459044L, 1629251865L,
+	1627047671L, 1624846459L, 1622648225L, 1620452965L, 1618260675L,
+	1616071351L, 1613884989L, 1611701585L, 1609521135L, 1607343634L,
+	1605169080L, 1602997467L, 1600828793L, 1598663052L, 1596500241L,
+	1594340357L, 1592183394L, 1590029350L, 1587878220L, 1585730000L,
+	1583584686L, 1581442275L, 1579302762L, 1577166143L, 1575032416L,
+	1572901575L, 1570773616L, 1568648537L, 1566526333L, 1564406999L,
+	1562290533L, 1560176931L, 1558066187L, 1555958300L, 1553853264L,
+	1551751076L, 1549651732L, 1547555228L, 1545461560L, 1543370725L,
+	1541282719L, 1539197537L, 1537115177L, 1535035634L, 1532958904L,
+	1530884983L, 1528813869L, 1526745556L, 1524680042L, 1522617322L,
+	1520557392L, 1518500250L, 1516445891L, 1514394310L, 1512345506L,
+	1510299473L, 1508256209L, 1506215708L, 1504177968L, 1502142985L,
+	1500110755L, 1498081275L, 1496054540L, 1494030547L, 1492009293L,
+	1489990772L, 1487974983L, 1485961921L, 1483951582L, 1481943963L,
+	1479939060L, 1477936870L, 1475937388L, 1473940611L, 1471946536L,
+	1469955159L, 1467966475L, 1465980482L, 1463997176L, 1462016553L,
+	1460038610L, 1458063343L, 1456090748L, 1454120821L, 1452153560L,
+	1450188960L, 1448227018L, 1446267730L, 1444311093L, 1442357104L,
+	1440405757L, 1438457051L, 1436510981L, 1434567544L, 1432626736L,
+	1430688553L, 1428752993L, 1426820052L, 1424889725L, 1422962010L,
+	1421036903L, 1419114401L, 1417194499L, 1415277195L, 1413362485L,
+	1411450365L, 1409540832L, 1407633882L, 1405729513L, 1403827719L,
+	1401928499L, 1400031848L, 1398137763L, 1396246240L, 1394357277L,
+	1392470869L, 1390587013L, 1388705706L, 1386826944L, 1384950723L,
+	1383077041L, 1381205894L, 1379337279L, 1377471191L, 1375607628L,
+	1373746586L, 1371888062L, 1370032052L, 1368178554L, 1366327563L,
+	1364479076L, 1362633090L, 1360789601L, 1358948606L, 1357110102L,
+	1355274085L, 1353440552L, 1351609500L, 1349780925L, 1347954824L,
+	1346131193L, 1344310030L, 1342491330L, 1340675091L, 1338861309L,
+	1337049980L, 1335241103L, 1333434672L, 1331630686L, 1329829140L,
+	1328030031L, 1326233356L, 1324439112L, 1322647296L, 1320857903L,
+	1319070932L, 1317286378L, 1315504238L, 1313724509L, 1311947188L,
+	1310172272L, 1308399756L, 1306629639L, 1304861917L, 1303096586L,
+	1301333643L, 1299573086L, 1297814910L, 1296059113L, 1294305692L,
+	1292554642L, 1290805962L, 1289059647L, 1287315695L, 1285574102L,
+	1283834865L, 1282097982L, 1280363448L, 1278631261L, 1276901417L,
+	1275173913L, 1273448747L, 1271725915L, 1270005413L, 1268287239L,
+	1266571390L, 1264857861L, 1263146652L, 1261437757L, 1259731174L,
+	1258026900L, 1256324931L, 1254625266L, 1252927899L, 1251232829L,
+	1249540052L, 1247849566L, 1246161366L, 1244475451L, 1242791816L,
+	1241110459L, 1239431376L, 1237754566L, 1236080024L, 1234407747L,
+	1232737732L, 1231069977L, 1229404479L, 1227741233L, 1226080238L,
+	1224421490L, 1222764986L, 1221110723L, 1219458698L, 1217808908L,
+	1216161350L, 1214516021L, 1212872918L, 1211232038L, 1209593378L,
+	1207956934L, 1206322705L, 1204690686L, 1203060876L, 1201433270L,
+	1199807867L, 1198184662L, 1196563654L, 1194944838L, 1193328213L,
+	1191713774L, 1190101520L, 1188491447L, 1186883552L, 1185277833L,
+	1183674286L, 1182072908L, 1180473697L, 1178876649L, 1177281762L,
+	1175689033L, 1174098458L, 1172510036L, 1170923762L, 1169339634L,
+	1167757650L, 1166177806L, 1164600099L, 1163024526L, 1161451085L,
+	1159879773L, 1158310587L, 1156743523L, 1155178580L, 1153615754L,
+	1152055042L, 1150496441L, 1148939949L, 1147385563L, 1145833280L,
+	1144283097L, 1142735011L, 1141189020L, 1139645120L, 1138103309L,
+	1136563583L, 1135025941L, 1133490379L, 1131956895L, 1130425485L,
+	1128896147L, 1127368878L, 1125843675L, 1124320536L, 1122799457L,
+	1121280436L, 1119763470L, 1118248556L, 1116735692L, 1115224875L,
+	1113716102L, 1112209370L, 1110704676L, 1109202018L, 1107701393L,
+	1106202798L, 1104706230L, 1103211687L, 1101719167L, 1100228665L,
+	1098740180L, 1097253708L, 1095769248L, 1094286796L, 1092806349L,
+	1091327906L, 1089851462L, 1088377016L, 1086904565L, 1085434106L,
+	1083965636L, 1082499153L, 1081034654L, 1079572136L, 1078111597L,
+	1076653033L, 1075196443L, 1073741824L
+};
+
+/**
+ * \par
+ * The table holds 2^(-t) for t in [0 1] and is used by the exponential functions.
+ * \par
+ * Example code for the generation of the Q15 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	exp2Table[n] = pow(2, -n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q15 (Fixed point), round to the nearest integer value
+ * and saturate to the Q15 range:
+ *	exp2Table[n] = round(exp2Table[n] * pow(2, 15));
+ */
+const q15_t exp2Table_q15[FAST_MATH_TABLE_SIZE + 1] = {
+	32767, 32724, 32679, 32635, 32591, 32547, 32503, 32459, 32415, 32371,
+	32327, 32284, 32240, 32196, 32153, 32109, 32066, 32022, 31979, 31936,
+	31893, 31850, 31806, 31763, 31720, 31678, 31635, 31592, 31549, 31506,
+	31464, 31421, 31379, 31336, 31294, 31252, 31209, 31167, 31125, 31083,
+	31041, 30999, 30957, 30915, 30873, 30831, 30790, 30748, 30706, 30665,
+	30623, 30582, 30541, 30499, 30458, 30417, 30376, 30334, 30293, 30252,
+	30212, 30171, 30130, 30089, 30048, 30008, 29967, 29927, 29886, 29846,
+	29805, 29765, 29725, 29684, 29644, 29604, 29564, 29524, 29484, 29444,
+	29405, 29365, 29325, 29285, 29246, 29206, 29167, 29127, 29088, 29048,
+	29009, 28970, 28931, 28892, 28852, 28813, 28774, 28736, 28697, 28658,
+	28619, 28580, 28542, 28503, 28464, 28426, 28388, 28349, 28311, 28272,
+	28234, 28196, 28158, 28120, 28082, 28044, 28006, 27968, 27930, 27892,
+	27855, 27817, 27779, 27742, 27704, 27667, 27629, 27592, 27554, 27517,
+	27480, 27443, 27406, 27369, 27332, 27295, 27258, 27221, 27184, 27147,
+	27110, 27074, 27037, 27001, 26964, 26928, 26891, 26855, 26818, 26782,
+	26746, 26710, 26674, 26638, 26601, 26565, 26530, 26494, 26458, 26422,
+	26386, 26351, 26315, 26279, 26244, 26208, 26173, 26137, 26102, 26067,
+	26031, 25996, 25961, 25926, 25891, 25856, 25821, 25786, 25751, 25716,
+	25681, 25647, 25612, 25577, 25543, 25508, 25474, 25439, 25405, 25370,
+	25336, 25302, 25268, 25233, 25199, 25165, 25131, 25097, 25063, 25029,
+	24995, 24962, 24928, 24894, 24860, 24827, 24793, 24760, 24726, 24693,
+	24659, 24626, 24593, 24559, 24526, 24493, 24460, 24427, 24394, 24361,
+	24328, 24295, 24262, 24229, 24196, 24164, 24131, 24098, 24066, 24033,
+	24001, 23968, 23936, 23903, 23871, 23839, 23806, 23774, 23742, 23710,
+	23678, 23646, 23614, 23582, 23550, 23518, 23486, 23455, 23423, 23391,
+	23359, 23328, 23296, 23265, 23233, 23202, 23170, 23139, 23108, 23077,
+	23045, 23014, 22983, 22952, 22921, 22890, 22859, 22828, 22797, 22766,
+	22735, 22705, 22674, 22643, 22613, 22582, 22552, 22521, 22491, 22460,
+	22430, 22399, 22369, 22339, 22309, 22278, 22248, 22218, 22188, 22158,
+	22128, 22098, 22068, 22038, 22009, 21979, 21949, 21919, 21890, 21860,
+	21831, 21801, 21772, 21742, 21713, 21683, 21654, 21625, 21595, 21566,
+	21537, 21508, 21479, 21450, 21421, 21392, 21363, 21334, 21305, 21276,
+	21247, 21219, 21190, 21161, 21133, 21104, 21076, 21047, 21019, 20990,
+	20962, 20933, 20905, 20877, 20849, 20820, 20792, 20764, 20736, 20708,
+	20680, 20652, 20624, 20596, 20568, 20540, 20513, 20485, 20457, 20429,
+	20402, 20374, 20347, 20319, 20292, 20264, 20237, 20209, 20182, 20155,
+	20127, 20100, 20073, 20046, 20019, 19992, 19965, 19938, 19911, 19884,
+	19857, 19830, 19803, 19776, 19750, 19723, 19696, 19669, 19643, 19616,
+	19590, 19563, 19537, 19510, 19484, 19458, 19431, 19405, 19379, 19353,
+	19326, 19300, 19274, 19248, 19222, 19196, 19170, 19144, 19118, 19092,
+	19066, 19041, 19015, 18989, 18963, 18938, 18912, 18887, 18861, 18836,
+	18810, 18785, 18759, 18734, 18708, 18683, 18658, 18633, 18607, 18582,
+	18557, 18532, 18507, 18482, 18457, 18432, 18407, 18382, 18357, 18332,
+	18308, 18283, 18258, 18233, 18209, 18184, 18160, 18135, 18110, 18086,
+	18061, 18037, 18013, 17988, 17964, 17940, 17915, 17891, 17867, 17843,
+	17819, 17794, 17770, 17746, 17722, 17698, 17674, 17651, 17627, 17603,
+	17579, 17555, 17531, 17508, 17484, 17460, 17437, 17413, 17390, 17366,
+	17343, 17319, 17296, 17272, 17249, 17226, 17202, 17179, 17156, 17133,
+	17109, 17086, 17063, 17040, 17017, 16994, 16971, 16948, 16925, 16902,
+	16879, 16856, 16834, 16811, 16788, 16765, 16743, 16720, 16697, 16675,
+	16652, 16630, 16607, 16585, 16562, 16540, 16518, 16495, 16473, 16451,
+	16428, 16406, 16384
+};
+
+/**
+ * \par
+ * The table holds log2(m) for m in [0.5 1] and is used by the logarithm functions.
+ * \par
+ * Example code for the generation of the Q31 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	log2Table[n] = log2(0.5 + 0.5*n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q31 (Fixed point), round to the nearest integer value
+ * and saturate to the Q31 range:
+ *	log2Table[n] = round(log2Table[n] * pow(2, 31));
+ */
+const q31_t log2Table_q31[FAST_MATH_TABLE_SIZE + 1] = {
+	-2147483648L, -2141438448L, -2135405021L, -2129383320L, -2123373301L,
+	-2117374917L, -2111388125L, -2105412879L, -2099449135L, -2093496849L,
+	-2087555977L, -2081626474L, -2075708299L, -2069801407L, -2063905755L,
+	-2058021301L, -2052148003L, -2046285817L, -2040434703L, -2034594618L,
+	-2028765522L, -2022947372L, -2017140127L, -2011343748L, -2005558192L,
+	-1999783421L, -1994019393L, -1988266069L, -1982523409L, -1976791374L,
+	-1971069925L, -1965359022L, -1959658627L, -1953968700L, -1948289205L,
+	-1942620101L, -1936961353L, -1931312921L, -1925674768L, -1920046858L,
+	-1914429152L, -1908821613L, -1903224206L, -1897636894L, -1892059639L,
+	-1886492407L, -1880935160L, -1875387864L, -1869850483L, -1864322981L,
+	-1858805323L, -1853297475L, -1847799401L, -1842311066L, -1836832437L,
+	-1831363479L, -1825904158L, -1820454439L, -1815014290L, -1809583677L,
+	-1804162566L, -1798750925L, -1793348720L, -1787955917L, -1782572486L,
+	-1777198393L, -1771833605L, -1766478091L, -1761131819L, -1755794757L,
+	-1750466872L, -1745148134L, -1739838512L, -1734537973L, -1729246488L,
+	-1723964024L, -1718690553L, -1713426041L, -1708170461L, -1702923781L,
+	-1697685970L, -1692457000L, -1687236841L, -1682025462L, -1676822834L,
+	-1671628928L, -1666443716L, -1661267166L, -1656099252L, -1650939943L,
+	-1645789212L, -1640647030L, -1635513369L, -1630388200L, -1625271495L,
+	-1620163227L, -1615063367L, -1609971888L, -1604888763L, -1599813965L,
+	-1594747465L, -1589689237L, -1584639253L, -1579597488L, -1574563914L,
+	-1569538505L, -1564521235L, -1559512076L, -1554511003L, -1549517990L,
+	-1544533010L, -1539556039L, -1534587050L, -1529626018L, -1524672917L,
+	-1519727722L, -1514790407L, -1509860949L, -1504939321L, -1500025499L,
+	-1495119459L, -1490221175L, -1485330623L, -1480447779L, -1475572618L,
+	-1470705116L, -1465845250L, -1460992996L, -1456148328L, -1451311225L,
+	-1446481662L, -1441659616L, -1436845063L, -1432037981L, -1427238346L,
+	-1422446134L, -1417661324L, -1412883892L, -1408113816L, -1403351072L,
+	-1398595639L, -1393847494L, -1389106615L, -1384372979L, -1379646565L,
+	-1374927350L, -1370215312L, -1365510431L, -1360812683L, -1356122048L,
+	-1351438503L, -1346762028L, -1342092602L, -1337430202L, -1332774808L,
+	-1328126399L, -1323484954L, -1318850452L, -1314222873L, -1309602195L,
+	-1304988398L, -1300381462L, -1295781366L, -1291188090L, -1286601614L,
+	-1282021917L, -1277448981L, -1272882784L, -1268323307L, -1263770530L,
+	-1259224434L, -1254684999L, -1250152205L, -1245626033L, -1241106464L,
+	-1236593479L, -1232087058L, -1227587182L, -1223093832L, -1218606990L,
+	-1214126636L, -1209652752L, -1205185320L, -1200724320L, -1196269734L,
+	-1191821543L, -1187379730L, -1182944277L, -1178515164L, -1174092373L,
+	-1169675888L, -1165265689L, -1160861760L, -1156464081L, -1152072636L,
+	-1147687407L, -1143308375L, -1138935525L, -1134568838L, -1130208297L,
+	-1125853884L, -1121505583L, -1117163376L, -1112827247L, -1108497178L,
+	-1104173152L, -1099855153L, -1095543163L, -1091237166L, -1086937146L,
+	-1082643086L, -1078354969L, -1074072779L, -1069796499L, -1065526114L,
+	-1061261607L, -1057002962L, -1052750162L, -1048503192L, -1044262036L,
+	-1040026678L, -1035797102L, -1031573292L, -1027355233L, -1023142909L,
+	-1018936304L, -1014735403L, -1010540190L, -1006350651L, -1002166769L,
+	-997988530L, -993815917L, -989648917L, -985487515L, -981331694L,
+	-977181440L, -973036738L, -968897574L, -964763932L, -960635798L,
+	-956513158L, -952395996L, -948284298L, -944178049L, -940077236L,
+	-935981843L, -931891857L, -927807263L, -923728047L, -919654195L,
+	-915585693L, -911522527L, -907464682L, -903412145L, -899364902L,
+	-895322939L, -891286243L, -887254799L, -883228595L, -879207616L,
+	-875191848L, -871181279L, -867175896L, -863175683L, -859180629L,
+	-855190720L, -851205943L, -847226284L, -843251730L, -839282269L,
+	-835317887L, -831358572L, -827404309L, -823455088L, -819510894L,
+	-815571715L, -811637538L, -807708350L, -803784139L, -799864893L,
+	-795950598L, -792041242L, -788136813L, -784237298L, -780342685L,
+	-776452962L, -772568117L, -768688136L, -764813009L, -760942722L,
+	-757077264L, -753216623L, -749360787L, -745509744L, -741663481L,
+	-737821988L, -733985252L, -730153261L, -726326004L, -722503470L,
+	-718685645L, -714872520L, -711064082L, -707260320L, -703461222L,
+	-699666777L, -695876973L, -692091800L, -688311245L, -684535298L,
+	-680763948L, -676997183L, -673234992L, -669477363L, -665724287L,
+	-661975752L, -658231747L, -654492260L, -650757282L, -647026801L,
+	-643300807L, -639579288L, -635862234L, -632149635L, -628441479L,
+	-624737755L, -621038455L, -617343566L, -613653078L, -609966981L,
+	-606285265L, -602607918L, -598934932L, -595266294L, -591601996L,
+	-587942026L, -584286375L, -580635032L, -576987987L, -573345231L,
+	-569706753L, -566072542L, -562442590L, -558816885L, -555195419L,
+	-551578181L, -547965161L, -544356350L, -540751738L, -537151315L,
+	-533555070L, -529962996L, -526375081L, -522791317L, -519211693L,
+	-515636200L, -512064829L, -508497570L, -504934414L, -501375351L,
+	-497820372L, -494269467L, -490722628L, -487179844L, -483641107L,
+	-480106407L, -476575735L, -473049083L, -469526440L, -466007798L,
+	-462493148L, -458982480L, -455475785L, -451973056L, -448474282L,
+	-444979455L, -441488565L, -438001605L, -434518565L, -431039436L,
+	-427564209L, -424092877L, -420625429L, -417161858L, -413702155L,
+	-410246311L, -406794317L, -403346165L, -399901847L, -396461353L,
+	-393024676L, -389591807L, -386162738L, -382737459L, -379315964L,
+	-375898242L, -372484287L, -369074090L, -365667642L, -362264935L,
+	-358865962L, -355470713L, -352079182L, -348691358L, -345307236L,
+	-341926805L, -338550060L, -335176990L, -331807589L, -328441848L,
+	-325079760L, -321721316L, -318366509L, -315015331L, -311667774L,
+	-308323830L, -304983491L, -301646749L, -298313598L, -294984028L,
+	-291658034L, -288335605L, -285016736L, -281701419L, -278389645L,
+	-275081408L, -271776699L, -268475512L, -265177838L, -261883671L,
+	-258593002L, -255305825L, -252022132L, -248741916L, -245465169L,
+	-242191884L, -238922054L, -235655671L, -232392728L, -229133218L,
+	-225877133L, -222624467L, -219375213L, -216129362L, -212886909L,
+	-209647845L, -206412165L, -203179860L, -199950923L, -196725349L,
+	-193503129L, -190284257L, -187068726L, -183856529L, -180647658L,
+	-177442108L, -174239871L, -171040941L, -167845310L, -164652971L,
+	-161463919L, -158278146L, -155095645L, -151916411L, -148740435L,
+	-145567712L, -142398234L, -139231996L, -136068990L, -132909210L,
+	-129752649L, -126599301L, -123449160L, -120302218L, -117158469L,
+	-114017907L, -110880526L, -107746318L, -104615278L, -101487399L,
+	-98362674L, -95241098L, -92122664L, -89007366L, -85895197L,
+	-82786151L, -79680222L, -76577403L, -73477689L, -70381073L,
+	-67287549L, -64197111L, -61109753L, -58025468L, -54944250L,
+	-51866094L, -48790993L, -45718941L, -42649932L, -39583961L,
+	-36521020L, -33461105L, -30404209L, -27350326L, -24299450L,
+	-21251576L, -18206697L, -15164808L, -12125902L, -9089974L, -6057019L,
+	-3027029L, 0L
+};
+
+/**
+ * \par
+ * The table holds log2(m) for m in [0.5 1] and is used by the logarithm functions.
+ * \par
+ * Example code for the generation of the Q15 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	log2Table[n] = log2(0.5 + 0.5*n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q15 (Fixed point), round to the nearest integer value
+ * and saturate to the Q15 range:
+ *	log2Table[n] = round(log2Table[n] * pow(2, 15));
+ */
+const q15_t log2Table_q15[FAST_MATH_TABLE_SIZE + 1] = {
+	-32768, -32676, -32584, -32492, -32400, -32309, -32217, -32126,
+	-32035, -31944, -31854, -31763, -31673, -31583, -31493, -31403,
+	-31313, -31224, -31135, -31045, -30957, -30868, -30779, -30691,
+	-30602, -30514, -30426, -30339, -30251, -30163, -30076, -29989,
+	-29902, -29815, -29729, -29642, -29556, -29469, -29383, -29298,
+	-29212, -29126, -29041, -28956, -28871, -28786, -28701, -28616,
+	-28532, -28447, -28363, -28279, -28195, -28111, -28028, -27944,
+	-27861, -27778, -27695, -27612, -27529, -27447, -27364, -27282,
+	-27200, -27118, -27036, -26954, -26873, -26791, -26710, -26629,
+	-26548, -26467, -26386, -26306, -26225, -26145, -26065, -25985,
+	-25905, -25825, -25745, -25666, -25586, -25507, -25428, -25349,
+	-25270, -25191, -25113, -25034, -24956, -24878, -24800, -24722,
+	-24644, -24566, -24489, -24411, -24334, -24257, -24180, -24103,
+	-24026, -23949, -23873, -23796, -23720, -23644, -23568, -23492,
+	-23416, -23340, -23265, -23189, -23114, -23039, -22964, -22889,
+	-22814, -22739, -22664, -22590, -22515, -22441, -22367, -22293,
+	-22219, -22145, -22072, -21998, -21925, -21851, -21778, -21705,
+	-21632, -21559, -21486, -21413, -21341, -21268, -21196, -21124,
+	-21052, -20980, -20908, -20836, -20764, -20693, -20621, -20550,
+	-20479, -20408, -20337, -20266, -20195, -20124, -20053, -19983,
+	-19913, -19842, -19772, -19702, -19632, -19562, -19492, -19423,
+	-19353, -19284, -19214, -19145, -19076, -19007, -18938, -18869,
+	-18800, -18731, -18663, -18594, -18526, -18458, -18390, -18322,
+	-18254, -18186, -18118, -18050, -17983, -17915, -17848, -17781,
+	-17713, -17646, -17579, -17512, -17446, -17379, -17312, -17246,
+	-17179, -17113, -17047, -16980, -16914, -16848, -16782, -16717,
+	-16651, -16585, -16520, -16454, -16389, -16324, -16259, -16194,
+	-16129, -16064, -15999, -15934, -15870, -15805, -15741, -15676,
+	-15612, -15548, -15484, -15420, -15356, -15292, -15228, -15164,
+	-15101, -15037, -14974, -14911, -14847, -14784, -14721, -14658,
+	-14595, -14532, -14470, -14407, -14344, -14282, -14220, -14157,
+	-14095, -14033, -13971, -13909, -13847, -13785, -13723, -13662,
+	-13600, -13538, -13477, -13416, -13354, -13293, -13232, -13171,
+	-13110, -13049, -12988, -12928, -12867, -12806, -12746, -12686,
+	-12625, -12565, -12505, -12445, -12385, -12325, -12265, -12205,
+	-12145, -12086, -12026, -11967, -11907, -11848, -11788, -11729,
+	-11670, -11611, -11552, -11493, -11434, -11376, -11317, -11258,
+	-11200, -11141, -11083, -11025, -10966, -10908, -10850, -10792,
+	-10734, -10676, -10618, -10560, -10503, -10445, -10388, -10330,
+	-10273, -10215, -10158, -10101, -10044, -9987, -9930, -9873, -9816,
+	-9759, -9702, -9646, -9589, -9533, -9476, -9420, -9364, -9307, -9251,
+	-9195, -9139, -9083, -9027, -8971, -8916, -8860, -8804, -8749, -8693,
+	-8638, -8582, -8527, -8472, -8416, -8361, -8306, -8251, -8196, -8141,
+	-8087, -8032, -7977, -7923, -7868, -7813, -7759, -7705, -7650, -7596,
+	-7542, -7488, -7434, -7380, -7326, -7272, -7218, -7164, -7111, -7057,
+	-7004, -6950, -6897, -6843, -6790, -6737, -6683, -6630, -6577, -6524,
+	-6471, -6418, -6365, -6313, -6260, -6207, -6155, -6102, -6050, -5997,
+	-5945, -5892, -5840, -5788, -5736, -5684, -5632, -5580, -5528, -5476,
+	-5424, -5372, -5321, -5269, -5217, -5166, -5114, -5063, -5012, -4960,
+	-4909, -4858, -4807, -4756, -4705, -4654, -4603, -4552, -4501, -4450,
+	-4400, -4349, -4298, -4248, -4197, -4147, -4097, -4046, -3996, -3946,
+	-3896, -3846, -3796, -3746, -3696, -3646, -3596, -3546, -3496, -3447,
+	-3397, -3347, -3298, -3248, -3199, -3150, -3100, -3051, -3002, -2953,
+	-2904, -2854, -2805, -2756, -2708, -2659, -2610, -2561, -2512, -2464,
+	-2415, -2367, -2318, -2270, -2221, -2173, -2125, -2076, -2028, -1980,
+	-1932, -1884, -1836, -1788, -1740, -1692, -1644, -1596, -1549, -1501,
+	-1453, -1406, -1358, -1311, -1263, -1216, -1168, -1121, -1074, -1027,
+	-980, -932, -885, -838, -791, -744, -698, -651, -604, -557, -511,
+	-464, -417, -371, -324, -278, -231, -185, -139, -92, -46, 0
+};
+
+/**
+ * \par
+ * The table holds atan(t) for t in [0 1] and is used by the arc tangent functions.
+ * \par
+ * Example code for the generation of the Q31 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	atanTable[n] = atan(n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q31 (Fixed point), round to the nearest integer value
+ * and saturate to the Q31 range:
+ *	atanTable[n] = round(atanTable[n] * pow(2, 31));
+ */
+const q31_t atanTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
+	0L, 4194299L, 8388565L, 12582768L, 16776875L, 20970853L, 25164672L,
+	29358299L, 33551702L, 37744849L, 41937708L, 46130247L, 50322435L,
+	54514239L, 58705628L, 62896569L, 67087031L, 71276983L, 75466391L,
+	79655225L, 83843452L, 88031042L, 92217961L, 96404180L, 100589665L,
+	104774386L, 108958310L, 113141407L, 117323644L, 121504991L,
+	125685416L, 129864887L, 134043374L, 138220844L, 142397268L,
+	146572612L, 150746848L, 154919942L, 159091865L, 163262585L,
+	167432071L, 171600293L, 175767220L, 179932820L, 184097064L,
+	188259920L, 192421358L, 196581348L, 200739859L, 204896860L,
+	209052322L, 213206214L, 217358506L, 221509168L, 225658169L,
+	229805480L, 233951071L, 238094912L, 242236974L, 246377227L,
+	250515640L, 254652185L, 258786833L, 262919553L, 267050317L,
+	271179096L, 275305860L, 279430581L, 283553229L, 287673776L,
+	291792193L, 295908452L, 300022523L, 304134379L, 308243991L,
+	312351331L, 316456371L, 320559083L, 324659438L, 328757409L,
+	332852969L, 336946089L, 341036742L, 345124901L, 349210538L,
+	353293626L, 357374138L, 361452047L, 365527326L, 369599949L,
+	373669888L, 377737117L, 381801610L, 385863340L, 389922281L,
+	393978407L, 398031692L, 402082110L, 406129636L, 410174243L,
+	414215907L, 418254601L, 422290301L, 426322982L, 430352617L,
+	434379184L, 438402656L, 442423009L, 446440219L, 450454261L,
+	454465111L, 458472745L, 462477139L, 466478268L, 470476109L,
+	474470639L, 478461834L, 482449671L, 486434126L, 490415176L,
+	494392799L, 498366971L, 502337670L, 506304874L, 510268559L,
+	514228703L, 518185285L, 522138282L, 526087673L, 530033436L,
+	533975548L, 537913989L, 541848738L, 545779773L, 549707072L,
+	553630616L, 557550384L, 561466354L, 565378506L, 569286820L,
+	573191276L, 577091854L, 580988533L, 584881295L, 588770118L,
+	592654984L, 596535874L, 600412768L, 604285648L, 608154493L,
+	612019286L, 615880008L, 619736641L, 623589165L, 627437563L,
+	631281817L, 635121909L, 638957821L, 642789535L, 646617035L,
+	650440302L, 654259320L, 658074071L, 661884539L, 665690706L,
+	669492557L, 673290075L, 677083243L, 680872046L, 684656466L,
+	688436490L, 692212100L, 695983281L, 699750018L, 703512295L,
+	707270098L, 711023411L, 714772219L, 718516508L, 722256264L,
+	725991471L, 729722115L, 733448183L, 737169661L, 740886534L,
+	744598789L, 748306412L, 752009391L, 755707711L, 759401359L,
+	763090324L, 766774591L, 770454148L, 774128983L, 777799082L,
+	781464435L, 785125029L, 788780852L, 792431891L, 796078136L,
+	799719575L, 803356196L, 806987988L, 810614940L, 814237042L,
+	817854281L, 821466648L, 825074132L, 828676723L, 832274409L,
+	835867182L, 839455031L, 843037946L, 846615917L, 850188935L,
+	853756991L, 857320075L, 860878177L, 864431290L, 867979403L,
+	871522508L, 875060597L, 878593661L, 882121691L, 885644680L,
+	889162618L, 892675499L, 896183314L, 899686056L, 903183717L,
+	906676289L, 910163766L, 913646139L, 917123403L, 920595549L,
+	924062571L, 927524463L, 930981218L, 934432829L, 937879290L,
+	941320595L, 944756737L, 948187712L, 951613512L, 955034133L,
+	958449569L, 961859814L, 965264863L, 968664710L, 972059352L,
+	975448781L, 978832995L, 982211988L, 985585755L, 988954292L,
+	992317595L, 995675659L, 999028480L, 1002376054L, 1005718377L,
+	1009055446L, 1012387256L, 1015713805L, 1019035088L, 1022351102L,
+	1025661844L, 1028967312L, 1032267501L, 1035562408L, 1038852032L,
+	1042136370L, 1045415418L, 1048689175L, 1051957637L, 1055220803L,
+	1058478671L, 1061731238L, 1064978503L, 1068220463L, 1071457117L,
+	1074688463L, 1077914500L, 1081135226L, 1084350640L, 1087560741L,
+	1090765527L, 1093964997L, 1097159151L, 1100347987L, 1103531506L,
+	1106709705L, 1109882585L, 1113050146L, 1116212385L, 1119369305L,
+	1122520904L, 1125667181L, 1128808138L, 1131943775L, 1135074090L,
+	1138199086L, 1141318761L, 1144433117L, 1147542154L, 1150645872L,
+	1153744273L, 1156837356L, 1159925124L, 1163007577L, 1166084716L,
+	1169156541L, 1172223055L, 1175284259L, 1178340154L, 1181390741L,
+	1184436022L, 1187475998L, 1190510672L, 1193540045L, 1196564119L,
+	1199582895L, 1202596377L, 1205604565L, 1208607463L, 1211605072L,
+	1214597394L, 1217584432L, 1220566189L, 1223542667L, 1226513869L,
+	1229479796L, 1232440453L, 1235395842L, 1238345965L, 1241290826L,
+	1244230427L, 1247164773L, 1250093865L, 1253017707L, 1255936303L,
+	1258849656L, 1261757769L, 1264660646L, 1267558289L, 1270450704L,
+	1273337893L, 1276219861L, 1279096611L, 1281968146L, 1284834472L,
+	1287695591L, 1290551508L, 1293402227L, 1296247753L, 1299088088L,
+	1301923239L, 1304753208L, 1307578001L, 1310397621L, 1313212074L,
+	1316021363L, 1318825494L, 1321624472L, 1324418300L, 1327206983L,
+	1329990527L, 1332768936L, 1335542216L, 1338310370L, 1341073405L,
+	1343831325L, 1346584136L, 1349331842L, 1352074448L, 1354811961L,
+	1357544385L, 1360271726L, 1362993989L, 1365711179L, 1368423302L,
+	1371130364L, 1373832370L, 1376529325L, 1379221237L, 1381908109L,
+	1384589948L, 1387266759L, 1389938549L, 1392605323L, 1395267088L,
+	1397923849L, 1400575612L, 1403222383L, 1405864168L, 1408500974L,
+	1411132806L, 1413759671L, 1416381575L, 1418998524L, 1421610524L,
+	1424217582L, 1426819704L, 1429416897L, 1432009166L, 1434596519L,
+	1437178962L, 1439756501L, 1442329143L, 1444896894L, 1447459761L,
+	1450017751L, 1452570871L, 1455119126L, 1457662525L, 1460201073L,
+	1462734777L, 1465263644L, 1467787682L, 1470306896L, 1472821294L,
+	1475330883L, 1477835670L, 1480335661L, 1482830864L, 1485321285L,
+	1487806933L, 1490287813L, 1492763933L, 1495235300L, 1497701921L,
+	1500163803L, 1502620954L, 1505073381L, 1507521090L, 1509964090L,
+	1512402387L, 1514835989L, 1517264904L, 1519689137L, 1522108698L,
+	1524523592L, 1526933828L, 1529339413L, 1531740355L, 1534136660L,
+	1536528337L, 1538915393L, 1541297834L, 1543675670L, 1546048907L,
+	1548417553L, 1550781615L, 1553141101L, 1555496019L, 1557846376L,
+	1560192180L, 1562533439L, 1564870160L, 1567202350L, 1569530018L,
+	1571853171L, 1574171817L, 1576485964L, 1578795619L, 1581100789L,
+	1583401484L, 1585697710L, 1587989476L, 1590276789L, 1592559656L,
+	1594838087L, 1597112087L, 1599381666L, 1601646832L, 1603907591L,
+	1606163952L, 1608415923L, 1610663511L, 1612906725L, 1615145572L,
+	1617380060L, 1619610198L, 1621835992L, 1624057451L, 1626274583L,
+	1628487396L, 1630695897L, 1632900095L, 1635099998L, 1637295613L,
+	1639486948L, 1641674012L, 1643856811L, 1646035356L, 1648209652L,
+	1650379709L, 1652545533L, 1654707134L, 1656864519L, 1659017696L,
+	1661166673L, 1663311459L, 1665452060L, 1667588485L, 1669720742L,
+	1671848840L, 1673972785L, 1676092586L, 1678208252L, 1680319789L,
+	1682427206L, 1684530512L, 1686629713L
+};
+
+/**
+ * \par
+ * The table holds atan(t) for t in [0 1] and is used by the arc tangent functions.
+ * \par
+ * Example code for the generation of the Q15 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	atanTable[n] = atan(n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q15 (Fixed point), round to the nearest integer value
+ * and saturate to the Q15 range:
+ *	atanTable[n] = round(atanTable[n] * pow(2, 15));
+ */
+const q15_t atanTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
+	0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832,
+	896, 960, 1024, 1088, 1152, 1215, 1279, 1343, 1407, 1471, 1535, 1599,
+	1663, 1726, 1790, 1854, 1918, 1982, 2045, 2109, 2173, 2237, 2300,
+	2364, 2428, 2491, 2555, 2618, 2682, 2746, 2809, 2873, 2936, 3000,
+	3063, 3126, 3190, 3253, 3317, 3380, 3443, 3507, 3570, 3633, 3696,
+	3759, 3823, 3886, 3949, 4012, 4075, 4138, 4201, 4264, 4327, 4390,
+	4452, 4515, 4578, 4641, 4703, 4766, 4829, 4891, 4954, 5016, 5079,
+	5141, 5204, 5266, 5329, 5391, 5453, 5515, 5578, 5640, 5702, 5764,
+	5826, 5888, 5950, 6012, 6073, 6135, 6197, 6259, 6320, 6382, 6444,
+	6505, 6567, 6628, 6689, 6751, 6812, 6873, 6935, 6996, 7057, 7118,
+	7179, 7240, 7301, 7362, 7422, 7483, 7544, 7604, 7665, 7726, 7786,
+	7847, 7907, 7967, 8027, 8088, 8148, 8208, 8268, 8328, 8388, 8448,
+	8508, 8567, 8627, 8687, 8746, 8806, 8865, 8925, 8984, 9043, 9102,
+	9162, 9221, 9280, 9339, 9398, 9456, 9515, 9574, 9633, 9691, 9750,
+	9808, 9867, 9925, 9983, 10041, 10100, 10158, 10216, 10274, 10331,
+	10389, 10447, 10505, 10562, 10620, 10677, 10735, 10792, 10849, 10907,
+	10964, 11021, 11078, 11135, 11192, 11248, 11305, 11362, 11418, 11475,
+	11531, 11588, 11644, 11700, 11756, 11812, 11868, 11924, 11980, 12036,
+	12092, 12147, 12203, 12258, 12314, 12369, 12424, 12479, 12535, 12590,
+	12645, 12699, 12754, 12809, 12864, 12918, 12973, 13027, 13082, 13136,
+	13190, 13244, 13298, 13352, 13406, 13460, 13514, 13568, 13621, 13675,
+	13728, 13781, 13835, 13888, 13941, 13994, 14047, 14100, 14153, 14206,
+	14258, 14311, 14363, 14416, 14468, 14520, 14573, 14625, 14677, 14729,
+	14781, 14832, 14884, 14936, 14987, 15039, 15090, 15142, 15193, 15244,
+	15295, 15346, 15397, 15448, 15499, 15549, 15600, 15650, 15701, 15751,
+	15801, 15852, 15902, 15952, 16002, 16052, 16101, 16151, 16201, 16250,
+	16300, 16349, 16398, 16448, 16497, 16546, 16595, 16644, 16693, 16741,
+	16790, 16839, 16887, 16935, 16984, 17032, 17080, 17128, 17176, 17224,
+	17272, 17320, 17368, 17415, 17463, 17510, 17557, 17605, 17652, 17699,
+	17746, 17793, 17840, 17887, 17933, 17980, 18027, 18073, 18119, 18166,
+	18212, 18258, 18304, 18350, 18396, 18442, 18488, 18533, 18579, 18624,
+	18670, 18715, 18760, 18806, 18851, 18896, 18941, 18985, 19030, 19075,
+	19120, 19164, 19209, 19253, 19297, 19341, 19386, 19430, 19474, 19517,
+	19561, 19605, 19649, 19692, 19736, 19779, 19823, 19866, 19909, 19952,
+	19995, 20038, 20081, 20124, 20166, 20209, 20252, 20294, 20336, 20379,
+	20421, 20463, 20505, 20547, 20589, 20631, 20673, 20714, 20756, 20798,
+	20839, 20880, 20922, 20963, 21004, 21045, 21086, 21127, 21168, 21209,
+	21249, 21290, 21331, 21371, 21411, 21452, 21492, 21532, 21572, 21612,
+	21652, 21692, 21732, 21772, 21811, 21851, 21890, 21930, 21969, 22008,
+	22047, 22086, 22126, 22164, 22203, 22242, 22281, 22320, 22358, 22397,
+	22435, 22473, 22512, 22550, 22588, 22626, 22664, 22702, 22740, 22778,
+	22815, 22853, 22891, 22928, 22966, 23003, 23040, 23077, 23115, 23152,
+	23189, 23226, 23262, 23299, 23336, 23373, 23409, 23446, 23482, 23518,
+	23555, 23591, 23627, 23663, 23699, 23735, 23771, 23807, 23842, 23878,
+	23914, 23949, 23985, 24020, 24055, 24091, 24126, 24161, 24196, 24231,
+	24266, 24301, 24335, 24370, 24405, 24439, 24474, 24508, 24542, 24577,
+	24611, 24645, 24679, 24713, 24747, 24781, 24815, 24849, 24882, 24916,
+	24950, 24983, 25017, 25050, 25083, 25117, 25150, 25183, 25216, 25249,
+	25282, 25315, 25347, 25380, 25413, 25445, 25478, 25510, 25543, 25575,
+	25607, 25640, 25672, 25704, 25736
+};
+
+/**
+ * \par
+ * The table holds tanh(x) for x in [0 8] and is used by the hyperbolic tangent and sigmoid functions.
+ * \par
+ * Example code for the generation of the Q31 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	tanhTable[n] = tanh(8*n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q31 (Fixed point), round to the nearest integer value
+ * and saturate to the Q31 range:
+ *	tanhTable[n] = round(tanhTable[n] * pow(2, 31));
+ */
+const q31_t arm_tanhTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
+	0L, 33551702L, 67087027L, 100589633L, 134043238L, 167431658L,
+	200738834L, 233948866L, 267046038L, 300014853L, 332840059L,
+	365506674L, 398000016L, 430305726L, 462409793L, 494298576L,
+	525958823L, 557377695L, 588542781L, 619442116L, 650064194L,
+	680397984L, 710432940L, 740159012L, 769566653L, 798646828L,
+	827391017L, 855791222L, 883839965L, 911530290L, 938855767L,
+	965810482L, 992389039L, 1018586552L, 1044398644L, 1069821434L,
+	1094851532L, 1119486029L, 1143722488L, 1167558933L, 1190993835L,
+	1214026103L, 1236655069L, 1258880475L, 1280702458L, 1302121540L,
+	1323138607L, 1343754898L, 1363971989L, 1383791779L, 1403216471L,
+	1422248561L, 1440890820L, 1459146280L, 1477018219L, 1494510142L,
+	1511625774L, 1528369038L, 1544744046L, 1560755080L, 1576406585L,
+	1591703148L, 1606649491L, 1621250457L, 1635510996L, 1649436155L,
+	1663031067L, 1676300937L, 1689251036L, 1701886689L, 1714213263L,
+	1726236161L, 1737960815L, 1749392670L, 1760537185L, 1771399821L,
+	1781986033L, 1792301266L, 1802350947L, 1812140482L, 1821675246L,
+	1830960580L, 1840001788L, 1848804130L, 1857372819L, 1865713017L,
+	1873829831L, 1881728313L, 1889413451L, 1896890171L, 1904163334L,
+	1911237734L, 1918118093L, 1924809064L, 1931315227L, 1937641087L,
+	1943791074L, 1949769543L, 1955580771L, 1961228961L, 1966718233L,
+	1972052634L, 1977236130L, 1982272611L, 1987165888L, 1991919693L,
+	1996537682L, 2001023435L, 2005380453L, 2009612162L, 2013721914L,
+	2017712985L, 2021588576L, 2025351816L, 2029005763L, 2032553402L,
+	2035997648L, 2039341346L, 2042587275L, 2045738144L, 2048796596L,
+	2051765210L, 2054646501L, 2057442919L, 2060156855L, 2062790638L,
+	2065346536L, 2067826760L, 2070233464L, 2072568746L, 2074834649L,
+	2077033160L, 2079166216L, 2081235701L, 2083243450L, 2085191248L,
+	2087080830L, 2088913886L, 2090692061L, 2092416952L, 2094090114L,
+	2095713059L, 2097287257L, 2098814137L, 2100295089L, 2101731462L,
+	2103124571L, 2104475690L, 2105786059L, 2107056884L, 2108289334L,
+	2109484547L, 2110643629L, 2111767651L, 2112857658L, 2113914661L,
+	2114939645L, 2115933563L, 2116897344L, 2117831889L, 2118738072L,
+	2119616742L, 2120468724L, 2121294818L, 2122095801L, 2122872427L,
+	2123625428L, 2124355516L, 2125063379L, 2125749687L, 2126415091L,
+	2127060220L, 2127685686L, 2128292084L, 2128879988L, 2129449960L,
+	2130002540L, 2130538255L, 2131057616L, 2131561118L, 2132049242L,
+	2132522455L, 2132981208L, 2133425941L, 2133857079L, 2134275035L,
+	2134680210L, 2135072992L, 2135453758L, 2135822874L, 2136180694L,
+	2136527563L, 2136863812L, 2137189767L, 2137505741L, 2137812038L,
+	2138108952L, 2138396771L, 2138675772L, 2138946223L, 2139208386L,
+	2139462513L, 2139708851L, 2139947636L, 2140179101L, 2140403468L,
+	2140620954L, 2140831770L, 2141036119L, 2141234200L, 2141426204L,
+	2141612318L, 2141792720L, 2141967587L, 2142137087L, 2142301385L,
+	2142460640L, 2142615006L, 2142764634L, 2142909668L, 2143050249L,
+	2143186514L, 2143318595L, 2143446620L, 2143570713L, 2143690995L,
+	2143807583L, 2143920590L, 2144030125L, 2144136296L, 2144239206L,
+	2144338953L, 2144435637L, 2144529350L, 2144620183L, 2144708226L,
+	2144793563L, 2144876278L, 2144956451L, 2145034161L, 2145109482L,
+	2145182488L, 2145253251L, 2145321838L, 2145388318L, 2145452754L,
+	2145515209L, 2145575745L, 2145634419L, 2145691290L, 2145746413L,
+	2145799841L, 2145851627L, 2145901820L, 2145950471L, 2145997625L,
+	2146043330L, 2146087630L, 2146130567L, 2146172184L, 2146212522L,
+	2146251619L, 2146289514L, 2146326244L, 2146361844L, 2146396350L,
+	2146429794L, 2146462210L, 2146493629L, 2146524082L, 2146553598L,
+	2146582207L, 2146609936L, 2146636812L, 2146662861L, 2146688109L,
+	2146712581L, 2146736300L, 2146759290L, 2146781572L, 2146803170L,
+	2146824103L, 2146844392L, 2146864057L, 2146883117L, 2146901591L,
+	2146919496L, 2146936851L, 2146953672L, 2146969976L, 2146985778L,
+	2147001094L, 2147015939L, 2147030328L, 2147044273L, 2147057790L,
+	2147070891L, 2147083589L, 2147095897L, 2147107825L, 2147119387L,
+	2147130594L, 2147141455L, 2147151982L, 2147162186L, 2147172076L,
+	2147181661L, 2147190951L, 2147199956L, 2147208684L, 2147217143L,
+	2147225342L, 2147233289L, 2147240991L, 2147248457L, 2147255692L,
+	2147262705L, 2147269503L, 2147276091L, 2147282477L, 2147288666L,
+	2147294664L, 2147300479L, 2147306114L, 2147311576L, 2147316870L,
+	2147322001L, 2147326974L, 2147331794L, 2147336466L, 2147340994L,
+	2147345383L, 2147349637L, 2147353760L, 2147357756L, 2147361629L,
+	2147365383L, 2147369022L, 2147372548L, 2147375966L, 2147379279L,
+	2147382490L, 2147385602L, 2147388619L, 2147391543L, 2147394376L,
+	2147397123L, 2147399785L, 2147402365L, 2147404866L, 2147407290L,
+	2147409639L, 2147411916L, 2147414123L, 2147416262L, 2147418335L,
+	2147420345L, 2147422292L, 2147424180L, 2147426009L, 2147427783L,
+	2147429502L, 2147431167L, 2147432782L, 2147434347L, 2147435864L,
+	2147437334L, 2147438759L, 2147440140L, 2147441479L, 2147442776L,
+	2147444033L, 2147445252L, 2147446434L, 2147447579L, 2147448688L,
+	2147449764L, 2147450806L, 2147451817L, 2147452796L, 2147453745L,
+	2147454665L, 2147455557L, 2147456421L, 2147457259L, 2147458071L,
+	2147458858L, 2147459621L, 2147460360L, 2147461076L, 2147461771L,
+	2147462444L, 2147463096L, 2147463728L, 2147464341L, 2147464935L,
+	2147465511L, 2147466069L, 2147466610L, 2147467134L, 2147467642L,
+	2147468135L, 2147468612L, 2147469075L, 2147469523L, 2147469958L,
+	2147470379L, 2147470787L, 2147471183L, 2147471566L, 2147471938L,
+	2147472298L, 2147472647L, 2147472986L, 2147473314L, 2147473632L,
+	2147473940L, 2147474239L, 2147474528L, 2147474809L, 2147475081L,
+	2147475344L, 2147475600L, 2147475847L, 2147476087L, 2147476320L,
+	2147476545L, 2147476764L, 2147476976L, 2147477181L, 2147477380L,
+	2147477573L, 2147477760L, 2147477941L, 2147478117L, 2147478287L,
+	2147478452L, 2147478612L, 2147478766L, 2147478917L, 2147479062L,
+	2147479203L, 2147479340L, 2147479473L, 2147479601L, 2147479726L,
+	2147479846L, 2147479963L, 2147480077L, 2147480186L, 2147480293L,
+	2147480396L, 2147480496L, 2147480593L, 2147480687L, 2147480778L,
+	2147480867L, 2147480952L, 2147481035L, 2147481116L, 2147481193L,
+	2147481269L, 2147481342L, 2147481413L, 2147481482L, 2147481548L,
+	2147481613L, 2147481676L, 2147481736L, 2147481795L, 2147481852L,
+	2147481907L, 2147481961L, 2147482013L, 2147482063L, 2147482112L,
+	2147482159L, 2147482205L, 2147482249L, 2147482292L, 2147482334L,
+	2147482375L, 2147482414L, 2147482452L, 2147482489L, 2147482524L,
+	2147482559L, 2147482592L, 2147482625L, 2147482656L, 2147482687L,
+	2147482716L, 2147482745L, 2147482773L, 2147482800L, 2147482826L,
+	2147482851L, 2147482876L, 2147482899L, 2147482922L, 2147482945L,
+	2147482966L, 2147482987L, 2147483008L, 2147483027L, 2147483046L,
+	2147483065L, 2147483083L, 2147483100L, 2147483117L, 2147483133L,
+	2147483149L, 2147483165L
+};
+
+/**
+ * \par
+ * The table holds tanh(x) for x in [0 8] and is used by the hyperbolic tangent and sigmoid functions.
+ * \par
+ * Example code for the generation of the Q15 table:
+ * <pre>
+ * tableSize = 512;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	tanhTable[n] = tanh(8*n/tableSize);
+ * } </pre>
+ * \par
+ * Convert floating-point to Q15 (Fixed point), round to the nearest integer value
+ * and saturate to the Q15 range:
+ *	tanhTable[n] = round(tanhTable[n] * pow(2, 15));
+ */
+const q15_t arm_tanhTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
+	0, 512, 1024, 1535, 2045, 2555, 3063, 3570, 4075, 4578, 5079, 5577,
+	6073, 6566, 7056, 7542, 8025, 8505, 8980, 9452, 9919, 10382, 10840,
+	11294, 11743, 12186, 12625, 13058, 13486, 13909, 14326, 14737, 15143,
+	15542, 15936, 16324, 16706, 17082, 17452, 17816, 18173, 18525, 18870,
+	19209, 19542, 19869, 20189, 20504, 20813, 21115, 21411, 21702, 21986,
+	22265, 22538, 22804, 23066, 23321, 23571, 23815, 24054, 24287, 24516,
+	24738, 24956, 25168, 25376, 25578, 25776, 25969, 26157, 26340, 26519,
+	26694, 26864, 27029, 27191, 27348, 27502, 27651, 27797, 27938, 28076,
+	28211, 28341, 28469, 28592, 28713, 28830, 28944, 29055, 29163, 29268,
+	29370, 29470, 29566, 29660, 29751, 29840, 29926, 30010, 30091, 30170,
+	30247, 30322, 30394, 30465, 30533, 30600, 30664, 30727, 30788, 30847,
+	30904, 30960, 31014, 31067, 31118, 31167, 31215, 31262, 31307, 31351,
+	31394, 31435, 31476, 31515, 31553, 31589, 31625, 31659, 31693, 31726,
+	31757, 31788, 31817, 31846, 31874, 31901, 31928, 31953, 31978, 32002,
+	32025, 32048, 32070, 32091, 32112, 32132, 32151, 32170, 32188, 32206,
+	32223, 32240, 32256, 32271, 32287, 32301, 32316, 32329, 32343, 32356,
+	32368, 32381, 32392, 32404, 32415, 32426, 32436, 32447, 32456, 32466,
+	32475, 32484, 32493, 32501, 32509, 32517, 32525, 32532, 32540, 32547,
+	32553, 32560, 32566, 32573, 32579, 32584, 32590, 32596, 32601, 32606,
+	32611, 32616, 32620, 32625, 32629, 32634, 32638, 32642, 32646, 32649,
+	32653, 32657, 32660, 32663, 32667, 32670, 32673, 32676, 32678, 32681,
+	32684, 32686, 32689, 32691, 32694, 32696, 32698, 32700, 32702, 32704,
+	32706, 32708, 32710, 32712, 32714, 32715, 32717, 32718, 32720, 32721,
+	32723, 32724, 32726, 32727, 32728, 32729, 32731, 32732, 32733, 32734,
+	32735, 32736, 32737, 32738, 32739, 32740, 32741, 32741, 32742, 32743,
+	32744, 32745, 32745, 32746, 32747, 32747, 32748, 32749, 32749, 32750,
+	32750, 32751, 32751, 32752, 32752, 32753, 32753, 32754, 32754, 32755,
+	32755, 32755, 32756, 32756, 32757, 32757, 32757, 32758, 32758, 32758,
+	32759, 32759, 32759, 32759, 32760, 32760, 32760, 32760, 32761, 32761,
+	32761, 32761, 32762, 32762, 32762, 32762, 32762, 32762, 32763, 32763,
+	32763, 32763, 32763, 32763, 32764, 32764, 32764, 32764, 32764, 32764,
+	32764, 32764, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32765,
+	32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766,
+	32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767
+};
@@ -139,6 +139,43 @@ const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
 	4096, twiddleCoef_4096_q15, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
 
+/* Half-precision structs, sharing the floating-point twiddles and the fixed-point bit reversal tables */
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len16 = {
+	16, twiddleCoef_16, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len32 = {
+	32, twiddleCoef_32, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len64 = {
+	64, twiddleCoef_64, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len128 = {
+	128, twiddleCoef_128, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len256 = {
+	256, twiddleCoef_256, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len512 = {
+	512, twiddleCoef_512, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len1024 = {
+	1024, twiddleCoef_1024, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len2048 = {
+	2048, twiddleCoef_2048, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f16 arm_cfft_sR_f16_len4096 = {
+	4096, twiddleCoef_4096, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+};
+
 /* Structure for real-value inputs */
 /* Floating-point structs */
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len32 = {
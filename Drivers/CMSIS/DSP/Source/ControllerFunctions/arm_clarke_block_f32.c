@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_clarke_block_f32.c
+ * Description:  Floating-point Clarke transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup clarke
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Clarke transform of a block of samples.
+ * @param[in]  pIa        points to the block of three-phase coordinates <code>a</code>
+ * @param[in]  pIb        points to the block of three-phase coordinates <code>b</code>
+ * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+ * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * \par
+ * Each output pair is bit exact with <code>arm_clarke_f32()</code> for the same input pair.
+ * The function can operate in-place: <code>pIalpha</code> may alias <code>pIa</code>
+ * and <code>pIbeta</code> may alias <code>pIb</code>.
+ */
+
+void arm_clarke_block_f32(
+  float32_t * pIa,
+  float32_t * pIb,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  uint32_t blockSize)
+{
+  float32_t Ia, Ib;                              /* Temporary input variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t Ia1, Ia2, Ia3, Ia4;                  /* Temporary input variables */
+  float32_t Ib1, Ib2, Ib3, Ib4;                  /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Read four samples of each phase */
+    Ia1 = pIa[0];
+    Ia2 = pIa[1];
+    Ia3 = pIa[2];
+    Ia4 = pIa[3];
+    Ib1 = pIb[0];
+    Ib2 = pIb[1];
+    Ib3 = pIb[2];
+    Ib4 = pIb[3];
+
+    /* Ialpha = Ia */
+    pIalpha[0] = Ia1;
+    pIalpha[1] = Ia2;
+    pIalpha[2] = Ia3;
+    pIalpha[3] = Ia4;
+
+    /* Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    pIbeta[0] = ((float32_t) 0.57735026919 * Ia1 + (float32_t) 1.15470053838 * Ib1);
+    pIbeta[1] = ((float32_t) 0.57735026919 * Ia2 + (float32_t) 1.15470053838 * Ib2);
+    pIbeta[2] = ((float32_t) 0.57735026919 * Ia3 + (float32_t) 1.15470053838 * Ib3);
+    pIbeta[3] = ((float32_t) 0.57735026919 * Ia4 + (float32_t) 1.15470053838 * Ib4);
+
+    /* update pointers to process next samples */
+    pIa += 4U;
+    pIb += 4U;
+    pIalpha += 4U;
+    pIbeta += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    Ia = *pIa++;
+    Ib = *pIb++;
+
+    /* Ialpha = Ia */
+    *pIalpha++ = Ia;
+
+    /* Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    *pIbeta++ = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of clarke group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_clarke_block_q31.c
+ * Description:  Q31 Clarke transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup clarke
+ * @{
+ */
+
+/**
+ * @brief  Q31 Clarke transform of a block of samples.
+ * @param[in]  pIa        points to the block of three-phase coordinates <code>a</code>
+ * @param[in]  pIb        points to the block of three-phase coordinates <code>b</code>
+ * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+ * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each output pair is bit exact with <code>arm_clarke_q31()</code> for the same input pair.
+ * The intermediate multiplications are truncated to 1.31 format and the addition saturates.
+ * The function can operate in-place.
+ */
+
+void arm_clarke_block_q31(
+  q31_t * pIa,
+  q31_t * pIb,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  uint32_t blockSize)
+{
+  q31_t Ia, Ib;                                  /* Temporary input variables */
+  q31_t product1, product2;                      /* Temporary variables used to store intermediate results */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t Ia1, Ia2, Ib1, Ib2;                      /* Temporary input variables */
+  q31_t product3, product4;                      /* Temporary variables used to store intermediate results */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1U;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while (blkCnt > 0U)
+  {
+    Ia1 = pIa[0];
+    Ia2 = pIa[1];
+    Ib1 = pIb[0];
+    Ib2 = pIb[1];
+
+    /* Ialpha = Ia */
+    pIalpha[0] = Ia1;
+    pIalpha[1] = Ia2;
+
+    /* Intermediate products (1/sqrt(3)) * Ia and (2/sqrt(3)) * Ib */
+    product1 = (q31_t) (((q63_t) Ia1 * 0x24F34E8B) >> 30);
+    product3 = (q31_t) (((q63_t) Ia2 * 0x24F34E8B) >> 30);
+    product2 = (q31_t) (((q63_t) Ib1 * 0x49E69D16) >> 30);
+    product4 = (q31_t) (((q63_t) Ib2 * 0x49E69D16) >> 30);
+
+    /* Ibeta is calculated by adding the intermediate products */
+    pIbeta[0] = __QADD(product1, product2);
+    pIbeta[1] = __QADD(product3, product4);
+
+    /* update pointers to process next samples */
+    pIa += 2U;
+    pIb += 2U;
+    pIalpha += 2U;
+    pIbeta += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    Ia = *pIa++;
+    Ib = *pIb++;
+
+    /* Ialpha = Ia */
+    *pIalpha++ = Ia;
+
+    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
+
+    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
+    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+
+    /* Ibeta is calculated by adding the intermediate products */
+    *pIbeta++ = __QADD(product1, product2);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of clarke group
+ */
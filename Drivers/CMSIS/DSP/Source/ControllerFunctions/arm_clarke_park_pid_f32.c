@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_clarke_park_pid_f32.c
+ * Description:  Floating-point fused Clarke, Park and PID current control step
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup clarke_park_pid
+ * @{
+ */
+
+/**
+ * @brief  Floating-point fused Clarke, Park and PID current control on a block of samples.
+ * @param[in,out] Sd         points to the PID Control instance of the d axis
+ * @param[in,out] Sq         points to the PID Control instance of the q axis
+ * @param[in]     pIa        points to the block of three-phase coordinates <code>a</code>
+ * @param[in]     pIb        points to the block of three-phase coordinates <code>b</code>
+ * @param[in]     pSinVal    points to the block of sine values of rotation angle theta
+ * @param[in]     pCosVal    points to the block of cosine values of rotation angle theta
+ * @param[in]     pIdRef     points to the block of d axis references
+ * @param[in]     pIqRef     points to the block of q axis references
+ * @param[out]    pVd        points to the block of d axis controller outputs
+ * @param[out]    pVq        points to the block of q axis controller outputs
+ * @param[in]     blockSize  number of samples to process
+ * @return none.
+ *
+ * \par
+ * The outputs and final states are bit exact with the sequence
+ * <code>arm_clarke_f32()</code>, <code>arm_park_f32()</code>, the subtractions
+ * <code>IdRef - Id</code> and <code>IqRef - Iq</code> and then <code>arm_pid_f32()</code>
+ * on each axis, but the intermediate currents and the controller states stay in local
+ * variables for the whole block.
+ */
+
+void arm_clarke_park_pid_f32(
+  arm_pid_instance_f32 * Sd,
+  arm_pid_instance_f32 * Sq,
+  float32_t * pIa,
+  float32_t * pIb,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  float32_t * pIdRef,
+  float32_t * pIqRef,
+  float32_t * pVd,
+  float32_t * pVq,
+  uint32_t blockSize)
+{
+  float32_t dA0 = Sd->A0, dA1 = Sd->A1, dA2 = Sd->A2;  /* d axis derived gains */
+  float32_t qA0 = Sq->A0, qA1 = Sq->A1, qA2 = Sq->A2;  /* q axis derived gains */
+  float32_t dx1 = Sd->state[0];                  /* d axis x[n-1] */
+  float32_t dx2 = Sd->state[1];                  /* d axis x[n-2] */
+  float32_t dy = Sd->state[2];                   /* d axis y[n-1] */
+  float32_t qx1 = Sq->state[0];                  /* q axis x[n-1] */
+  float32_t qx2 = Sq->state[1];                  /* q axis x[n-2] */
+  float32_t qy = Sq->state[2];                   /* q axis y[n-1] */
+  float32_t Ialpha, Ibeta;                       /* stationary frame currents */
+  float32_t Id, Iq;                              /* rotating frame currents */
+  float32_t ed, eq;                              /* control errors */
+  float32_t sinVal, cosVal;                      /* sine and cosine of theta */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* Clarke transform */
+    Ialpha = *pIa++;
+    Ibeta = ((float32_t) 0.57735026919 * Ialpha + (float32_t) 1.15470053838 * *pIb++);
+
+    /* Park transform */
+    sinVal = *pSinVal++;
+    cosVal = *pCosVal++;
+    Id = Ialpha * cosVal + Ibeta * sinVal;
+    Iq = -Ialpha * sinVal + Ibeta * cosVal;
+
+    /* Control errors */
+    ed = *pIdRef++ - Id;
+    eq = *pIqRef++ - Iq;
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    dy = (dA0 * ed) + (dA1 * dx1) + (dA2 * dx2) + (dy);
+    qy = (qA0 * eq) + (qA1 * qx1) + (qA2 * qx2) + (qy);
+
+    /* Update states */
+    dx2 = dx1;
+    dx1 = ed;
+    qx2 = qx1;
+    qx1 = eq;
+
+    *pVd++ = dy;
+    *pVq++ = qy;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Write back the states */
+  Sd->state[0] = dx1;
+  Sd->state[1] = dx2;
+  Sd->state[2] = dy;
+  Sq->state[0] = qx1;
+  Sq->state[1] = qx2;
+  Sq->state[2] = qy;
+}
+
+/**
+ * @} end of clarke_park_pid group
+ */
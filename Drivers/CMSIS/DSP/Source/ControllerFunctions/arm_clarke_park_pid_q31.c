@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_clarke_park_pid_q31.c
+ * Description:  Q31 fused Clarke, Park and PID current control step
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup clarke_park_pid
+ * @{
+ */
+
+/**
+ * @brief  Q31 fused Clarke, Park and PID current control on a block of samples.
+ * @param[in,out] Sd         points to the PID Control instance of the d axis
+ * @param[in,out] Sq         points to the PID Control instance of the q axis
+ * @param[in]     pIa        points to the block of three-phase coordinates <code>a</code>
+ * @param[in]     pIb        points to the block of three-phase coordinates <code>b</code>
+ * @param[in]     pSinVal    points to the block of sine values of rotation angle theta
+ * @param[in]     pCosVal    points to the block of cosine values of rotation angle theta
+ * @param[in]     pIdRef     points to the block of d axis references
+ * @param[in]     pIqRef     points to the block of q axis references
+ * @param[out]    pVd        points to the block of d axis controller outputs
+ * @param[out]    pVq        points to the block of q axis controller outputs
+ * @param[in]     blockSize  number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs and final states are bit exact with the sequence
+ * <code>arm_clarke_q31()</code>, <code>arm_park_q31()</code>, the saturating subtractions
+ * <code>__QSUB(IdRef, Id)</code> and <code>__QSUB(IqRef, Iq)</code> and then
+ * <code>arm_pid_q31()</code> on each axis, so the scaling recommendations of those
+ * functions apply.  The intermediate currents and the controller states stay in local
+ * variables for the whole block.
+ */
+
+void arm_clarke_park_pid_q31(
+  arm_pid_instance_q31 * Sd,
+  arm_pid_instance_q31 * Sq,
+  q31_t * pIa,
+  q31_t * pIb,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  q31_t * pIdRef,
+  q31_t * pIqRef,
+  q31_t * pVd,
+  q31_t * pVq,
+  uint32_t blockSize)
+{
+  q31_t dA0 = Sd->A0, dA1 = Sd->A1, dA2 = Sd->A2;  /* d axis derived gains */
+  q31_t qA0 = Sq->A0, qA1 = Sq->A1, qA2 = Sq->A2;  /* q axis derived gains */
+  q31_t dx1 = Sd->state[0];                      /* d axis x[n-1] */
+  q31_t dx2 = Sd->state[1];                      /* d axis x[n-2] */
+  q31_t dy = Sd->state[2];                       /* d axis y[n-1] */
+  q31_t qx1 = Sq->state[0];                      /* q axis x[n-1] */
+  q31_t qx2 = Sq->state[1];                      /* q axis x[n-2] */
+  q31_t qy = Sq->state[2];                       /* q axis y[n-1] */
+  q31_t Ialpha, Ibeta;                           /* stationary frame currents */
+  q31_t Id, Iq;                                  /* rotating frame currents */
+  q31_t ed, eq;                                  /* control errors */
+  q31_t sinVal, cosVal;                          /* sine and cosine of theta */
+  q31_t product1, product2;                      /* Temporary variables used to store intermediate results */
+  q31_t product3, product4;                      /* Temporary variables used to store intermediate results */
+  q63_t accd, accq;                              /* PID accumulators */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* Clarke transform */
+    Ialpha = *pIa++;
+    product1 = (q31_t) (((q63_t) Ialpha * 0x24F34E8B) >> 30);
+    product2 = (q31_t) (((q63_t) *pIb++ * 0x49E69D16) >> 30);
+    Ibeta = __QADD(product1, product2);
+
+    /* Park transform */
+    sinVal = *pSinVal++;
+    cosVal = *pCosVal++;
+    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
+    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
+    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
+    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+    Id = __QADD(product1, product2);
+    Iq = __QSUB(product4, product3);
+
+    /* Control errors */
+    ed = __QSUB(*pIdRef++, Id);
+    eq = __QSUB(*pIqRef++, Iq);
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+    accd = (q63_t) dA0 * ed;
+    accq = (q63_t) qA0 * eq;
+    accd += (q63_t) dA1 * dx1;
+    accq += (q63_t) qA1 * qx1;
+    accd += (q63_t) dA2 * dx2;
+    accq += (q63_t) qA2 * qx2;
+
+    /* convert output to 1.31 format and add y[n-1] */
+    dy = (q31_t) (accd >> 31U) + dy;
+    qy = (q31_t) (accq >> 31U) + qy;
+
+    /* Update states */
+    dx2 = dx1;
+    dx1 = ed;
+    qx2 = qx1;
+    qx1 = eq;
+
+    *pVd++ = dy;
+    *pVq++ = qy;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Write back the states */
+  Sd->state[0] = dx1;
+  Sd->state[1] = dx2;
+  Sd->state[2] = dy;
+  Sq->state[0] = qx1;
+  Sq->state[1] = qx2;
+  Sq->state[2] = qy;
+}
+
+/**
+ * @} end of clarke_park_pid group
+ */
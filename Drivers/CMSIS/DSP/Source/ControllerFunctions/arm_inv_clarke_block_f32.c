@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_clarke_block_f32.c
+ * Description:  Floating-point inverse Clarke transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup inv_clarke
+ * @{
+ */
+
+/**
+ * @brief  Floating-point inverse Clarke transform of a block of samples.
+ * @param[in]  pIalpha    points to the block of two-phase orthogonal vector axis alpha
+ * @param[in]  pIbeta     points to the block of two-phase orthogonal vector axis beta
+ * @param[out] pIa        points to the block of output three-phase coordinates <code>a</code>
+ * @param[out] pIb        points to the block of output three-phase coordinates <code>b</code>
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * \par
+ * Each output pair is bit exact with <code>arm_inv_clarke_f32()</code> for the same input pair.
+ * The function can operate in-place.
+ */
+
+void arm_inv_clarke_block_f32(
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t * pIa,
+  float32_t * pIb,
+  uint32_t blockSize)
+{
+  float32_t Ialpha, Ibeta;                       /* Temporary input variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t Ialpha1, Ialpha2, Ialpha3, Ialpha4;  /* Temporary input variables */
+  float32_t Ibeta1, Ibeta2, Ibeta3, Ibeta4;      /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    Ialpha1 = pIalpha[0];
+    Ialpha2 = pIalpha[1];
+    Ialpha3 = pIalpha[2];
+    Ialpha4 = pIalpha[3];
+    Ibeta1 = pIbeta[0];
+    Ibeta2 = pIbeta[1];
+    Ibeta3 = pIbeta[2];
+    Ibeta4 = pIbeta[3];
+
+    /* Ia = Ialpha */
+    pIa[0] = Ialpha1;
+    pIa[1] = Ialpha2;
+    pIa[2] = Ialpha3;
+    pIa[3] = Ialpha4;
+
+    /* Ib = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+    pIb[0] = -0.5f * Ialpha1 + 0.8660254039f * Ibeta1;
+    pIb[1] = -0.5f * Ialpha2 + 0.8660254039f * Ibeta2;
+    pIb[2] = -0.5f * Ialpha3 + 0.8660254039f * Ibeta3;
+    pIb[3] = -0.5f * Ialpha4 + 0.8660254039f * Ibeta4;
+
+    /* update pointers to process next samples */
+    pIalpha += 4U;
+    pIbeta += 4U;
+    pIa += 4U;
+    pIb += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    Ialpha = *pIalpha++;
+    Ibeta = *pIbeta++;
+
+    /* Ia = Ialpha */
+    *pIa++ = Ialpha;
+
+    /* Ib = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+    *pIb++ = -0.5f * Ialpha + 0.8660254039f * Ibeta;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of inv_clarke group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_clarke_block_q31.c
+ * Description:  Q31 inverse Clarke transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup inv_clarke
+ * @{
+ */
+
+/**
+ * @brief  Q31 inverse Clarke transform of a block of samples.
+ * @param[in]  pIalpha    points to the block of two-phase orthogonal vector axis alpha
+ * @param[in]  pIbeta     points to the block of two-phase orthogonal vector axis beta
+ * @param[out] pIa        points to the block of output three-phase coordinates <code>a</code>
+ * @param[out] pIb        points to the block of output three-phase coordinates <code>b</code>
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each output pair is bit exact with <code>arm_inv_clarke_q31()</code> for the same input pair.
+ * The intermediate multiplications are truncated to 1.31 format and the subtraction saturates.
+ * The function can operate in-place.
+ */
+
+void arm_inv_clarke_block_q31(
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t * pIa,
+  q31_t * pIb,
+  uint32_t blockSize)
+{
+  q31_t Ialpha, Ibeta;                           /* Temporary input variables */
+  q31_t product1, product2;                      /* Temporary variables used to store intermediate results */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t Ialpha1, Ialpha2, Ibeta1, Ibeta2;        /* Temporary input variables */
+  q31_t product3, product4;                      /* Temporary variables used to store intermediate results */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1U;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while (blkCnt > 0U)
+  {
+    Ialpha1 = pIalpha[0];
+    Ialpha2 = pIalpha[1];
+    Ibeta1 = pIbeta[0];
+    Ibeta2 = pIbeta[1];
+
+    /* Ia = Ialpha */
+    pIa[0] = Ialpha1;
+    pIa[1] = Ialpha2;
+
+    /* Intermediate products (1/2) * Ialpha and (sqrt(3)/2) * Ibeta */
+    product1 = (q31_t) (((q63_t) (Ialpha1) * (0x40000000)) >> 31);
+    product3 = (q31_t) (((q63_t) (Ialpha2) * (0x40000000)) >> 31);
+    product2 = (q31_t) (((q63_t) (Ibeta1) * (0x6ED9EBA1)) >> 31);
+    product4 = (q31_t) (((q63_t) (Ibeta2) * (0x6ED9EBA1)) >> 31);
+
+    /* Ib is calculated by subtracting the products */
+    pIb[0] = __QSUB(product2, product1);
+    pIb[1] = __QSUB(product4, product3);
+
+    /* update pointers to process next samples */
+    pIalpha += 2U;
+    pIbeta += 2U;
+    pIa += 2U;
+    pIb += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    Ialpha = *pIalpha++;
+    Ibeta = *pIbeta++;
+
+    /* Ia = Ialpha */
+    *pIa++ = Ialpha;
+
+    /* Intermediate product is calculated by (1/2) * Ialpha */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
+
+    /* Intermediate product is calculated by (sqrt(3)/2) * Ibeta */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+
+    /* Ib is calculated by subtracting the products */
+    *pIb++ = __QSUB(product2, product1);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of inv_clarke group
+ */
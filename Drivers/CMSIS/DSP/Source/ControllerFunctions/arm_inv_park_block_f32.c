@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_park_block_f32.c
+ * Description:  Floating-point inverse Park transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup inv_park
+ * @{
+ */
+
+/**
+ * @brief  Floating-point inverse Park transform of a block of samples.
+ * @param[in]  pId        points to the block of rotor reference frame d
+ * @param[in]  pIq        points to the block of rotor reference frame q
+ * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+ * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+ * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+ * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * \par
+ * Each output pair is bit exact with <code>arm_inv_park_f32()</code> for the same inputs.
+ * The function can operate in-place.
+ */
+
+void arm_inv_park_block_f32(
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  float32_t Id, Iq;                              /* Temporary input variables */
+  float32_t sinVal, cosVal;                      /* sine and cosine of theta */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t Id1, Id2, Iq1, Iq2;                  /* Temporary input variables */
+  float32_t sin1, sin2, cos1, cos2;              /* sine and cosine of theta */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1U;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while (blkCnt > 0U)
+  {
+    Id1 = pId[0];
+    Id2 = pId[1];
+    Iq1 = pIq[0];
+    Iq2 = pIq[1];
+    sin1 = pSinVal[0];
+    sin2 = pSinVal[1];
+    cos1 = pCosVal[0];
+    cos2 = pCosVal[1];
+
+    /* Ialpha = Id * cosVal - Iq * sinVal */
+    pIalpha[0] = Id1 * cos1 - Iq1 * sin1;
+    pIalpha[1] = Id2 * cos2 - Iq2 * sin2;
+
+    /* Ibeta = Id * sinVal + Iq * cosVal */
+    pIbeta[0] = Id1 * sin1 + Iq1 * cos1;
+    pIbeta[1] = Id2 * sin2 + Iq2 * cos2;
+
+    /* update pointers to process next samples */
+    pId += 2U;
+    pIq += 2U;
+    pSinVal += 2U;
+    pCosVal += 2U;
+    pIalpha += 2U;
+    pIbeta += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    Id = *pId++;
+    Iq = *pIq++;
+    sinVal = *pSinVal++;
+    cosVal = *pCosVal++;
+
+    /* Ialpha = Id * cosVal - Iq * sinVal */
+    *pIalpha++ = Id * cosVal - Iq * sinVal;
+
+    /* Ibeta = Id * sinVal + Iq * cosVal */
+    *pIbeta++ = Id * sinVal + Iq * cosVal;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of inv_park group
+ */
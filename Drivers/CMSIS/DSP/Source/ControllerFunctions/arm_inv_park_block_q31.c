@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_park_block_q31.c
+ * Description:  Q31 inverse Park transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup inv_park
+ * @{
+ */
+
+/**
+ * @brief  Q31 inverse Park transform of a block of samples.
+ * @param[in]  pId        points to the block of rotor reference frame d
+ * @param[in]  pIq        points to the block of rotor reference frame q
+ * @param[out] pIalpha    points to the block of output two-phase orthogonal vector axis alpha
+ * @param[out] pIbeta     points to the block of output two-phase orthogonal vector axis beta
+ * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+ * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each output pair is bit exact with <code>arm_inv_park_q31()</code> for the same inputs.
+ * The intermediate multiplications are truncated to 1.31 format and the addition and
+ * subtraction saturate.
+ * The function can operate in-place.
+ */
+
+void arm_inv_park_block_q31(
+  q31_t * pId,
+  q31_t * pIq,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize)
+{
+  q31_t Id, Iq;                                  /* Temporary input variables */
+  q31_t sinVal, cosVal;                          /* sine and cosine of theta */
+  q31_t product1, product2;                      /* Temporary variables used to store intermediate results */
+  q31_t product3, product4;                      /* Temporary variables used to store intermediate results */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  /* The four products of a sample already keep the pipeline busy, no loop unrolling is used. */
+  while (blkCnt > 0U)
+  {
+    Id = *pId++;
+    Iq = *pIq++;
+    sinVal = *pSinVal++;
+    cosVal = *pCosVal++;
+
+    /* Intermediate product is calculated by (Id * cosVal) */
+    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * sinVal) */
+    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Id * sinVal) */
+    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * cosVal) */
+    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+
+    /* Calculate Ialpha by using the two intermediate products 1 and 2 */
+    *pIalpha++ = __QSUB(product1, product2);
+
+    /* Calculate Ibeta by using the two intermediate products 3 and 4 */
+    *pIbeta++ = __QADD(product4, product3);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of inv_park group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_park_block_f32.c
+ * Description:  Floating-point Park transform of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup park
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Park transform of a block of samples.
+ * @param[in]  pIalpha    points to the block of two-phase vector coordinates alpha
+ * @param[in]  pIbeta     points to the block of two-phase vector coordinates beta
+ * @param[out] pId        points to the block of output rotor reference frame d
+ * @param[out] pIq        points to the block of output rotor reference frame q
+ * @param[in]  pSinVal    points to the block of sine values of rotation angle theta
+ * @param[in]  pCosVal    points to the block of cosine values of rotation angle theta
+ * @param[in]  blockSize  number of samples to process
+ * @return none.
+ *
+ * \par
+ * Each output pair is bit exact with <code>arm_park_f32()</code> for the same inputs.
+ * The function can operate in-place.
+ */
+
+void arm_park_block_f32(
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  float32_t Ialpha, Ibeta;                       /* Temporary input variables */
+  float32_t sinVal, cosVal;                      /* sine and cosine of theta */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t Ialpha1, Ialpha2, Ibeta1, Ibeta2;    /* Temporary input variables */
+  float32_t sin1, sin2, cos1, cos2;              /* sine and cosine of theta */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1U;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while (blkCnt > 0U)
+  {
+    Ialpha1 = pIalpha[0];
+    Ialpha2 = pIalpha[1];
+    Ibeta1 = pIbeta[0];
+    Ibeta2 = pIbeta[1];
+    sin1 = pSinVal[0];
+    sin2 = pSinVal[1];
+    cos1 = pCosVal[0];
+    cos2 = pCosVal[1];
+
+    /* Id = Ialpha * cosVal + Ibeta * sinVal */
+    pId[0] = Ialpha1 * cos1 + Ibeta1 * sin1;
+    pId[1] = Ialpha2 * cos2 + Ibeta2 * sin2;
+
+    /* Iq = - Ialpha * sinVal + Ibeta * cosVal */
+    pIq[0] = -Ialpha1 * sin1 + Ibeta1 * cos1;
+    pIq[1] = -Ialpha2 * sin2 + Ibeta2 * cos2;
+
+    /* update pointers to process next samples */
+    pIalpha += 2U;
+    pIbeta += 2U;
+    pSinVal += 2U;
+    pCosVal += 2U;
+    pId += 2U;
+    pIq += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    Ialpha = *pIalpha++;
+    Ibeta = *pIbeta++;
+    sinVal = *pSinVal++;
+    cosVal = *pCosVal++;
+
+    /* Id = Ialpha * cosVal + Ibeta * sinVal */
+    *pId++ = Ialpha * cosVal + Ibeta * sinVal;
+
+    /* Iq = - Ialpha * sinVal + Ibeta * cosVal */
+    *pIq++ = -Ialpha * sinVal + Ibeta * cosVal;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of park group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_block_f32.c
+ * Description:  Floating-point PID Control of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for the floating-point PID Control on a block of samples.
+ * @param[in,out] S          points to an instance of the floating-point PID Control structure
+ * @param[in]     pSrc       points to the block of input samples
+ * @param[out]    pDst       points to the block of output samples
+ * @param[in]     blockSize  number of samples to process
+ * @return none.
+ *
+ * \par
+ * The outputs and the final state are bit exact with calling <code>arm_pid_f32()</code>
+ * once per input sample.  The gains and the state are held in local variables for the
+ * whole block and the state is written back once at the end.
+ * The function can operate in-place.
+ */
+
+void arm_pid_block_f32(
+  arm_pid_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t A0 = S->A0;                          /* derived gain A0 */
+  float32_t A1 = S->A1;                          /* derived gain A1 */
+  float32_t A2 = S->A2;                          /* derived gain A2 */
+  float32_t x1 = S->state[0];                    /* x[n-1] */
+  float32_t x2 = S->state[1];                    /* x[n-2] */
+  float32_t out = S->state[2];                   /* y[n-1] */
+  float32_t in;                                  /* x[n] */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  /* The recursion on y[n-1] serializes the samples, no loop unrolling is used. */
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    out = (A0 * in) + (A1 * x1) + (A2 * x2) + (out);
+
+    /* Update state */
+    x2 = x1;
+    x1 = in;
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Write back the state */
+  S->state[0] = x1;
+  S->state[1] = x2;
+  S->state[2] = out;
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_block_q15.c
+ * Description:  Q15 PID Control of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for the Q15 PID Control on a block of samples.
+ * @param[in,out] S          points to an instance of the Q15 PID Control structure
+ * @param[in]     pSrc       points to the block of input samples
+ * @param[out]    pDst       points to the block of output samples
+ * @param[in]     blockSize  number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs and the final state are bit exact with calling <code>arm_pid_q15()</code>
+ * once per input sample.  The gains and the state are held in local variables for the
+ * whole block; on cores with the DSP extension x[n-1] and x[n-2] stay packed in one
+ * register for the dual multiply-accumulate.
+ * The function can operate in-place.
+ */
+
+void arm_pid_block_q15(
+  arm_pid_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t A0 = S->A0;                              /* derived gain A0 */
+  q15_t out = S->state[2];                       /* y[n-1] */
+  q15_t in;                                      /* x[n] */
+  q63_t acc;                                     /* accumulator */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t A1 = S->A1;                              /* packed derived gains A1 and A2 */
+  q31_t xState = *__SIMD32_CONST(S->state);      /* packed x[n-1] and x[n-2] */
+
+  /* The recursion on y[n-1] serializes the samples, no loop unrolling is used. */
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* acc = A0 * x[n]  */
+    acc = (q31_t) __SMUAD((uint32_t)A0, (uint32_t)in);
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc = (q63_t)__SMLALD((uint32_t)A1, (uint32_t)xState, (uint64_t)acc);
+
+    /* acc += y[n-1] */
+    acc += (q31_t) out << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state, x[n] moves to the low half and x[n-1] to the high half */
+    xState = (q31_t) __PKHBT(in, xState, 16);
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Write back the state */
+  *__SIMD32_CONST(S->state) = xState;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q15_t A1 = S->A1;                              /* derived gain A1 */
+  q15_t A2 = S->A2;                              /* derived gain A2 */
+  q15_t x1 = S->state[0];                        /* x[n-1] */
+  q15_t x2 = S->state[1];                        /* x[n-2] */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* acc = A0 * x[n]  */
+    acc = ((q31_t) A0) * in;
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc += (q31_t) A1 * x1;
+    acc += (q31_t) A2 * x2;
+
+    /* acc += y[n-1] */
+    acc += (q31_t) out << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    x2 = x1;
+    x1 = in;
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Write back the state */
+  S->state[0] = x1;
+  S->state[1] = x2;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  S->state[2] = out;
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_block_q31.c
+ * Description:  Q31 PID Control of a block of samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for the Q31 PID Control on a block of samples.
+ * @param[in,out] S          points to an instance of the Q31 PID Control structure
+ * @param[in]     pSrc       points to the block of input samples
+ * @param[out]    pDst       points to the block of output samples
+ * @param[in]     blockSize  number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs and the final state are bit exact with calling <code>arm_pid_q31()</code>
+ * once per input sample, so the scaling recommendations of that function apply.
+ * The gains and the state are held in local variables for the whole block and the state
+ * is written back once at the end.
+ * The function can operate in-place.
+ */
+
+void arm_pid_block_q31(
+  arm_pid_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t A0 = S->A0;                              /* derived gain A0 */
+  q31_t A1 = S->A1;                              /* derived gain A1 */
+  q31_t A2 = S->A2;                              /* derived gain A2 */
+  q31_t x1 = S->state[0];                        /* x[n-1] */
+  q31_t x2 = S->state[1];                        /* x[n-2] */
+  q31_t out = S->state[2];                       /* y[n-1] */
+  q31_t in;                                      /* x[n] */
+  q63_t acc;                                     /* accumulator */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  /* The recursion on y[n-1] serializes the samples, no loop unrolling is used. */
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+    acc = (q63_t) A0 * in;
+    acc += (q63_t) A1 * x1;
+    acc += (q63_t) A2 * x2;
+
+    /* convert output to 1.31 format and add y[n-1] */
+    out = (q31_t) (acc >> 31U) + out;
+
+    /* Update state */
+    x2 = x1;
+    x1 = in;
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Write back the state */
+  S->state[0] = x1;
+  S->state[1] = x2;
+  S->state[2] = out;
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_multi_q31.c
+ * Description:  Q31 PID Control of several axes stored in SoA layout
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for several Q31 PID Controls on blocks of samples.
+ * @param[in,out] S          points to an array of <code>numAxes</code> PID Control instances
+ * @param[in]     numAxes    number of axes (independent controllers)
+ * @param[in]     pSrc       points to the input samples in SoA layout
+ * @param[out]    pDst       points to the output samples in SoA layout
+ * @param[in]     blockSize  number of samples to process for each axis
+ * @return none.
+ *
+ * \par
+ * The samples of axis <code>k</code> are stored contiguously at
+ * <code>pSrc[k * blockSize]</code> and written to <code>pDst[k * blockSize]</code>.
+ * The outputs and final states are bit exact with calling <code>arm_pid_q31()</code>
+ * once per sample of each axis.
+ * \par
+ * On cores with the DSP extension two axes are processed together so that their
+ * independent recursions interleave in the pipeline.  A remaining odd axis is processed
+ * with <code>arm_pid_block_q31()</code>.
+ */
+
+void arm_pid_multi_q31(
+  arm_pid_instance_q31 * S,
+  uint32_t numAxes,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t axCnt;                                /* axis counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  arm_pid_instance_q31 *S1, *S2;                 /* instances of the axis pair */
+  q31_t *pSrc1, *pSrc2;                          /* inputs of the axis pair */
+  q31_t *pDst1, *pDst2;                          /* outputs of the axis pair */
+  q31_t x11, x12, y1, in1;                       /* state and input of the first axis */
+  q31_t x21, x22, y2, in2;                       /* state and input of the second axis */
+  q63_t acc1, acc2;                              /* accumulators */
+  uint32_t blkCnt;                               /* loop counter */
+
+  axCnt = numAxes >> 1U;
+
+  while (axCnt > 0U)
+  {
+    S1 = S;
+    S2 = S + 1;
+    pSrc1 = pSrc;
+    pSrc2 = pSrc + blockSize;
+    pDst1 = pDst;
+    pDst2 = pDst + blockSize;
+
+    x11 = S1->state[0];
+    x12 = S1->state[1];
+    y1 = S1->state[2];
+    x21 = S2->state[0];
+    x22 = S2->state[1];
+    y2 = S2->state[2];
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      in1 = *pSrc1++;
+      in2 = *pSrc2++;
+
+      /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      acc1 = (q63_t) S1->A0 * in1;
+      acc2 = (q63_t) S2->A0 * in2;
+      acc1 += (q63_t) S1->A1 * x11;
+      acc2 += (q63_t) S2->A1 * x21;
+      acc1 += (q63_t) S1->A2 * x12;
+      acc2 += (q63_t) S2->A2 * x22;
+
+      /* convert output to 1.31 format and add y[n-1] */
+      y1 = (q31_t) (acc1 >> 31U) + y1;
+      y2 = (q31_t) (acc2 >> 31U) + y2;
+
+      /* Update state */
+      x12 = x11;
+      x11 = in1;
+      x22 = x21;
+      x21 = in2;
+
+      *pDst1++ = y1;
+      *pDst2++ = y2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Write back the states */
+    S1->state[0] = x11;
+    S1->state[1] = x12;
+    S1->state[2] = y1;
+    S2->state[0] = x21;
+    S2->state[1] = x22;
+    S2->state[2] = y2;
+
+    /* Advance to the next pair of axes */
+    S += 2U;
+    pSrc += 2U * blockSize;
+    pDst += 2U * blockSize;
+
+    /* Decrement the axis counter */
+    axCnt--;
+  }
+
+  /* Process the remaining axis, if any */
+  axCnt = numAxes % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  axCnt = numAxes;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (axCnt > 0U)
+  {
+    arm_pid_block_q31(S, pSrc, pDst, blockSize);
+
+    S++;
+    pSrc += blockSize;
+    pDst += blockSize;
+
+    /* Decrement the axis counter */
+    axCnt--;
+  }
+}
+
+/**
+ * @} end of PID group
+ */
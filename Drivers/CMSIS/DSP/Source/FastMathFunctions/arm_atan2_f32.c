@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_f32.c
+ * Description:  Floating-point vector four-quadrant arc tangent function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Four-Quadrant Arc Tangent
+ *
+ * Computes the angle <code>atan2(y, x)</code> in the range [-pi pi] for each pair of
+ * elements of two vectors, for instance the phase of complex numbers stored in two
+ * separate arrays.
+ * There are separate functions for Q15, Q31, and floating-point data types.
+ *
+ * The smaller of <code>|x|</code> and <code>|y|</code> is divided by the larger one so that
+ * the arc tangent is only needed for a ratio <code>t</code> in [0 1].  The result is moved to
+ * the right quadrant with the signs of <code>x</code> and <code>y</code>.
+ *
+ * The floating-point function computes <code>atan(t)</code> with a degree 9 odd polynomial
+ * after the further reduction <code>atan(t) = pi/4 + atan((t-1)/(t+1))</code> for
+ * <code>t > tan(pi/8)</code>.  The maximum error is 3 ULP.
+ * The signed zeros and infinities are handled as in the C library.
+ *
+ * The fixed-point functions find <code>atan(t)</code> by linear interpolation in a table of
+ * 513 values.  The output is in radians, in 3.29 format for Q31 and in 3.13 format for Q15.
+ * <code>atan2(0, 0)</code> is 0.
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector four-quadrant arc tangent.
+ * @param[in]  pSrcY      points to the vector of y values.
+ * @param[in]  pSrcX      points to the vector of x values.
+ * @param[out] pDst       points to the output vector of angles in radians.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ */
+
+void arm_atan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, y, out;                           /* Temporary variables for inputs, output */
+  float32_t ax, ay, num, den;                    /* Absolute values */
+  float32_t t, z, z2, base;                      /* Reduced argument */
+  uint32_t swap;                                 /* The ratio is |x|/|y| */
+  uint32_t blkCnt;                               /* Loop counter */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } bits;                                        /* Access to the sign bits */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    y = *pSrcY++;
+    x = *pSrcX++;
+
+    if ((x != x) || (y != y))
+    {
+      /* NaN */
+      out = x + y;
+    }
+    else
+    {
+      ax = (x < 0.0f) ? -x : x;
+      ay = (y < 0.0f) ? -y : y;
+
+      /* Divide the smaller absolute value by the larger one */
+      if (ax >= ay)
+      {
+        num = ay;
+        den = ax;
+        swap = 0U;
+      }
+      else
+      {
+        num = ax;
+        den = ay;
+        swap = 1U;
+      }
+
+      if (den == 0.0f)
+      {
+        /* Both values are zero */
+        t = 0.0f;
+      }
+      else if (num > 3.40282347e+38f)
+      {
+        /* Both values are infinite */
+        t = 1.0f;
+      }
+      else
+      {
+        t = num / den;
+      }
+
+      /* atan(t) = pi/4 + atan((t-1)/(t+1)) for t > tan(pi/8) */
+      if (t > 0.414213562373095f)
+      {
+        z = (t - 1.0f) / (t + 1.0f);
+        base = 0.785398163397448f;
+      }
+      else
+      {
+        z = t;
+        base = 0.0f;
+      }
+
+      /* atan(z) = z + z^3 * P(z^2) */
+      z2 = z * z;
+      out = 8.05374449538e-2f;
+      out = out * z2 - 1.38776856032e-1f;
+      out = out * z2 + 1.99777106478e-1f;
+      out = out * z2 - 3.33329491539e-1f;
+      out = out * z2 * z + z;
+      out += base;
+
+      /* Move the angle to the right octant */
+      if (swap != 0U)
+      {
+        out = 1.57079632679490f - out;
+      }
+
+      /* and to the right quadrant */
+      bits.f = x;
+
+      if (bits.i < 0)
+      {
+        out = PI - out;
+      }
+
+      bits.f = y;
+
+      if (bits.i < 0)
+      {
+        out = -out;
+      }
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
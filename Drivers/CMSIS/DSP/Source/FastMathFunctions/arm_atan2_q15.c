@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q15.c
+ * Description:  Q15 vector four-quadrant arc tangent function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Q15 vector four-quadrant arc tangent.
+ * @param[in]  pSrcY      points to the vector of y values.
+ * @param[in]  pSrcX      points to the vector of x values.
+ * @param[out] pDst       points to the output vector of angles in radians in 3.13 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The maximum absolute error is 2^-13.
+ */
+
+void arm_atan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t x, y;                                    /* Temporary variables for inputs */
+  int32_t a, b, out;                             /* Two nearest table values and output */
+  uint32_t ax, ay, num, den;                     /* Absolute values */
+  uint32_t t, index, fract;                      /* Ratio, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    y = *pSrcY++;
+    x = *pSrcX++;
+
+    /* Absolute values, 0x8000 becomes 2^15 */
+    ax = (uint32_t) ((x < 0) ? -(int32_t) x : (int32_t) x);
+    ay = (uint32_t) ((y < 0) ? -(int32_t) y : (int32_t) y);
+
+    /* Divide the smaller absolute value by the larger one */
+    num = (ax >= ay) ? ay : ax;
+    den = (ax >= ay) ? ax : ay;
+
+    if (den == 0U)
+    {
+      out = 0;
+    }
+    else
+    {
+      /* t = num / den in 1.15 format, t = 2^15 for num == den */
+      t = (num << 15) / den;
+
+      if (t >= 0x8000U)
+      {
+        out = (int32_t) atanTable_q15[FAST_MATH_TABLE_SIZE] << 6;
+      }
+      else
+      {
+        /* The 15 bits of t are split in a table index and an interpolation fraction */
+        index = t >> 6;
+        fract = t & 0x3FU;
+
+        /* Read two nearest values of atan(t) from the table */
+        a = atanTable_q15[index];
+        b = atanTable_q15[index + 1];
+
+        /* Linear interpolation process, with the result in 1.21 format */
+        out = (a << 6) + (b - a) * (int32_t) fract;
+      }
+
+      /* Convert the angle in [0 pi/4] to 3.13 format with rounding */
+      out = (out + 0x80) >> 8;
+
+      /* Move the angle to the right octant, pi/2 in 3.13 format */
+      if (ax < ay)
+      {
+        out = 12868 - out;
+      }
+
+      /* and to the right quadrant, pi in 3.13 format */
+      if (x < 0)
+      {
+        out = 25736 - out;
+      }
+
+      if (y < 0)
+      {
+        out = -out;
+      }
+    }
+
+    *pDst++ = (q15_t) out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Q31 vector four-quadrant arc tangent function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Q31 vector four-quadrant arc tangent.
+ * @param[in]  pSrcY      points to the vector of y values.
+ * @param[in]  pSrcX      points to the vector of x values.
+ * @param[out] pDst       points to the output vector of angles in radians in 3.29 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The maximum absolute error is 2^-21.
+ */
+
+void arm_atan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t x, y, out;                               /* Temporary variables for inputs, output */
+  q31_t a, b;                                    /* Two nearest table values */
+  uint32_t ax, ay, num, den;                     /* Absolute values */
+  uint32_t t, index, fract;                      /* Ratio, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    y = *pSrcY++;
+    x = *pSrcX++;
+
+    /* Absolute values, 0x80000000 becomes 2^31 */
+    ax = (x < 0) ? (0U - (uint32_t) x) : (uint32_t) x;
+    ay = (y < 0) ? (0U - (uint32_t) y) : (uint32_t) y;
+
+    /* Divide the smaller absolute value by the larger one */
+    num = (ax >= ay) ? ay : ax;
+    den = (ax >= ay) ? ax : ay;
+
+    if (den == 0U)
+    {
+      out = 0;
+    }
+    else
+    {
+      /* t = num / den in 1.31 format, t = 2^31 for num == den */
+      t = (uint32_t) (((uint64_t) num << 31) / den);
+
+      if (t >= 0x80000000U)
+      {
+        out = atanTable_q31[FAST_MATH_TABLE_SIZE];
+      }
+      else
+      {
+        /* The 31 bits of t are split in a table index and an interpolation fraction */
+        index = t >> 22;
+        fract = t & 0x3FFFFFU;
+
+        /* Read two nearest values of atan(t) from the table */
+        a = atanTable_q31[index];
+        b = atanTable_q31[index + 1];
+
+        /* Linear interpolation process */
+        out = a + (q31_t) (((q63_t) (b - a) * fract) >> 22);
+      }
+
+      /* Convert the angle in [0 pi/4] to 3.29 format */
+      out = out >> 2;
+
+      /* Move the angle to the right octant, pi/2 in 3.29 format */
+      if (ax < ay)
+      {
+        out = 843314857 - out;
+      }
+
+      /* and to the right quadrant, pi in 3.29 format */
+      if (x < 0)
+      {
+        out = 1686629713 - out;
+      }
+
+      if (y < 0)
+      {
+        out = -out;
+      }
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Floating-point vector exponential function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vexp Vector Exponential
+ *
+ * Computes the exponential function <code>exp(x)</code> for each element of a vector.
+ * There are separate functions for Q15, Q31, and floating-point data types.
+ *
+ * The floating-point function reduces the input to
+ * <pre>
+ *     x = n * ln(2) + r,    |r| <= ln(2)/2
+ * </pre>
+ * and computes <code>exp(r)</code> with a degree 6 polynomial.
+ * The result is scaled by <code>2^n</code> by adding <code>n</code> to the exponent.
+ * The maximum error is 1 ULP for results in the normal range.
+ * Inputs larger than 88.72 give +Inf and inputs smaller than -103.97 give 0.
+ *
+ * The fixed-point functions compute <code>2^(-t)</code> with <code>t = -x*log2(e)</code>.
+ * The integer part of <code>t</code> is a right shift and the fractional part is found
+ * by linear interpolation in a table of 513 values, the same size as the tables of the
+ * sine and cosine functions.
+ * Their input is in the format produced by the logarithm functions (6.26 for Q31,
+ * 5.11 for Q15), only non positive inputs are meaningful and positive inputs saturate
+ * to the largest output.
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector exponential.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in, out;                             /* Temporary variables for input, output */
+  float32_t fn, r, z, p;                         /* Reduced argument and polynomial */
+  int32_t n;                                     /* Power of 2 of the result */
+  uint32_t blkCnt;                               /* Loop counter */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;                                       /* Power of 2 built from its exponent bits */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in > 88.7228394f)
+    {
+      /* Overflow, return +Inf */
+      scale.i = 0x7F800000;
+      out = scale.f;
+    }
+    else if (in < -103.972084f)
+    {
+      /* Underflow, below the smallest subnormal number */
+      out = 0.0f;
+    }
+    else if (in != in)
+    {
+      /* NaN */
+      out = in;
+    }
+    else
+    {
+      /* n = round(x / ln(2)) */
+      fn = in * 1.44269504088896341f;
+      n = (int32_t) (fn + ((fn >= 0.0f) ? 0.5f : -0.5f));
+      fn = (float32_t) n;
+
+      /* r = x - n * ln(2), with ln(2) split in two parts so that the product of the first part is exact */
+      r = in - fn * 0.693359375f;
+      r = r - fn * -2.12194440e-4f;
+
+      /* exp(r) = 1 + r + r^2 * P(r) */
+      z = r * r;
+      p = 1.9875691500e-4f;
+      p = p * r + 1.3981999507e-3f;
+      p = p * r + 8.3334519073e-3f;
+      p = p * r + 4.1665795894e-2f;
+      p = p * r + 1.6666665459e-1f;
+      p = p * r + 5.0000001201e-1f;
+      p = p * z + r + 1.0f;
+
+      /* Bring n in the range of the normal exponents */
+      if (n < -126)
+      {
+        /* Multiply by 2^-64 */
+        scale.i = 63 << 23;
+        p = p * scale.f;
+        n += 64;
+      }
+      else if (n > 127)
+      {
+        p = p * 2.0f;
+        n--;
+      }
+
+      /* Multiply by 2^n */
+      scale.i = (n + 127) << 23;
+      out = p * scale.f;
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
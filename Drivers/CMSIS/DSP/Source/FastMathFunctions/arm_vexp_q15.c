@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_q15.c
+ * Description:  Q15 vector exponential function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Q15 vector exponential.
+ * @param[in]  pSrc       points to the input vector in 5.11 format.
+ * @param[out] pDst       points to the output vector in 1.15 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The inputs are in the range [-16 0] and the outputs in the range (0 +1).
+ * Positive inputs saturate to 0x7FFF.
+ * The maximum absolute error is 2^-15.
+ */
+
+void arm_vexp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t in, out;                                 /* Temporary variables for input, output */
+  q15_t a, b;                                    /* Two nearest table values */
+  int32_t t;                                     /* -x * log2(e) in 6.26 format */
+  uint32_t k, index, fract;                      /* Integer part, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in >= 0)
+    {
+      /* exp(x) >= 1 */
+      out = 0x7FFF;
+    }
+    else
+    {
+      /* t = -x * log2(e) in 6.26 format, log2(e) in 1.15 format */
+      t = -(int32_t) in * 47274;
+
+      /* exp(x) = 2^(-t) = 2^(-k) * 2^(-fract) */
+      k = (uint32_t) t >> 26;
+
+      if (k > 15U)
+      {
+        out = 0;
+      }
+      else
+      {
+        /* The 26 fractional bits are split in a table index and a 12 bit interpolation fraction */
+        index = ((uint32_t) t & 0x3FFFFFFU) >> 17;
+        fract = ((uint32_t) t >> 5) & 0xFFFU;
+
+        /* Read two nearest values of 2^(-fract) from the table */
+        a = exp2Table_q15[index];
+        b = exp2Table_q15[index + 1];
+
+        /* Linear interpolation process and multiplication by 2^(-k) with rounding */
+        out = (q15_t) (((a << 12) + (b - a) * (int32_t) fract + (0x800 << k)) >> (12 + k));
+      }
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_q31.c
+ * Description:  Q31 vector exponential function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Q31 vector exponential.
+ * @param[in]  pSrc       points to the input vector in 6.26 format.
+ * @param[out] pDst       points to the output vector in 1.31 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The inputs are in the range [-32 0] and the outputs in the range (0 +1).
+ * Positive inputs saturate to 0x7FFFFFFF.
+ * The maximum absolute error is 2^-22.
+ */
+
+void arm_vexp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in, out;                                 /* Temporary variables for input, output */
+  q31_t a, b;                                    /* Two nearest table values */
+  q63_t t;                                       /* -x * log2(e) with 26 fractional bits */
+  uint32_t k, index, fract;                      /* Integer part, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in >= 0)
+    {
+      /* exp(x) >= 1 */
+      out = 0x7FFFFFFF;
+    }
+    else
+    {
+      /* t = -x * log2(e), log2(e) in 2.30 format */
+      t = (-(q63_t) in * 1549082005) >> 30;
+
+      /* exp(x) = 2^(-t) = 2^(-k) * 2^(-fract) */
+      k = (uint32_t) (t >> 26);
+
+      if (k > 31U)
+      {
+        out = 0;
+      }
+      else
+      {
+        /* The 26 fractional bits are split in a table index and an interpolation fraction */
+        index = ((uint32_t) t & 0x03FFFFFFU) >> 17;
+        fract = (uint32_t) t & 0x1FFFFU;
+
+        /* Read two nearest values of 2^(-fract) from the table */
+        a = exp2Table_q31[index];
+        b = exp2Table_q31[index + 1];
+
+        /* Linear interpolation process */
+        out = a + (q31_t) (((q63_t) (b - a) * fract) >> 17);
+
+        /* Multiply by 2^(-k) */
+        out = out >> k;
+      }
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
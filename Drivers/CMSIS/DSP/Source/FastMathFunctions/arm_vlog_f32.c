@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Floating-point vector natural logarithm function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vlog Vector Natural Logarithm
+ *
+ * Computes the natural logarithm <code>ln(x)</code> for each element of a vector.
+ * There are separate functions for Q15, Q31, and floating-point data types.
+ *
+ * The floating-point function splits the input into its exponent and mantissa
+ * <pre>
+ *     x = 2^e * m,    sqrt(2)/2 <= m < sqrt(2)
+ * </pre>
+ * and computes <code>ln(m)</code> with a degree 9 polynomial in <code>m-1</code>.
+ * The maximum error is 1 ULP.
+ * Zero gives -Inf, negative inputs give NaN and subnormal inputs are handled.
+ *
+ * The fixed-point functions normalize the input with a count of leading zeros and
+ * compute <code>log2</code> of the normalized value by linear interpolation in a table
+ * of 513 values.
+ * The result is converted to a natural logarithm by a multiplication with <code>ln(2)</code>.
+ * The output of the Q31 function is in 6.26 format and the output of the Q15 function
+ * is in 5.11 format.  The output for inputs that are not positive is the most negative
+ * value of the output format.
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector natural logarithm.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in, out;                             /* Temporary variables for input, output */
+  float32_t m, z, p, fe;                         /* Mantissa and polynomial */
+  int32_t e;                                     /* Exponent of the input */
+  uint32_t blkCnt;                               /* Loop counter */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } bits;                                        /* Access to the bits of the input */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if ((in > 0.0f) && (in <= 3.40282347e+38f))
+    {
+      bits.f = in;
+      e = -126;
+
+      if (bits.i < 0x00800000)
+      {
+        /* Subnormal input, multiply by 2^25 */
+        bits.f = in * 33554432.0f;
+        e -= 25;
+      }
+
+      /* Split the input in exponent and mantissa in [0.5 1) */
+      e += bits.i >> 23;
+      bits.i = (bits.i & 0x007FFFFF) | 0x3F000000;
+      m = bits.f;
+
+      /* Bring the mantissa in [sqrt(2)/2 sqrt(2)) and subtract 1 */
+      if (m < 0.707106781186547524f)
+      {
+        e--;
+        m = m + m - 1.0f;
+      }
+      else
+      {
+        m = m - 1.0f;
+      }
+
+      /* ln(1+m) = m - m^2/2 + m^3 * P(m) */
+      z = m * m;
+      p = 7.0376836292e-2f;
+      p = p * m - 1.1514610310e-1f;
+      p = p * m + 1.1676998740e-1f;
+      p = p * m - 1.2420140846e-1f;
+      p = p * m + 1.4249322787e-1f;
+      p = p * m - 1.6668057665e-1f;
+      p = p * m + 2.0000714765e-1f;
+      p = p * m - 2.4999993993e-1f;
+      p = p * m + 3.3333331174e-1f;
+      p = p * m * z;
+
+      /* Add e * ln(2), with ln(2) split in two parts so that the product of the first part is exact */
+      fe = (float32_t) e;
+      p += fe * -2.12194440e-4f;
+      p += -0.5f * z;
+      out = m + p;
+      out += fe * 0.693359375f;
+    }
+    else if (in == 0.0f)
+    {
+      /* -Inf */
+      bits.i = (int32_t) 0xFF800000;
+      out = bits.f;
+    }
+    else if (in < 0.0f)
+    {
+      /* NaN */
+      bits.i = 0x7FC00000;
+      out = bits.f;
+    }
+    else
+    {
+      /* +Inf and NaN */
+      out = in;
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
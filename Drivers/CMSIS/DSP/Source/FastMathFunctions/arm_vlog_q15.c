@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_q15.c
+ * Description:  Q15 vector natural logarithm function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Q15 vector natural logarithm.
+ * @param[in]  pSrc       points to the input vector in 1.15 format.
+ * @param[out] pDst       points to the output vector in 5.11 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The inputs are in the range (0 +1) and the outputs in the range [-10.4 0).
+ * The output for inputs that are not positive is 0x8000.
+ * The maximum absolute error is 2^-11.
+ */
+
+void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t in, out;                                 /* Temporary variables for input, output */
+  q15_t a, b;                                    /* Two nearest table values */
+  int32_t l;                                     /* log2 of the input in 12.20 format */
+  uint32_t m, n, index, fract;                   /* Normalized input, shift, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in <= 0)
+    {
+      /* -Inf */
+      out = (q15_t) 0x8000;
+    }
+    else
+    {
+      /* x = m * 2^(-n) with m in [0.5 1) */
+      n = __CLZ((uint32_t) in) - 17U;
+      m = ((uint32_t) in << n) - 0x4000U;
+
+      /* The 14 bits of m - 0.5 are split in a table index and an interpolation fraction */
+      index = m >> 5;
+      fract = m & 0x1FU;
+
+      /* Read two nearest values of log2(m) from the table */
+      a = log2Table_q15[index];
+      b = log2Table_q15[index + 1];
+
+      /* Linear interpolation process, log2(x) = log2(m) - n in 12.20 format */
+      l = (a << 5) + (b - a) * (int32_t) fract;
+      l = l - (int32_t) (n << 20);
+
+      /* ln(x) = log2(x) * ln(2), ln(2) in 1.15 format, rounded to 5.11 format */
+      out = (q15_t) ((((q63_t) l * 22713) + 0x800000) >> 24);
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
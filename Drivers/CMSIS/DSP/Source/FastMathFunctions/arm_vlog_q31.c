@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_q31.c
+ * Description:  Q31 vector natural logarithm function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Q31 vector natural logarithm.
+ * @param[in]  pSrc       points to the input vector in 1.31 format.
+ * @param[out] pDst       points to the output vector in 6.26 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The inputs are in the range (0 +1) and the outputs in the range [-21.5 0).
+ * The output for inputs that are not positive is 0x80000000.
+ * The maximum absolute error is 2^-20.
+ */
+
+void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in, out;                                 /* Temporary variables for input, output */
+  q31_t a, b;                                    /* Two nearest table values */
+  q31_t l;                                       /* log2 of the normalized input */
+  uint32_t m, n, index, fract;                   /* Normalized input, shift, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in <= 0)
+    {
+      /* -Inf */
+      out = (q31_t) 0x80000000;
+    }
+    else
+    {
+      /* x = m * 2^(-n) with m in [0.5 1) */
+      n = __CLZ(in) - 1U;
+      m = ((uint32_t) in << n) - 0x40000000U;
+
+      /* The 30 bits of m - 0.5 are split in a table index and an interpolation fraction */
+      index = m >> 21;
+      fract = m & 0x1FFFFFU;
+
+      /* Read two nearest values of log2(m) from the table */
+      a = log2Table_q31[index];
+      b = log2Table_q31[index + 1];
+
+      /* Linear interpolation process */
+      l = a + (q31_t) (((q63_t) (b - a) * fract) >> 21);
+
+      /* log2(x) = log2(m) - n in 6.26 format */
+      out = (l >> 5) - (q31_t) (n << 26);
+
+      /* ln(x) = log2(x) * ln(2), ln(2) in 1.31 format */
+      out = (q31_t) (((q63_t) out * 1488522236) >> 31);
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
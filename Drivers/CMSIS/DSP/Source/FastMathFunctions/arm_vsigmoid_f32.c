@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsigmoid_f32.c
+ * Description:  Floating-point vector sigmoid function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vsigmoid Vector Sigmoid
+ *
+ * Computes the logistic sigmoid <code>1 / (1 + exp(-x))</code> for each element of a vector.
+ * There are separate functions for Q15, Q31, and floating-point data types.
+ *
+ * The floating-point function computes the exponentials with <code>arm_vexp_f32()</code>
+ * and its maximum error is 3 ULP.
+ *
+ * The fixed-point functions use
+ * <pre>
+ *     sigmoid(x) = 1/2 + tanh(x/2) / 2
+ * </pre>
+ * and share the table of the hyperbolic tangent functions.  They take inputs in 4.28 (Q31)
+ * or 4.12 (Q15) format, like <code>arm_vtanh_q31()</code> and <code>arm_vtanh_q15()</code>,
+ * and produce Q31 or Q15 outputs.
+ */
+
+/**
+ * @addtogroup vsigmoid
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector sigmoid.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ */
+
+void arm_vsigmoid_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pOut = pDst;                        /* Output pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* exp(-x) */
+  arm_negate_f32(pSrc, pDst, blockSize);
+  arm_vexp_f32(pDst, pDst, blockSize);
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* 1 / (1 + exp(-x)) */
+    *pOut = 1.0f / (1.0f + *pOut);
+    pOut++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vsigmoid group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsigmoid_q15.c
+ * Description:  Q15 vector sigmoid function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vsigmoid
+ * @{
+ */
+
+/**
+ * @brief  Q15 vector sigmoid.
+ * @param[in]  pSrc       points to the input vector in 4.12 format.
+ * @param[out] pDst       points to the output vector in 1.15 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ * The maximum absolute error is 2^-13.
+ */
+
+void arm_vsigmoid_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pOut = pDst;                            /* Output pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* x/2 */
+  arm_shift_q15(pSrc, -1, pDst, blockSize);
+
+  /* tanh(x/2) */
+  arm_vtanh_q15(pDst, pDst, blockSize);
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* 1/2 + tanh(x/2) / 2 */
+    *pOut = (*pOut >> 1) + 0x4000;
+    pOut++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vsigmoid group
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_f32.c
+ * Description:  Floating-point vector hyperbolic tangent function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vtanh Vector Hyperbolic Tangent
+ *
+ * Computes the hyperbolic tangent <code>tanh(x)</code> for each element of a vector.
+ * There are separate functions for Q15, Q31, and floating-point data types.
+ *
+ * For <code>|x| < 0.625</code> the floating-point function uses an odd polynomial of
+ * degree 11.  For larger inputs it uses
+ * <pre>
+ *     tanh(|x|) = 1 - 2 / (exp(2*|x|) + 1)
+ * </pre>
+ * with the exponential computed by <code>arm_vexp_f32()</code>.  The maximum error is 2 ULP.
+ *
+ * The fixed-point functions take inputs in 4.28 (Q31) or 4.12 (Q15) format, that is
+ * in the range [-8 8), and produce Q31 or Q15 outputs.
+ * The Q15 function uses linear interpolation in a table of 513 values of
+ * <code>tanh</code> over [0 8].  The Q31 function uses cubic Hermite interpolation in
+ * the same table, the derivatives being computed from the table values as
+ * <code>1 - tanh^2</code>.
+ */
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector hyperbolic tangent.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ * The exponentials are computed in chunks of 32 samples in a buffer on the stack.
+ */
+
+void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t expBuf[32];                          /* Exponentials of a chunk of samples */
+  float32_t in, out, a, z;                       /* Temporary variables */
+  uint32_t chunk, i;                             /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    chunk = (blockSize < 32U) ? blockSize : 32U;
+
+    /* exp(2*|x|), tanh(9) rounds to 1 */
+    for (i = 0U; i < chunk; i++)
+    {
+      a = (pSrc[i] < 0.0f) ? -pSrc[i] : pSrc[i];
+      expBuf[i] = (a < 9.0f) ? (a + a) : 18.0f;
+    }
+
+    arm_vexp_f32(expBuf, expBuf, chunk);
+
+    for (i = 0U; i < chunk; i++)
+    {
+      in = pSrc[i];
+      a = (in < 0.0f) ? -in : in;
+
+      if (a < 0.625f)
+      {
+        /* tanh(x) = x + x^3 * P(x^2) */
+        z = in * in;
+        out = -5.70498872745e-3f;
+        out = out * z + 2.06390887954e-2f;
+        out = out * z - 5.37397155531e-2f;
+        out = out * z + 1.33314422036e-1f;
+        out = out * z - 3.33332819422e-1f;
+        out = out * z * in + in;
+      }
+      else if (in != in)
+      {
+        /* NaN */
+        out = in;
+      }
+      else
+      {
+        out = 1.0f - 2.0f / (expBuf[i] + 1.0f);
+        out = (in < 0.0f) ? -out : out;
+      }
+
+      pDst[i] = out;
+    }
+
+    pSrc += chunk;
+    pDst += chunk;
+    blockSize -= chunk;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_q15.c
+ * Description:  Q15 vector hyperbolic tangent function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief  Q15 vector hyperbolic tangent.
+ * @param[in]  pSrc       points to the input vector in 4.12 format.
+ * @param[out] pDst       points to the output vector in 1.15 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ * The maximum absolute error is 2^-14.
+ */
+
+void arm_vtanh_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t in;                                      /* Temporary variable for input */
+  int32_t a, b, out;                             /* Two nearest table values and output */
+  uint32_t ax, index, fract;                     /* Absolute value, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Absolute value, 0x8000 becomes 2^15 */
+    ax = (uint32_t) ((in < 0) ? -(int32_t) in : (int32_t) in);
+
+    if (ax >= 0x8000U)
+    {
+      out = arm_tanhTable_q15[FAST_MATH_TABLE_SIZE];
+    }
+    else
+    {
+      /* The 15 bits of |x| are split in a table index and an interpolation fraction */
+      index = ax >> 6;
+      fract = ax & 0x3FU;
+
+      /* Read two nearest values of tanh from the table */
+      a = arm_tanhTable_q15[index];
+      b = arm_tanhTable_q15[index + 1];
+
+      /* Linear interpolation process */
+      out = a + (((b - a) * (int32_t) fract + 0x20) >> 6);
+    }
+
+    /* tanh is odd */
+    *pDst++ = (q15_t) ((in < 0) ? -out : out);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
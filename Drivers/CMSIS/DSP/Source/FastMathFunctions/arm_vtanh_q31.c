@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_q31.c
+ * Description:  Q31 vector hyperbolic tangent function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief  Q31 vector hyperbolic tangent.
+ * @param[in]  pSrc       points to the input vector in 4.28 format.
+ * @param[out] pDst       points to the output vector in 1.31 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return     none.
+ *
+ * The function can be used in place (<code>pSrc == pDst</code>).
+ * The maximum absolute error is 2^-29.
+ */
+
+void arm_vtanh_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* Temporary variable for input */
+  q31_t a, b;                                    /* Two nearest table values */
+  q31_t d0, d1, c2, c3;                          /* Coefficients of the cubic */
+  q63_t out;                                     /* Interpolated value */
+  uint32_t ax, index, t;                         /* Absolute value, table index and fraction */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Absolute value, 0x80000000 becomes 2^31 */
+    ax = (in < 0) ? (0U - (uint32_t) in) : (uint32_t) in;
+
+    if (ax >= 0x80000000U)
+    {
+      out = arm_tanhTable_q31[FAST_MATH_TABLE_SIZE];
+    }
+    else
+    {
+      /* The 31 bits of |x| are split in a table index and an interpolation fraction */
+      index = ax >> 22;
+      t = (ax & 0x3FFFFFU) << 9;
+
+      /* Read two nearest values of tanh from the table */
+      a = arm_tanhTable_q31[index];
+      b = arm_tanhTable_q31[index + 1];
+
+      /* Derivatives 1 - tanh^2 at both ends, scaled by the table step 1/64 */
+      d0 = (q31_t) ((0x7FFFFFFF - (q31_t) (((q63_t) a * a) >> 31)) >> 6);
+      d1 = (q31_t) ((0x7FFFFFFF - (q31_t) (((q63_t) b * b) >> 31)) >> 6);
+
+      /* Cubic Hermite interpolation process:
+       * p(t) = a + d0 * t + c2 * t^2 + c3 * t^3 */
+      c2 = 3 * (b - a) - 2 * d0 - d1;
+      c3 = 2 * (a - b) + d0 + d1;
+
+      out = c2 + (((q63_t) c3 * t) >> 31);
+      out = d0 + ((out * t) >> 31);
+      out = a + ((out * t) >> 31);
+    }
+
+    /* tanh is odd */
+    out = (in < 0) ? -out : out;
+
+    *pDst++ = clip_q63_to_q31(out);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df1_f16.c
+ * Description:  Processing function for the half-precision Biquad cascade DirectFormI(DF1) filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @param[in]  *S         points to an instance of the half-precision Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process per call.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The coefficients are kept in single precision, since poles close to the unit circle
+ * cannot be placed accurately with an 11-bit mantissa.  Input, output and state are
+ * stored in half precision and the recursion runs in single precision within a block,
+ * so the state is rounded to half precision once per block and the output of each
+ * stage once per sample.  Signals must stay within the half-precision range at the
+ * output of every stage.
+ */
+
+void arm_biquad_cascade_df1_f16(
+  const arm_biquad_casd_df1_inst_f16 * S,
+  float16_t * pSrc,
+  float16_t * pDst,
+  uint32_t blockSize)
+{
+  float16_t *pIn = pSrc;                         /*  source pointer            */
+  float16_t *pOut = pDst;                        /*  destination pointer       */
+  float16_t *pState = S->pState;                 /*  pState pointer            */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t acc;                                 /*  Simulates the accumulator */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn1, Xn2, Yn1, Yn2;                  /*  Filter pState variables   */
+  float32_t Xn;                                  /*  temporary input           */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the pState values */
+    Xn1 = convert_f16_to_f32(pState[0]);
+    Xn2 = convert_f16_to_f32(pState[1]);
+    Yn1 = convert_f16_to_f32(pState[2]);
+    Yn2 = convert_f16_to_f32(pState[3]);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Apply loop unrolling and compute 2 output values at a time,
+     ** swapping the roles of the state variables instead of moving them. */
+    sample = blockSize >> 1U;
+
+    while (sample > 0U)
+    {
+      /* Read the first input */
+      Xn = convert_f16_to_f32(*pIn++);
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      Yn2 = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+
+      /* Store the result in the destination buffer. */
+      *pOut++ = convert_f32_to_f16(Yn2);
+
+      /* Read the second input into Xn2, which now holds x[n] */
+      Xn2 = convert_f16_to_f32(*pIn++);
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      Yn1 = (b0 * Xn2) + (b1 * Xn) + (b2 * Xn1) + (a1 * Yn2) + (a2 * Yn1);
+
+      /* Store the result in the destination buffer. */
+      *pOut++ = convert_f32_to_f16(Yn1);
+
+      /* Restore the state ordering: x[n-1] in Xn1, x[n-2] in Xn2 */
+      Xn1 = Xn2;
+      Xn2 = Xn;
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /* If the blockSize is odd, compute the remaining output sample here. */
+    sample = blockSize & 0x1U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize sample with blockSize */
+    sample = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = convert_f16_to_f32(*pIn++);
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+
+      /* Store the result in the destination buffer. */
+      *pOut++ = convert_f32_to_f16(acc);
+
+      /* Every time after the output is computed state should be updated. */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = acc;
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /*  Store the updated state variables back into the pState array */
+    *pState++ = convert_f32_to_f16(Xn1);
+    *pState++ = convert_f32_to_f16(Xn2);
+    *pState++ = convert_f32_to_f16(Yn1);
+    *pState++ = convert_f32_to_f16(Yn2);
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent numStages  occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Reset the output pointer */
+    pOut = pDst;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
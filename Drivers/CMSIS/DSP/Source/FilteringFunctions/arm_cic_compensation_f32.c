@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_compensation_f32.c
+ * Description:  CIC droop compensation filter design
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Designs a FIR filter that compensates the passband droop of a CIC decimator.
+ * @param[in]  order      number of stages of the CIC decimator.
+ * @param[in]  R          decimation factor of the CIC decimator.
+ * @param[in]  passFreq   passband edge, normalized to the CIC output rate.
+ * @param[in]  stopFreq   stopband edge, normalized to the CIC output rate.
+ * @param[out] pCoeffs    points to the designed filter coefficients.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @return     The function returns ARM_MATH_SUCCESS if the design is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code>, <code>order</code> or <code>R</code> is zero
+ * or the band edges do not satisfy <code>0 < passFreq < stopFreq <= 0.5</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * The filter runs at the output rate of the CIC decimator.  Its desired response is the
+ * inverse of the CIC response up to <code>passFreq</code>, falls to zero at
+ * <code>stopFreq</code> along a raised cosine and is zero above.  The impulse response
+ * is obtained by integrating the desired response on a grid of <code>16*numTaps</code>
+ * frequencies and applying a Hamming window.  The coefficients are symmetric and scaled to a DC gain
+ * of one, so they can be used in either order.
+ * \par
+ * The filter usually also performs the last decimation stage.  Setting
+ * <code>stopFreq</code> to <code>0.5/M</code> or slightly above lets it be used with
+ * <code>arm_fir_decimate_q31()</code> and a decimation factor <code>M</code>, after
+ * conversion with <code>arm_float_to_q31()</code>.
+ * \par
+ * When <code>R</code> is not a power of two the CIC gain is slightly below one, see the
+ * description of the @ref CIC group; scale the coefficients by
+ * <code>2^shift / R^order</code> to correct it.
+ * \par
+ * This function is meant to be called once at initialization time.
+ */
+
+arm_status arm_cic_compensation_f32(
+  uint8_t order,
+  uint16_t R,
+  float32_t passFreq,
+  float32_t stopFreq,
+  float32_t * pCoeffs,
+  uint16_t numTaps)
+{
+  float32_t center = 0.5f * (float32_t) (numTaps - 1U); /* Center of the impulse response */
+  float32_t df, f, fc, d, t, sum, mag;           /* Temporary variables */
+  uint32_t gridLen = 16U * (uint32_t) numTaps;   /* Number of grid intervals */
+  uint32_t n, k, i;                              /* Loop counters */
+  arm_status status;
+
+  if ((numTaps == 0U) || (order == 0U) || (R == 0U) ||
+      (passFreq <= 0.0f) || (stopFreq <= passFreq) || (stopFreq > 0.5f))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    df = 0.5f / (float32_t) gridLen;
+
+    /* Only the first half of the symmetric impulse response is computed */
+    for (n = 0U; n < (((uint32_t) numTaps + 1U) >> 1U); n++)
+    {
+      t = (float32_t) n - center;
+      sum = 0.0f;
+
+      /* Trapezoidal integration of d(f) cos(2 pi f t) up to the stopband edge */
+      for (k = 0U; k <= gridLen; k++)
+      {
+        f = (float32_t) k * df;
+
+        if (f >= stopFreq)
+        {
+          break;
+        }
+
+        /* Inverse of the CIC magnitude response |sin(pi f) / (R sin(pi f / R))|^order,
+         ** held at its passband edge value across the transition band */
+        d = 1.0f;
+
+        if (k > 0U)
+        {
+          fc = (f < passFreq) ? f : passFreq;
+          mag = ((float32_t) R * arm_sin_f32(PI * fc / (float32_t) R)) / arm_sin_f32(PI * fc);
+
+          for (i = 0U; i < order; i++)
+          {
+            d *= mag;
+          }
+        }
+
+        /* Raised cosine transition between the band edges */
+        if (f > passFreq)
+        {
+          d *= 0.5f + 0.5f * arm_cos_f32(PI * (f - passFreq) / (stopFreq - passFreq));
+        }
+
+        d *= arm_cos_f32(2.0f * PI * f * t);
+        sum += (k == 0U) ? (0.5f * d) : d;
+      }
+
+      /* Apply the Hamming window */
+      if (numTaps > 1U)
+      {
+        sum *= 0.54f - 0.46f * arm_cos_f32(2.0f * PI * (float32_t) n / (float32_t) (numTaps - 1U));
+      }
+
+      pCoeffs[n] = sum;
+      pCoeffs[numTaps - 1U - n] = sum;
+    }
+
+    /* Scale to unit DC gain */
+    sum = 0.0f;
+
+    for (n = 0U; n < numTaps; n++)
+    {
+      sum += pCoeffs[n];
+    }
+
+    arm_scale_f32(pCoeffs, 1.0f / sum, pCoeffs, numTaps);
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CIC group
+ */
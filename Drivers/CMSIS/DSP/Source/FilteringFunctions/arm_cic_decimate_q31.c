@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_decimate_q31.c
+ * Description:  Q31 CIC decimator
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CIC Cascaded Integrator-Comb Filters
+ *
+ * Cascaded integrator-comb (CIC) filters perform high ratio sample rate changes
+ * without any multiplication.  They are the usual first stage behind PDM microphones
+ * and sigma-delta converters, where the input rate is in the MHz range and a FIR
+ * decimator such as <code>arm_fir_decimate_q31()</code> would have to evaluate a
+ * filter several times the decimation factor long.
+ *
+ * A CIC decimator of order <code>N</code> and rate change factor <code>R</code> is
+ * <code>N</code> integrators running at the input rate, followed by a downsampler
+ * and <code>N</code> comb stages running at the output rate:
+ * <pre>
+ *    integrator: i[n] = i[n-1] + x[n]
+ *    comb:       c[m] = y[m] - y[m-1]
+ * </pre>
+ * The cascade is equivalent to <code>N</code> moving average filters of length
+ * <code>R</code> and has the transfer function
+ * <pre>
+ *    H(z) = ((1 - z^(-R)) / (1 - z^(-1)))^N
+ * </pre>
+ * The interpolator is the transpose: the comb stages run at the input rate, the
+ * signal is upsampled by zero insertion and the integrators run at the output rate.
+ *
+ * \par Wrap-around arithmetic
+ * The integrators have no feedback path that could be stabilized by saturation.
+ * Instead, all stages are kept in 64-bit two's complement registers that are
+ * allowed to wrap around.  The overflows of the integrators are cancelled by the
+ * comb stages, so the result is exact as long as the final output fits in the
+ * register.  This holds when the filter gain <code>R^N</code> is at most
+ * <code>2^32</code>, which is checked by the initialization functions.
+ *
+ * \par Gain
+ * The DC gain of the decimator is <code>R^N</code> and that of the interpolator is
+ * <code>R^(N-1)</code>.  The output is scaled by a right shift of
+ * <code>ceil(log2(gain))</code>, so the overall gain is exactly one when
+ * <code>R</code> is a power of two and slightly below one otherwise.
+ *
+ * \par Compensation
+ * The response of a CIC filter droops by <code>sinc^N</code> across the passband.
+ * The droop is usually corrected by a short FIR filter running at the CIC output
+ * rate, which also performs the final decimation by a small factor.
+ * <code>arm_cic_compensation_f32()</code> designs such a filter; after conversion to
+ * Q31 with <code>arm_float_to_q31()</code> it is used with the regular
+ * <code>arm_fir_decimate_q31()</code> functions.
+ * <code>arm_pdm_to_pcm_q31()</code> bundles the CIC decimator and the compensation
+ * FIR decimator for 1-bit PDM input.
+ *
+ * \par Instance Structure
+ * The state and parameters of each filter are stored in an instance structure.
+ * A separate instance structure must be defined for each filter.
+ * The state array holds <code>2*N</code> 64-bit values: the integrators followed by
+ * the comb delays.
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 CIC decimator.
+ * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>blockSize</code> does not need to be a multiple of the decimation factor;
+ * the position within the current output period is kept in the instance and the
+ * function returns the number of output samples that were completed.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The integrators and combs use 64-bit registers that wrap around, see the
+ * description of the @ref CIC group.  The comb output is shifted right by
+ * <code>S->shift</code> bits and truncated to 1.31 format; no saturation is needed.
+ */
+
+uint32_t arm_cic_decimate_q31(
+  arm_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t *pInteg = S->pState;                     /* Points to the integrator states */
+  q63_t *pComb = S->pState + S->order;           /* Points to the comb delay states */
+  q63_t *pI, *pC;                                /* Temporary pointers to the stage states */
+  q63_t x, prev;                                 /* Stage input and delayed comb input */
+  uint32_t R = S->R;                             /* Decimation factor */
+  uint32_t phase = S->phase;                     /* Input samples integrated since the last output */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t sampCnt, stageCnt;                    /* Loop counters */
+  uint32_t order = S->order;                     /* Number of integrator and comb stages */
+  uint32_t shift = S->shift;                     /* Output normalization shift */
+
+  while (blockSize > 0U)
+  {
+    /* Number of input samples until the next output, limited to the block */
+    sampCnt = R - phase;
+    if (sampCnt > blockSize)
+    {
+      sampCnt = blockSize;
+    }
+
+    blockSize -= sampCnt;
+    phase += sampCnt;
+
+    /* Integrator section, running at the input rate */
+    while (sampCnt > 0U)
+    {
+      x = (q63_t) *pSrc++;
+
+      pI = pInteg;
+      stageCnt = order;
+
+      while (stageCnt > 0U)
+      {
+        /* i[n] = i[n-1] + x[n], wrapping around modulo 2^64 */
+        x = (q63_t) ((uint64_t) *pI + (uint64_t) x);
+        *pI++ = x;
+
+        /* Decrement the loop counter */
+        stageCnt--;
+      }
+
+      /* Decrement the loop counter */
+      sampCnt--;
+    }
+
+    if (phase == R)
+    {
+      phase = 0U;
+
+      /* Comb section, running at the output rate, on the output of the last integrator */
+      x = pInteg[order - 1U];
+      pC = pComb;
+      stageCnt = order;
+
+      while (stageCnt > 0U)
+      {
+        /* c[m] = y[m] - y[m-1] */
+        prev = *pC;
+        *pC++ = x;
+        x = (q63_t) ((uint64_t) x - (uint64_t) prev);
+
+        /* Decrement the loop counter */
+        stageCnt--;
+      }
+
+      /* Remove the filter gain and store the result in the destination buffer */
+      *pDst++ = (q31_t) (x >> shift);
+      outCnt++;
+    }
+  }
+
+  /* Save the position within the output period for the next call */
+  S->phase = phase;
+
+  return (outCnt);
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_interpolate_init_q31.c
+ * Description:  Q31 CIC interpolator initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CIC interpolator.
+ * @param[in,out] S          points to an instance of the Q31 CIC interpolator structure.
+ * @param[in]     order      number of comb and integrator stages.
+ * @param[in]     R          interpolation factor.
+ * @param[in]     pState     points to the state buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>order</code> or <code>R</code> is zero or the filter gain
+ * <code>R^(order-1)</code> exceeds <code>2^32</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*order</code> 64-bit words.
+ */
+
+arm_status arm_cic_interpolate_init_q31(
+  arm_cic_interpolate_instance_q31 * S,
+  uint8_t order,
+  uint16_t R,
+  q63_t * pState)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint64_t gain = 1U;
+  uint32_t shift = 0U;
+  uint32_t i;
+
+  if ((order == 0U) || (R == 0U))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Zero insertion divides the gain by R, leaving R^(order-1) */
+    for (i = 1U; (i < order) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      gain *= R;
+
+      if (gain > ((uint64_t) 1U << 32))
+      {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+      }
+    }
+
+    /* Smallest shift that removes the gain */
+    while (((uint64_t) 1U << shift) < gain)
+    {
+      shift++;
+    }
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* Assign filter order and interpolation factor */
+    S->order = order;
+    S->R = R;
+
+    /* Assign the output normalization shift */
+    S->shift = (uint8_t) shift;
+
+    /* Clear the comb and integrator states */
+    memset(pState, 0, 2U * (uint32_t) order * sizeof(q63_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_interpolate_q31.c
+ * Description:  Q31 CIC interpolator
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 CIC interpolator.
+ * @param[in]  S          points to an instance of the Q31 CIC interpolator structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data.
+ * @param[in]  blockSize  number of input samples to process per call.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pDst</code> receives <code>blockSize*R</code> output samples.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The combs and integrators use 64-bit registers that wrap around, see the
+ * description of the @ref CIC group.  The integrator output is shifted right by
+ * <code>S->shift</code> bits and truncated to 1.31 format; no saturation is needed.
+ */
+
+void arm_cic_interpolate_q31(
+  const arm_cic_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t *pComb = S->pState;                      /* Points to the comb delay states */
+  q63_t *pInteg = S->pState + S->order;          /* Points to the integrator states */
+  q63_t *pI, *pC;                                /* Temporary pointers to the stage states */
+  q63_t x, y, prev;                              /* Stage inputs and delayed comb input */
+  uint32_t R = S->R;                             /* Interpolation factor */
+  uint32_t order = S->order;                     /* Number of integrator and comb stages */
+  uint32_t shift = S->shift;                     /* Output normalization shift */
+  uint32_t blkCnt, sampCnt, stageCnt;            /* Loop counters */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Comb section, running at the input rate */
+    x = (q63_t) *pSrc++;
+
+    pC = pComb;
+    stageCnt = order;
+
+    while (stageCnt > 0U)
+    {
+      /* c[m] = x[m] - x[m-1] */
+      prev = *pC;
+      *pC++ = x;
+      x = (q63_t) ((uint64_t) x - (uint64_t) prev);
+
+      /* Decrement the loop counter */
+      stageCnt--;
+    }
+
+    /* Integrator section, running at the output rate.
+     ** The comb output is followed by R-1 inserted zeros. */
+    sampCnt = R;
+
+    while (sampCnt > 0U)
+    {
+      y = x;
+      x = 0;
+
+      pI = pInteg;
+      stageCnt = order;
+
+      while (stageCnt > 0U)
+      {
+        /* i[n] = i[n-1] + y[n], wrapping around modulo 2^64 */
+        y = (q63_t) ((uint64_t) *pI + (uint64_t) y);
+        *pI++ = y;
+
+        /* Decrement the loop counter */
+        stageCnt--;
+      }
+
+      /* Remove the filter gain and store the result in the destination buffer */
+      *pDst++ = (q31_t) (y >> shift);
+
+      /* Decrement the loop counter */
+      sampCnt--;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CIC group
+ */
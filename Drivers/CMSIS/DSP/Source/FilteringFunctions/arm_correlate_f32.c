@@ -85,6 +85,13 @@
  * \par
  * Opt versions are supported for Q15 and Q7.  Design uses internal scratch buffer for getting good optimisation.
  * These versions are optimised in cycles and consumes more memory(Scratch memory) compared to Q15 and Q7 versions of correlate
+ *
+ * <b>Lag Range</b>
+ *
+ * \par
+ * arm_correlate_lag_f32() computes only the lags between <code>minLag</code> and <code>maxLag</code>,
+ * for example the few lags around zero needed for a delay estimate.
+ * See also the @ref GCC functions, which compute them with FFTs.
  */
 
 /**
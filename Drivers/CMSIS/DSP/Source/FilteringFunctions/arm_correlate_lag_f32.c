@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_lag_f32.c
+ * Description:  Floating-point correlation over a range of lags
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Correlation of floating-point sequences over a range of lags.
+ * @param[in]  *pSrcA  points to the first input sequence.
+ * @param[in]  srcALen length of the first input sequence.
+ * @param[in]  *pSrcB  points to the second input sequence.
+ * @param[in]  srcBLen length of the second input sequence.
+ * @param[in]  minLag  first lag to compute, may be negative.
+ * @param[in]  maxLag  last lag to compute, not less than <code>minLag</code>.
+ * @param[out] *pDst   points to the location where the output result is written.  Length <code>maxLag - minLag + 1</code>.
+ * @return none.
+ *
+ * \par
+ * Computes only the requested lags of the cross-correlation
+ * <pre>
+ *     pDst[k - minLag] = sum(n) pSrcA[n + k] * pSrcB[n],    k = minLag, ..., maxLag
+ * </pre>
+ * where the sum runs over the samples for which both sequences are defined.
+ * A positive lag is a delay of <code>pSrcA</code> relative to <code>pSrcB</code>.
+ * Lags without overlap are set to zero.
+ * When <code>srcALen >= srcBLen</code>, the lag <code>k</code> is element
+ * <code>srcBLen - 1 + k</code> of the output of arm_correlate_f32().
+ * \par
+ * The cost is one dot product per lag, that is about
+ * <code>(maxLag - minLag + 1) * min(srcALen, srcBLen)</code> multiply-accumulates,
+ * instead of <code>srcALen * srcBLen</code> for the full correlation.
+ * When more than a few hundred lags of long sequences are needed, the
+ * FFT-based arm_gcc_phat_f32() is faster.
+ */
+
+void arm_correlate_lag_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t minLag,
+  int32_t maxLag,
+  float32_t * pDst)
+{
+  int32_t lag;                                   /* Current lag */
+  int32_t start, stop;                           /* Overlap of the sequences, as indices of pSrcB */
+
+  for (lag = minLag; lag <= maxLag; lag++)
+  {
+    /* pSrcA[n + lag] and pSrcB[n] are both defined for start <= n < stop */
+    start = (lag < 0) ? -lag : 0;
+    stop = (int32_t) srcALen - lag;
+    stop = (stop < (int32_t) srcBLen) ? stop : (int32_t) srcBLen;
+
+    if (stop > start)
+    {
+      arm_dot_prod_f32(pSrcA + (start + lag), pSrcB + start, (uint32_t) (stop - start), pDst);
+    }
+    else
+    {
+      *pDst = 0.0f;
+    }
+
+    pDst++;
+  }
+}
+
+/**
+ * @} end of Corr group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_peak_f32.c
+ * Description:  Sub-sample peak of a floating-point correlation
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup GCC
+ * @{
+ */
+
+/**
+ * @brief  Finds the peak of a correlation with sub-sample resolution.
+ * @param[in]  pSrc     points to the correlation values.
+ * @param[in]  numLags  number of correlation values.
+ * @param[in]  minLag   lag of the first correlation value.
+ * @param[out] pLag     lag of the peak, a fraction of a sample.
+ * @param[out] pValue   interpolated value at the peak.
+ * @return     none.
+ *
+ * \par
+ * The largest value is located with arm_max_f32() and a parabola is fitted through it and
+ * its two neighbours.  The vertex of the parabola gives the fractional lag
+ * <pre>
+ *     d = 0.5 * (r[m-1] - r[m+1]) / (r[m-1] - 2*r[m] + r[m+1])
+ * </pre>
+ * between -0.5 and 0.5 samples.  When the maximum is the first or the last value, or the
+ * three values are not concave, the lag of the maximum is returned as is.
+ * \par
+ * The function can be used on the output of arm_gcc_phat_f32() with
+ * <code>minLag = -maxLag</code>, or on the output of arm_correlate_lag_f32().
+ */
+
+void arm_correlate_peak_f32(
+  float32_t * pSrc,
+  uint32_t numLags,
+  int32_t minLag,
+  float32_t * pLag,
+  float32_t * pValue)
+{
+  float32_t peak, prev, next;                    /* Maximum and its neighbours */
+  float32_t curv, frac;                          /* Curvature and fractional lag of the parabola */
+  uint32_t index;                                /* Index of the maximum */
+
+  arm_max_f32(pSrc, numLags, &peak, &index);
+
+  frac = 0.0f;
+
+  if ((index > 0U) && (index < (numLags - 1U)))
+  {
+    prev = pSrc[index - 1U];
+    next = pSrc[index + 1U];
+    curv = (prev - (2.0f * peak)) + next;
+
+    /* Parabolic interpolation, only around a strict maximum */
+    if (curv < 0.0f)
+    {
+      frac = (0.5f * (prev - next)) / curv;
+      peak = peak - ((0.25f * (prev - next)) * frac);
+    }
+  }
+
+  *pLag = (float32_t) (minLag + (int32_t) index) + frac;
+  *pValue = peak;
+}
+
+/**
+ * @} end of GCC group
+ */
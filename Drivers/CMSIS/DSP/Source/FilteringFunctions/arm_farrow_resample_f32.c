@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_resample_f32.c
+ * Description:  Floating-point Farrow fractional resampler processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Farrow_Resample Farrow Fractional Resampler
+ *
+ * These functions resample a signal by an arbitrary, possibly time varying, ratio.
+ * They target links between two clock domains that are nominally at the same rate or at a
+ * simple ratio but drift slowly with respect to each other, where a rational
+ * <code>L/M</code> factor cannot follow the drift.
+ *
+ * \par Algorithm:
+ * Each output sample is computed from the four input samples around its position with a
+ * third order Lagrange interpolator in Farrow structure.
+ * For a fractional position <code>mu</code> between <code>x[n]</code> and <code>x[n+1]</code>:
+ * <pre>
+ *    c0 = x[n]
+ *    c1 = -x[n-1]/3 - x[n]/2 + x[n+1] - x[n+2]/6
+ *    c2 =  x[n-1]/2 - x[n]   + x[n+1]/2
+ *    c3 = -x[n-1]/6 + x[n]/2 - x[n+1]/2 + x[n+2]/6
+ *    y  = ((c3 * mu + c2) * mu + c1) * mu + c0
+ * </pre>
+ * The polynomial coefficients only depend on the input samples, so changing the
+ * position costs nothing but the three multiplications of the Horner evaluation.
+ * The interpolator has a fixed delay of two input samples:
+ * the output at position <code>t</code> is the input signal at <code>t - 2</code>.
+ *
+ * \par
+ * <code>step</code> is the number of input samples advanced per output sample, which is the
+ * ratio of the input rate to the output rate.  It can be changed directly in the instance
+ * structure between two calls, for example by a control loop that tracks the fill level of
+ * a buffer.  Each call consumes <code>blockSize</code> input samples and returns the number of
+ * output samples written to <code>pDst</code>, which never exceeds
+ * <code>blockSize/step + 1</code>.
+ *
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + 3</code>.
+ * The three last input samples of a block are kept for the next call.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function sets the values of the internal structure fields,
+ * zeros out the values in the state buffer and checks that the step is positive.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point version of the Farrow resampler.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup Farrow_Resample
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point Farrow fractional resampler.
+ * @param[in,out] S          points to an instance of the floating-point Farrow fractional resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_farrow_resample_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *px;                                 /* Points to the oldest sample of the window */
+  float32_t step = S->step;                      /* Input samples advanced per output sample */
+  float32_t mu = S->mu;                          /* Fractional position of the current output */
+  float32_t x0, x1, x2, x3;                      /* Window of four input samples */
+  float32_t c1, c2, c3;                          /* Farrow polynomial coefficients */
+  uint32_t index = S->offset;                    /* Input sample of the current output */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t adv;                                  /* Whole samples advanced */
+
+  /* Copy the new input samples after the three previous ones */
+  arm_copy_f32(pSrc, pState + 3U, blockSize);
+
+  while (index < blockSize)
+  {
+    /* Read the window x[n-1], x[n], x[n+1], x[n+2] */
+    px = pState + index;
+    x0 = px[0];
+    x1 = px[1];
+    x2 = px[2];
+    x3 = px[3];
+
+    /* Polynomial coefficients of the cubic Lagrange interpolator */
+    c1 = x2 - 0.333333333f * x0 - 0.5f * x1 - 0.166666667f * x3;
+    c2 = 0.5f * (x0 + x2) - x1;
+    c3 = 0.5f * (x1 - x2) + 0.166666667f * (x3 - x0);
+
+    /* Horner evaluation at the fractional position */
+    *pDst++ = ((c3 * mu + c2) * mu + c1) * mu + x1;
+    outCnt++;
+
+    /* Advance the position, carrying whole samples into the index */
+    mu += step;
+    adv = (uint32_t) mu;
+    mu -= (float32_t) adv;
+    index += adv;
+  }
+
+  /* Store the position of the next output relative to the next block */
+  S->mu = mu;
+  S->offset = index - blockSize;
+
+  /* Keep the last three input samples for the next call */
+  px = pState + blockSize;
+  pState[0] = px[0];
+  pState[1] = px[1];
+  pState[2] = px[2];
+
+  return (outCnt);
+}
+
+/**
+ * @} end of Farrow_Resample group
+ */
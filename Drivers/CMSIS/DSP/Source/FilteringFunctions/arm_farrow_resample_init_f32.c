@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_resample_init_f32.c
+ * Description:  Floating-point Farrow fractional resampler initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Farrow_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Farrow fractional resampler.
+ * @param[in,out] S          points to an instance of the floating-point Farrow fractional resampler structure.
+ * @param[in]     step       input samples advanced per output sample.
+ * @param[in]     pState     points to the state buffer.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>step</code> is not positive.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to the array of state variables of length <code>blockSize+3</code>
+ * where <code>blockSize</code> is the number of input samples processed by each call to
+ * <code>arm_farrow_resample_f32()</code>.
+ */
+
+arm_status arm_farrow_resample_init_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t step,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if (!(step > 0.0f))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the resampling step and start on the first input sample */
+    S->step = step;
+    S->mu = 0.0f;
+    S->offset = 0U;
+
+    /* Clear state buffer and size of state array is always blockSize + 3 */
+    memset(pState, 0, (blockSize + 3U) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Farrow_Resample group
+ */
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_resample_q31.c
+ * Description:  Q31 Farrow fractional resampler processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Farrow_Resample
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 Farrow fractional resampler.
+ * @param[in,out] S          points to an instance of the Q31 Farrow fractional resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The step and the position are held in 8.24 format, so the step must be below 128.
+ * The polynomial coefficients are computed from 64-bit accumulations and stored in 4.28 format,
+ * which leaves enough headroom for every partial sum of the Horner evaluation with full scale
+ * inputs.  The result is converted back to 1.31 format with saturation: the interpolator can
+ * overshoot full scale by up to 25% for signals near the Nyquist frequency.
+ */
+
+uint32_t arm_farrow_resample_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *px;                                     /* Points to the oldest sample of the window */
+  q31_t step = S->step;                          /* Input samples advanced per output sample */
+  q31_t mu = S->mu;                              /* Fractional position of the current output */
+  q31_t muQ31;                                   /* Fractional position in 1.31 format */
+  q31_t x0, x1, x2, x3;                          /* Window of four input samples */
+  q31_t c0, c1, c2, c3, y;                       /* Farrow coefficients and output in 4.28 format */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t index = S->offset;                    /* Input sample of the current output */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+
+  /* Copy the new input samples after the three previous ones */
+  arm_copy_q31(pSrc, pState + 3U, blockSize);
+
+  while (index < blockSize)
+  {
+    /* Read the window x[n-1], x[n], x[n+1], x[n+2] */
+    px = pState + index;
+    x0 = px[0];
+    x1 = px[1];
+    x2 = px[2];
+    x3 = px[3];
+
+    /* Polynomial coefficients of the cubic Lagrange interpolator, scaled by 1/8.
+     * The constants are 1/8, 1/16, 1/24 and 1/48 in 1.31 format. */
+    c0 = x1 >> 3;
+
+    acc  = (q63_t) x2 * 0x10000000;
+    acc -= (q63_t) x0 * 0x05555555;
+    acc -= (q63_t) x1 * 0x08000000;
+    acc -= (q63_t) x3 * 0x02AAAAAB;
+    c1 = (q31_t) (acc >> 31);
+
+    acc  = ((q63_t) x0 + x2) * 0x08000000;
+    acc -= (q63_t) x1 * 0x10000000;
+    c2 = (q31_t) (acc >> 31);
+
+    acc  = ((q63_t) x1 - x2) * 0x08000000;
+    acc += ((q63_t) x3 - x0) * 0x02AAAAAB;
+    c3 = (q31_t) (acc >> 31);
+
+    /* Horner evaluation at the fractional position */
+    muQ31 = mu << 7;
+    y = (q31_t) (((q63_t) c3 * muQ31) >> 31) + c2;
+    y = (q31_t) (((q63_t) y * muQ31) >> 31) + c1;
+    y = (q31_t) (((q63_t) y * muQ31) >> 31) + c0;
+
+    /* Convert from 4.28 to 1.31 format with saturation */
+    *pDst++ = clip_q63_to_q31((q63_t) y << 3);
+    outCnt++;
+
+    /* Advance the position, carrying whole samples into the index */
+    mu += step;
+    index += (uint32_t) mu >> 24;
+    mu &= 0x00FFFFFF;
+  }
+
+  /* Store the position of the next output relative to the next block */
+  S->mu = mu;
+  S->offset = index - blockSize;
+
+  /* Keep the last three input samples for the next call */
+  px = pState + blockSize;
+  pState[0] = px[0];
+  pState[1] = px[1];
+  pState[2] = px[2];
+
+  return (outCnt);
+}
+
+/**
+ * @} end of Farrow_Resample group
+ */
@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_f32.c
+ * Description:  Floating-point partitioned frequency-domain adaptive filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FDAF Frequency-Domain Adaptive Filter
+ *
+ * This function implements a partitioned block frequency-domain adaptive filter (PBFDAF),
+ * an adaptive FIR filter with the same inputs and outputs as the normalized LMS filter
+ * whose convolution and coefficient update are computed with real FFTs.
+ * It is intended for long filters such as acoustic echo paths, where
+ * arm_lms_norm_f32() spends <code>2*numTaps</code> multiply-accumulates on every sample.
+ *
+ * The filter of <code>numTaps</code> coefficients is split in
+ * <code>P = numTaps/blockLen</code> partitions of <code>blockLen</code> coefficients.
+ * The input is processed in blocks of <code>blockLen</code> samples with the overlap-save
+ * method and FFTs of length <code>2*blockLen</code>.
+ * The spectra of the last <code>P</code> input frames are kept in a frequency-domain delay line
+ * and the output spectrum is the sum of their products with the spectra of the partitions.
+ * The output therefore has the latency of one block, but no other delay than that of the
+ * time-domain filter.
+ *
+ * \par Algorithm:
+ * For each block, with <code>X[p]</code> the spectrum of the frame of <code>2*blockLen</code>
+ * input samples that ends <code>p</code> blocks earlier and <code>W[p]</code> the spectrum of partition <code>p</code>:
+ * <pre>
+ *     y = last blockLen samples of IFFT(X[0] * W[0] + ... + X[P-1] * W[P-1])
+ *     e = d - y
+ *     E = FFT(blockLen zeros, e)
+ * </pre>
+ * The power of the input in each bin is estimated with a first order recursive average:
+ * <pre>
+ *     Pxx[k] = alpha * Pxx[k] + (1 - alpha) * |X[0][k]|^2
+ * </pre>
+ * and every partition is updated with the constrained gradient:
+ * <pre>
+ *     G[k] = (2 * mu / P) * E[k] / (Pxx[k] + delta)
+ *     W[p] = W[p] + FFT(first half of IFFT(G * conj(X[p])), blockLen zeros)
+ * </pre>
+ * The step size is normalized in each bin, so all the frequencies converge at the same rate
+ * for colored inputs.  The factor <code>2/P</code> gives <code>mu</code> the same meaning as in
+ * arm_lms_norm_f32(), <code>mu</code> between 0 and 1 is a sensible range.
+ * <code>delta</code> is 1/100 of the average of <code>Pxx</code> over the bins and keeps the step
+ * size bounded in the bins where the input has no energy.
+ * The power estimate starts from 0 and is divided by <code>1 - alpha^n</code> after
+ * <code>n</code> blocks, so that the first blocks are not normalized by a too small power.
+ *
+ * \par
+ * The cost per block is <code>2*P + 3</code> real FFTs of length <code>2*blockLen</code>
+ * and <code>2*P</code> complex products of <code>blockLen</code> bins, that is
+ * <code>O(P*log(blockLen))</code> operations per sample instead of <code>2*numTaps</code>.
+ * Short blocks reduce the latency, long blocks reduce the cost.
+ *
+ * \par Instance Structure
+ * The filter spectra and the state are stored in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * The filter is only available in single-precision floating-point.
+ *
+ * \par Initialization Function
+ * The initialization function checks the lengths, initializes the real FFT and
+ * zeros the filter spectra and the state.  The filter always starts from zero.
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point partitioned frequency-domain adaptive filter.
+ * @param[in]  S          points to an instance of the floating-point FDAF structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process, a multiple of <code>blockLen</code>.
+ * @return     none.
+ *
+ * The output and the error of each sample are computed with the filter adapted at the end of
+ * the previous block.
+ */
+
+void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  uint32_t blockLen = S->blockLen;               /* block and partition length */
+  uint32_t frameLen = 2U * blockLen;             /* FFT length */
+  uint32_t numParts = S->numPartitions;          /* number of partitions */
+  float32_t *pSpectra = S->pState;               /* delay line of the input spectra */
+  float32_t *pFrame = pSpectra + numParts * frameLen; /* last 2*blockLen input samples */
+  float32_t *pBuf = pFrame + frameLen;           /* output and error spectrum */
+  float32_t *pGrad = pBuf + frameLen;            /* gradient of a partition */
+  float32_t *pPower = pGrad + frameLen;          /* power of the input, blockLen+1 bins */
+  float32_t *pX, *pW;                            /* spectra of an input frame and of a partition */
+  float32_t xr, xi, wr, wi;                      /* complex values */
+  float32_t sum, step, delta;                    /* power sum, step size and regularization */
+  float32_t alpha = S->alpha;                    /* forgetting factor */
+  uint32_t blkCnt, k, p, slot;                   /* loop counters and partition index */
+
+  blkCnt = blockSize / blockLen;
+
+  while (blkCnt > 0U)
+  {
+    /* Slide the input frame by one block */
+    arm_copy_f32(pFrame + blockLen, pFrame, blockLen);
+    arm_copy_f32(pSrc, pFrame + blockLen, blockLen);
+    pSrc += blockLen;
+
+    /* The new spectrum replaces the oldest one of the delay line */
+    S->head = (S->head == 0U) ? (uint16_t) (numParts - 1U) : (uint16_t) (S->head - 1U);
+    pX = pSpectra + S->head * frameLen;
+    arm_copy_f32(pFrame, pX, frameLen);
+    arm_rfft_fast_inplace_f32(&S->rfft, pX, 0U);
+
+    /* Output spectrum, sum of the products of the input spectra and the partitions.
+     * DC and Nyquist are real and packed in the first complex value */
+    arm_fill_f32(0.0f, pBuf, frameLen);
+    slot = S->head;
+    pW = S->pCoeffs;
+
+    for (p = 0U; p < numParts; p++)
+    {
+      pX = pSpectra + slot * frameLen;
+
+      pBuf[0] += pX[0] * pW[0];
+      pBuf[1] += pX[1] * pW[1];
+
+      for (k = 2U; k < frameLen; k += 2U)
+      {
+        xr = pX[k];
+        xi = pX[k + 1U];
+        wr = pW[k];
+        wi = pW[k + 1U];
+        pBuf[k] += xr * wr - xi * wi;
+        pBuf[k + 1U] += xr * wi + xi * wr;
+      }
+
+      pW += frameLen;
+      slot = (slot + 1U == numParts) ? 0U : slot + 1U;
+    }
+
+    /* Overlap-save: the last blockLen samples are the linear convolution */
+    arm_rfft_fast_inplace_f32(&S->rfft, pBuf, 1U);
+
+    for (k = 0U; k < blockLen; k++)
+    {
+      *pOut = pBuf[blockLen + k];
+      *pErr = *pRef++ - *pOut++;
+      pBuf[blockLen + k] = *pErr++;
+    }
+
+    /* Error spectrum, with the error in the second half of the frame */
+    arm_fill_f32(0.0f, pBuf, blockLen);
+    arm_rfft_fast_inplace_f32(&S->rfft, pBuf, 0U);
+
+    /* Power of the input in each bin */
+    pX = pSpectra + S->head * frameLen;
+    S->alphaN = (S->alphaN > 5.96046448e-8f) ? S->alphaN * alpha : 0.0f;
+
+    pPower[0] = alpha * pPower[0] + (1.0f - alpha) * (pX[0] * pX[0]);
+    pPower[blockLen] = alpha * pPower[blockLen] + (1.0f - alpha) * (pX[1] * pX[1]);
+    sum = pPower[0] + pPower[blockLen];
+
+    for (k = 1U; k < blockLen; k++)
+    {
+      xr = pX[2U * k];
+      xi = pX[2U * k + 1U];
+      pPower[k] = alpha * pPower[k] + (1.0f - alpha) * (xr * xr + xi * xi);
+      sum += pPower[k];
+    }
+
+    /* Normalized error spectrum.  The bias of the average is removed from the power
+     * and from the regularization with the same factor, and moved to the step size */
+    delta = 0.01f * sum / (float32_t) (blockLen + 1U) + 0.000000119209289f;
+    step = 2.0f * S->mu * (1.0f - S->alphaN) / (float32_t) numParts;
+
+    pBuf[0] *= step / (pPower[0] + delta);
+    pBuf[1] *= step / (pPower[blockLen] + delta);
+
+    for (k = 1U; k < blockLen; k++)
+    {
+      wr = step / (pPower[k] + delta);
+      pBuf[2U * k] *= wr;
+      pBuf[2U * k + 1U] *= wr;
+    }
+
+    /* Constrained update of each partition with the correlation of the error and its input */
+    slot = S->head;
+    pW = S->pCoeffs;
+
+    for (p = 0U; p < numParts; p++)
+    {
+      pX = pSpectra + slot * frameLen;
+
+      pGrad[0] = pBuf[0] * pX[0];
+      pGrad[1] = pBuf[1] * pX[1];
+
+      for (k = 2U; k < frameLen; k += 2U)
+      {
+        xr = pX[k];
+        xi = pX[k + 1U];
+        wr = pBuf[k];
+        wi = pBuf[k + 1U];
+        pGrad[k] = wr * xr + wi * xi;
+        pGrad[k + 1U] = wi * xr - wr * xi;
+      }
+
+      /* Keep the first blockLen taps of the gradient, the others are circular wrap-around */
+      arm_rfft_fast_inplace_f32(&S->rfft, pGrad, 1U);
+      arm_fill_f32(0.0f, pGrad + blockLen, blockLen);
+      arm_rfft_fast_inplace_f32(&S->rfft, pGrad, 0U);
+
+      arm_add_f32(pW, pGrad, pW, frameLen);
+
+      pW += frameLen;
+      slot = (slot + 1U == numParts) ? 0U : slot + 1U;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FDAF group
+ */
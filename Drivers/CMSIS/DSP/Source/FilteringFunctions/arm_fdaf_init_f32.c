@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_init_f32.c
+ * Description:  Floating-point partitioned frequency-domain adaptive filter initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point partitioned frequency-domain adaptive filter.
+ * @param[in,out] S          points to an instance of the floating-point FDAF structure.
+ * @param[in]     numTaps    number of filter coefficients, a multiple of <code>blockLen</code>.
+ * @param[in]     blockLen   block and partition length, <code>2*blockLen</code> must be one of the arm_rfft_fast_f32() lengths.
+ * @param[in]     pCoeffs    points to the buffer of the filter spectra, <code>2*numTaps</code> values.
+ * @param[in]     pState     points to the state buffer, <code>2*numTaps + 7*blockLen + 1</code> values.
+ * @param[in]     mu         step size that controls filter coefficient updates.
+ * @param[in]     alpha      forgetting factor of the input power estimate, between 0 and 1.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if the FFT length is not supported or <code>numTaps</code>
+ *                is not a nonzero multiple of <code>blockLen</code>.
+ *
+ * \par
+ * The filter spectra are in the packed format of arm_rfft_fast_f32(), partition after partition.
+ * The filter and the state are cleared.
+ * A value of <code>alpha</code> close to <code>1 - blockLen/(4*numTaps)</code> averages the power over a few filter lengths.
+ */
+
+arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t blockLen,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  float32_t alpha)
+{
+  arm_status status;
+
+  /* Initialize the real FFT, this also checks the block length */
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) (2U * blockLen));
+
+  if ((blockLen == 0U) || (numTaps == 0U) || ((numTaps % blockLen) != 0U))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* Assign filter lengths */
+    S->numTaps = numTaps;
+    S->blockLen = blockLen;
+    S->numPartitions = numTaps / blockLen;
+    S->head = 0U;
+
+    /* Assign adaptation parameters, the power estimate is not averaged yet */
+    S->mu = mu;
+    S->alpha = alpha;
+    S->alphaN = 1.0f;
+
+    /* Assign coefficient and state pointers */
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    /* The filter starts from zero */
+    memset(pCoeffs, 0, 2U * numTaps * sizeof(float32_t));
+    memset(pState, 0, (2U * numTaps + 7U * blockLen + 1U) * sizeof(float32_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FDAF group
+ */
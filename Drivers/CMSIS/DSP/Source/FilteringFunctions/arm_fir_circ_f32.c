@@ -0,0 +1,317 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_f32.c
+ * Description:  Floating-point FIR filter with circular state processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Circ Finite Impulse Response (FIR) Filters with Circular State
+ *
+ * These functions compute the same outputs as the FIR filter functions but keep the
+ * filter history in a circular delay line instead of a linear one.
+ *
+ * The FIR filter functions append each block of input to the end of their state array
+ * and, once the outputs are computed, move the last <code>numTaps-1</code> samples back
+ * to the front of the array.
+ * With short blocks and long filters that copy costs as much as the new samples themselves
+ * and it has to be paid on every call.
+ * The circular state functions write each input sample to two places of a mirrored delay
+ * line and never move the history, so the bookkeeping done for each block is proportional
+ * to <code>blockSize</code> only.
+ *
+ * \par Algorithm:
+ * The outputs are the same as those of the FIR filter:
+ * <pre>
+ *    y[n] = b[0] * x[n] + b[1] * x[n-1] + b[2] * x[n-2] + ...+ b[numTaps-1] * x[n-numTaps+1]
+ * </pre>
+ * The delay line holds <code>stateLength = numTaps + blockSize - 1</code> samples in a circular
+ * buffer and sample <code>k</code> of the buffer is stored both at <code>pState[k]</code> and at
+ * <code>pState[k + stateLength]</code>.
+ * Any run of up to <code>stateLength</code> consecutive samples is therefore contiguous in
+ * memory, whatever the current write position is, and the multiply-accumulate loops
+ * read the history without any wrap around test.
+ *
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>.
+ * Coefficients are stored in time reversed order, as for the FIR filter:
+ * \par
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to a state array of size <code>2*(numTaps + blockSize - 1)</code>.
+ * The state array is twice the size of the state array of the FIR filter;
+ * this is the price of removing the copy.
+ * \par
+ * <code>blockSize</code> given to the initialization function is the largest number of samples
+ * filtered in one pass.  The processing functions accept blocks of any length and split
+ * longer blocks into passes of that size.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ * There are separate instance structure declarations for each of the 4 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * numTaps, stateLength (numTaps + blockSize - 1), pCoeffs, pState and set stateIndex to zero.
+ * Also set all of the values in pState to zero.
+ *
+ * \par Fixed-Point Behavior
+ * The fixed-point functions use the same accumulators as <code>arm_fir_q31()</code>,
+ * <code>arm_fir_q15()</code> and <code>arm_fir_q7()</code> and produce the same outputs.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Circ
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point FIR filter with circular state.
+ * @param[in,out] S          points to an instance of the floating-point FIR filter with circular state structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ */
+
+void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pWin;                               /* Points to the oldest sample of the current output */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t stateLen = S->stateLength;            /* Length of the circular delay line */
+  uint32_t index = S->stateIndex;                /* Write position in the circular delay line */
+  uint32_t passSize;                             /* Number of samples filtered in one pass */
+  uint32_t cnt, tapCnt, blkCnt;                  /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Temporary variables to hold state and coefficient values */
+
+#endif
+
+  while (blockSize > 0U)
+  {
+    /* The delay line holds numTaps - 1 old samples and up to stateLen - numTaps + 1 new ones */
+    passSize = stateLen - (numTaps - 1U);
+    passSize = (blockSize < passSize) ? blockSize : passSize;
+
+    /* The outputs of this pass read the samples starting numTaps - 1 samples before the write position */
+    pWin = pState + ((index >= (numTaps - 1U)) ?
+                     (index - (numTaps - 1U)) : (index + stateLen - (numTaps - 1U)));
+
+    /* Write the new samples in both halves of the mirrored delay line */
+    cnt = stateLen - index;
+    cnt = (passSize < cnt) ? passSize : cnt;
+
+    arm_copy_f32(pSrc, pState + index, cnt);
+    arm_copy_f32(pSrc, pState + index + stateLen, cnt);
+
+    if (cnt < passSize)
+    {
+      /* Wrap around to the start of the delay line */
+      arm_copy_f32(pSrc + cnt, pState, passSize - cnt);
+      arm_copy_f32(pSrc + cnt, pState + stateLen, passSize - cnt);
+    }
+
+    /* Advance the write position */
+    index += passSize;
+
+    if (index >= stateLen)
+    {
+      index -= stateLen;
+    }
+
+    pSrc += passSize;
+    blockSize -= passSize;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Apply loop unrolling and compute 4 output values simultaneously.
+     * Each coefficient is read once for the 4 outputs and the samples are
+     * rotated through x0 ... x3. */
+    blkCnt = passSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* Set all accumulators to zero */
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      /* Read the first three samples of the window */
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        c0 = *pb++;
+        x0 = *px++;
+        acc0 += x1 * c0;
+        acc1 += x2 * c0;
+        acc2 += x3 * c0;
+        acc3 += x0 * c0;
+
+        c0 = *pb++;
+        x1 = *px++;
+        acc0 += x2 * c0;
+        acc1 += x3 * c0;
+        acc2 += x0 * c0;
+        acc3 += x1 * c0;
+
+        c0 = *pb++;
+        x2 = *px++;
+        acc0 += x3 * c0;
+        acc1 += x0 * c0;
+        acc2 += x1 * c0;
+        acc3 += x2 * c0;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining taps here. */
+      tapCnt = numTaps % 0x4U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        /* Shift the samples by one */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the 4 results in the destination buffer */
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+
+      /* Advance the window by 4 samples */
+      pWin += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the pass size is not a multiple of 4, compute the remaining outputs here. */
+    blkCnt = passSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = passSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      /* Perform the multiply-accumulates */
+      while (tapCnt > 0U)
+      {
+        acc0 += *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the result in the destination buffer */
+      *pDst++ = acc0;
+
+      /* Advance the window by one sample */
+      pWin++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Save the write position for the next call */
+  S->stateIndex = index;
+}
+
+/**
+ * @} end of FIR_Circ group
+ */
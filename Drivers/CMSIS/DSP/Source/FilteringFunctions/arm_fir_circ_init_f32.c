@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_init_f32.c
+ * Description:  Floating-point FIR filter with circular state initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Circ
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point FIR filter with circular state.
+ * @param[in,out] S          points to an instance of the floating-point FIR filter with circular state structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer.
+ * @param[in]     blockSize  largest number of samples that are processed in one pass.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*(numTaps+blockSize-1)</code> samples.
+ * Calls to <code>arm_fir_circ_f32()</code> with more than <code>blockSize</code> samples
+ * are processed in several passes.
+ */
+
+void arm_fir_circ_init_f32(
+  arm_fir_circ_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* The circular delay line holds numTaps + blockSize - 1 samples */
+  S->stateLength = (uint32_t) numTaps + blockSize - 1U;
+
+  /* Start writing at the beginning of the delay line */
+  S->stateIndex = 0U;
+
+  /* Clear both halves of the mirrored delay line */
+  memset(pState, 0, 2U * S->stateLength * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of FIR_Circ group
+ */
@@ -0,0 +1,263 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_q7.c
+ * Description:  Q7 FIR filter with circular state processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Circ
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q7 FIR filter with circular state.
+ * @param[in,out] S          points to an instance of the Q7 FIR filter with circular state structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 32-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.7 format and multiplications yield a 2.14 result.
+ * The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+ * There is no risk of overflow using this approach as the number of additions is bounded by the filter length.
+ * The accumulator is converted to 18.7 format by discarding the low 7 bits.
+ * Finally, the result is truncated to 1.7 format.
+ * The outputs are the same as the outputs of <code>arm_fir_q7()</code>.
+ */
+
+void arm_fir_circ_q7(
+  arm_fir_circ_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  q7_t *pState = S->pState;                      /* State pointer */
+  q7_t *pCoeffs = S->pCoeffs;                    /* Coefficient pointer */
+  q7_t *pWin;                                    /* Points to the oldest sample of the current output */
+  q7_t *px, *pb;                                 /* Temporary pointers for state and coefficient buffers */
+  q31_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t stateLen = S->stateLength;            /* Length of the circular delay line */
+  uint32_t index = S->stateIndex;                /* Write position in the circular delay line */
+  uint32_t passSize;                             /* Number of samples filtered in one pass */
+  uint32_t cnt, tapCnt, blkCnt;                  /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  q31_t acc1, acc2, acc3;                        /* Accumulators */
+  q7_t x0, x1, x2, x3, c0;                       /* Temporary variables to hold state and coefficient values */
+
+#endif
+
+  while (blockSize > 0U)
+  {
+    /* The delay line holds numTaps - 1 old samples and up to stateLen - numTaps + 1 new ones */
+    passSize = stateLen - (numTaps - 1U);
+    passSize = (blockSize < passSize) ? blockSize : passSize;
+
+    /* The outputs of this pass read the samples starting numTaps - 1 samples before the write position */
+    pWin = pState + ((index >= (numTaps - 1U)) ?
+                     (index - (numTaps - 1U)) : (index + stateLen - (numTaps - 1U)));
+
+    /* Write the new samples in both halves of the mirrored delay line */
+    cnt = stateLen - index;
+    cnt = (passSize < cnt) ? passSize : cnt;
+
+    arm_copy_q7(pSrc, pState + index, cnt);
+    arm_copy_q7(pSrc, pState + index + stateLen, cnt);
+
+    if (cnt < passSize)
+    {
+      /* Wrap around to the start of the delay line */
+      arm_copy_q7(pSrc + cnt, pState, passSize - cnt);
+      arm_copy_q7(pSrc + cnt, pState + stateLen, passSize - cnt);
+    }
+
+    /* Advance the write position */
+    index += passSize;
+
+    if (index >= stateLen)
+    {
+      index -= stateLen;
+    }
+
+    pSrc += passSize;
+    blockSize -= passSize;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Apply loop unrolling and compute 4 output values simultaneously.
+     * Each coefficient is read once for the 4 outputs and the samples are
+     * rotated through x0 ... x3. */
+    blkCnt = passSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* Set all accumulators to zero */
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      /* Read the first three samples of the window */
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+        acc0 += (q31_t) x0 * c0;
+        acc1 += (q31_t) x1 * c0;
+        acc2 += (q31_t) x2 * c0;
+        acc3 += (q31_t) x3 * c0;
+
+        c0 = *pb++;
+        x0 = *px++;
+        acc0 += (q31_t) x1 * c0;
+        acc1 += (q31_t) x2 * c0;
+        acc2 += (q31_t) x3 * c0;
+        acc3 += (q31_t) x0 * c0;
+
+        c0 = *pb++;
+        x1 = *px++;
+        acc0 += (q31_t) x2 * c0;
+        acc1 += (q31_t) x3 * c0;
+        acc2 += (q31_t) x0 * c0;
+        acc3 += (q31_t) x1 * c0;
+
+        c0 = *pb++;
+        x2 = *px++;
+        acc0 += (q31_t) x3 * c0;
+        acc1 += (q31_t) x0 * c0;
+        acc2 += (q31_t) x1 * c0;
+        acc3 += (q31_t) x2 * c0;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining taps here. */
+      tapCnt = numTaps % 0x4U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+        acc0 += (q31_t) x0 * c0;
+        acc1 += (q31_t) x1 * c0;
+        acc2 += (q31_t) x2 * c0;
+        acc3 += (q31_t) x3 * c0;
+
+        /* Shift the samples by one */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the 4 results in the destination buffer */
+      *pDst++ = (q7_t) __SSAT((acc0 >> 7U), 8);
+      *pDst++ = (q7_t) __SSAT((acc1 >> 7U), 8);
+      *pDst++ = (q7_t) __SSAT((acc2 >> 7U), 8);
+      *pDst++ = (q7_t) __SSAT((acc3 >> 7U), 8);
+
+      /* Advance the window by 4 samples */
+      pWin += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the pass size is not a multiple of 4, compute the remaining outputs here. */
+    blkCnt = passSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = passSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      /* Perform the multiply-accumulates */
+      while (tapCnt > 0U)
+      {
+        acc0 += (q31_t) *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the result in the destination buffer */
+      *pDst++ = (q7_t) __SSAT((acc0 >> 7U), 8);
+
+      /* Advance the window by one sample */
+      pWin++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Save the write position for the next call */
+  S->stateIndex = index;
+}
+
+/**
+ * @} end of FIR_Circ group
+ */
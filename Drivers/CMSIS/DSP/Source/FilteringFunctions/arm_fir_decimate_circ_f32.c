@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_decimate_circ_f32.c
+ * Description:  Floating-point FIR decimator with circular state processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Circ
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point FIR decimator with circular state.
+ * @param[in,out] S          points to an instance of the floating-point FIR decimator with circular state structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process.  Must be a multiple of the decimation factor.
+ * @return        none.
+ *
+ * \par
+ * The function computes the same outputs as <code>arm_fir_decimate_f32()</code> and writes
+ * <code>blockSize/M</code> samples to <code>pDst</code>.
+ * Only the outputs that are kept are computed and the history is kept in a mirrored
+ * circular delay line, as described for <code>arm_fir_circ_f32()</code>.
+ */
+
+void arm_fir_decimate_circ_f32(
+  arm_fir_decimate_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pWin;                               /* Points to the oldest sample of the current output */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t M = S->M;                             /* Decimation factor */
+  uint32_t stateLen = S->stateLength;            /* Length of the circular delay line */
+  uint32_t index = S->stateIndex;                /* Write position in the circular delay line */
+  uint32_t passSize;                             /* Number of input samples filtered in one pass */
+  uint32_t cnt, tapCnt, blkCnt;                  /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* The delay line holds numTaps - 1 old samples and up to stateLen - numTaps + 1 new ones.
+     ** That is a multiple of M, checked by the initialization function. */
+    passSize = stateLen - (numTaps - 1U);
+    passSize = (blockSize < passSize) ? blockSize : passSize;
+
+    /* The first output of this pass reads the samples starting numTaps - 1 samples before
+     ** the write position and ending with the first new sample */
+    pWin = pState + ((index >= (numTaps - 1U)) ?
+                     (index - (numTaps - 1U)) : (index + stateLen - (numTaps - 1U)));
+
+    /* Write the new samples in both halves of the mirrored delay line */
+    cnt = stateLen - index;
+    cnt = (passSize < cnt) ? passSize : cnt;
+
+    arm_copy_f32(pSrc, pState + index, cnt);
+    arm_copy_f32(pSrc, pState + index + stateLen, cnt);
+
+    if (cnt < passSize)
+    {
+      /* Wrap around to the start of the delay line */
+      arm_copy_f32(pSrc + cnt, pState, passSize - cnt);
+      arm_copy_f32(pSrc + cnt, pState + stateLen, passSize - cnt);
+    }
+
+    /* Advance the write position */
+    index += passSize;
+
+    if (index >= stateLen)
+    {
+      index -= stateLen;
+    }
+
+    pSrc += passSize;
+    blockSize -= passSize;
+
+    /* One output for every M input samples */
+    blkCnt = passSize / M;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulator to zero */
+      sum0 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pWin;
+      pb = pCoeffs;
+
+#if defined (ARM_MATH_DSP)
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        /* Perform the multiply-accumulates */
+        sum0 += *px++ * *pb++;
+        sum0 += *px++ * *pb++;
+        sum0 += *px++ * *pb++;
+        sum0 += *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining taps here. */
+      tapCnt = numTaps % 0x4U;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      tapCnt = numTaps;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      while (tapCnt > 0U)
+      {
+        /* Perform the multiply-accumulate */
+        sum0 += *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the result in the destination buffer */
+      *pDst++ = sum0;
+
+      /* Advance the window by the decimation factor */
+      pWin += M;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Save the write position for the next call */
+  S->stateIndex = index;
+}
+
+/**
+ * @} end of FIR_Circ group
+ */
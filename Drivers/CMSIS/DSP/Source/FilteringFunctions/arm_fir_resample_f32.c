@@ -0,0 +1,253 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point FIR rational resampler processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate of a signal by the rational factor <code>L/M</code>.
+ * Conceptually, they are equivalent to an FIR interpolator by <code>L</code> followed by
+ * a decimator by <code>M</code> sharing a single lowpass filter:
+ * the signal is upsampled by inserting <code>L-1</code> zeros between samples, filtered, and
+ * only every <code>M</code>-th sample of the result is kept.
+ * The lowpass filter should have a normalized cutoff frequency of <code>min(1/L, 1/M)</code>
+ * relative to the upsampled rate.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * A cascade of <code>arm_fir_interpolate_f32()</code> and <code>arm_fir_decimate_f32()</code>
+ * computes all of the <code>L</code> upsampled outputs and then throws away <code>M-1</code>
+ * out of <code>M</code> of them.
+ * For a 44.1 kHz to 48 kHz conversion (<code>L=160</code>, <code>M=147</code>) that is
+ * more than 99% of the work.
+ * The resampler functions evaluate only the polyphase component that contributes to each
+ * kept output sample, so each output costs <code>phaseLength = numTaps/L</code>
+ * multiply-accumulates whatever the values of <code>L</code> and <code>M</code>.
+ *
+ * \par Algorithm:
+ * Output sample <code>m</code> corresponds to time <code>t = m*M</code> at the upsampled rate.
+ * With <code>n = t / L</code> and <code>p = t % L</code>:
+ * <pre>
+ *    y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ * </pre>
+ * The values of <code>n</code> and <code>p</code> are advanced incrementally and carried over
+ * from one call to the next, so a signal can be processed in blocks of any length.
+ * With <code>M=1</code> the output is the same as the output of the FIR interpolator.
+ *
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>.
+ * <code>numTaps</code> must be a multiple of the upsample factor <code>L</code> and this is
+ * checked by the initialization functions.
+ * Coefficients are stored in time reversed order, as for the FIR interpolator:
+ * \par
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+ * The state variables are updated after each block of data is processed, the coefficients are untouched.
+ *
+ * \par
+ * Each call consumes <code>blockSize</code> input samples and returns the number of output
+ * samples written to <code>pDst</code>.  The number varies from call to call by at most one
+ * and never exceeds <code>(blockSize*L + M - 1) / M</code>, which is the size required
+ * for the destination buffer.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks that <code>L</code> and <code>M</code> are not zero and that the length of the filter
+ * is a multiple of the upsample factor.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * L, M, phaseLength (numTaps / L), pCoeffs, pState and set phase and offset to zero.
+ * Also set all of the values in pState to zero.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point versions of the FIR resampler functions.
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point FIR rational resampler.
+ * @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t stepInt = S->M / L;                   /* Input samples advanced per output sample */
+  uint32_t stepFrac = S->M % L;                  /* Polyphase components advanced per output sample */
+  uint32_t phase = S->phase;                     /* Polyphase component of the current output */
+  uint32_t index = S->offset;                    /* Input sample of the current output */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t tapCnt;                               /* Loop counter */
+  uint16_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_f32(pSrc, pStateCurnt, blockSize);
+
+  /* Only the outputs that survive the downsampling are computed.
+   ** Output samples are produced as long as their newest input sample is in this block. */
+  while (index < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum = 0.0f;
+
+    /* The window of the current output ends with input sample index */
+    px = pState + index;
+
+    /* Coefficients of the polyphase component, stored in time reversed order */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = (uint32_t) phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      sum += *px++ * *pb;
+      pb += L;
+      sum += *px++ * *pb;
+      pb += L;
+      sum += *px++ * *pb;
+      pb += L;
+      sum += *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining taps here. */
+    tapCnt = (uint32_t) phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the polyPhase length */
+    tapCnt = (uint32_t) phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum += *px++ * *pb;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = sum;
+    outCnt++;
+
+    /* Advance the output time by M samples at the upsampled rate */
+    index += stepInt;
+    phase += stepFrac;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      index++;
+    }
+  }
+
+  /* Store the position of the next output relative to the next block */
+  S->phase = (uint16_t) phase;
+  S->offset = index - blockSize;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the oldest sample still needed */
+  px = pState + blockSize;
+
+  tapCnt = (uint32_t) phaseLen - 1U;
+
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 FIR rational resampler processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 FIR rational resampler.
+ * @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t stepInt = S->M / L;                   /* Input samples advanced per output sample */
+  uint32_t stepFrac = S->M % L;                  /* Polyphase components advanced per output sample */
+  uint32_t phase = S->phase;                     /* Polyphase component of the current output */
+  uint32_t index = S->offset;                    /* Input sample of the current output */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t tapCnt;                               /* Loop counter */
+  uint16_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_q15(pSrc, pStateCurnt, blockSize);
+
+  /* Only the outputs that survive the downsampling are computed.
+   ** Output samples are produced as long as their newest input sample is in this block. */
+  while (index < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum = 0;
+
+    /* The window of the current output ends with input sample index */
+    px = pState + index;
+
+    /* Coefficients of the polyphase component, stored in time reversed order */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = (uint32_t) phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      sum += (q31_t) *px++ * *pb;
+      pb += L;
+      sum += (q31_t) *px++ * *pb;
+      pb += L;
+      sum += (q31_t) *px++ * *pb;
+      pb += L;
+      sum += (q31_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining taps here. */
+    tapCnt = (uint32_t) phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the polyPhase length */
+    tapCnt = (uint32_t) phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum += (q31_t) *px++ * *pb;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result after converting to 1.15 format in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((sum >> 15), 16));
+    outCnt++;
+
+    /* Advance the output time by M samples at the upsampled rate */
+    index += stepInt;
+    phase += stepFrac;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      index++;
+    }
+  }
+
+  /* Store the position of the next output relative to the next block */
+  S->phase = (uint16_t) phase;
+  S->offset = index - blockSize;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the oldest sample still needed */
+  px = pState + blockSize;
+
+  tapCnt = (uint32_t) phaseLen - 1U;
+
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
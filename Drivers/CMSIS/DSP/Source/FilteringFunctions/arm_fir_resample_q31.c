@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 FIR rational resampler processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 FIR rational resampler.
+ * @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>
+ * since <code>numTaps/L</code> additions occur per output sample.
+ * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+ */
+
+uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t stepInt = S->M / L;                   /* Input samples advanced per output sample */
+  uint32_t stepFrac = S->M % L;                  /* Polyphase components advanced per output sample */
+  uint32_t phase = S->phase;                     /* Polyphase component of the current output */
+  uint32_t index = S->offset;                    /* Input sample of the current output */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t tapCnt;                               /* Loop counter */
+  uint16_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_q31(pSrc, pStateCurnt, blockSize);
+
+  /* Only the outputs that survive the downsampling are computed.
+   ** Output samples are produced as long as their newest input sample is in this block. */
+  while (index < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum = 0;
+
+    /* The window of the current output ends with input sample index */
+    px = pState + index;
+
+    /* Coefficients of the polyphase component, stored in time reversed order */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = (uint32_t) phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      sum += (q63_t) *px++ * *pb;
+      pb += L;
+      sum += (q63_t) *px++ * *pb;
+      pb += L;
+      sum += (q63_t) *px++ * *pb;
+      pb += L;
+      sum += (q63_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining taps here. */
+    tapCnt = (uint32_t) phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the polyPhase length */
+    tapCnt = (uint32_t) phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum += (q63_t) *px++ * *pb;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Convert the result from 2.62 to 1.31 format and store in the destination buffer. */
+    *pDst++ = (q31_t) (sum >> 31);
+    outCnt++;
+
+    /* Advance the output time by M samples at the upsampled rate */
+    index += stepInt;
+    phase += stepFrac;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      index++;
+    }
+  }
+
+  /* Store the position of the next output relative to the next block */
+  S->phase = (uint16_t) phase;
+  S->offset = index - blockSize;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the oldest sample still needed */
+  px = pState + blockSize;
+
+  tapCnt = (uint32_t) phaseLen - 1U;
+
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gcc_phat_f32.c
+ * Description:  Generalized cross-correlation with phase transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup GCC Generalized Cross-Correlation
+ *
+ * These functions estimate the delay between two signals, for example the time
+ * difference of arrival (TDOA) of a sound at two microphones.
+ * The cross-correlation of two blocks is computed with real FFTs and only the lags
+ * of interest are returned, typically a few tens around zero for the spacing of the
+ * microphones.
+ *
+ * \par Algorithm:
+ * The blocks <code>a</code> and <code>b</code> are padded with zeros to the FFT length
+ * and the cross spectrum is weighted before the inverse transform:
+ * <pre>
+ *     X[k] = A[k] * conj(B[k])
+ *     r    = IFFT(W[k] * X[k])
+ * </pre>
+ * Without weighting, <code>W[k] = 1</code> and <code>r</code> is the cross-correlation
+ * computed by arm_correlate_lag_f32().
+ * With the phase transform (PHAT), <code>W[k] = 1/|X[k]|</code> keeps only the phase of the
+ * cross spectrum.  All frequencies then contribute equally, which sharpens the peak and
+ * makes it robust to reverberation and to the spectrum of the source.
+ * For a pure delay the PHAT correlation is a peak close to 1 at the delay.
+ * Bins where the cross spectrum is zero are left at zero.
+ *
+ * \par
+ * Lag <code>k</code> is a delay of <code>a</code> relative to <code>b</code>.
+ * The correlation is linear when <code>blockSize + maxLag <= fftLen</code>.
+ * Longer blocks, up to <code>fftLen</code>, give a circular correlation:
+ * the result at lag <code>k</code> also includes the products of the last
+ * <code>|k|</code> samples of one block with the first samples of the other,
+ * which is usually negligible for lags much shorter than the block.
+ * \par
+ * The cost is three real FFTs of length <code>fftLen</code> and a complex product per bin,
+ * whatever the number of lags.
+ * The direct arm_correlate_lag_f32() is cheaper when only a few lags are needed.
+ * arm_correlate_peak_f32() refines the position of the maximum to a fraction of a sample.
+ *
+ * \par Instance Structure
+ * The FFT, the lag range, the weighting and the work buffer are stored in an instance
+ * data structure.  The correlation keeps no state between calls.
+ *
+ * \par Initialization Function
+ * arm_gcc_phat_init_f32() checks the lengths and initializes the real FFT.
+ */
+
+/**
+ * @addtogroup GCC
+ * @{
+ */
+
+/**
+ * @brief  Generalized cross-correlation of floating-point blocks.
+ * @param[in]  S          points to an instance of the floating-point GCC structure.
+ * @param[in]  pSrcA      points to the first block.
+ * @param[in]  pSrcB      points to the second block.
+ * @param[in]  blockSize  number of samples in each block, at most <code>fftLen</code>.
+ * @param[out] pDst       points to the correlation at lags <code>-maxLag</code> to <code>maxLag</code>,
+ *                        <code>2*maxLag + 1</code> values.
+ * @return     none.
+ */
+
+void arm_gcc_phat_f32(
+  arm_gcc_phat_instance_f32 * S,
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  uint32_t maxLag = S->maxLag;                   /* Largest lag */
+  float32_t *pA = S->pState;                     /* Spectrum of the first block, then cross spectrum */
+  float32_t *pB = pA + fftLen;                   /* Spectrum of the second block */
+  float32_t *pX = pB + fftLen;                   /* Padded block, then correlation */
+  float32_t *pOut;                               /* Cross spectrum pointer */
+  float32_t ar, ai, br, bi;                      /* Bins of the spectra */
+  float32_t xr, xi, mag;                         /* Bin of the cross spectrum and its magnitude */
+  uint32_t k;                                    /* Loop counter */
+
+  /* Spectrum of the first block */
+  arm_copy_f32(pSrcA, pX, blockSize);
+  arm_fill_f32(0.0f, pX + blockSize, fftLen - blockSize);
+  arm_rfft_fast_f32(&S->rfft, pX, pA, 0U);
+
+  /* Spectrum of the second block */
+  arm_copy_f32(pSrcB, pX, blockSize);
+  arm_fill_f32(0.0f, pX + blockSize, fftLen - blockSize);
+  arm_rfft_fast_f32(&S->rfft, pX, pB, 0U);
+
+  /* DC and Nyquist bins are real and packed in the first two values */
+  pA[0] = pA[0] * pB[0];
+  pA[1] = pA[1] * pB[1];
+
+  if (S->phat != 0U)
+  {
+    pA[0] = (pA[0] > 0.0f) ? 1.0f : ((pA[0] < 0.0f) ? -1.0f : 0.0f);
+    pA[1] = (pA[1] > 0.0f) ? 1.0f : ((pA[1] < 0.0f) ? -1.0f : 0.0f);
+  }
+
+  /* Cross spectrum A * conj(B) in the other bins */
+  pOut = pA + 2U;
+  pB += 2U;
+
+  /* Loop over the fftLen/2 - 1 complex bins */
+  k = (fftLen >> 1U) - 1U;
+
+  while (k > 0U)
+  {
+    ar = pOut[0];
+    ai = pOut[1];
+    br = *pB++;
+    bi = *pB++;
+
+    xr = (ar * br) + (ai * bi);
+    xi = (ai * br) - (ar * bi);
+
+    if (S->phat != 0U)
+    {
+      /* Keep the phase only */
+      arm_sqrt_f32((xr * xr) + (xi * xi), &mag);
+
+      if (mag > 0.0f)
+      {
+        mag = 1.0f / mag;
+      }
+
+      xr *= mag;
+      xi *= mag;
+    }
+
+    *pOut++ = xr;
+    *pOut++ = xi;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+
+  /* Correlation, the inverse transform includes the 1/fftLen scaling */
+  arm_rfft_fast_f32(&S->rfft, pA, pX, 1U);
+
+  /* Negative lags are at the end of the circular correlation */
+  arm_copy_f32(pX + (fftLen - maxLag), pDst, maxLag);
+  arm_copy_f32(pX, pDst + maxLag, maxLag + 1U);
+}
+
+/**
+ * @} end of GCC group
+ */
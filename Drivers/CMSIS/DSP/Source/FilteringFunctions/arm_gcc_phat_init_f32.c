@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gcc_phat_init_f32.c
+ * Description:  Initialization function for the generalized cross-correlation
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup GCC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point generalized cross-correlation.
+ * @param[in,out] S       points to an instance of the floating-point GCC structure.
+ * @param[in]     fftLen  FFT length, one of the arm_rfft_fast_f32() lengths.
+ * @param[in]     maxLag  largest lag computed, less than <code>fftLen/2</code>.
+ * @param[in]     phat    1 to apply the phase transform, 0 for the plain cross-correlation.
+ * @param[in]     pState  points to the work buffer, <code>3*fftLen</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if the FFT length is not supported or
+ *                <code>maxLag</code> is too large.
+ *
+ * \par
+ * For blocks of <code>blockSize</code> samples, an FFT length of at least
+ * <code>blockSize + maxLag</code> gives the linear correlation.
+ */
+
+arm_status arm_gcc_phat_init_f32(
+  arm_gcc_phat_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t maxLag,
+  uint8_t phat,
+  float32_t * pState)
+{
+  arm_status status;
+
+  /* Initialize the real FFT, this also checks the FFT length */
+  status = arm_rfft_fast_init_f32(&S->rfft, fftLen);
+
+  /* Positive and negative lags must not overlap in the circular correlation */
+  if (maxLag >= (fftLen >> 1U))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLen = fftLen;
+    S->maxLag = maxLag;
+    S->phat = phat;
+    S->pState = pState;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of GCC group
+ */
@@ -0,0 +1,302 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_norm_block_f32.c
+ * Description:  Processing function for the floating-point block normalized LMS filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_NORM
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point block normalized LMS filter.
+ * @param[in,out] S          points to an instance of the floating-point normalized LMS filter structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     pRef       points to the block of reference data.
+ * @param[out]    pOut       points to the block of output data.
+ * @param[out]    pErr       points to the block of error data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * The block variant uses the instance and the initialization function of arm_lms_norm_f32(),
+ * but updates the coefficients once per call instead of once per sample.
+ * The outputs of the block are computed with the same coefficients and the update is
+ * the sum of the updates of arm_lms_norm_f32(), with the energy of the last sample:
+ * <pre>
+ *     b[k] = b[k] + (mu/E) * (e[0] * x[-k] + e[1] * x[1-k] + ... + e[blockSize-1] * x[blockSize-1-k])
+ * </pre>
+ * The coefficient array is therefore read <code>blockSize</code> times and written once per call,
+ * instead of being read twice and written once per sample, and the update is a correlation that
+ * accumulates in a register.  The convergence per sample is close to that of arm_lms_norm_f32()
+ * as long as <code>blockSize</code> is small compared to <code>numTaps</code>; with a block of
+ * 1 sample both functions are identical.
+ * When the input is strongly correlated, the updates of the samples of a block point in the
+ * same direction and add up, and <code>mu</code> may have to be reduced down to
+ * <code>mu/blockSize</code> to keep the filter stable.
+ */
+
+void arm_lms_norm_block_f32(
+  arm_lms_norm_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb, *pe;                       /* Temporary pointers for state, coefficient and error buffers */
+  float32_t *pErrStart = pErr;                   /* Error of the first sample of the block */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+  float32_t energy;                              /* Energy of the input */
+  float32_t sum, w, x0, in;                      /* accumulator, weight factor, oldest and new sample */
+
+  energy = S->energy;
+  x0 = S->x0;
+
+  /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* The whole block is filtered with the same coefficients */
+  arm_copy_f32(pSrc, pStateCurnt, blockSize);
+
+  blkCnt = blockSize;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  while (blkCnt > 0U)
+  {
+    /* Initialize pState pointer */
+    px = pState;
+
+    /* Initialize coeff pointer */
+    pb = pCoeffs;
+
+    /* Read the sample from input buffer */
+    in = *pSrc++;
+
+    /* Update the energy calculation */
+    energy -= x0 * x0;
+    energy += in * in;
+
+    /* Set the accumulator to zero */
+    sum = 0.0f;
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = numTaps >> 2;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum += (*px++) * (*pb++);
+      sum += (*px++) * (*pb++);
+      sum += (*px++) * (*pb++);
+      sum += (*px++) * (*pb++);
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = numTaps % 0x4U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum += (*px++) * (*pb++);
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result in the accumulator, store in the destination buffer. */
+    *pOut++ = sum;
+
+    /* Compute and store error */
+    *pErr++ = *pRef++ - sum;
+
+    x0 = *pState;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Weighting factor of the block, with the energy of the last sample */
+  /* epsilon value 0.000000119209289f */
+  w = S->mu / (energy + 0.000000119209289f);
+
+  /* Update filter coefficients with the correlation of the errors and the state */
+  px = S->pState;
+  pb = pCoeffs;
+  tapCnt = numTaps;
+
+  while (tapCnt > 0U)
+  {
+    pe = pErrStart;
+    pState = px++;
+    sum = 0.0f;
+
+    /* Loop unrolling.  Process 4 samples at a time. */
+    blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0U)
+    {
+      sum += (*pe++) * (*pState++);
+      sum += (*pe++) * (*pState++);
+      sum += (*pe++) * (*pState++);
+      sum += (*pe++) * (*pState++);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the block size is not a multiple of 4, compute the remaining samples */
+    blkCnt = blockSize % 0x4U;
+
+    while (blkCnt > 0U)
+    {
+      sum += (*pe++) * (*pState++);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pb++ += w * sum;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  while (blkCnt > 0U)
+  {
+    /* Initialize pState pointer */
+    px = pState;
+
+    /* Initialize pCoeffs pointer */
+    pb = pCoeffs;
+
+    /* Read the sample from input buffer */
+    in = *pSrc++;
+
+    /* Update the energy calculation */
+    energy -= x0 * x0;
+    energy += in * in;
+
+    /* Set the accumulator to zero */
+    sum = 0.0f;
+
+    /* Loop over numTaps number of values */
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum += (*px++) * (*pb++);
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is stored in the destination buffer. */
+    *pOut++ = sum;
+
+    /* Compute and store error */
+    *pErr++ = *pRef++ - sum;
+
+    x0 = *pState;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Weighting factor of the block, with the energy of the last sample */
+  /* epsilon value 0.000000119209289f */
+  w = S->mu / (energy + 0.000000119209289f);
+
+  /* Update filter coefficients with the correlation of the errors and the state */
+  px = S->pState;
+  pb = pCoeffs;
+  tapCnt = numTaps;
+
+  while (tapCnt > 0U)
+  {
+    pe = pErrStart;
+    pState = px++;
+    sum = 0.0f;
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      sum += (*pe++) * (*pState++);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pb++ += w * sum;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  S->energy = energy;
+  S->x0 = x0;
+
+  /* Processing is complete. Now copy the last numTaps - 1 samples to the
+     start of the state buffer. This prepares the state buffer for the
+     next function call. */
+  arm_copy_f32(S->pState + blockSize, S->pState, numTaps - 1U);
+}
+
+/**
+ * @} end of LMS_NORM group
+ */
@@ -0,0 +1,355 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_f32.c
+ * Description:  Floating-point sliding-window median filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Median Median Filter
+ *
+ * The median filter replaces each sample by the median of the last
+ * <code>windowLen</code> input samples.  Unlike a linear filter it removes isolated
+ * spikes completely while preserving steps, which makes it the usual choice for
+ * impulse noise rejection.
+ * <pre>
+ *    y[n] = median(x[n-windowLen+1], ..., x[n-1], x[n])
+ * </pre>
+ * The window length is odd, so the median is a sample of the window.  The output
+ * is delayed by <code>(windowLen-1)/2</code> samples with respect to the center of
+ * the window.  As with the other filters of the library the samples before the first
+ * call are zero.
+ *
+ * \par Algorithm
+ * The window is kept in a circular buffer and each sample of the window has a
+ * position in an indexed double heap: a max-heap of the smaller half of the window,
+ * a min-heap of the larger half and the median between them.  A new sample replaces
+ * the oldest one in place and is moved up or down its heap, crossing over the median
+ * if needed, so each output costs <code>O(log(windowLen))</code> comparisons.
+ * \par
+ * Windows of 1, 3, 5, 7 and 9 samples use a fixed median selection network of
+ * 0, 3, 7, 13 and 19 compare-exchange operations on the circular buffer instead,
+ * which is branch free and faster than the heap for such short windows.  These
+ * windows do not need the heap index array.
+ *
+ * \par Instance Structure
+ * The window samples and the heap indices are stored in an instance structure.
+ * A separate instance structure must be defined for each filter.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the window buffer.
+ * - Builds the initial heap.
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/* Compare-exchange of the median selection networks */
+#define MEDIAN_SORT(a, b)  { if ((a) > (b)) { t = (a); (a) = (b); (b) = t; } }
+
+/**
+ * @brief  Median of a short window by a selection network.
+ * @param[in,out] p    points to the window samples, reordered on return.
+ * @param[in]     len  number of samples, 1, 3, 5, 7 or 9.
+ * @return        median of the samples.
+ */
+static float32_t arm_median_network_f32(
+  float32_t * p,
+  uint32_t len)
+{
+  float32_t t;                                   /* Temporary variable for the exchanges */
+
+  switch (len)
+  {
+  case 3U:
+    MEDIAN_SORT(p[0], p[1]); MEDIAN_SORT(p[1], p[2]); MEDIAN_SORT(p[0], p[1]);
+    return (p[1]);
+
+  case 5U:
+    MEDIAN_SORT(p[0], p[1]); MEDIAN_SORT(p[3], p[4]); MEDIAN_SORT(p[0], p[3]);
+    MEDIAN_SORT(p[1], p[4]); MEDIAN_SORT(p[1], p[2]); MEDIAN_SORT(p[2], p[3]);
+    MEDIAN_SORT(p[1], p[2]);
+    return (p[2]);
+
+  case 7U:
+    MEDIAN_SORT(p[0], p[5]); MEDIAN_SORT(p[0], p[3]); MEDIAN_SORT(p[1], p[6]);
+    MEDIAN_SORT(p[2], p[4]); MEDIAN_SORT(p[0], p[1]); MEDIAN_SORT(p[3], p[5]);
+    MEDIAN_SORT(p[2], p[6]); MEDIAN_SORT(p[2], p[3]); MEDIAN_SORT(p[3], p[6]);
+    MEDIAN_SORT(p[4], p[5]); MEDIAN_SORT(p[1], p[4]); MEDIAN_SORT(p[1], p[3]);
+    MEDIAN_SORT(p[3], p[4]);
+    return (p[3]);
+
+  case 9U:
+    MEDIAN_SORT(p[1], p[2]); MEDIAN_SORT(p[4], p[5]); MEDIAN_SORT(p[7], p[8]);
+    MEDIAN_SORT(p[0], p[1]); MEDIAN_SORT(p[3], p[4]); MEDIAN_SORT(p[6], p[7]);
+    MEDIAN_SORT(p[1], p[2]); MEDIAN_SORT(p[4], p[5]); MEDIAN_SORT(p[7], p[8]);
+    MEDIAN_SORT(p[0], p[3]); MEDIAN_SORT(p[5], p[8]); MEDIAN_SORT(p[4], p[7]);
+    MEDIAN_SORT(p[3], p[6]); MEDIAN_SORT(p[1], p[4]); MEDIAN_SORT(p[2], p[5]);
+    MEDIAN_SORT(p[4], p[7]); MEDIAN_SORT(p[4], p[2]); MEDIAN_SORT(p[6], p[4]);
+    MEDIAN_SORT(p[4], p[2]);
+    return (p[4]);
+
+  default:
+    return (p[0]);
+  }
+}
+
+/**
+ * @brief  Compares two heap entries and exchanges them if the first one is smaller.
+ * @param[in]     pData  points to the window samples.
+ * @param[in,out] pHeap  points to the heap center, pHeap[i] is the window slot at heap position i.
+ * @param[in,out] pPos   points to the heap position of each window slot.
+ * @param[in]     i      heap position of the entry that must not be smaller.
+ * @param[in]     j      heap position of the other entry.
+ * @return        1 if the entries were exchanged, 0 otherwise.
+ */
+static uint32_t arm_median_exchange_f32(
+  const float32_t * pData,
+  int32_t * pHeap,
+  int32_t * pPos,
+  int32_t i,
+  int32_t j)
+{
+  int32_t slot;
+
+  if (pData[pHeap[i]] < pData[pHeap[j]])
+  {
+    slot = pHeap[i];
+    pHeap[i] = pHeap[j];
+    pHeap[j] = slot;
+    pPos[pHeap[i]] = i;
+    pPos[pHeap[j]] = j;
+
+    return (1U);
+  }
+
+  return (0U);
+}
+
+/**
+ * @brief  Processing function for the floating-point median filter.
+ * @param[in,out] S          points to an instance of the floating-point median filter structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+
+void arm_median_filter_f32(
+  arm_median_filter_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pData = S->pState;                  /* Circular buffer of the window samples */
+  float32_t win[9];                              /* Copy of a short window */
+  float32_t in, old;                             /* New and replaced samples */
+  int32_t *pHeap, *pPos;                         /* Heap center and heap positions */
+  int32_t half = ((int32_t) S->windowLen - 1) >> 1; /* Number of entries in each heap */
+  int32_t p, i;                                  /* Heap positions */
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t index = S->index;                     /* Slot of the oldest sample */
+  uint32_t blkCnt, k;                            /* Loop counters */
+
+  blkCnt = blockSize;
+
+  if (windowLen <= 9U)
+  {
+    /* Selection network on a copy of the window, the order of the samples does not matter */
+    while (blkCnt > 0U)
+    {
+      pData[index] = *pSrc++;
+      index = (index + 1U == windowLen) ? 0U : (index + 1U);
+
+      for (k = 0U; k < windowLen; k++)
+      {
+        win[k] = pData[k];
+      }
+
+      *pDst++ = arm_median_network_f32(win, windowLen);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    pHeap = S->pIndex + half;
+    pPos = S->pIndex + windowLen;
+
+    while (blkCnt > 0U)
+    {
+      /* Replace the oldest sample in place */
+      in = *pSrc++;
+      old = pData[index];
+      pData[index] = in;
+      p = pPos[index];
+      index = (index + 1U == windowLen) ? 0U : (index + 1U);
+
+      if (p > 0)
+      {
+        /* The sample is in the min-heap of the larger half */
+        if (in > old)
+        {
+          /* Move down: exchange with the smaller child while it is smaller */
+          for (i = 2 * p; i <= half; i *= 2)
+          {
+            if ((i < half) && (pData[pHeap[i + 1]] < pData[pHeap[i]]))
+            {
+              i++;
+            }
+
+            if (arm_median_exchange_f32(pData, pHeap, pPos, i, i / 2) == 0U)
+            {
+              break;
+            }
+          }
+        }
+        else
+        {
+          /* Move up, possibly across the median */
+          while ((p > 0) && (arm_median_exchange_f32(pData, pHeap, pPos, p, p / 2) != 0U))
+          {
+            p /= 2;
+          }
+
+          if (p == 0)
+          {
+            /* The previous median moved to the max-heap root */
+            for (i = -1; i >= -half; i *= 2)
+            {
+              if ((i < -1) && (i > -half) && (pData[pHeap[i]] < pData[pHeap[i - 1]]))
+              {
+                i--;
+              }
+
+              if (arm_median_exchange_f32(pData, pHeap, pPos, i / 2, i) == 0U)
+              {
+                break;
+              }
+            }
+          }
+        }
+      }
+      else if (p < 0)
+      {
+        /* The sample is in the max-heap of the smaller half */
+        if (in < old)
+        {
+          /* Move down: exchange with the larger child while it is larger */
+          for (i = 2 * p; i >= -half; i *= 2)
+          {
+            if ((i > -half) && (pData[pHeap[i]] < pData[pHeap[i - 1]]))
+            {
+              i--;
+            }
+
+            if (arm_median_exchange_f32(pData, pHeap, pPos, i / 2, i) == 0U)
+            {
+              break;
+            }
+          }
+        }
+        else
+        {
+          /* Move up, possibly across the median */
+          while ((p < 0) && (arm_median_exchange_f32(pData, pHeap, pPos, p / 2, p) != 0U))
+          {
+            p /= 2;
+          }
+
+          if (p == 0)
+          {
+            /* The previous median moved to the min-heap root */
+            for (i = 1; i <= half; i *= 2)
+            {
+              if ((i > 1) && (i < half) && (pData[pHeap[i + 1]] < pData[pHeap[i]]))
+              {
+                i++;
+              }
+
+              if (arm_median_exchange_f32(pData, pHeap, pPos, i, i / 2) == 0U)
+              {
+                break;
+              }
+            }
+          }
+        }
+      }
+      else
+      {
+        /* The sample is the median: restore the order with both heap roots */
+        for (i = -1; i >= -half; i *= 2)
+        {
+          if ((i < -1) && (i > -half) && (pData[pHeap[i]] < pData[pHeap[i - 1]]))
+          {
+            i--;
+          }
+
+          if (arm_median_exchange_f32(pData, pHeap, pPos, i / 2, i) == 0U)
+          {
+            break;
+          }
+        }
+
+        for (i = 1; i <= half; i *= 2)
+        {
+          if ((i > 1) && (i < half) && (pData[pHeap[i + 1]] < pData[pHeap[i]]))
+          {
+            i++;
+          }
+
+          if (arm_median_exchange_f32(pData, pHeap, pPos, i, i / 2) == 0U)
+          {
+            break;
+          }
+        }
+      }
+
+      /* The median is at the heap center */
+      *pDst++ = pData[pHeap[0]];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Save the slot of the oldest sample for the next call */
+  S->index = (uint16_t) index;
+}
+
+/**
+ * @} end of Median group
+ */
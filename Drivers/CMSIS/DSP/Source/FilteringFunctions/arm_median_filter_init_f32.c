@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_init_f32.c
+ * Description:  Floating-point median filter initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point median filter.
+ * @param[in,out] S          points to an instance of the floating-point median filter structure.
+ * @param[in]     windowLen  number of samples in the window, odd.
+ * @param[in]     pState     points to the window buffer.
+ * @param[in]     pIndex     points to the heap index buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is even or <code>pIndex</code> is NULL
+ * for a window of more than 9 samples.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> is of length <code>windowLen</code> and <code>pIndex</code> is of
+ * length <code>2*windowLen</code>.  Windows of up to 9 samples use a selection network
+ * and do not need <code>pIndex</code>, which can be NULL.
+ */
+
+arm_status arm_median_filter_init_f32(
+  arm_median_filter_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState,
+  int32_t * pIndex)
+{
+  arm_status status;
+  int32_t half = ((int32_t) windowLen - 1) >> 1;
+  int32_t i;
+
+  if (((windowLen & 1U) == 0U) || ((windowLen > 9U) && (pIndex == NULL)))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign window length */
+    S->windowLen = windowLen;
+
+    /* The oldest sample is in slot 0 */
+    S->index = 0U;
+
+    /* Clear the window */
+    memset(pState, 0, (uint32_t) windowLen * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    if (windowLen > 9U)
+    {
+      /* All samples are equal, so any placement is a valid double heap:
+       ** pIndex[half + i] is the slot at heap position i and
+       ** pIndex[windowLen + slot] is the heap position of slot. */
+      for (i = 0; i < (int32_t) windowLen; i++)
+      {
+        pIndex[i] = i;
+        pIndex[windowLen + i] = i - half;
+      }
+    }
+
+    /* Assign heap index pointer */
+    S->pIndex = pIndex;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Median group
+ */
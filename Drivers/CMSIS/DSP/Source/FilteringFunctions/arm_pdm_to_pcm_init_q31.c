@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pdm_to_pcm_init_q31.c
+ * Description:  PDM to Q31 PCM converter initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the PDM to Q31 PCM converter.
+ * @param[in,out] S          points to an instance of the PDM to PCM converter structure.
+ * @param[in]     order      number of stages of the CIC decimator.
+ * @param[in]     R          decimation factor of the CIC decimator.
+ * @param[in]     numTaps    number of coefficients in the compensation filter.
+ * @param[in]     M          decimation factor of the compensation filter.
+ * @param[in]     pCoeffs    points to the compensation filter coefficients.
+ * @param[in]     pCicState  points to the CIC state buffer.
+ * @param[in]     pFirState  points to the compensation filter state buffer.
+ * @param[in]     pScratch   points to the buffer for the CIC output.
+ * @param[in]     blockSize  number of PDM bytes to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful,
+ * ARM_MATH_ARGUMENT_ERROR if the CIC parameters are not supported, see
+ * <code>arm_cic_decimate_init_q31()</code>, or ARM_MATH_LENGTH_ERROR if
+ * <code>8*blockSize</code> is not a multiple of <code>R*M</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * The CIC stage produces <code>L = 8*blockSize/R</code> samples per call.
+ * <code>pCicState</code> is of length <code>2*order</code> 64-bit words,
+ * <code>pFirState</code> is of length <code>numTaps+L-1</code> words and
+ * <code>pScratch</code> is of length <code>L</code> words.
+ * \par
+ * <code>pCoeffs</code> is used as in <code>arm_fir_decimate_init_q31()</code>; suitable
+ * coefficients are designed with <code>arm_cic_compensation_f32()</code>.
+ */
+
+arm_status arm_pdm_to_pcm_init_q31(
+  arm_pdm_to_pcm_instance_q31 * S,
+  uint8_t order,
+  uint16_t R,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t * pCoeffs,
+  q63_t * pCicState,
+  q31_t * pFirState,
+  q31_t * pScratch,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  status = arm_cic_decimate_init_q31(&S->cic, order, R, pCicState);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* The block must hold a whole number of CIC output samples */
+    if (((8U * blockSize) % R) != 0U)
+    {
+      /* Set status as ARM_MATH_LENGTH_ERROR */
+      status = ARM_MATH_LENGTH_ERROR;
+    }
+    else
+    {
+      /* The compensation filter checks that its block is a multiple of M */
+      status = arm_fir_decimate_init_q31(&S->fir, numTaps, M, pCoeffs, pFirState,
+                                         (8U * blockSize) / R);
+    }
+  }
+
+  /* Assign scratch buffer pointer */
+  S->pScratch = pScratch;
+
+  return (status);
+}
+
+/**
+ * @} end of CIC group
+ */
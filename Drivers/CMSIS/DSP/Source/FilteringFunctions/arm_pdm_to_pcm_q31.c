@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pdm_to_pcm_q31.c
+ * Description:  PDM to Q31 PCM conversion
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Converts a 1-bit PDM stream to Q31 PCM samples.
+ * @param[in,out] S          points to an instance of the PDM to PCM converter structure.
+ * @param[in]     pSrc       points to the block of packed PDM data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of PDM bytes to process per call.
+ *
+ * <b>Description:</b>
+ * \par
+ * Each byte of <code>pSrc</code> holds eight PDM samples, the oldest in the most
+ * significant bit.  A set bit is +1 and a cleared bit is -1.  The bits are fed
+ * directly into the CIC integrators, without unpacking them to Q31 first, and the
+ * CIC output is passed through the compensation FIR decimator.
+ * <code>pDst</code> receives <code>8*blockSize/(R*M)</code> output samples.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The CIC output is scaled so that a PDM stream of all ones maps to full scale,
+ * saturating to 0x7FFFFFFF.  The compensation FIR stage follows the scaling rules of
+ * <code>arm_fir_decimate_q31()</code>.
+ */
+
+void arm_pdm_to_pcm_q31(
+  arm_pdm_to_pcm_instance_q31 * S,
+  uint8_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  arm_cic_decimate_instance_q31 *C = &S->cic;    /* CIC decimator stage */
+  q63_t *pInteg = C->pState;                     /* Points to the integrator states */
+  q63_t *pComb = C->pState + C->order;           /* Points to the comb delay states */
+  q63_t *pI, *pC;                                /* Temporary pointers to the stage states */
+  q63_t x, prev;                                 /* Stage input and delayed comb input */
+  q31_t *pOut = S->pScratch;                     /* Points to the CIC output */
+  uint32_t R = C->R;                             /* CIC decimation factor */
+  uint32_t phase = C->phase;                     /* Bits integrated since the last CIC output */
+  uint32_t order = C->order;                     /* Number of integrator and comb stages */
+  uint32_t lShift, rShift;                       /* Shifts from R^order to 1.31 format */
+  uint32_t in;                                   /* Current PDM byte */
+  uint32_t blkCnt, bitCnt, stageCnt;             /* Loop counters */
+
+  /* A comb output of R^order is full scale */
+  lShift = (C->shift < 31U) ? (31U - C->shift) : 0U;
+  rShift = (C->shift > 31U) ? (C->shift - 31U) : 0U;
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    bitCnt = 8U;
+
+    while (bitCnt > 0U)
+    {
+      /* Map the most significant bit to +1 or -1 */
+      x = (q63_t) ((in >> 6U) & 2U) - 1;
+      in <<= 1U;
+
+      /* Integrator section, running at the PDM rate */
+      pI = pInteg;
+      stageCnt = order;
+
+      while (stageCnt > 0U)
+      {
+        /* i[n] = i[n-1] + x[n], wrapping around modulo 2^64 */
+        x = (q63_t) ((uint64_t) *pI + (uint64_t) x);
+        *pI++ = x;
+
+        /* Decrement the loop counter */
+        stageCnt--;
+      }
+
+      phase++;
+
+      if (phase == R)
+      {
+        phase = 0U;
+
+        /* Comb section, running at the CIC output rate */
+        pC = pComb;
+        stageCnt = order;
+
+        while (stageCnt > 0U)
+        {
+          /* c[m] = y[m] - y[m-1] */
+          prev = *pC;
+          *pC++ = x;
+          x = (q63_t) ((uint64_t) x - (uint64_t) prev);
+
+          /* Decrement the loop counter */
+          stageCnt--;
+        }
+
+        /* Convert to 1.31 format and store the result in the scratch buffer */
+        *pOut++ = clip_q63_to_q31((x << lShift) >> rShift);
+      }
+
+      /* Decrement the loop counter */
+      bitCnt--;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the position within the CIC output period */
+  C->phase = phase;
+
+  /* Droop compensation and final decimation */
+  arm_fir_decimate_q31(&S->fir, S->pScratch, pDst, (uint32_t) (pOut - S->pScratch));
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_minmax_init_q15.c
+ * Description:  Q15 running minimum and maximum initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup RunningMinMax
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 running minimum and maximum filter.
+ * @param[in,out] S          points to an instance of the Q15 running minimum and maximum structure.
+ * @param[in]     windowLen  number of samples in the window.
+ * @param[in]     pState     points to the window buffer.
+ * @param[in]     pQueue     points to the queue buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> is of length <code>windowLen</code> and <code>pQueue</code> is of
+ * length <code>2*windowLen</code>.
+ */
+
+arm_status arm_running_minmax_init_q15(
+  arm_running_minmax_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState,
+  uint16_t * pQueue)
+{
+  arm_status status;
+
+  if (windowLen == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign window length */
+    S->windowLen = windowLen;
+
+    /* The oldest sample is in slot 0 */
+    S->index = 0U;
+
+    /* Clear the window */
+    memset(pState, 0, (uint32_t) windowLen * sizeof(q15_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    /* The zero samples are represented by the newest one, in the last slot */
+    pQueue[0] = windowLen - 1U;
+    pQueue[windowLen] = windowLen - 1U;
+
+    S->minHead = 0U;
+    S->minTail = (windowLen == 1U) ? 0U : 1U;
+    S->maxHead = 0U;
+    S->maxTail = S->minTail;
+
+    /* Assign queue pointer */
+    S->pQueue = pQueue;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RunningMinMax group
+ */
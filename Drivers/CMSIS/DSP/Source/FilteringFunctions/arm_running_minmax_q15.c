@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_minmax_q15.c
+ * Description:  Q15 running minimum and maximum filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup RunningMinMax
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 running minimum and maximum filter.
+ * @param[in,out] S          points to an instance of the Q15 running minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pMin       points to the block of running minimum values.
+ * @param[out]    pMax       points to the block of running maximum values.
+ * @param[in]     blockSize  number of samples to process.
+ */
+
+void arm_running_minmax_q15(
+  arm_running_minmax_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMin,
+  q15_t * pMax,
+  uint32_t blockSize)
+{
+  q15_t *pData = S->pState;                  /* Circular buffer of the window samples */
+  uint16_t *pMinQ = S->pQueue;                   /* Queue of minimum candidates */
+  uint16_t *pMaxQ = S->pQueue + S->windowLen;    /* Queue of maximum candidates */
+  q15_t in;                                  /* Input sample */
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t index = S->index;                     /* Slot of the oldest sample */
+  uint32_t minHead = S->minHead, minTail = S->minTail; /* First and past the last entries */
+  uint32_t maxHead = S->maxHead, maxTail = S->maxTail;
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* The oldest sample leaves the window */
+    if (pMinQ[minHead] == index)
+    {
+      minHead = (minHead + 1U == windowLen) ? 0U : (minHead + 1U);
+    }
+
+    if (pMaxQ[maxHead] == index)
+    {
+      maxHead = (maxHead + 1U == windowLen) ? 0U : (maxHead + 1U);
+    }
+
+    /* Drop the candidates that can no longer be the minimum or the maximum */
+    while ((minTail != minHead) &&
+           (pData[pMinQ[(minTail == 0U) ? (windowLen - 1U) : (minTail - 1U)]] >= in))
+    {
+      minTail = (minTail == 0U) ? (windowLen - 1U) : (minTail - 1U);
+    }
+
+    while ((maxTail != maxHead) &&
+           (pData[pMaxQ[(maxTail == 0U) ? (windowLen - 1U) : (maxTail - 1U)]] <= in))
+    {
+      maxTail = (maxTail == 0U) ? (windowLen - 1U) : (maxTail - 1U);
+    }
+
+    /* Store the new sample and append it to both queues */
+    pData[index] = in;
+
+    pMinQ[minTail] = (uint16_t) index;
+    minTail = (minTail + 1U == windowLen) ? 0U : (minTail + 1U);
+
+    pMaxQ[maxTail] = (uint16_t) index;
+    maxTail = (maxTail + 1U == windowLen) ? 0U : (maxTail + 1U);
+
+    /* The front of each queue is the result */
+    *pMin++ = pData[pMinQ[minHead]];
+    *pMax++ = pData[pMaxQ[maxHead]];
+
+    index = (index + 1U == windowLen) ? 0U : (index + 1U);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the queues and the slot of the oldest sample for the next call */
+  S->index = (uint16_t) index;
+  S->minHead = (uint16_t) minHead;
+  S->minTail = (uint16_t) minTail;
+  S->maxHead = (uint16_t) maxHead;
+  S->maxTail = (uint16_t) maxTail;
+}
+
+/**
+ * @} end of RunningMinMax group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bilinear_interp_block_f32.c
+ * Description:  Floating-point bilinear interpolation of a block of query points
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point bilinear interpolation of a block of query points.
+ * @param[in]  S          points to an instance of the interpolation structure.
+ * @param[in]  pX         points to the block of x coordinates.
+ * @param[in]  pY         points to the block of y coordinates.
+ * @param[out] pDst       points to the block of interpolated output values.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The coordinates follow the table layout described for the bilinear interpolation
+ * functions: element (x, y) is located at <code>pData[x + y*numCols]</code>.
+ * Points whose 2x2 neighbourhood is not completely inside the table return zero.
+ * The neighbourhood indices are clamped into the table and the zero output is applied
+ * with a conditional select, so the loop body has no data dependent branches and
+ * never reads outside of the table.
+ */
+
+void arm_bilinear_interp_block_f32(
+  const arm_bilinear_interp_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pData = S->pData;                   /* pointer to the data table */
+  int32_t nCols = (int32_t) S->numCols;          /* number of columns */
+  int32_t xMax = (int32_t) S->numCols - 2;       /* largest valid column index */
+  int32_t yMax = (int32_t) S->numRows - 2;       /* largest valid row index */
+  float32_t X, Y;                                /* interpolation coordinates */
+  float32_t f00, f01, f10, f11;                  /* neighbourhood values */
+  float32_t xdiff, ydiff;                        /* fractional parts */
+  float32_t out;                                 /* interpolated value */
+  float32_t *pRow;                               /* first row of the neighbourhood */
+  int32_t xIndex, yIndex;                        /* integer parts */
+  int32_t xI, yI;                                /* clamped integer parts */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    X = *pX++;
+    Y = *pY++;
+
+    xIndex = (int32_t) X;
+    yIndex = (int32_t) Y;
+
+    /* Clamp the neighbourhood into the table */
+    xI = (xIndex < 0) ? 0 : xIndex;
+    yI = (yIndex < 0) ? 0 : yIndex;
+    xI = (xI > xMax) ? xMax : xI;
+    yI = (yI > yMax) ? yMax : yI;
+
+    /* Read the 2x2 neighbourhood */
+    pRow = pData + xI + (yI * nCols);
+    f00 = pRow[0];
+    f01 = pRow[1];
+    f10 = pRow[nCols];
+    f11 = pRow[nCols + 1];
+
+    /* Calculation of fractional parts */
+    xdiff = X - (float32_t) xIndex;
+    ydiff = Y - (float32_t) yIndex;
+
+    /* Calculation of bi-linear interpolated output */
+    out = f00 + (f01 - f00) * xdiff + (f10 - f00) * ydiff + (f00 - f01 - f10 + f11) * xdiff * ydiff;
+
+    /* Zero output outside of the table */
+    out = ((X < 0.0f) || (xIndex > xMax)) ? 0.0f : out;
+    out = ((Y < 0.0f) || (yIndex > yMax)) ? 0.0f : out;
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bilinear_interp_block_q31.c
+ * Description:  Q31 bilinear interpolation of a block of query points
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q31 bilinear interpolation of a block of query points.
+ * @param[in]  S          points to an instance of the interpolation structure.
+ * @param[in]  pX         points to the block of x coordinates in 12.20 format.
+ * @param[in]  pY         points to the block of y coordinates in 12.20 format.
+ * @param[out] pDst       points to the block of interpolated output values.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Inside the table each output is bit exact with <code>arm_bilinear_interp_q31()</code>.
+ * \par
+ * The coordinates follow the table layout described for the bilinear interpolation
+ * functions: element (x, y) is located at <code>pData[x + y*numCols]</code>.
+ * Points whose 2x2 neighbourhood is not completely inside the table return zero.
+ * The neighbourhood indices are clamped into the table and the zero output is applied
+ * with a conditional select, so the loop body has no data dependent branches and
+ * never reads outside of the table.
+ */
+
+void arm_bilinear_interp_block_q31(
+  const arm_bilinear_interp_instance_q31 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pYData = S->pData;                      /* pointer to output table values */
+  int32_t nCols = (int32_t) S->numCols;          /* number of columns */
+  int32_t xMax = (int32_t) S->numCols - 2;       /* largest valid column index */
+  int32_t yMax = (int32_t) S->numRows - 2;       /* largest valid row index */
+  q31_t *pRow;                                   /* first row of the neighbourhood */
+  q31_t x1, x2, y1, y2;                          /* Nearest output values */
+  q31_t acc, tmp, out;                           /* accumulator, partial product and output */
+  q31_t X, Y;                                    /* interpolation coordinates */
+  q31_t xfract, yfract;                          /* X, Y fractional parts */
+  int32_t rI, cI;                                /* Column and row indices */
+  int32_t xI, yI;                                /* clamped indices */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    X = *pX++;
+    Y = *pY++;
+
+    /* Input is in 12.20 format, 12 bits for the table index */
+    rI = X >> 20;
+    cI = Y >> 20;
+
+    /* Clamp the neighbourhood into the table */
+    xI = (rI < 0) ? 0 : rI;
+    yI = (cI < 0) ? 0 : cI;
+    xI = (xI > xMax) ? xMax : xI;
+    yI = (yI > yMax) ? yMax : yI;
+
+    /* Read the 2x2 neighbourhood */
+    pRow = pYData + xI + (yI * nCols);
+    x1 = pRow[0];
+    x2 = pRow[1];
+    y1 = pRow[nCols];
+    y2 = pRow[nCols + 1];
+
+    /* 20 bits for the fractional part, shift left by 11 to keep 1.31 format */
+    xfract = (X & 0x000FFFFF) << 11U;
+    yfract = (Y & 0x000FFFFF) << 11U;
+
+    /* x1 * (1-xfract) * (1-yfract) in 3.29(q29) format */
+    acc = ((q31_t) (((q63_t) x1  * (0x7FFFFFFF - xfract)) >> 32));
+    acc = ((q31_t) (((q63_t) acc * (0x7FFFFFFF - yfract)) >> 32));
+
+    /* x2 * (xfract) * (1-yfract) in 3.29(q29) and adding to acc */
+    tmp = ((q31_t) ((q63_t) x2 * (0x7FFFFFFF - yfract) >> 32));
+    acc += ((q31_t) ((q63_t) tmp * (xfract) >> 32));
+
+    /* y1 * (1 - xfract) * (yfract) in 3.29(q29) and adding to acc */
+    tmp = ((q31_t) ((q63_t) y1 * (0x7FFFFFFF - xfract) >> 32));
+    acc += ((q31_t) ((q63_t) tmp * (yfract) >> 32));
+
+    /* y2 * (xfract) * (yfract) in 3.29(q29) and adding to acc */
+    tmp = ((q31_t) ((q63_t) y2 * (xfract) >> 32));
+    acc += ((q31_t) ((q63_t) tmp * (yfract) >> 32));
+
+    /* Convert acc to 1.31(q31) format */
+    out = (q31_t) (acc << 2);
+
+    /* Zero output outside of the table */
+    out = ((rI < 0) || (rI > xMax)) ? 0 : out;
+    out = ((cI < 0) || (cI > yMax)) ? 0 : out;
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
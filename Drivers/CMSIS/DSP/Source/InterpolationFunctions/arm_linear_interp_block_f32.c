@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_f32.c
+ * Description:  Floating-point linear interpolation of a block of query points
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point linear interpolation of a block of query points.
+ * @param[in]  S          points to an instance of the floating-point Linear Interpolation structure.
+ * @param[in]  pSrc       points to the block of input x values.
+ * @param[out] pDst       points to the block of interpolated output values.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The block function produces the same result as calling <code>arm_linear_interp_f32()</code>
+ * once per input value, up to floating-point rounding, but the reciprocal of
+ * <code>xSpacing</code> is computed once per call and the table index is clamped
+ * with conditional selects instead of branches.
+ * Input values below the table range return the first table value and input values
+ * at or above the last table entry return the last table value.
+ * The table must contain at least two values.
+ */
+
+void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pYData = S->pYData;                 /* pointer to output table */
+  float32_t x1 = S->x1;                          /* first input value of the table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* reciprocal of the spacing between input values */
+  float32_t tMax = (float32_t) (S->nValues - 1U); /* largest normalised table position */
+  int32_t iMax = (int32_t) S->nValues - 2;       /* largest index of the left neighbour */
+  float32_t t, fract, y0;                        /* normalised position, fractional part, left value */
+  int32_t i;                                     /* index of the left neighbour */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t t1, t2, t3, t4;                      /* normalised positions */
+  float32_t f1, f2, f3, f4;                      /* fractional parts */
+  float32_t a1, a2, a3, a4;                      /* left neighbours */
+  int32_t i1, i2, i3, i4;                        /* left neighbour indices */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Normalise the four input values to table positions */
+    t1 = (pSrc[0] - x1) * invSpacing;
+    t2 = (pSrc[1] - x1) * invSpacing;
+    t3 = (pSrc[2] - x1) * invSpacing;
+    t4 = (pSrc[3] - x1) * invSpacing;
+
+    /* Saturate the positions to the table range */
+    t1 = (t1 < 0.0f) ? 0.0f : t1;
+    t2 = (t2 < 0.0f) ? 0.0f : t2;
+    t3 = (t3 < 0.0f) ? 0.0f : t3;
+    t4 = (t4 < 0.0f) ? 0.0f : t4;
+    t1 = (t1 > tMax) ? tMax : t1;
+    t2 = (t2 > tMax) ? tMax : t2;
+    t3 = (t3 > tMax) ? tMax : t3;
+    t4 = (t4 > tMax) ? tMax : t4;
+
+    /* Index of the left neighbour, the last segment absorbs t == tMax */
+    i1 = (int32_t) t1;
+    i2 = (int32_t) t2;
+    i3 = (int32_t) t3;
+    i4 = (int32_t) t4;
+    i1 = (i1 > iMax) ? iMax : i1;
+    i2 = (i2 > iMax) ? iMax : i2;
+    i3 = (i3 > iMax) ? iMax : i3;
+    i4 = (i4 > iMax) ? iMax : i4;
+
+    /* Fractional distance from the left neighbour */
+    f1 = t1 - (float32_t) i1;
+    f2 = t2 - (float32_t) i2;
+    f3 = t3 - (float32_t) i3;
+    f4 = t4 - (float32_t) i4;
+
+    /* Read the left neighbours */
+    a1 = pYData[i1];
+    a2 = pYData[i2];
+    a3 = pYData[i3];
+    a4 = pYData[i4];
+
+    /* y = y0 + fract * (y1 - y0) */
+    pDst[0] = a1 + f1 * (pYData[i1 + 1] - a1);
+    pDst[1] = a2 + f2 * (pYData[i2 + 1] - a2);
+    pDst[2] = a3 + f3 * (pYData[i3 + 1] - a3);
+    pDst[3] = a4 + f4 * (pYData[i4 + 1] - a4);
+
+    /* update pointers to process next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Normalise the input value to a table position and saturate it */
+    t = (*pSrc++ - x1) * invSpacing;
+    t = (t < 0.0f) ? 0.0f : t;
+    t = (t > tMax) ? tMax : t;
+
+    /* Index of the left neighbour and fractional distance from it */
+    i = (int32_t) t;
+    i = (i > iMax) ? iMax : i;
+    fract = t - (float32_t) i;
+
+    /* y = y0 + fract * (y1 - y0) */
+    y0 = pYData[i];
+    *pDst++ = y0 + fract * (pYData[i + 1] - y0);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
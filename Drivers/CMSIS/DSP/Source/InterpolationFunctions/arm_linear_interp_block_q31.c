@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_q31.c
+ * Description:  Q31 linear interpolation of a block of query points
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q31 linear interpolation of a block of query points.
+ * @param[in]  pYData     points to the Q31 Linear Interpolation table.
+ * @param[in]  nValues    number of table values.
+ * @param[in]  pSrc       points to the block of input x values in 12.20 format.
+ * @param[out] pDst       points to the block of interpolated output values.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Each output is bit exact with <code>arm_linear_interp_q31()</code> for the same input.
+ * The neighbour index is clamped into the table and the out of range cases saturate to
+ * the first or last table value through conditional selects, so the loop body has no
+ * data dependent branches and never reads outside of the table.
+ * The table must contain at least two values.
+ */
+
+void arm_linear_interp_block_q31(
+  q31_t * pYData,
+  uint32_t nValues,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t yFirst = pYData[0];                      /* output below the table range */
+  q31_t yLast = pYData[nValues - 1U];            /* output above the table range */
+  int32_t iLast = (int32_t) nValues - 1;         /* first out of range index */
+  int32_t iMax = (int32_t) nValues - 2;          /* largest index of the left neighbour */
+  q31_t x, y, fract;                             /* input, output and fractional part */
+  int32_t index, i;                              /* table index and clamped table index */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t x1, x2;                                  /* inputs */
+  q31_t y1, y2;                                  /* outputs */
+  q31_t f1, f2;                                  /* fractional parts */
+  int32_t n1, n2, i1, i2;                        /* table indices */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 1U;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while (blkCnt > 0U)
+  {
+    x1 = *pSrc++;
+    x2 = *pSrc++;
+
+    /* Input is in 12.20 format, 12 bits for the table index */
+    n1 = x1 >> 20;
+    n2 = x2 >> 20;
+
+    /* Clamp the left neighbour into the table */
+    i1 = (n1 < 0) ? 0 : n1;
+    i2 = (n2 < 0) ? 0 : n2;
+    i1 = (i1 > iMax) ? iMax : i1;
+    i2 = (i2 > iMax) ? iMax : i2;
+
+    /* 20 bits for the fractional part, shift left by 11 to keep fract in 1.31 format */
+    f1 = (x1 & 0x000FFFFF) << 11;
+    f2 = (x2 & 0x000FFFFF) << 11;
+
+    /* y0 * (1 - fract) + y1 * fract in 2.30 format */
+    y1  = (q31_t) (((q63_t) pYData[i1    ] * (0x7FFFFFFF - f1)) >> 32);
+    y2  = (q31_t) (((q63_t) pYData[i2    ] * (0x7FFFFFFF - f2)) >> 32);
+    y1 += (q31_t) (((q63_t) pYData[i1 + 1] * f1) >> 32);
+    y2 += (q31_t) (((q63_t) pYData[i2 + 1] * f2) >> 32);
+
+    /* Convert to 1.31 format */
+    y1 = y1 << 1U;
+    y2 = y2 << 1U;
+
+    /* Saturate to the end points of the table */
+    y1 = (n1 < 0) ? yFirst : y1;
+    y2 = (n2 < 0) ? yFirst : y2;
+    y1 = (n1 >= iLast) ? yLast : y1;
+    y2 = (n2 >= iLast) ? yLast : y2;
+
+    *pDst++ = y1;
+    *pDst++ = y2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    /* Input is in 12.20 format, 12 bits for the table index */
+    index = x >> 20;
+
+    /* Clamp the left neighbour into the table */
+    i = (index < 0) ? 0 : index;
+    i = (i > iMax) ? iMax : i;
+
+    /* 20 bits for the fractional part, shift left by 11 to keep fract in 1.31 format */
+    fract = (x & 0x000FFFFF) << 11;
+
+    /* y0 * (1 - fract) + y1 * fract in 2.30 format */
+    y  = (q31_t) (((q63_t) pYData[i    ] * (0x7FFFFFFF - fract)) >> 32);
+    y += (q31_t) (((q63_t) pYData[i + 1] * fract) >> 32);
+
+    /* Convert to 1.31 format */
+    y = y << 1U;
+
+    /* Saturate to the end points of the table */
+    y = (index < 0) ? yFirst : y;
+    y = (index >= iLast) ? yLast : y;
+
+    *pDst++ = y;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_stride_q15.c
+ * Description:  Q15 linear interpolation at uniformly spaced points
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q15 linear interpolation at uniformly spaced query points.
+ * @param[in]  pYData     points to the Q15 Linear Interpolation table.
+ * @param[in]  nValues    number of table values.
+ * @param[in]  xStart     first query point in 12.20 format.
+ * @param[in]  xStep      distance between consecutive query points in 12.20 format.
+ * @param[out] pDst       points to the block of interpolated output values.
+ * @param[in]  blockSize  number of samples to produce.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = arm_linear_interp_q15(pYData, xStart + n * xStep, nValues)</code>
+ * for <code>0 <= n < blockSize</code> and is bit exact with it.
+ * Because the query points are monotonic, the block splits into at most three
+ * runs: points before the table, points inside the table and points past the table.
+ * The run lengths are computed once per call, the outer runs are filled with the
+ * saturated end values and the inner run is interpolated without any range checks.
+ * <code>xStart + (blockSize - 1) * xStep</code> must be representable in 12.20 format
+ * and the table must contain at least two values.
+ */
+
+void arm_linear_interp_stride_q15(
+  q15_t * pYData,
+  uint32_t nValues,
+  q31_t xStart,
+  q31_t xStep,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t xMax = (q63_t) (nValues - 1U) << 20;     /* first position past the interpolated range */
+  q63_t xBody;                                   /* first position of the inner run */
+  q63_t nRun;                                    /* unclipped run length */
+  q15_t headVal, tailVal;                        /* saturated outputs before and after the inner run */
+  q63_t y;                                       /* output */
+  q31_t x, fract;                                /* position and fractional part */
+  int32_t index;                                 /* table index */
+  uint32_t nHead, nBody;                         /* lengths of the outer and inner runs */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Length of the leading run outside of the table */
+  if (xStep >= 0)
+  {
+    headVal = pYData[0];
+    tailVal = pYData[nValues - 1U];
+    nRun = (xStart >= 0) ? 0 : ((xStep == 0) ? (q63_t) blockSize :
+           (((-(q63_t) xStart) + xStep - 1) / xStep));
+  }
+  else
+  {
+    headVal = pYData[nValues - 1U];
+    tailVal = pYData[0];
+    nRun = ((q63_t) xStart < xMax) ? 0 :
+           ((((q63_t) xStart - xMax) / (-(q63_t) xStep)) + 1);
+  }
+  nHead = (nRun > (q63_t) blockSize) ? blockSize : (uint32_t) nRun;
+
+  /* Length of the inner run */
+  xBody = (q63_t) xStart + (q63_t) nHead * xStep;
+  if ((xBody < 0) || (xBody >= xMax))
+  {
+    nRun = 0;
+  }
+  else if (xStep > 0)
+  {
+    nRun = (xMax - xBody + xStep - 1) / xStep;
+  }
+  else if (xStep < 0)
+  {
+    nRun = (xBody / (-(q63_t) xStep)) + 1;
+  }
+  else
+  {
+    nRun = (q63_t) blockSize;
+  }
+  nBody = (nRun > (q63_t) (blockSize - nHead)) ? (blockSize - nHead) : (uint32_t) nRun;
+
+  /* Leading run saturates to one end of the table */
+  blkCnt = nHead;
+  while (blkCnt > 0U)
+  {
+    *pDst++ = headVal;
+    blkCnt--;
+  }
+
+  /* Inner run, every position lies inside the table */
+  x = (q31_t) xBody;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  {
+    q31_t x2;                                    /* second position */
+    q63_t y2;                                    /* second output */
+    q31_t f2;                                    /* second fractional part */
+    int32_t i2;                                  /* second table index */
+
+    /* loop Unrolling */
+    blkCnt = nBody >> 1U;
+
+    /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+     ** a second loop below computes the remaining sample. */
+    while (blkCnt > 0U)
+    {
+      x2 = x + xStep;
+
+      /* Input is in 12.20 format, 12 bits for the table index */
+      index = x >> 20;
+      i2 = x2 >> 20;
+
+      /* 20 bits for the fractional part, fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
+      f2 = (x2 & 0x000FFFFF);
+
+      /* y0 * (1 - fract) + y1 * fract in 13.35 format */
+      y  = ((q63_t) pYData[index    ] * (0xFFFFF - fract));
+      y2 = ((q63_t) pYData[i2       ] * (0xFFFFF - f2));
+      y  += ((q63_t) pYData[index + 1] * fract);
+      y2 += ((q63_t) pYData[i2 + 1   ] * f2);
+
+      /* Convert to 1.15 format */
+      *pDst++ = (q15_t) (y >> 20);
+      *pDst++ = (q15_t) (y2 >> 20);
+
+      /* Advance to the next pair of query points */
+      x = x2 + xStep;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the inner run length is not a multiple of 2, compute the remaining output sample here.
+     ** No loop unrolling is used. */
+    blkCnt = nBody % 0x2U;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = nBody;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Input is in 12.20 format, 12 bits for the table index */
+    index = x >> 20;
+
+    /* 20 bits for the fractional part, fract is in 12.20 format */
+    fract = (x & 0x000FFFFF);
+
+    /* y0 * (1 - fract) + y1 * fract in 13.35 format */
+    y  = ((q63_t) pYData[index    ] * (0xFFFFF - fract));
+    y += ((q63_t) pYData[index + 1] * fract);
+
+    /* Convert to 1.15 format */
+    *pDst++ = (q15_t) (y >> 20);
+
+    /* Advance to the next query point */
+    x += xStep;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Trailing run saturates to the other end of the table */
+  blkCnt = blockSize - nHead - nBody;
+  while (blkCnt > 0U)
+  {
+    *pDst++ = tailVal;
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
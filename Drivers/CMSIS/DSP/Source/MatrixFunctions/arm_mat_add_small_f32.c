@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_add_small_f32.c
+ * Description:  Fixed-size floating-point matrix addition for 2x2 to 6x6 matrices
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSmall
+ * @{
+ */
+
+/* pDst = pSrcA + pSrcB, NN = N * N elements */
+#define ARM_MAT_ADD_SMALL_F32(N, NN)                                            \
+void arm_mat_add_##N##x##N##_f32(                                               \
+  const float32_t * pSrcA,                                                      \
+  const float32_t * pSrcB,                                                      \
+  float32_t * pDst)                                                             \
+{                                                                               \
+  uint32_t i;                                                                   \
+                                                                                \
+  for (i = 0U; i < NN; i++)                                                     \
+  {                                                                             \
+    pDst[i] = pSrcA[i] + pSrcB[i];                                              \
+  }                                                                             \
+}
+
+ARM_MAT_ADD_SMALL_F32(2, 4)
+ARM_MAT_ADD_SMALL_F32(3, 9)
+ARM_MAT_ADD_SMALL_F32(4, 16)
+ARM_MAT_ADD_SMALL_F32(5, 25)
+ARM_MAT_ADD_SMALL_F32(6, 36)
+
+/**
+ * @} end of MatrixSmall group
+ */
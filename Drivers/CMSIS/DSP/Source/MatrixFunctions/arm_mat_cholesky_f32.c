@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDLT Decompositions
+ *
+ * Decomposes a symmetric matrix into triangular factors.
+ *
+ * The Cholesky decomposition of a symmetric positive definite matrix A is
+ * <pre>
+ *     A = L * L'
+ * </pre>
+ * where L is lower triangular with a positive diagonal.  The LDLT decomposition
+ * also applies to positive semi-definite and to some indefinite matrices:
+ * <pre>
+ *     P * A * P' = L * D * L'
+ * </pre>
+ * where L is lower triangular with a unit diagonal, D is diagonal and P is the
+ * permutation that puts the largest remaining diagonal element first at each step.
+ *
+ * With the triangular solvers of the \ref MatrixSolve group, a system
+ * <code>A * X = B</code> is solved without forming the inverse of A:
+ * <code>L * Y = B</code> then <code>L' * X = Y</code>.  The decomposition needs about a third
+ * of the operations of arm_mat_inverse_f32() and is numerically more stable, which makes it
+ * the preferred way to compute the gain of a Kalman filter.
+ *
+ * Only the lower triangle of the source matrix is read and the functions check that the
+ * matrices are square and of the same size.  If the matrix is not positive definite the
+ * Cholesky decomposition returns <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+ * @param[in]       *pSrc points to the instance of the input floating-point matrix structure.
+ * @param[out]      *pDst points to the instance of the output floating-point matrix structure.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The output is the lower triangular factor L, the upper triangle is set to zero.
+ * The decomposition can be computed in place, with <code>pDst->pData</code> equal to
+ * <code>pSrc->pData</code>.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pAi, *pLi, *pLj;                    /* row pointers */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j;                                 /* loop counters */
+  float32_t sum;                                 /* dot product of the factor rows */
+  float32_t diag;                                /* diagonal element of the factor */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Cholesky-Banachiewicz: the factor is computed row by row, so that the dot
+     * products run over contiguous rows.  L(i,j) only depends on A(i,j) and on
+     * the factor elements on its left and above, so the output can overwrite the input. */
+    for (i = 0U; i < n; i++)
+    {
+      pAi = pA + i * n;
+      pLi = pL + i * n;
+
+      for (j = 0U; j <= i; j++)
+      {
+        pLj = pL + j * n;
+
+        /* sum = L(i,0:j-1) . L(j,0:j-1) */
+        arm_dot_prod_f32(pLi, pLj, j, &sum);
+
+        sum = pAi[j] - sum;
+
+        if (j == i)
+        {
+          /* The pivot must be positive */
+          if (sum <= 0.0f)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+
+          arm_sqrt_f32(sum, &diag);
+          pLi[i] = diag;
+        }
+        else
+        {
+          pLi[j] = sum / pLj[j];
+        }
+      }
+
+      /* Clear the upper triangle */
+      for (j = i + 1U; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f64.c
+ * Description:  Double precision Cholesky decomposition
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Double precision Cholesky decomposition of a symmetric positive definite matrix.
+ * @param[in]       *pSrc points to the instance of the input double precision matrix structure.
+ * @param[out]      *pDst points to the instance of the output double precision matrix structure.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The output is the lower triangular factor L, the upper triangle is set to zero.
+ * The decomposition can be computed in place, with <code>pDst->pData</code> equal to
+ * <code>pSrc->pData</code>.
+ */
+
+arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float64_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float64_t *pAi, *pLi, *pLj;                    /* row pointers */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  float64_t sum;                                 /* dot product of the factor rows */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Cholesky-Banachiewicz, see arm_mat_cholesky_f32() */
+    for (i = 0U; i < n; i++)
+    {
+      pAi = pA + i * n;
+      pLi = pL + i * n;
+
+      for (j = 0U; j <= i; j++)
+      {
+        pLj = pL + j * n;
+
+        /* sum = A(i,j) - L(i,0:j-1) . L(j,0:j-1) */
+        sum = pAi[j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pLi[k] * pLj[k];
+        }
+
+        if (j == i)
+        {
+          /* The pivot must be positive */
+          if (sum <= 0.0)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+
+          pLi[i] = sqrt(sum);
+        }
+        else
+        {
+          pLi[j] = sum / pLj[j];
+        }
+      }
+
+      /* Clear the upper triangle */
+      for (j = i + 1U; j < n; j++)
+      {
+        pLi[j] = 0.0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_small_f32.c
+ * Description:  Fixed-size floating-point matrix inverse for 2x2 to 6x6 matrices
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSmall
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 matrix inverse.
+ * @param[in]       *pSrc points to the 4 elements of the input matrix
+ * @param[out]      *pDst points to the 4 elements of the output matrix, can be the same as pSrc
+ * @return     		The function returns <code>ARM_MATH_SINGULAR</code> if the determinant
+ * is zero, <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_inverse_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a0 = pSrc[0], a1 = pSrc[1];          /* input matrix */
+  float32_t a2 = pSrc[2], a3 = pSrc[3];
+  float32_t det;                                 /* determinant */
+
+  det = a0 * a3 - a1 * a2;
+
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  det = 1.0f / det;
+
+  /* Adjugate divided by the determinant */
+  pDst[0] = a3 * det;
+  pDst[1] = -a1 * det;
+  pDst[2] = -a2 * det;
+  pDst[3] = a0 * det;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 3x3 matrix inverse.
+ * @param[in]       *pSrc points to the 9 elements of the input matrix
+ * @param[out]      *pDst points to the 9 elements of the output matrix, can be the same as pSrc
+ * @return     		The function returns <code>ARM_MATH_SINGULAR</code> if the determinant
+ * is zero, <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a0 = pSrc[0], a1 = pSrc[1], a2 = pSrc[2]; /* input matrix */
+  float32_t a3 = pSrc[3], a4 = pSrc[4], a5 = pSrc[5];
+  float32_t a6 = pSrc[6], a7 = pSrc[7], a8 = pSrc[8];
+  float32_t c0, c1, c2;                          /* cofactors of the first row */
+  float32_t det;                                 /* determinant */
+
+  c0 = a4 * a8 - a5 * a7;
+  c1 = a5 * a6 - a3 * a8;
+  c2 = a3 * a7 - a4 * a6;
+
+  det = a0 * c0 + a1 * c1 + a2 * c2;
+
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  det = 1.0f / det;
+
+  /* Adjugate divided by the determinant */
+  pDst[0] = c0 * det;
+  pDst[1] = (a2 * a7 - a1 * a8) * det;
+  pDst[2] = (a1 * a5 - a2 * a4) * det;
+  pDst[3] = c1 * det;
+  pDst[4] = (a0 * a8 - a2 * a6) * det;
+  pDst[5] = (a2 * a3 - a0 * a5) * det;
+  pDst[6] = c2 * det;
+  pDst[7] = (a1 * a6 - a0 * a7) * det;
+  pDst[8] = (a0 * a4 - a1 * a3) * det;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* Gauss-Jordan elimination with partial pivoting on a local copy of the input,
+ * with the size as a constant so that all the loops have fixed trip counts */
+#define ARM_MAT_INVERSE_SMALL_F32(N)                                            \
+arm_status arm_mat_inverse_##N##x##N##_f32(                                     \
+  const float32_t * pSrc,                                                       \
+  float32_t * pDst)                                                             \
+{                                                                               \
+  float32_t m[N * N];                                                           \
+  float32_t maxVal, inv, f, t;                                                  \
+  uint32_t r, c, j, p;                                                          \
+                                                                                \
+  for (j = 0U; j < N * N; j++)                                                  \
+  {                                                                             \
+    m[j] = pSrc[j];                                                             \
+  }                                                                             \
+                                                                                \
+  for (j = 0U; j < N * N; j++)                                                  \
+  {                                                                             \
+    pDst[j] = ((j % (N + 1U)) == 0U) ? 1.0f : 0.0f;                             \
+  }                                                                             \
+                                                                                \
+  for (c = 0U; c < N; c++)                                                      \
+  {                                                                             \
+    /* Pivot: largest element of column c on or below the diagonal */          \
+    p = c;                                                                      \
+    maxVal = fabsf(m[c * N + c]);                                               \
+                                                                                \
+    for (r = c + 1U; r < N; r++)                                                \
+    {                                                                           \
+      if (fabsf(m[r * N + c]) > maxVal)                                         \
+      {                                                                         \
+        maxVal = fabsf(m[r * N + c]);                                           \
+        p = r;                                                                  \
+      }                                                                         \
+    }                                                                           \
+                                                                                \
+    if (maxVal == 0.0f)                                                         \
+    {                                                                           \
+      return (ARM_MATH_SINGULAR);                                               \
+    }                                                                           \
+                                                                                \
+    if (p != c)                                                                 \
+    {                                                                           \
+      for (j = 0U; j < N; j++)                                                  \
+      {                                                                         \
+        t = m[c * N + j];                                                       \
+        m[c * N + j] = m[p * N + j];                                            \
+        m[p * N + j] = t;                                                       \
+                                                                                \
+        t = pDst[c * N + j];                                                    \
+        pDst[c * N + j] = pDst[p * N + j];                                      \
+        pDst[p * N + j] = t;                                                    \
+      }                                                                         \
+    }                                                                           \
+                                                                                \
+    /* Normalize the pivot row */                                               \
+    inv = 1.0f / m[c * N + c];                                                  \
+                                                                                \
+    for (j = 0U; j < N; j++)                                                    \
+    {                                                                           \
+      m[c * N + j] *= inv;                                                      \
+      pDst[c * N + j] *= inv;                                                   \
+    }                                                                           \
+                                                                                \
+    /* Eliminate column c from the other rows */                                \
+    for (r = 0U; r < N; r++)                                                    \
+    {                                                                           \
+      f = m[r * N + c];                                                         \
+                                                                                \
+      if ((r != c) && (f != 0.0f))                                              \
+      {                                                                         \
+        for (j = 0U; j < N; j++)                                                \
+        {                                                                       \
+          m[r * N + j] -= f * m[c * N + j];                                     \
+          pDst[r * N + j] -= f * pDst[c * N + j];                               \
+        }                                                                       \
+      }                                                                         \
+    }                                                                           \
+  }                                                                             \
+                                                                                \
+  return (ARM_MATH_SUCCESS);                                                    \
+}
+
+ARM_MAT_INVERSE_SMALL_F32(4)
+ARM_MAT_INVERSE_SMALL_F32(5)
+ARM_MAT_INVERSE_SMALL_F32(6)
+
+/**
+ * @} end of MatrixSmall group
+ */
@@ -0,0 +1,215 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f32.c
+ * Description:  Floating-point LDLT decomposition with diagonal pivoting
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDLT decomposition of a symmetric matrix.
+ * @param[in]       *pSrc points to the instance of the input floating-point matrix structure.
+ * @param[out]      *pl   points to the instance of the output unit lower triangular matrix L.
+ * @param[out]      *pd   points to the instance of the output diagonal matrix D.
+ * @param[out]      *pp   points to the permutation vector of length <code>numRows</code>.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the sizes
+ * of the output matrices do not match the size of the input matrix.
+ * If the decomposition does not exist, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The outputs satisfy <code>A(pp[i],pp[j]) = (L * D * L')(i,j)</code>.  No square root is
+ * computed, and a positive semi-definite matrix of rank r gives r non-zero elements on the
+ * diagonal of D followed by zeros.  An indefinite matrix is decomposed unless all the
+ * remaining diagonal elements become zero while the remaining submatrix is not, as for
+ * <code>[0 1; 1 0]</code>.
+ * \par
+ * The decomposition is computed in <code>pl</code>, which can be the input matrix itself.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pd,
+  uint16_t * pp)
+{
+  float32_t *pA = pl->pData;                     /* working matrix, becomes L */
+  float32_t *pD = pd->pData;                     /* diagonal matrix pointer */
+  float32_t *pAk, *pAm, *pAi;                    /* row pointers */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, m;                           /* loop counters and pivot index */
+  uint16_t idx;                                  /* permutation swap temporary */
+  float32_t maxVal, pivot, invPivot;             /* pivot search and pivot */
+  float32_t lik, t;                              /* multipliers and swap temporary */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pl->numRows != pl->numCols)
+     || (pd->numRows != pd->numCols) || (pSrc->numRows != pl->numRows)
+     || (pSrc->numRows != pd->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Work on a full symmetric copy so that rows and columns can be swapped */
+    for (i = 0U; i < n; i++)
+    {
+      pp[i] = (uint16_t) i;
+
+      for (j = 0U; j <= i; j++)
+      {
+        t = pSrc->pData[i * n + j];
+        pA[i * n + j] = t;
+        pA[j * n + i] = t;
+      }
+    }
+
+    for (k = 0U; k < n; k++)
+    {
+      pAk = pA + k * n;
+
+      /* Largest remaining diagonal element */
+      m = k;
+      maxVal = fabsf(pAk[k]);
+
+      for (i = k + 1U; i < n; i++)
+      {
+        if (fabsf(pA[i * n + i]) > maxVal)
+        {
+          maxVal = fabsf(pA[i * n + i]);
+          m = i;
+        }
+      }
+
+      /* The remaining submatrix must be zero if its diagonal is */
+      if (maxVal == 0.0f)
+      {
+        for (i = k; i < n; i++)
+        {
+          for (j = k; j < n; j++)
+          {
+            if (pA[i * n + j] != 0.0f)
+            {
+              return (ARM_MATH_DECOMPOSITION_FAILURE);
+            }
+          }
+        }
+
+        break;
+      }
+
+      /* Symmetric exchange of the rows and columns k and m */
+      if (m != k)
+      {
+        pAm = pA + m * n;
+
+        for (j = 0U; j < n; j++)
+        {
+          t = pAk[j];
+          pAk[j] = pAm[j];
+          pAm[j] = t;
+        }
+
+        for (i = 0U; i < n; i++)
+        {
+          t = pA[i * n + k];
+          pA[i * n + k] = pA[i * n + m];
+          pA[i * n + m] = t;
+        }
+
+        idx = pp[k];
+        pp[k] = pp[m];
+        pp[m] = idx;
+      }
+
+      pivot = pAk[k];
+      invPivot = 1.0f / pivot;
+
+      /* Column k of L */
+      for (i = k + 1U; i < n; i++)
+      {
+        pA[i * n + k] *= invPivot;
+      }
+
+      /* Rank one update of the lower triangle of the remaining submatrix, mirrored
+       * to the upper triangle for the next exchanges */
+      for (i = k + 1U; i < n; i++)
+      {
+        pAi = pA + i * n;
+        lik = pAi[k] * pivot;
+
+        for (j = k + 1U; j <= i; j++)
+        {
+          pAi[j] -= lik * pA[j * n + k];
+          pA[j * n + i] = pAi[j];
+        }
+      }
+    }
+
+    /* Split the result into D and the unit lower triangular L */
+    for (i = 0U; i < n; i++)
+    {
+      pAi = pA + i * n;
+
+      for (j = 0U; j < n; j++)
+      {
+        pD[i * n + j] = 0.0f;
+      }
+
+      pD[i * n + i] = pAi[i];
+      pAi[i] = 1.0f;
+
+      for (j = i + 1U; j < n; j++)
+      {
+        pAi[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_small_f32.c
+ * Description:  Fixed-size floating-point matrix products for 2x2 to 6x6 matrices
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSmall Small Fixed-Size Matrix Kernels
+ *
+ * Products, sums and inverses of square matrices of 2x2 to 6x6 elements, as used
+ * in attitude estimation and sensor fusion filters.
+ *
+ * For such sizes the loop control, the size checks and the remainder loops of
+ * arm_mat_mult_f32() cost as much as the arithmetic.  These kernels exist in one
+ * version per size, named after it, for example arm_mat_mult_3x3_f32(): the size is
+ * a compile time constant, the inner products are written out in full and the
+ * remaining loops have constant trip counts.  They operate on the row-major data
+ * arrays directly and do not check sizes.
+ *
+ * The functions available for N = 2, 3, 4, 5 and 6 are:
+ * - <code>arm_mat_mult_NxN_f32(pSrcA, pSrcB, pDst)</code>: pDst = pSrcA * pSrcB
+ * - <code>arm_mat_mult_trans_NxN_f32(pSrcA, pSrcB, pDst)</code>: pDst = pSrcA * pSrcB'
+ * - <code>arm_mat_vec_mult_NxN_f32(pSrcA, pVec, pDst)</code>: pDst = pSrcA * pVec
+ * - <code>arm_mat_add_NxN_f32(pSrcA, pSrcB, pDst)</code>: pDst = pSrcA + pSrcB
+ * - <code>arm_mat_inverse_NxN_f32(pSrc, pDst)</code>: pDst = inv(pSrc)
+ *
+ * The output of the products must not overlap the inputs.  The sum and the
+ * inverse can be computed in place, and the inverse does not modify its input,
+ * unlike arm_mat_inverse_f32().
+ */
+
+/**
+ * @addtogroup MatrixSmall
+ * @{
+ */
+
+/* Inner product of N elements read with strides sa and sb */
+#define ARM_MAT_DOT_2(a, sa, b, sb) \
+  ((a)[0] * (b)[0] + (a)[(sa)] * (b)[(sb)])
+#define ARM_MAT_DOT_3(a, sa, b, sb) \
+  (ARM_MAT_DOT_2(a, sa, b, sb) + (a)[2 * (sa)] * (b)[2 * (sb)])
+#define ARM_MAT_DOT_4(a, sa, b, sb) \
+  (ARM_MAT_DOT_3(a, sa, b, sb) + (a)[3 * (sa)] * (b)[3 * (sb)])
+#define ARM_MAT_DOT_5(a, sa, b, sb) \
+  (ARM_MAT_DOT_4(a, sa, b, sb) + (a)[4 * (sa)] * (b)[4 * (sb)])
+#define ARM_MAT_DOT_6(a, sa, b, sb) \
+  (ARM_MAT_DOT_5(a, sa, b, sb) + (a)[5 * (sa)] * (b)[5 * (sb)])
+
+/* pDst = pSrcA * pSrcB: row i of A by column j of B */
+#define ARM_MAT_MULT_SMALL_F32(N)                                               \
+void arm_mat_mult_##N##x##N##_f32(                                              \
+  const float32_t * pSrcA,                                                      \
+  const float32_t * pSrcB,                                                      \
+  float32_t * pDst)                                                             \
+{                                                                               \
+  uint32_t i, j;                                                                \
+                                                                                \
+  for (i = 0U; i < N; i++)                                                      \
+  {                                                                             \
+    for (j = 0U; j < N; j++)                                                    \
+    {                                                                           \
+      pDst[i * N + j] = ARM_MAT_DOT_##N(pSrcA + i * N, 1, pSrcB + j, N);        \
+    }                                                                           \
+  }                                                                             \
+}
+
+/* pDst = pSrcA * pSrcB': row i of A by row j of B */
+#define ARM_MAT_MULT_TRANS_SMALL_F32(N)                                         \
+void arm_mat_mult_trans_##N##x##N##_f32(                                        \
+  const float32_t * pSrcA,                                                      \
+  const float32_t * pSrcB,                                                      \
+  float32_t * pDst)                                                             \
+{                                                                               \
+  uint32_t i, j;                                                                \
+                                                                                \
+  for (i = 0U; i < N; i++)                                                      \
+  {                                                                             \
+    for (j = 0U; j < N; j++)                                                    \
+    {                                                                           \
+      pDst[i * N + j] = ARM_MAT_DOT_##N(pSrcA + i * N, 1, pSrcB + j * N, 1);    \
+    }                                                                           \
+  }                                                                             \
+}
+
+/* pDst = pSrcA * pVec */
+#define ARM_MAT_VEC_MULT_SMALL_F32(N)                                           \
+void arm_mat_vec_mult_##N##x##N##_f32(                                          \
+  const float32_t * pSrcA,                                                      \
+  const float32_t * pVec,                                                       \
+  float32_t * pDst)                                                             \
+{                                                                               \
+  uint32_t i;                                                                   \
+                                                                                \
+  for (i = 0U; i < N; i++)                                                      \
+  {                                                                             \
+    pDst[i] = ARM_MAT_DOT_##N(pSrcA + i * N, 1, pVec, 1);                       \
+  }                                                                             \
+}
+
+ARM_MAT_MULT_SMALL_F32(2)
+ARM_MAT_MULT_SMALL_F32(3)
+ARM_MAT_MULT_SMALL_F32(4)
+ARM_MAT_MULT_SMALL_F32(5)
+ARM_MAT_MULT_SMALL_F32(6)
+
+ARM_MAT_MULT_TRANS_SMALL_F32(2)
+ARM_MAT_MULT_TRANS_SMALL_F32(3)
+ARM_MAT_MULT_TRANS_SMALL_F32(4)
+ARM_MAT_MULT_TRANS_SMALL_F32(5)
+ARM_MAT_MULT_TRANS_SMALL_F32(6)
+
+ARM_MAT_VEC_MULT_SMALL_F32(2)
+ARM_MAT_VEC_MULT_SMALL_F32(3)
+ARM_MAT_VEC_MULT_SMALL_F32(4)
+ARM_MAT_VEC_MULT_SMALL_F32(5)
+ARM_MAT_VEC_MULT_SMALL_F32(6)
+
+/**
+ * @} end of MatrixSmall group
+ */
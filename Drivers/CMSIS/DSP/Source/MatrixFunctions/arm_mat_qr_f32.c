@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_f32.c
+ * Description:  Floating-point Householder QR decomposition
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition
+ *
+ * Decomposes a matrix A of M rows and N columns, with M >= N, into
+ * <pre>
+ *     A = Q * R
+ * </pre>
+ * where Q is an orthogonal M x M matrix and R is upper triangular.
+ *
+ * \par Algorithm
+ * Householder reflections <code>H(k) = I - tau(k) * v(k) * v(k)'</code> zero the elements
+ * below the diagonal one column at a time, so that
+ * <code>H(N-1) * ... * H(1) * H(0) * A = R</code> and <code>Q = H(0) * H(1) * ... * H(N-1)</code>.
+ * v(k) is zero above row k and one on row k; its elements below row k are stored
+ * below the diagonal of R and the factors tau(k) in a separate vector, as in LAPACK.
+ *
+ * The least-squares solution of an overdetermined system <code>A * x = b</code> is the
+ * solution of <code>R(0:N-1,0:N-1) * x = (Q' * b)(0:N-1)</code>, computed with
+ * arm_mat_solve_upper_triangular_f32().
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point Householder QR decomposition.
+ * @param[in]       *pSrc      points to the instance of the input floating-point matrix structure.
+ * @param[in]       threshold  norm below which a column is considered already reduced.
+ * @param[out]      *pOutR     points to the instance of the output M x N matrix R.
+ * @param[out]      *pOutQ     points to the instance of the output M x M matrix Q, or NULL.
+ * @param[out]      *pOutTau   points to the N Householder factors tau.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix has more columns than rows
+ * or if the sizes of the output matrices do not match.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The elements of R below the diagonal hold the Householder vectors.  When
+ * <code>pOutQ</code> is NULL, Q is not computed.  When the norm of the elements
+ * below the diagonal of a column is not larger than <code>threshold</code>, no reflection
+ * is applied to that column and its tau is zero.
+ * \par
+ * The decomposition can be computed in place, with <code>pOutR->pData</code> equal to
+ * <code>pSrc->pData</code>.
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  const float32_t threshold,
+  arm_matrix_instance_f32 * pOutR,
+  arm_matrix_instance_f32 * pOutQ,
+  float32_t * pOutTau)
+{
+  float32_t *pR = pOutR->pData;                  /* output R matrix pointer */
+  float32_t *pQ;                                 /* output Q matrix pointer */
+  float32_t *pV;                                 /* column k of R, holds x then v */
+  uint32_t numRows = pSrc->numRows;              /* number of rows M */
+  uint32_t numCols = pSrc->numCols;              /* number of columns N */
+  uint32_t i, j, k;                              /* loop counters */
+  float32_t alpha, norm2, beta;                  /* reflector computation */
+  float32_t tau, scale, w;                       /* reflector and its application */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((numRows < numCols) || (pOutR->numRows != numRows) || (pOutR->numCols != numCols)
+     || ((pOutQ != NULL) && ((pOutQ->numRows != numRows) || (pOutQ->numCols != numRows))))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if (pR != pSrc->pData)
+    {
+      memcpy(pR, pSrc->pData, numRows * numCols * sizeof(float32_t));
+    }
+
+    for (k = 0U; k < numCols; k++)
+    {
+      pV = pR + k * numCols + k;
+
+      /* Norm of x = R(k+1:M-1,k) */
+      alpha = pV[0];
+      norm2 = 0.0f;
+
+      for (i = 1U; i < numRows - k; i++)
+      {
+        norm2 += pV[i * numCols] * pV[i * numCols];
+      }
+
+      if (norm2 <= threshold * threshold)
+      {
+        /* Nothing to reduce */
+        tau = 0.0f;
+
+        for (i = 1U; i < numRows - k; i++)
+        {
+          pV[i * numCols] = 0.0f;
+        }
+      }
+      else
+      {
+        /* beta = -sign(alpha) * norm(alpha, x), so that alpha - beta does not cancel */
+        arm_sqrt_f32(alpha * alpha + norm2, &beta);
+        beta = (alpha >= 0.0f) ? -beta : beta;
+
+        tau = (beta - alpha) / beta;
+        scale = 1.0f / (alpha - beta);
+
+        /* v = [1, x / (alpha - beta)] */
+        for (i = 1U; i < numRows - k; i++)
+        {
+          pV[i * numCols] *= scale;
+        }
+
+        pV[0] = beta;
+
+        /* Apply H(k) to the remaining columns: R(:,j) -= tau * v * (v' * R(:,j)) */
+        for (j = 1U; j < numCols - k; j++)
+        {
+          w = pV[j];
+
+          for (i = 1U; i < numRows - k; i++)
+          {
+            w += pV[i * numCols] * pV[i * numCols + j];
+          }
+
+          w *= tau;
+          pV[j] -= w;
+
+          for (i = 1U; i < numRows - k; i++)
+          {
+            pV[i * numCols + j] -= w * pV[i * numCols];
+          }
+        }
+      }
+
+      pOutTau[k] = tau;
+    }
+
+    if (pOutQ != NULL)
+    {
+      pQ = pOutQ->pData;
+
+      /* Q = I */
+      for (i = 0U; i < numRows; i++)
+      {
+        for (j = 0U; j < numRows; j++)
+        {
+          pQ[i * numRows + j] = (i == j) ? 1.0f : 0.0f;
+        }
+      }
+
+      /* Backward accumulation Q = H(k) * Q, H(k) only changes rows and columns k to M-1 */
+      for (k = numCols; k > 0U; k--)
+      {
+        tau = pOutTau[k - 1U];
+
+        if (tau == 0.0f)
+        {
+          continue;
+        }
+
+        pV = pR + (k - 1U) * numCols + (k - 1U);
+
+        for (j = k - 1U; j < numRows; j++)
+        {
+          w = pQ[(k - 1U) * numRows + j];
+
+          for (i = 1U; i < numRows - k + 1U; i++)
+          {
+            w += pV[i * numCols] * pQ[(k - 1U + i) * numRows + j];
+          }
+
+          w *= tau;
+          pQ[(k - 1U) * numRows + j] -= w;
+
+          for (i = 1U; i < numRows - k + 1U; i++)
+          {
+            pQ[(k - 1U + i) * numRows + j] -= w * pV[i * numCols];
+          }
+        }
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
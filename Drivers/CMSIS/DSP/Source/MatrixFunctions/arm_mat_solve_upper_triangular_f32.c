@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_f32.c
+ * Description:  Solves a upper triangular floating-point system
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point solver of an upper triangular system.
+ * @param[in]       *ut   points to the instance of the upper triangular floating-point matrix T.
+ * @param[in]       *a    points to the instance of the right-hand side matrix A.
+ * @param[out]      *dst  points to the instance of the solution matrix X, can be the same as A.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if T is not square or if the sizes of A, X and T
+ * do not match.  If an element of the diagonal of T is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst)
+{
+  float32_t *pT = ut->pData;                     /* triangular matrix pointer */
+  float32_t *pA = a->pData;                      /* right-hand side matrix pointer */
+  float32_t *pX = dst->pData;                    /* solution matrix pointer */
+  float32_t *pTi, *pXi, *pXk;                    /* row pointers */
+  uint32_t n = ut->numRows;                      /* size of the triangular matrix */
+  uint32_t m = a->numCols;                       /* number of right-hand sides */
+  uint32_t i, k;                                 /* loop counters */
+  float32_t coef, invDiag;                       /* element of T and reciprocal of its diagonal */
+  uint32_t blkCnt;                               /* loop counter of the unrolled loop */
+  float32_t *pOut;                               /* output row pointer */
+  arm_status status;                             /* status of the solver */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((ut->numRows != ut->numCols) || (a->numRows != ut->numRows)
+     || (dst->numRows != a->numRows) || (dst->numCols != a->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Back substitution: X(i,:) = (A(i,:) - T(i,i+1:n-1) * X(i+1:n-1,:)) / T(i,i) */
+    for (i = n; i-- > 0U; )
+    {
+      pTi = pT + i * n;
+      pXi = pX + i * m;
+
+      if (pTi[i] == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      invDiag = 1.0f / pTi[i];
+
+      if (pXi != pA + i * m)
+      {
+        memcpy(pXi, pA + i * m, m * sizeof(float32_t));
+      }
+
+      for (k = i + 1U; k < n; k++)
+      {
+        coef = pTi[k];
+        pXk = pX + k * m;
+        pOut = pXi;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop Unrolling */
+        blkCnt = m >> 2U;
+
+        while (blkCnt > 0U)
+        {
+          pOut[0] -= coef * pXk[0];
+          pOut[1] -= coef * pXk[1];
+          pOut[2] -= coef * pXk[2];
+          pOut[3] -= coef * pXk[3];
+
+          pOut += 4U;
+          pXk += 4U;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        blkCnt = m % 0x4U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        blkCnt = m;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while (blkCnt > 0U)
+        {
+          *pOut++ -= coef * *pXk++;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+      }
+
+      arm_scale_f32(pXi, invDiag, pXi, m);
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_cfft_f32.c
+ * Description:  Floating-point complex FFT dispatched through a plan
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex FFT with the implementation selected by a plan.
+ * @param[in]     S         points to an instance of the plan structure.
+ * @param[in]     pCfft     points to the arm_cfft_f32() instance of the FFT length.
+ * @param[in,out] p1        points to the complex data buffer, processed in place.
+ * @param[in]     ifftFlag  0 for the forward transform, 1 for the inverse transform.
+ * @return        none.
+ *
+ * \par
+ * Calls arm_cfft_f32(), arm_cfft_radix4_f32() or arm_cfft_radix2_f32() as recorded for the
+ * FFT length and direction.  The output is always in natural order, and the inverse
+ * transforms are all scaled by <code>1/fftLen</code>.
+ * The radix-2 and radix-4 instances are initialized on each call, which only sets a few pointers.
+ */
+
+void arm_plan_cfft_f32(
+  const arm_plan_instance * S,
+  const arm_cfft_instance_f32 * pCfft,
+  float32_t * p1,
+  uint8_t ifftFlag)
+{
+  arm_cfft_radix2_instance_f32 radix2;           /* Radix-2 instance */
+  arm_cfft_radix4_instance_f32 radix4;           /* Radix-4 instance */
+  uint8_t variant;                               /* Selected implementation */
+
+  variant = arm_plan_lookup(S, (uint8_t) ARM_PLAN_CFFT_F32, pCfft->fftLen, ifftFlag);
+
+  if ((variant == (uint8_t) ARM_PLAN_VARIANT_RADIX4) &&
+      (arm_cfft_radix4_init_f32(&radix4, pCfft->fftLen, ifftFlag, 1U) == ARM_MATH_SUCCESS))
+  {
+    arm_cfft_radix4_f32(&radix4, p1);
+  }
+  else if ((variant == (uint8_t) ARM_PLAN_VARIANT_RADIX2) &&
+           (arm_cfft_radix2_init_f32(&radix2, pCfft->fftLen, ifftFlag, 1U) == ARM_MATH_SUCCESS))
+  {
+    arm_cfft_radix2_f32(&radix2, p1);
+  }
+  else
+  {
+    arm_cfft_f32(pCfft, p1, ifftFlag, 1U);
+  }
+}
+
+/**
+ * @} end of Plan group
+ */
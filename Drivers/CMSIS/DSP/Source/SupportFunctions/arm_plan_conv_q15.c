@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_conv_q15.c
+ * Description:  Q15 convolution dispatched through a plan
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Q15 convolution with the implementation selected by a plan.
+ * @param[in]  S          points to an instance of the plan structure.
+ * @param[in]  pSrcA      points to the first input sequence.
+ * @param[in]  srcALen    length of the first input sequence.
+ * @param[in]  pSrcB      points to the second input sequence.
+ * @param[in]  srcBLen    length of the second input sequence.
+ * @param[out] pDst       points to the output, <code>srcALen+srcBLen-1</code> values.
+ * @param[in]  pScratch1  points to scratch buffer of size <code>max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2</code>.
+ * @param[in]  pScratch2  points to scratch buffer of size <code>min(srcALen, srcBLen)</code>.
+ * @return     none.
+ *
+ * \par
+ * Calls arm_conv_q15(), arm_conv_fast_q15(), arm_conv_opt_q15() or arm_conv_fast_opt_q15()
+ * as recorded for the input lengths.  The scratch buffers are only used by the last two,
+ * they can be NULL when the plan does not select them.
+ */
+
+void arm_plan_conv_q15(
+  const arm_plan_instance * S,
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2)
+{
+  switch (arm_plan_lookup(S, (uint8_t) ARM_PLAN_CONV_Q15, srcALen, srcBLen))
+  {
+  case ARM_PLAN_VARIANT_FAST:
+    arm_conv_fast_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    break;
+
+  case ARM_PLAN_VARIANT_OPT:
+    arm_conv_opt_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch1, pScratch2);
+    break;
+
+  case ARM_PLAN_VARIANT_FAST_OPT:
+    arm_conv_fast_opt_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch1, pScratch2);
+    break;
+
+  default:
+    arm_conv_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    break;
+  }
+}
+
+/**
+ * @} end of Plan group
+ */
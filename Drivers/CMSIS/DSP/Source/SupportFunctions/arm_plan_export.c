@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_export.c
+ * Description:  Serialization of a plan of implementations
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Serializes a plan.
+ * @param[in]  S         points to an instance of the plan structure.
+ * @param[out] pDst      points to the output words.
+ * @param[in]  maxWords  size of the output, at least <code>ARM_PLAN_EXPORT_WORDS(numEntries)</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the output is too small.
+ *
+ * \par
+ * The plan is written as <code>ARM_PLAN_MAGIC</code>, the number of entries, four words per entry
+ * (operation and implementation, the two size keys and the cycles) and a check word.
+ * The words are in the byte order of the core.
+ */
+
+arm_status arm_plan_export(
+  const arm_plan_instance * S,
+  uint32_t * pDst,
+  uint32_t maxWords)
+{
+  const arm_plan_entry *pEntry = S->pEntries;    /* Entry pointer */
+  uint32_t numWords = ARM_PLAN_EXPORT_WORDS((uint32_t) S->numEntries); /* Words written */
+  uint32_t check = 0U;                           /* Check word */
+  uint32_t i;                                    /* Loop counter */
+  arm_status status;
+
+  if (maxWords < numWords)
+  {
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    pDst[0] = ARM_PLAN_MAGIC;
+    pDst[1] = S->numEntries;
+
+    for (i = 0U; i < S->numEntries; i++)
+    {
+      pDst[2U + (4U * i)] = (uint32_t) pEntry->op | ((uint32_t) pEntry->variant << 8U);
+      pDst[3U + (4U * i)] = pEntry->len1;
+      pDst[4U + (4U * i)] = pEntry->len2;
+      pDst[5U + (4U * i)] = pEntry->cycles;
+      pEntry++;
+    }
+
+    /* Rotate and add, so that swapped words are detected */
+    for (i = 0U; i < (numWords - 1U); i++)
+    {
+      check = ((check << 1U) | (check >> 31U)) + pDst[i];
+    }
+
+    pDst[numWords - 1U] = check;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_fir_q15.c
+ * Description:  Q15 FIR filter dispatched through a plan
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Q15 FIR filter with the implementation selected by a plan.
+ * @param[in]     S          points to an instance of the plan structure.
+ * @param[in,out] pFir       points to an instance of the Q15 FIR filter structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Calls arm_fir_q15() or arm_fir_fast_q15() as recorded for the number of taps and
+ * the block size.  Both use the same instance and state.
+ */
+
+void arm_plan_fir_q15(
+  const arm_plan_instance * S,
+  arm_fir_instance_q15 * pFir,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  if (arm_plan_lookup(S, (uint8_t) ARM_PLAN_FIR_Q15, pFir->numTaps, blockSize) ==
+      (uint8_t) ARM_PLAN_VARIANT_FAST)
+  {
+    arm_fir_fast_q15(pFir, pSrc, pDst, blockSize);
+  }
+  else
+  {
+    arm_fir_q15(pFir, pSrc, pDst, blockSize);
+  }
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_import.c
+ * Description:  Loads a serialized plan of implementations
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Loads a serialized plan.
+ * @param[in,out] S         points to an instance of the plan structure.
+ * @param[in]     pSrc      points to the words written by arm_plan_export().
+ * @param[in]     numWords  number of words available.
+ * @return        The function returns ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if the words
+ *                are not a valid plan or ARM_MATH_LENGTH_ERROR if the plan is full.
+ *
+ * \par
+ * The format and the check word are verified before the entries are loaded.
+ * The entries are added to the plan with arm_plan_record(), replacing the entries
+ * of the same operations and sizes.  The timer and the tolerance of the plan are unchanged.
+ */
+
+arm_status arm_plan_import(
+  arm_plan_instance * S,
+  const uint32_t * pSrc,
+  uint32_t numWords)
+{
+  uint32_t numEntries;                           /* Number of entries */
+  uint32_t check = 0U;                           /* Check word */
+  uint32_t i;                                    /* Loop counter */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if ((numWords < ARM_PLAN_EXPORT_WORDS(0U)) || (pSrc[0] != ARM_PLAN_MAGIC) ||
+      (pSrc[1] > ((numWords - ARM_PLAN_EXPORT_WORDS(0U)) / 4U)))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    numEntries = pSrc[1];
+    numWords = ARM_PLAN_EXPORT_WORDS(numEntries);
+
+    for (i = 0U; i < (numWords - 1U); i++)
+    {
+      check = ((check << 1U) | (check >> 31U)) + pSrc[i];
+    }
+
+    if (check != pSrc[numWords - 1U])
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Load the entries */
+    for (i = 0U; (i < numEntries) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      if ((pSrc[2U + (4U * i)] >> 16U) != 0U)
+      {
+        status = ARM_MATH_ARGUMENT_ERROR;
+      }
+      else
+      {
+        status = arm_plan_record(S,
+                                 (uint8_t) pSrc[2U + (4U * i)],
+                                 pSrc[3U + (4U * i)],
+                                 pSrc[4U + (4U * i)],
+                                 (uint8_t) (pSrc[2U + (4U * i)] >> 8U),
+                                 pSrc[5U + (4U * i)]);
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Plan group
+ */
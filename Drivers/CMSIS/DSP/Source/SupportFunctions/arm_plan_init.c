@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_init.c
+ * Description:  Initialization function for a plan of implementations
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Plan Implementation Plans
+ *
+ * Several operations of the library have more than one implementation: exact and fast
+ * Q15 FIR filters, convolutions with and without scratch buffers, matrix multiplications
+ * with 64-bit or 32-bit accumulators, and radix-2, radix-4 and mixed radix complex FFTs.
+ * Which one is the fastest depends on the core, the memory and the sizes, and the fast
+ * versions are only usable when their reduced headroom is enough for the signals.
+ *
+ * A plan records the implementation to use for each operation and size.  The tuning
+ * functions, such as arm_plan_tune_conv_q15(), run every implementation of an operation
+ * on representative inputs, reject the ones whose output differs from the default
+ * implementation by more than the tolerance of the plan, and record the fastest of the
+ * others.  The dispatch functions, such as arm_plan_conv_q15(), then call the recorded
+ * implementation, or the default one for the sizes that were not tuned.
+ *
+ * \par Accuracy
+ * The error of an implementation is the largest absolute difference between its output and
+ * the output of the default implementation, divided by the full scale: 1.0 for Q15 data and
+ * the largest magnitude of the reference output for floating-point data.  A tolerance of 0
+ * only accepts implementations that give the same results, a tolerance of 0.001 accepts
+ * errors of about 32 LSB in Q15.  The default implementation is always accepted.
+ *
+ * \par Timing
+ * The implementations are timed with the cycle counter given to arm_plan_init(), for example
+ * a function returning <code>DWT->CYCCNT</code>.  Each one runs ARM_PLAN_NUM_RUNS times and the
+ * fastest run is kept, so that a cold cache or an interrupt does not decide.  Without a cycle
+ * counter, the tuning functions record the default implementation.
+ *
+ * \par Serialization
+ * arm_plan_export() writes a plan as an array of 32-bit words with a check value, and
+ * arm_plan_import() loads it back.  A plan tuned once, for example during production
+ * test, can be stored in flash and loaded at startup without tuning again.
+ * The choices are only valid for the core and the memory configuration they were measured on.
+ * arm_plan_record() also sets an entry directly.
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for a plan.
+ * @param[out] S           points to an instance of the plan structure.
+ * @param[in]  pEntries    points to the entry array.
+ * @param[in]  maxEntries  size of the entry array, one entry per tuned operation and size.
+ * @param[in]  timer       cycle counter used for tuning, may be NULL.
+ * @param[in]  tolerance   largest error accepted from an implementation, relative to full scale.
+ * @return     none.
+ *
+ * \par
+ * The plan starts empty, so every operation uses its default implementation.
+ */
+
+void arm_plan_init(
+  arm_plan_instance * S,
+  arm_plan_entry * pEntries,
+  uint16_t maxEntries,
+  arm_plan_timer timer,
+  float32_t tolerance)
+{
+  S->numEntries = 0U;
+  S->maxEntries = maxEntries;
+  S->pEntries = pEntries;
+  S->timer = timer;
+  S->tolerance = tolerance;
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_lookup.c
+ * Description:  Looks up the implementation selected for an operation
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Looks up the implementation of an operation for a size.
+ * @param[in] S     points to an instance of the plan structure.
+ * @param[in] op    operation, one of arm_plan_op.
+ * @param[in] len1  first size key, see arm_plan_op.
+ * @param[in] len2  second size key, see arm_plan_op.
+ * @return    The function returns the recorded implementation, or ARM_PLAN_VARIANT_DEFAULT
+ *            if the size was not tuned.
+ *
+ * \par
+ * The entries are searched in order, so the cost grows with the number of entries.
+ * Plans usually hold a few entries, one per operation and size used by the application.
+ */
+
+uint8_t arm_plan_lookup(
+  const arm_plan_instance * S,
+  uint8_t op,
+  uint32_t len1,
+  uint32_t len2)
+{
+  const arm_plan_entry *pEntry = S->pEntries;    /* Entry pointer */
+  uint8_t variant = (uint8_t) ARM_PLAN_VARIANT_DEFAULT; /* Selected implementation */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < S->numEntries; i++)
+  {
+    if ((pEntry->op == op) && (pEntry->len1 == len1) && (pEntry->len2 == len2))
+    {
+      variant = pEntry->variant;
+      break;
+    }
+
+    pEntry++;
+  }
+
+  return (variant);
+}
+
+/**
+ * @} end of Plan group
+ */
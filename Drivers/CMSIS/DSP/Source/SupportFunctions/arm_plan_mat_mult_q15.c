@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_mat_mult_q15.c
+ * Description:  Q15 matrix multiplication dispatched through a plan
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Q15 matrix multiplication with the implementation selected by a plan.
+ * @param[in]  S       points to an instance of the plan structure.
+ * @param[in]  pSrcA   points to the first input matrix.
+ * @param[in]  pSrcB   points to the second input matrix.
+ * @param[out] pDst    points to the output matrix.
+ * @param[in]  pState  points to the scratch buffer of the multiplication.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the sizes
+ *             do not match and ARM_MATH_MATRIX_CHECK is defined.
+ *
+ * \par
+ * Calls arm_mat_mult_q15() or arm_mat_mult_fast_q15() as recorded for the sizes.
+ * The plan is keyed by <code>numRows*65536 + numCols</code> of <code>pSrcA</code> and
+ * <code>numCols</code> of <code>pSrcB</code>.
+ */
+
+arm_status arm_plan_mat_mult_q15(
+  const arm_plan_instance * S,
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pState)
+{
+  uint32_t len1 = ((uint32_t) pSrcA->numRows << 16U) | pSrcA->numCols; /* Size of the first matrix */
+  arm_status status;
+
+  if (arm_plan_lookup(S, (uint8_t) ARM_PLAN_MAT_MULT_Q15, len1, pSrcB->numCols) ==
+      (uint8_t) ARM_PLAN_VARIANT_FAST)
+  {
+    status = arm_mat_mult_fast_q15(pSrcA, pSrcB, pDst, pState);
+  }
+  else
+  {
+    status = arm_mat_mult_q15(pSrcA, pSrcB, pDst, pState);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_record.c
+ * Description:  Records the implementation selected for an operation
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/* Implementations available for each operation, one bit per arm_plan_variant */
+static const uint8_t planVariants[ARM_PLAN_NUM_OPS] =
+{
+  (1U << ARM_PLAN_VARIANT_DEFAULT) | (1U << ARM_PLAN_VARIANT_FAST) |
+  (1U << ARM_PLAN_VARIANT_OPT) | (1U << ARM_PLAN_VARIANT_FAST_OPT),     /* ARM_PLAN_CONV_Q15 */
+  (1U << ARM_PLAN_VARIANT_DEFAULT) | (1U << ARM_PLAN_VARIANT_FAST),     /* ARM_PLAN_FIR_Q15 */
+  (1U << ARM_PLAN_VARIANT_DEFAULT) | (1U << ARM_PLAN_VARIANT_FAST),     /* ARM_PLAN_MAT_MULT_Q15 */
+  (1U << ARM_PLAN_VARIANT_DEFAULT) | (1U << ARM_PLAN_VARIANT_RADIX4) |
+  (1U << ARM_PLAN_VARIANT_RADIX2)                                       /* ARM_PLAN_CFFT_F32 */
+};
+
+/**
+ * @brief  Records the implementation of an operation for a size.
+ * @param[in,out] S        points to an instance of the plan structure.
+ * @param[in]     op       operation, one of arm_plan_op.
+ * @param[in]     len1     first size key, see arm_plan_op.
+ * @param[in]     len2     second size key, see arm_plan_op.
+ * @param[in]     variant  implementation, one of arm_plan_variant.
+ * @param[in]     cycles   cycles of the implementation, informative.
+ * @return     The function returns ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if the operation
+ *             has no such implementation or ARM_MATH_LENGTH_ERROR if the plan is full.
+ *
+ * \par
+ * An existing entry for the same operation and size is replaced.
+ */
+
+arm_status arm_plan_record(
+  arm_plan_instance * S,
+  uint8_t op,
+  uint32_t len1,
+  uint32_t len2,
+  uint8_t variant,
+  uint32_t cycles)
+{
+  arm_plan_entry *pEntry = S->pEntries;          /* Entry pointer */
+  uint32_t i;                                    /* Loop counter */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if ((op >= (uint8_t) ARM_PLAN_NUM_OPS) || (variant >= (uint8_t) ARM_PLAN_NUM_VARIANTS) ||
+      ((planVariants[op] & (1U << variant)) == 0U))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Look for the entry of this operation and size */
+    for (i = 0U; i < S->numEntries; i++)
+    {
+      if ((pEntry->op == op) && (pEntry->len1 == len1) && (pEntry->len2 == len2))
+      {
+        break;
+      }
+
+      pEntry++;
+    }
+
+    /* Append a new entry if there is room */
+    if (i == S->numEntries)
+    {
+      if (S->numEntries < S->maxEntries)
+      {
+        S->numEntries++;
+      }
+      else
+      {
+        status = ARM_MATH_LENGTH_ERROR;
+      }
+    }
+
+    if (status == ARM_MATH_SUCCESS)
+    {
+      pEntry->op = op;
+      pEntry->variant = variant;
+      pEntry->len1 = len1;
+      pEntry->len2 = len2;
+      pEntry->cycles = cycles;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Plan group
+ */
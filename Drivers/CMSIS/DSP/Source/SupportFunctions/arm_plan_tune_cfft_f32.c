@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_tune_cfft_f32.c
+ * Description:  Selects the fastest accurate floating-point complex FFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/* Implementations of the complex FFT, the default one first */
+static const uint8_t planCfftVariants[3] =
+{
+  (uint8_t) ARM_PLAN_VARIANT_DEFAULT,
+  (uint8_t) ARM_PLAN_VARIANT_RADIX4,
+  (uint8_t) ARM_PLAN_VARIANT_RADIX2
+};
+
+/**
+ * @brief  Selects the fastest accurate floating-point complex FFT.
+ * @param[in,out] S         points to an instance of the plan structure.
+ * @param[in]     pCfft     points to the arm_cfft_f32() instance of the FFT length.
+ * @param[in]     pSrc      points to a representative input, <code>2*fftLen</code> values, not modified.
+ * @param[out]    pBuf      points to the work buffer, <code>2*fftLen</code> values.
+ * @param[out]    pRef      points to the reference output, <code>2*fftLen</code> values.
+ * @param[in]     ifftFlag  0 for the forward transform, 1 for the inverse transform.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the plan is full.
+ *
+ * \par
+ * The radix-4 transform is only tried for powers of 4.  The error is relative to the
+ * largest magnitude of the output of arm_cfft_f32().
+ * The selection is recorded for the FFT length and <code>ifftFlag</code>.
+ */
+
+arm_status arm_plan_tune_cfft_f32(
+  arm_plan_instance * S,
+  const arm_cfft_instance_f32 * pCfft,
+  float32_t * pSrc,
+  float32_t * pBuf,
+  float32_t * pRef,
+  uint8_t ifftFlag)
+{
+  arm_plan_instance trial;                       /* Plan of the implementation under test */
+  arm_plan_entry trialEntry;                     /* Entry of the implementation under test */
+  arm_cfft_radix4_instance_f32 radix4;           /* Radix-4 instance, to check the length */
+  uint32_t bufLen = 2U * pCfft->fftLen;          /* Number of values in the buffer */
+  uint32_t start, elapsed, cycles;               /* Cycle counts */
+  uint32_t bestCycles = 0U;                      /* Cycles of the selected implementation */
+  uint8_t best = (uint8_t) ARM_PLAN_VARIANT_DEFAULT; /* Selected implementation */
+  uint8_t variant;                               /* Implementation under test */
+  float32_t diff, maxDiff, fullScale;            /* Difference with the reference output */
+  uint32_t i, k, run;                            /* Loop counters */
+
+  /* Output of the default implementation and its full scale */
+  arm_copy_f32(pSrc, pRef, bufLen);
+  arm_cfft_f32(pCfft, pRef, ifftFlag, 1U);
+
+  fullScale = 0.0f;
+
+  for (i = 0U; i < bufLen; i++)
+  {
+    diff = (pRef[i] > 0.0f) ? pRef[i] : -pRef[i];
+    fullScale = (diff > fullScale) ? diff : fullScale;
+  }
+
+  arm_plan_init(&trial, &trialEntry, 1U, NULL, 0.0f);
+
+  for (k = 0U; (k < 3U) && (S->timer != NULL); k++)
+  {
+    variant = planCfftVariants[k];
+
+    /* The radix-4 transform only supports powers of 4 */
+    if ((variant != (uint8_t) ARM_PLAN_VARIANT_RADIX4) ||
+        (arm_cfft_radix4_init_f32(&radix4, pCfft->fftLen, ifftFlag, 1U) == ARM_MATH_SUCCESS))
+    {
+      (void) arm_plan_record(&trial, (uint8_t) ARM_PLAN_CFFT_F32, pCfft->fftLen, ifftFlag, variant, 0U);
+
+      /* Keep the fastest run */
+      cycles = 0xFFFFFFFFU;
+
+      for (run = 0U; run < ARM_PLAN_NUM_RUNS; run++)
+      {
+        arm_copy_f32(pSrc, pBuf, bufLen);
+
+        start = S->timer();
+        arm_plan_cfft_f32(&trial, pCfft, pBuf, ifftFlag);
+        elapsed = S->timer() - start;
+        cycles = (elapsed < cycles) ? elapsed : cycles;
+      }
+
+      /* Largest difference with the default implementation */
+      maxDiff = 0.0f;
+
+      for (i = 0U; i < bufLen; i++)
+      {
+        diff = pBuf[i] - pRef[i];
+        diff = (diff > 0.0f) ? diff : -diff;
+        maxDiff = (diff > maxDiff) ? diff : maxDiff;
+      }
+
+      if ((maxDiff <= (S->tolerance * fullScale)) &&
+          ((variant == (uint8_t) ARM_PLAN_VARIANT_DEFAULT) || (cycles < bestCycles)))
+      {
+        best = variant;
+        bestCycles = cycles;
+      }
+    }
+  }
+
+  return (arm_plan_record(S, (uint8_t) ARM_PLAN_CFFT_F32, pCfft->fftLen, ifftFlag, best, bestCycles));
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_tune_conv_q15.c
+ * Description:  Selects the fastest accurate Q15 convolution
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Selects the fastest accurate Q15 convolution.
+ * @param[in,out] S          points to an instance of the plan structure.
+ * @param[in]     pSrcA      points to a representative first input sequence.
+ * @param[in]     srcALen    length of the first input sequence.
+ * @param[in]     pSrcB      points to a representative second input sequence.
+ * @param[in]     srcBLen    length of the second input sequence.
+ * @param[out]    pDst       points to the output, <code>srcALen+srcBLen-1</code> values.
+ * @param[out]    pRef       points to the reference output, <code>srcALen+srcBLen-1</code> values.
+ * @param[in]     pScratch1  points to scratch buffer of size <code>max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2</code>.
+ * @param[in]     pScratch2  points to scratch buffer of size <code>min(srcALen, srcBLen)</code>.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the plan is full.
+ *
+ * \par
+ * The inputs should have the amplitude of the signals the application processes,
+ * since the fast versions overflow on large signals.
+ * The selection is recorded for <code>srcALen</code> and <code>srcBLen</code>.
+ */
+
+arm_status arm_plan_tune_conv_q15(
+  arm_plan_instance * S,
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pRef,
+  q15_t * pScratch1,
+  q15_t * pScratch2)
+{
+  arm_plan_instance trial;                       /* Plan of the implementation under test */
+  arm_plan_entry trialEntry;                     /* Entry of the implementation under test */
+  uint32_t outLen = (srcALen + srcBLen) - 1U;    /* Output length */
+  uint32_t start, elapsed, cycles;               /* Cycle counts */
+  uint32_t bestCycles = 0U;                      /* Cycles of the selected implementation */
+  uint8_t best = (uint8_t) ARM_PLAN_VARIANT_DEFAULT; /* Selected implementation */
+  uint8_t variant;                               /* Implementation under test */
+  int32_t diff, maxDiff;                         /* Difference with the reference output */
+  uint32_t i, run;                               /* Loop counters */
+
+  /* Output of the default implementation */
+  arm_conv_q15(pSrcA, srcALen, pSrcB, srcBLen, pRef);
+
+  arm_plan_init(&trial, &trialEntry, 1U, NULL, 0.0f);
+
+  for (variant = (uint8_t) ARM_PLAN_VARIANT_DEFAULT;
+       (variant <= (uint8_t) ARM_PLAN_VARIANT_FAST_OPT) && (S->timer != NULL); variant++)
+  {
+    (void) arm_plan_record(&trial, (uint8_t) ARM_PLAN_CONV_Q15, srcALen, srcBLen, variant, 0U);
+
+    /* Keep the fastest run */
+    cycles = 0xFFFFFFFFU;
+
+    for (run = 0U; run < ARM_PLAN_NUM_RUNS; run++)
+    {
+      start = S->timer();
+      arm_plan_conv_q15(&trial, pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch1, pScratch2);
+      elapsed = S->timer() - start;
+      cycles = (elapsed < cycles) ? elapsed : cycles;
+    }
+
+    /* Largest difference with the default implementation */
+    maxDiff = 0;
+
+    for (i = 0U; i < outLen; i++)
+    {
+      diff = (int32_t) pDst[i] - pRef[i];
+      diff = (diff > 0) ? diff : -diff;
+      maxDiff = (diff > maxDiff) ? diff : maxDiff;
+    }
+
+    if (((float32_t) maxDiff <= (S->tolerance * 32768.0f)) &&
+        ((variant == (uint8_t) ARM_PLAN_VARIANT_DEFAULT) || (cycles < bestCycles)))
+    {
+      best = variant;
+      bestCycles = cycles;
+    }
+  }
+
+  return (arm_plan_record(S, (uint8_t) ARM_PLAN_CONV_Q15, srcALen, srcBLen, best, bestCycles));
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_tune_fir_q15.c
+ * Description:  Selects the fastest accurate Q15 FIR filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Selects the fastest accurate Q15 FIR filter.
+ * @param[in,out] S          points to an instance of the plan structure.
+ * @param[in,out] pFir       points to an initialized Q15 FIR filter.
+ * @param[in]     pSrc       points to a representative block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[out]    pRef       points to the reference output, <code>blockSize</code> values.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the plan is full.
+ *
+ * \par
+ * Each run starts from a cleared state, and the state is cleared again at the end,
+ * so tuning should be done before the filter is used.
+ * The selection is recorded for the number of taps and <code>blockSize</code>.
+ */
+
+arm_status arm_plan_tune_fir_q15(
+  arm_plan_instance * S,
+  arm_fir_instance_q15 * pFir,
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pRef,
+  uint32_t blockSize)
+{
+  arm_plan_instance trial;                       /* Plan of the implementation under test */
+  arm_plan_entry trialEntry;                     /* Entry of the implementation under test */
+  uint32_t stateLen = (pFir->numTaps + blockSize) - 1U; /* State length */
+  uint32_t start, elapsed, cycles;               /* Cycle counts */
+  uint32_t bestCycles = 0U;                      /* Cycles of the selected implementation */
+  uint8_t best = (uint8_t) ARM_PLAN_VARIANT_DEFAULT; /* Selected implementation */
+  uint8_t variant;                               /* Implementation under test */
+  int32_t diff, maxDiff;                         /* Difference with the reference output */
+  uint32_t i, run;                               /* Loop counters */
+
+  /* Output of the default implementation */
+  arm_fill_q15(0, pFir->pState, stateLen);
+  arm_fir_q15(pFir, pSrc, pRef, blockSize);
+
+  arm_plan_init(&trial, &trialEntry, 1U, NULL, 0.0f);
+
+  for (variant = (uint8_t) ARM_PLAN_VARIANT_DEFAULT;
+       (variant <= (uint8_t) ARM_PLAN_VARIANT_FAST) && (S->timer != NULL); variant++)
+  {
+    (void) arm_plan_record(&trial, (uint8_t) ARM_PLAN_FIR_Q15, pFir->numTaps, blockSize, variant, 0U);
+
+    /* Keep the fastest run */
+    cycles = 0xFFFFFFFFU;
+
+    for (run = 0U; run < ARM_PLAN_NUM_RUNS; run++)
+    {
+      arm_fill_q15(0, pFir->pState, stateLen);
+
+      start = S->timer();
+      arm_plan_fir_q15(&trial, pFir, pSrc, pDst, blockSize);
+      elapsed = S->timer() - start;
+      cycles = (elapsed < cycles) ? elapsed : cycles;
+    }
+
+    /* Largest difference with the default implementation */
+    maxDiff = 0;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      diff = (int32_t) pDst[i] - pRef[i];
+      diff = (diff > 0) ? diff : -diff;
+      maxDiff = (diff > maxDiff) ? diff : maxDiff;
+    }
+
+    if (((float32_t) maxDiff <= (S->tolerance * 32768.0f)) &&
+        ((variant == (uint8_t) ARM_PLAN_VARIANT_DEFAULT) || (cycles < bestCycles)))
+    {
+      best = variant;
+      bestCycles = cycles;
+    }
+  }
+
+  arm_fill_q15(0, pFir->pState, stateLen);
+
+  return (arm_plan_record(S, (uint8_t) ARM_PLAN_FIR_Q15, pFir->numTaps, blockSize, best, bestCycles));
+}
+
+/**
+ * @} end of Plan group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_plan_tune_mat_mult_q15.c
+ * Description:  Selects the fastest accurate Q15 matrix multiplication
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Plan
+ * @{
+ */
+
+/**
+ * @brief  Selects the fastest accurate Q15 matrix multiplication.
+ * @param[in,out] S       points to an instance of the plan structure.
+ * @param[in]     pSrcA   points to a representative first input matrix.
+ * @param[in]     pSrcB   points to a representative second input matrix.
+ * @param[out]    pDst    points to the output matrix.
+ * @param[out]    pRef    points to the reference output, as many values as <code>pDst</code>.
+ * @param[in]     pState  points to the scratch buffer of the multiplication.
+ * @return        The function returns ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH if the sizes
+ *                do not match or ARM_MATH_LENGTH_ERROR if the plan is full.
+ *
+ * \par
+ * The selection is recorded for the sizes of the matrices, see arm_plan_mat_mult_q15().
+ */
+
+arm_status arm_plan_tune_mat_mult_q15(
+  arm_plan_instance * S,
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pRef,
+  q15_t * pState)
+{
+  arm_plan_instance trial;                       /* Plan of the implementation under test */
+  arm_plan_entry trialEntry;                     /* Entry of the implementation under test */
+  uint32_t len1 = ((uint32_t) pSrcA->numRows << 16U) | pSrcA->numCols; /* Size of the first matrix */
+  uint32_t outLen = (uint32_t) pSrcA->numRows * pSrcB->numCols; /* Number of output values */
+  uint32_t start, elapsed, cycles;               /* Cycle counts */
+  uint32_t bestCycles = 0U;                      /* Cycles of the selected implementation */
+  uint8_t best = (uint8_t) ARM_PLAN_VARIANT_DEFAULT; /* Selected implementation */
+  uint8_t variant;                               /* Implementation under test */
+  int32_t diff, maxDiff;                         /* Difference with the reference output */
+  uint32_t i, run;                               /* Loop counters */
+  arm_status status;
+
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pDst->numRows != pSrcA->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+  {
+    /* Output of the default implementation */
+    (void) arm_mat_mult_q15(pSrcA, pSrcB, pDst, pState);
+    arm_copy_q15(pDst->pData, pRef, outLen);
+
+    arm_plan_init(&trial, &trialEntry, 1U, NULL, 0.0f);
+
+    for (variant = (uint8_t) ARM_PLAN_VARIANT_DEFAULT;
+         (variant <= (uint8_t) ARM_PLAN_VARIANT_FAST) && (S->timer != NULL); variant++)
+    {
+      (void) arm_plan_record(&trial, (uint8_t) ARM_PLAN_MAT_MULT_Q15, len1, pSrcB->numCols, variant, 0U);
+
+      /* Keep the fastest run */
+      cycles = 0xFFFFFFFFU;
+
+      for (run = 0U; run < ARM_PLAN_NUM_RUNS; run++)
+      {
+        start = S->timer();
+        (void) arm_plan_mat_mult_q15(&trial, pSrcA, pSrcB, pDst, pState);
+        elapsed = S->timer() - start;
+        cycles = (elapsed < cycles) ? elapsed : cycles;
+      }
+
+      /* Largest difference with the default implementation */
+      maxDiff = 0;
+
+      for (i = 0U; i < outLen; i++)
+      {
+        diff = (int32_t) pDst->pData[i] - pRef[i];
+        diff = (diff > 0) ? diff : -diff;
+        maxDiff = (diff > maxDiff) ? diff : maxDiff;
+      }
+
+      if (((float32_t) maxDiff <= (S->tolerance * 32768.0f)) &&
+          ((variant == (uint8_t) ARM_PLAN_VARIANT_DEFAULT) || (cycles < bestCycles)))
+      {
+        best = variant;
+        bestCycles = cycles;
+      }
+    }
+
+    status = arm_plan_record(S, (uint8_t) ARM_PLAN_MAT_MULT_Q15, len1, pSrcB->numCols, best, bestCycles);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Plan group
+ */
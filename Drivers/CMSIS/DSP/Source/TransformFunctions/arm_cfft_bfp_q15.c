@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q15.c
+ * Description:  Block floating-point complex FFT for Q15 data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_16(
+    uint16_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @details
+* @brief       Processing function for the block floating-point complex FFT in Q15 format.
+* @param[in]      *S    points to an instance of the fixed-point CFFT structure.
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return        block exponent of the output.
+*
+* \par
+* The Q15 version of arm_cfft_bfp_q31(): the headroom is measured before each radix-2
+* stage and the data is only scaled down when fewer than two guard bits remain.
+* The unnormalized transform equals the output multiplied by 2^exponent, and
+* arm_cfft_q15() corresponds to a fixed exponent of <code>log2(fftLen)</code>.
+*/
+
+int32_t arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    uint32_t L = S->fftLen;                        /* length of the FFT */
+    const q15_t *pCoef = S->pTwiddle;              /* twiddle factor table */
+    uint32_t twidCoefModifier = 1U;                /* twiddle table stride of the stage */
+    uint32_t mask = 0U;                            /* OR of the magnitudes of the stage inputs */
+    uint32_t nextMask;                             /* OR of the magnitudes of the stage outputs */
+    uint32_t n2, i, j, k;                          /* loop counters and indices */
+    int32_t exponent = 0;                          /* block exponent */
+    int32_t shift;                                 /* down scaling of the stage */
+    q31_t xaR, xaI, xbR, xbI;                      /* butterfly inputs and outputs */
+    q31_t dR, dI;                                  /* butterfly differences */
+    q31_t cosVal, sinVal;                          /* twiddle factor */
+
+    /* Headroom of the input */
+    for (i = 0U; i < 2U * L; i++)
+    {
+        mask |= (uint32_t) ((q31_t) p1[i] ^ ((q31_t) p1[i] >> 15));
+    }
+
+    /* Normalize low amplitude inputs so that exactly two guard bits remain */
+    shift = (int32_t) __CLZ(mask) - 19;
+
+    if ((mask != 0U) && (shift > 0))
+    {
+        for (i = 0U; i < 2U * L; i++)
+        {
+            p1[i] = (q15_t) (p1[i] << shift);
+        }
+
+        mask <<= shift;
+        exponent = -shift;
+    }
+
+    /* Radix-2 decimation in frequency stages */
+    for (n2 = L >> 1U; n2 > 0U; n2 >>= 1U)
+    {
+        /* Scale down only by the number of bits missing to the two guard bits */
+        shift = 19 - (int32_t) __CLZ(mask);
+        shift = (shift < 0) ? 0 : shift;
+        exponent += shift;
+
+        nextMask = 0U;
+
+        for (j = 0U; j < n2; j++)
+        {
+            /* The inverse transform uses the conjugate twiddle factor */
+            cosVal = pCoef[2U * j * twidCoefModifier];
+            sinVal = pCoef[2U * j * twidCoefModifier + 1U];
+            sinVal = (ifftFlag == 1U) ? -sinVal : sinVal;
+
+            for (i = j; i < L; i += 2U * n2)
+            {
+                k = i + n2;
+
+                xaR = p1[2U * i] >> shift;
+                xaI = p1[2U * i + 1U] >> shift;
+                xbR = p1[2U * k] >> shift;
+                xbI = p1[2U * k + 1U] >> shift;
+
+                dR = xaR - xbR;
+                dI = xaI - xbI;
+
+                xaR = xaR + xbR;
+                xaI = xaI + xbI;
+
+                /* (xa - xb) * (cos - i sin) */
+                xbR = (dR * cosVal + dI * sinVal) >> 15;
+                xbI = (dI * cosVal - dR * sinVal) >> 15;
+
+                p1[2U * i] = (q15_t) xaR;
+                p1[2U * i + 1U] = (q15_t) xaI;
+                p1[2U * k] = (q15_t) xbR;
+                p1[2U * k + 1U] = (q15_t) xbI;
+
+                nextMask |= (uint32_t) ((xaR ^ (xaR >> 31)) | (xaI ^ (xaI >> 31)) |
+                                        (xbR ^ (xbR >> 31)) | (xbI ^ (xbI >> 31)));
+            }
+        }
+
+        mask = nextMask;
+        twidCoefModifier <<= 1U;
+    }
+
+    if ( bitReverseFlag )
+        arm_bitreversal_16((uint16_t*)p1,S->bitRevLength,S->pBitRevTable);
+
+    return (exponent);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_f16.c
+ * Description:  Combined Radix Decimation in Frequency CFFT Half-precision processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_16(
+    uint16_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @details
+* @brief       Processing function for the half-precision complex FFT.
+* @param[in]      *S    points to an instance of the half-precision CFFT structure.
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*
+* \par
+* The data is stored in half precision and each radix-2 butterfly is computed in single
+* precision with single-precision twiddle factors, so the buffer takes half the memory
+* of the floating-point transform and the error grows by one half-precision rounding
+* per stage.  The scaling is the same as for arm_cfft_f32(): the forward transform is
+* not scaled and the inverse transform is scaled by <code>1/fftLen</code>, applied as
+* a factor of one half in every stage so that intermediate values stay in range.  The
+* magnitude of every output bin of the forward transform must stay below 65504.
+* \par
+* The instances are the constant structures <code>arm_cfft_sR_f16_lenN</code>, which
+* share the floating-point twiddle tables and the Q15 bit reversal tables.
+*/
+
+void arm_cfft_f16(
+    const arm_cfft_instance_f16 * S,
+    float16_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    uint32_t fftLen = S->fftLen;
+    const float32_t *pCoef = S->pTwiddle;
+    uint32_t i, j, k, l;
+    uint32_t n1, n2, ia;
+    uint32_t twidCoefModifier = 1U;
+    float32_t xt, yt, cosVal, sinVal;
+    float32_t xi, yi, xl, yl;
+    float32_t sinSign, scale;
+
+    /* The inverse transform uses the conjugate twiddles and halves every stage */
+    sinSign = (ifftFlag == 1U) ? -1.0f : 1.0f;
+    scale = (ifftFlag == 1U) ? 0.5f : 1.0f;
+
+    n2 = fftLen;
+
+    /* loop for stage */
+    for (k = fftLen; k > 1U; k = k >> 1U)
+    {
+        n1 = n2;
+        n2 = n2 >> 1U;
+        ia = 0U;
+
+        /* loop for groups */
+        for (j = 0U; j < n2; j++)
+        {
+            cosVal = pCoef[ia * 2U];
+            sinVal = sinSign * pCoef[(ia * 2U) + 1U];
+            ia += twidCoefModifier;
+
+            /* loop for butterfly */
+            for (i = j; i < fftLen; i += n1)
+            {
+                l = i + n2;
+
+                xi = convert_f16_to_f32(p1[2U * i]);
+                yi = convert_f16_to_f32(p1[(2U * i) + 1U]);
+                xl = convert_f16_to_f32(p1[2U * l]);
+                yl = convert_f16_to_f32(p1[(2U * l) + 1U]);
+
+                xt = scale * (xi - xl);
+                yt = scale * (yi - yl);
+
+                p1[2U * i] = convert_f32_to_f16(scale * (xi + xl));
+                p1[(2U * i) + 1U] = convert_f32_to_f16(scale * (yi + yl));
+
+                p1[2U * l] = convert_f32_to_f16((xt * cosVal) + (yt * sinVal));
+                p1[(2U * l) + 1U] = convert_f32_to_f16((yt * cosVal) - (xt * sinVal));
+            }
+        }
+
+        twidCoefModifier <<= 1U;
+    }
+
+    if ( bitReverseFlag )
+        arm_bitreversal_16((uint16_t*)p1,S->bitRevLength,S->pBitRevTable);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
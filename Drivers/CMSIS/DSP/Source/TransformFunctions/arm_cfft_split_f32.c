@@ -0,0 +1,237 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_split_f32.c
+ * Description:  Floating-point complex FFT on split (planar) real and imaginary arrays
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @brief Radix-2 decimation in frequency complex FFT on two real arrays.
+* @param[in]      *S              points to an instance of the floating-point CFFT structure.
+* @param[in, out] *pRe            points to the real parts. Processing occurs in-place.
+* @param[in, out] *pIm            points to the imaginary parts. Processing occurs in-place.
+* @param[in]      stride          distance between consecutive elements of pRe and pIm.
+* @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*
+* \par
+* Shared by arm_cfft_split_f32() and arm_cfft_strided_f32().  The inverse
+* transform is the forward transform with the real and imaginary arrays swapped,
+* followed by the 1/fftLen scaling.
+*/
+
+void arm_cfft_radix2_split_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * pRe,
+    float32_t * pIm,
+    uint32_t stride,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    uint32_t L = S->fftLen;                        /* length of the FFT */
+    const float32_t *pCoef = S->pTwiddle;          /* twiddle factor table */
+    float32_t *pX, *pY;                            /* real and imaginary parts of the forward transform */
+    float32_t *pAR, *pAI, *pBR, *pBI;              /* butterfly pointers */
+    uint32_t n1, n2, i, j;                         /* loop counters and indices */
+    uint32_t twidCoefModifier = 2U;                /* twiddle table stride of the stage */
+    uint32_t a, b;                                 /* index and bit reversed index */
+    float32_t xaR, xaI, dR, dI;                    /* butterfly temporaries */
+    float32_t cosVal, sinVal;                      /* twiddle factor */
+    float32_t invL;                                /* scaling of the inverse transform */
+
+    /* swap(FFT(swap(x))) is the unscaled inverse FFT of x */
+    if (ifftFlag == 1U)
+    {
+        pX = pIm;
+        pY = pRe;
+    }
+    else
+    {
+        pX = pRe;
+        pY = pIm;
+    }
+
+    /* Radix-2 decimation in frequency stages, the last stage has no twiddles */
+    for (n2 = L; n2 > 2U; n2 >>= 1U)
+    {
+        n1 = n2 >> 1U;
+
+        for (j = 0U; j < n1; j++)
+        {
+            cosVal = pCoef[j * twidCoefModifier];
+            sinVal = pCoef[j * twidCoefModifier + 1U];
+
+            pAR = pX + j * stride;
+            pAI = pY + j * stride;
+            pBR = pAR + n1 * stride;
+            pBI = pAI + n1 * stride;
+
+            i = L / n2;
+
+            do
+            {
+                dR = *pAR - *pBR;
+                dI = *pAI - *pBI;
+
+                *pAR += *pBR;
+                *pAI += *pBI;
+
+                /* (xa - xb) * (cos - i sin) */
+                *pBR = dR * cosVal + dI * sinVal;
+                *pBI = dI * cosVal - dR * sinVal;
+
+                pAR += n2 * stride;
+                pAI += n2 * stride;
+                pBR += n2 * stride;
+                pBI += n2 * stride;
+
+                /* Decrement the loop counter */
+                i--;
+            } while (i > 0U);
+        }
+
+        twidCoefModifier <<= 1U;
+    }
+
+    /* Last stage */
+    pAR = pX;
+    pAI = pY;
+    i = L >> 1U;
+
+    do
+    {
+        xaR = pAR[0];
+        xaI = pAI[0];
+        dR = pAR[stride];
+        dI = pAI[stride];
+
+        pAR[0] = xaR + dR;
+        pAI[0] = xaI + dI;
+        pAR[stride] = xaR - dR;
+        pAI[stride] = xaI - dI;
+
+        pAR += 2U * stride;
+        pAI += 2U * stride;
+
+        /* Decrement the loop counter */
+        i--;
+    } while (i > 0U);
+
+    /* The bit reversal tables of the instance follow the radix-8 output order of
+       arm_cfft_f32(), so the radix-2 output is reordered with a counter instead */
+    if (bitReverseFlag)
+    {
+        b = 0U;
+
+        for (a = 0U; a < L - 1U; a++)
+        {
+            if (a < b)
+            {
+                xaR = pX[a * stride];
+                pX[a * stride] = pX[b * stride];
+                pX[b * stride] = xaR;
+
+                xaI = pY[a * stride];
+                pY[a * stride] = pY[b * stride];
+                pY[b * stride] = xaI;
+            }
+
+            /* Bit reversed increment of b */
+            i = L >> 1U;
+
+            while (i <= b)
+            {
+                b -= i;
+                i >>= 1U;
+            }
+
+            b += i;
+        }
+    }
+
+    if (ifftFlag == 1U)
+    {
+        invL = 1.0f / (float32_t) L;
+
+        pAR = pRe;
+        pAI = pIm;
+        i = L;
+
+        do
+        {
+            *pAR *= invL;
+            *pAI *= invL;
+
+            pAR += stride;
+            pAI += stride;
+
+            /* Decrement the loop counter */
+            i--;
+        } while (i > 0U);
+    }
+}
+
+/**
+* @brief Processing function for the floating-point complex FFT on split (planar) data.
+* @param[in]      *S              points to an instance of the floating-point CFFT structure.
+* @param[in, out] *pRe            points to the <code>fftLen</code> real parts. Processing occurs in-place.
+* @param[in, out] *pIm            points to the <code>fftLen</code> imaginary parts. Processing occurs in-place.
+* @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*
+* \par
+* The transform is the same as arm_cfft_f32() but the real and imaginary parts are held
+* in two separate arrays, so data kept in planar form, for example the I and Q samples
+* of a receiver, is transformed without interleaving it into a scratch buffer first.
+* The instance structures of arm_cfft_f32() are used directly.
+* \par
+* The function uses radix-2 butterflies and is slower than arm_cfft_f32(); it is
+* intended for memory constrained applications where the interleaved copy does not fit.
+*/
+
+void arm_cfft_split_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * pRe,
+    float32_t * pIm,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    arm_cfft_radix2_split_f32(S, pRe, pIm, 1U, ifftFlag, bitReverseFlag);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
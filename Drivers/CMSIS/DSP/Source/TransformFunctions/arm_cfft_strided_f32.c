@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_strided_f32.c
+ * Description:  Floating-point complex FFT on strided interleaved data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+extern void arm_cfft_radix2_split_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * pRe,
+    float32_t * pIm,
+    uint32_t stride,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point complex FFT on strided data.
+* @param[in]      *S              points to an instance of the floating-point CFFT structure.
+* @param[in, out] *p1             points to the first complex sample. Processing occurs in-place.
+* @param[in]      stride          distance between consecutive complex samples, in complex samples.
+* @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*
+* \par
+* Complex sample <code>n</code> of the transform is stored at <code>p1[2*n*stride]</code>
+* and <code>p1[2*n*stride+1]</code>.  This transforms one channel of interleaved
+* multichannel data, or a column of a complex matrix, in place without gathering it
+* into a contiguous buffer.  A stride of 1 gives the same result as arm_cfft_f32().
+* The samples in between are not accessed.
+* \par
+* The function uses radix-2 butterflies, see arm_cfft_split_f32().
+*/
+
+void arm_cfft_strided_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * p1,
+    uint32_t stride,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    arm_cfft_radix2_split_f32(S, p1, p1 + 1, 2U * stride, ifftFlag, bitReverseFlag);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
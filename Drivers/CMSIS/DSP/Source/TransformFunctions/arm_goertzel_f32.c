@@ -0,0 +1,283 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point multi-bin Goertzel
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Algorithm
+ *
+ * The Goertzel algorithm computes the power of the input at a small set of target
+ * frequencies.  Each frequency <code>f</code>, normalised to the sampling rate, is
+ * tracked by a second order resonator
+ * <pre>
+ *    s[n] = x[n] + 2*cos(w) * s[n-1] - s[n-2],   w = 2*pi*f
+ * </pre>
+ * and the DFT of the block at that frequency is obtained from the last two states as
+ * <code>X(f) = s[N-1] - exp(-j*w) * s[N-2]</code>, where <code>N</code> is the block size.
+ * For <code>f = k/N</code> this is bin <code>k</code> of an N point DFT, but any
+ * frequency can be used.
+ *
+ * \par
+ * Close to DC the states grow like <code>N^2</code> while the result only grows like
+ * <code>N</code>, so the direct recursion loses most of its precision to cancellation.
+ * The functions use the Reinsch form instead, which tracks the difference of the states:
+ * <pre>
+ *    d[n] = d[n-1] + lambda * s[n-1] + x[n]
+ *    s[n] = s[n-1] + d[n],                        lambda = 2*cos(w) - 2 = -4*sin(w/2)^2
+ * </pre>
+ * and computes the power without subtracting large states:
+ * <pre>
+ *    |X(f)|^2 = (d[N-1] - lambda/2 * s[N-2])^2 + sin(w)^2 * s[N-2]^2
+ * </pre>
+ * Frequencies above <code>fs/4</code> are mirrored to <code>0.5 - f</code> by negating
+ * the odd input samples, which keeps <code>lambda</code> small and accurate for them
+ * as well, so DC and the Nyquist frequency are both exact.
+ *
+ * \par
+ * A bin costs one multiplication and three additions per sample, against
+ * <code>log2(N)</code> butterfly operations per sample for a full FFT, so Goertzel is
+ * faster when only a few bins are needed, e.g. for DTMF or tone presence detection.
+ * The functions process several frequencies in each pass over the input, so the
+ * input is read once for every group of frequencies rather than once per frequency.
+ * The crossover bin count against arm_rfft_fast_f32() is measured by the
+ * <code>arm_goertzel_f32_crossover</code> test of the DSP test suite.
+ *
+ * \par
+ * When the bins must be updated at every sample rather than once per block, use the
+ * sliding DFT functions instead.
+ *
+ * \par Instance Structure
+ * The coefficients are owned by the caller and referenced by the instance structure.
+ * The functions keep no state between calls: every call processes one complete block.
+ *
+ * \par Initialization Functions
+ * arm_goertzel_init_f32() and arm_goertzel_init_q31() compute the coefficients from the
+ * normalised target frequencies.  The coefficient buffer holds two values per frequency,
+ * <code>lambda</code> and the sign of the odd input samples.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Power at the end of a block from the last resonator states.
+ * @param[in] lambda  coefficient 2*cos(w) - 2.
+ * @param[in] s1      state s[N-1].
+ * @param[in] d1      state difference d[N-1].
+ * @return    |X(f)|^2.
+ */
+static float32_t arm_goertzel_power_f32(
+  float32_t lambda,
+  float32_t s1,
+  float32_t d1)
+{
+  float32_t s2 = s1 - d1;                        /* state s[N-2] */
+  float32_t t = 0.5f * lambda * s2;              /* lambda/2 * s[N-2] */
+  float32_t re = d1 - t;                         /* real part of X(f) */
+
+  /* sin(w)^2 * s2^2 = -lambda/2 * (2 + lambda/2) * s2^2 = -2 * t * s2 - t^2 */
+  return (re * re - 2.0f * t * s2 - t * t);
+}
+
+/**
+ * @brief  Processing function for the floating-point multi-bin Goertzel.
+ * @param[in]  S          points to an instance of the floating-point Goertzel structure.
+ * @param[in]  pSrc       points to the block of input samples.
+ * @param[out] pDst       points to the power at each target frequency, <code>numBins</code> values.
+ * @param[in]  blockSize  number of input samples.
+ * @return none.
+ */
+
+void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs;         /* lambda and sign of the odd samples */
+  float32_t *pIn;                                /* input pointer */
+  float32_t x0, x1;                              /* even and odd input samples */
+  float32_t l, g;                                /* lambda and sign */
+  float32_t s, d;                                /* state and state difference */
+  uint32_t binCnt, blkCnt;                       /* loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t l1, l2, l3, l4;                      /* lambdas */
+  float32_t g1, g2, g3, g4;                      /* signs of the odd samples */
+  float32_t s1, s2, s3, s4;                      /* states */
+  float32_t d1, d2, d3, d4;                      /* state differences */
+
+  /* Four frequencies per pass over the input */
+  binCnt = S->numBins >> 2U;
+
+  /* First part of the processing.  Compute 4 frequencies at a time.
+   ** a second loop below computes the remaining 1 to 3 frequencies. */
+  while (binCnt > 0U)
+  {
+    l1 = pCoeffs[0];
+    g1 = pCoeffs[1];
+    l2 = pCoeffs[2];
+    g2 = pCoeffs[3];
+    l3 = pCoeffs[4];
+    g3 = pCoeffs[5];
+    l4 = pCoeffs[6];
+    g4 = pCoeffs[7];
+
+    /* Clear the resonator states */
+    s1 = s2 = s3 = s4 = 0.0f;
+    d1 = d2 = d3 = d4 = 0.0f;
+
+    pIn = pSrc;
+
+    /* Two samples at a time, the odd one is negated for the mirrored frequencies */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U)
+    {
+      x0 = pIn[0];
+      x1 = pIn[1];
+      pIn += 2U;
+
+      /* d[n] = d[n-1] + lambda * s[n-1] + x[n], s[n] = s[n-1] + d[n] */
+      d1 += l1 * s1 + x0;
+      s1 += d1;
+      d2 += l2 * s2 + x0;
+      s2 += d2;
+      d3 += l3 * s3 + x0;
+      s3 += d3;
+      d4 += l4 * s4 + x0;
+      s4 += d4;
+
+      d1 += l1 * s1 + g1 * x1;
+      s1 += d1;
+      d2 += l2 * s2 + g2 * x1;
+      s2 += d2;
+      d3 += l3 * s3 + g3 * x1;
+      s3 += d3;
+      d4 += l4 * s4 + g4 * x1;
+      s4 += d4;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Last even sample of an odd block size */
+    if ((blockSize & 1U) != 0U)
+    {
+      x0 = *pIn;
+
+      d1 += l1 * s1 + x0;
+      s1 += d1;
+      d2 += l2 * s2 + x0;
+      s2 += d2;
+      d3 += l3 * s3 + x0;
+      s3 += d3;
+      d4 += l4 * s4 + x0;
+      s4 += d4;
+    }
+
+    pDst[0] = arm_goertzel_power_f32(l1, s1, d1);
+    pDst[1] = arm_goertzel_power_f32(l2, s2, d2);
+    pDst[2] = arm_goertzel_power_f32(l3, s3, d3);
+    pDst[3] = arm_goertzel_power_f32(l4, s4, d4);
+
+    pCoeffs += 8U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  /* If the number of frequencies is not a multiple of 4, compute the remaining ones here. */
+  binCnt = S->numBins % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize binCnt with the number of frequencies */
+  binCnt = S->numBins;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (binCnt > 0U)
+  {
+    l = pCoeffs[0];
+    g = pCoeffs[1];
+    pCoeffs += 2U;
+
+    /* Clear the resonator states */
+    s = 0.0f;
+    d = 0.0f;
+
+    pIn = pSrc;
+
+    /* Two samples at a time, the odd one is negated for the mirrored frequencies */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U)
+    {
+      x0 = pIn[0];
+      x1 = pIn[1];
+      pIn += 2U;
+
+      /* d[n] = d[n-1] + lambda * s[n-1] + x[n], s[n] = s[n-1] + d[n] */
+      d += l * s + x0;
+      s += d;
+      d += l * s + g * x1;
+      s += d;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Last even sample of an odd block size */
+    if ((blockSize & 1U) != 0U)
+    {
+      d += l * s + *pIn;
+      s += d;
+    }
+
+    *pDst++ = arm_goertzel_power_f32(l, s, d);
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
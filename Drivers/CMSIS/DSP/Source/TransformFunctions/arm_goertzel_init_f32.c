@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Initialization function for the floating-point multi-bin Goertzel
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point multi-bin Goertzel.
+ * @param[in,out] S        points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numBins  number of target frequencies.
+ * @param[in]     pFreqs   points to the target frequencies, normalised to the sampling rate in the range [0 0.5].
+ * @param[out]    pCoeffs  points to the coefficient buffer of <code>2*numBins</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if a frequency is out of range.
+ *
+ * \par
+ * The target frequencies do not have to be multiples of <code>1/blockSize</code>.
+ * The coefficients <code>lambda = -4*sin(pi*f)^2</code> are computed with arm_sin_cos_f32(),
+ * which keeps their relative precision close to DC.  Frequencies above 0.25 are stored
+ * as <code>0.5 - f</code> with a sign of -1 for the odd input samples.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs)
+{
+  float32_t f;                                   /* frequency, mirrored below 0.25 */
+  float32_t sinVal, cosVal;                      /* sine and cosine of half the angle */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0U; k < numBins; k++)
+  {
+    f = pFreqs[k];
+
+    if ((f < 0.0f) || (f > 0.5f))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Mirror the upper half band, negating the odd samples moves f to 0.5 - f */
+    pCoeffs[2U * k + 1U] = (f > 0.25f) ? -1.0f : 1.0f;
+    f = (f > 0.25f) ? (0.5f - f) : f;
+
+    /* lambda = 2 * cos(2 * pi * f) - 2 = -4 * sin(pi * f)^2, the angle is in degrees */
+    arm_sin_cos_f32(180.0f * f, &sinVal, &cosVal);
+    pCoeffs[2U * k] = -4.0f * sinVal * sinVal;
+  }
+
+  /* Assign bin parameters */
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
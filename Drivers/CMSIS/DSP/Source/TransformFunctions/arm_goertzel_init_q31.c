@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function for the Q31 multi-bin Goertzel
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 multi-bin Goertzel.
+ * @param[in,out] S        points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins  number of target frequencies.
+ * @param[in]     pFreqs   points to the target frequencies, normalised to the sampling rate in the range [0 0.5].
+ * @param[out]    pCoeffs  points to the coefficient buffer of <code>2*numBins</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if a frequency is out of range.
+ *
+ * \par
+ * The coefficients hold <code>mu/2 = sin(pi*f)</code> in 1.31 format, computed with
+ * arm_sin_q31(), and a sign mask for the odd input samples of the frequencies above 0.25,
+ * which are mirrored to <code>0.5 - f</code>.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs)
+{
+  q31_t f;                                       /* frequency, mirrored below 0.25 */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0U; k < numBins; k++)
+  {
+    f = pFreqs[k];
+
+    if ((f < 0) || (f > 0x40000000))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Mirror the upper half band, negating the odd samples moves f to 0.5 - f */
+    pCoeffs[2U * k + 1U] = (f > 0x20000000) ? -1 : 0;
+    f = (f > 0x20000000) ? (0x40000000 - f) : f;
+
+    /* mu/2 = sin(pi * f), in the range [0 sqrt(2)/2] */
+    pCoeffs[2U * k] = arm_sin_q31(f >> 1);
+  }
+
+  /* Assign bin parameters */
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
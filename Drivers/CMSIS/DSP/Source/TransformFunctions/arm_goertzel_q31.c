@@ -0,0 +1,253 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 multi-bin Goertzel
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Power at the end of a block from the last resonator states.
+ * @param[in] m   coefficient mu/2 = sin(w/2) in 1.31 format.
+ * @param[in] u1  scaled state u[N-1].
+ * @param[in] d1  state difference d[N-1].
+ * @return    |X(f)|^2 in 2.62 format.
+ */
+static q63_t arm_goertzel_power_q31(
+  q31_t m,
+  q31_t u1,
+  q31_t d1)
+{
+  q31_t u2;                                      /* scaled state u[N-2] */
+  q31_t t;                                       /* mu/2 * u[N-2] */
+  q63_t acc;                                     /* power / 4 in 2.62 format */
+
+  /* u[N-2] = u[N-1] - mu * d[N-1] */
+  u2 = (q31_t) ((q63_t) u1 - (((q63_t) m * d1) >> 30));
+  t = (q31_t) (((q63_t) m * u2) >> 31);
+
+  /* (d1^2 + 2 * t * d1 + u2^2) / 4, the partial sums stay below 2^63 */
+  acc  = ((q63_t) d1 * d1) >> 2;
+  acc += ((q63_t) t * d1) >> 1;
+  acc += ((q63_t) u2 * u2) >> 2;
+
+  /* The truncations can give a small negative value */
+  acc = (acc < 0) ? 0 : acc;
+
+  return (acc << 2);
+}
+
+/**
+ * @brief  Processing function for the Q31 multi-bin Goertzel.
+ * @param[in]  S          points to an instance of the Q31 Goertzel structure.
+ * @param[in]  pSrc       points to the block of input samples.
+ * @param[out] pDst       points to the power at each target frequency, <code>numBins</code> values.
+ * @param[in]  blockSize  number of input samples.
+ * @return     number of bits <code>shift</code> by which the input was scaled down.
+ *
+ * \par
+ * The state <code>s</code> of the Reinsch form grows like <code>N^2</code> close to DC,
+ * which would cost <code>log2(N)</code> bits of headroom in fixed point.  The Q31 function
+ * tracks <code>u = mu * s</code> with <code>mu = 2*sin(w/2)</code> instead:
+ * <pre>
+ *    d[n] = d[n-1] - mu * u[n-1] + x[n]
+ *    u[n] = u[n-1] + mu * d[n]
+ *    |X(f)|^2 = d[N-1]^2 + mu * d[N-1] * u[N-2] + u[N-2]^2
+ * </pre>
+ * The power form is an invariant of the recursion, so both states stay below
+ * <code>4*N</code> times the largest input at any frequency, for one more multiplication
+ * per sample.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is scaled down by <code>shift = ceil(log2(blockSize)) + 3</code> bits before
+ * the resonators, so the function cannot overflow.  The output is the power of the
+ * scaled input in 2.62 format, i.e. <code>|X(f)|^2 / 2^(2*shift)</code>.
+ */
+
+uint32_t arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q63_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pCoeffs = S->pCoeffs;             /* mu/2 and sign mask of the odd samples */
+  uint32_t shift;                                /* input scaling */
+  q31_t *pIn;                                    /* input pointer */
+  q31_t x0, x1;                                  /* scaled even and odd input samples */
+  q31_t m, g;                                    /* mu/2 and sign mask */
+  q31_t u, d;                                    /* scaled state and state difference */
+  uint32_t binCnt, blkCnt;                       /* loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t m1, m2;                                  /* mu/2 */
+  q31_t g1, g2;                                  /* sign masks of the odd samples */
+  q31_t u1, u2;                                  /* scaled states */
+  q31_t d1, d2;                                  /* state differences */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Headroom for the sum of blockSize samples and for the gain of the recursion */
+  shift = ((blockSize > 1U) ? (32U - __CLZ(blockSize - 1U)) : 0U) + 3U;
+  shift = (shift > 31U) ? 31U : shift;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Two frequencies per pass over the input */
+  binCnt = S->numBins >> 1U;
+
+  /* First part of the processing.  Compute 2 frequencies at a time.
+   ** a second loop below computes the remaining frequency. */
+  while (binCnt > 0U)
+  {
+    m1 = pCoeffs[0];
+    g1 = pCoeffs[1];
+    m2 = pCoeffs[2];
+    g2 = pCoeffs[3];
+
+    /* Clear the resonator states */
+    u1 = u2 = 0;
+    d1 = d2 = 0;
+
+    pIn = pSrc;
+
+    /* Two samples at a time, the odd one is negated for the mirrored frequencies */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U)
+    {
+      x0 = pIn[0] >> shift;
+      x1 = pIn[1] >> shift;
+      pIn += 2U;
+
+      /* d[n] = d[n-1] - mu * u[n-1] + x[n], u[n] = u[n-1] + mu * d[n] */
+      d1 = (q31_t) (d1 - (((q63_t) m1 * u1) >> 30) + x0);
+      u1 = (q31_t) (u1 + (((q63_t) m1 * d1) >> 30));
+      d2 = (q31_t) (d2 - (((q63_t) m2 * u2) >> 30) + x0);
+      u2 = (q31_t) (u2 + (((q63_t) m2 * d2) >> 30));
+
+      d1 = (q31_t) (d1 - (((q63_t) m1 * u1) >> 30) + ((x1 ^ g1) - g1));
+      u1 = (q31_t) (u1 + (((q63_t) m1 * d1) >> 30));
+      d2 = (q31_t) (d2 - (((q63_t) m2 * u2) >> 30) + ((x1 ^ g2) - g2));
+      u2 = (q31_t) (u2 + (((q63_t) m2 * d2) >> 30));
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Last even sample of an odd block size */
+    if ((blockSize & 1U) != 0U)
+    {
+      x0 = *pIn >> shift;
+
+      d1 = (q31_t) (d1 - (((q63_t) m1 * u1) >> 30) + x0);
+      u1 = (q31_t) (u1 + (((q63_t) m1 * d1) >> 30));
+      d2 = (q31_t) (d2 - (((q63_t) m2 * u2) >> 30) + x0);
+      u2 = (q31_t) (u2 + (((q63_t) m2 * d2) >> 30));
+    }
+
+    pDst[0] = arm_goertzel_power_q31(m1, u1, d1);
+    pDst[1] = arm_goertzel_power_q31(m2, u2, d2);
+
+    pCoeffs += 4U;
+    pDst += 2U;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  /* If the number of frequencies is odd, compute the remaining one here. */
+  binCnt = S->numBins % 0x2U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize binCnt with the number of frequencies */
+  binCnt = S->numBins;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (binCnt > 0U)
+  {
+    m = pCoeffs[0];
+    g = pCoeffs[1];
+    pCoeffs += 2U;
+
+    /* Clear the resonator states */
+    u = 0;
+    d = 0;
+
+    pIn = pSrc;
+
+    /* Two samples at a time, the odd one is negated for the mirrored frequencies */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U)
+    {
+      x0 = pIn[0] >> shift;
+      x1 = pIn[1] >> shift;
+      pIn += 2U;
+
+      /* d[n] = d[n-1] - mu * u[n-1] + x[n], u[n] = u[n-1] + mu * d[n] */
+      d = (q31_t) (d - (((q63_t) m * u) >> 30) + x0);
+      u = (q31_t) (u + (((q63_t) m * d) >> 30));
+      d = (q31_t) (d - (((q63_t) m * u) >> 30) + ((x1 ^ g) - g));
+      u = (q31_t) (u + (((q63_t) m * d) >> 30));
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Last even sample of an odd block size */
+    if ((blockSize & 1U) != 0U)
+    {
+      d = (q31_t) (d - (((q63_t) m * u) >> 30) + (*pIn >> shift));
+      u = (q31_t) (u + (((q63_t) m * d) >> 30));
+    }
+
+    *pDst++ = arm_goertzel_power_q31(m, u, d);
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  return (shift);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_dct_f32.c
+ * Description:  DCT-II matrix generation function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Generates the orthonormal DCT-II matrix of the MFCC.
+ * @param[out] pDctCoefs     points to the <code>nbDctOutputs x nbMelFilters</code> matrix.
+ * @param[in]  nbDctOutputs  number of cepstral coefficients.
+ * @param[in]  nbMelFilters  number of mel filters.
+ * @return     none.
+ *
+ * \par
+ * Row <code>i</code> holds <code>s(i) * cos(pi * i * (2*j + 1) / (2*nbMelFilters))</code>,
+ * with <code>s(0) = sqrt(1/nbMelFilters)</code> and <code>s(i) = sqrt(2/nbMelFilters)</code>
+ * otherwise.  The magnitudes are at most 1, so the matrix can be converted to Q15.
+ */
+
+void arm_mfcc_dct_f32(
+  float32_t * pDctCoefs,
+  uint16_t nbDctOutputs,
+  uint16_t nbMelFilters)
+{
+  float32_t s0, s;                               /* row scales */
+  float32_t step = PI / (float32_t) (2U * nbMelFilters);  /* angle of one unit of i*(2j+1) */
+  uint32_t period = 4U * nbMelFilters;           /* period of the cosine in units of i*(2j+1) */
+  uint32_t i, j;                                 /* loop counters */
+
+  arm_sqrt_f32(1.0f / (float32_t) nbMelFilters, &s0);
+  arm_sqrt_f32(2.0f / (float32_t) nbMelFilters, &s);
+
+  for (i = 0U; i < nbDctOutputs; i++)
+  {
+    for (j = 0U; j < nbMelFilters; j++)
+    {
+      /* Reduce the angle to one period before the cosine */
+      *pDctCoefs++ = ((i == 0U) ? s0 : s) *
+        arm_cos_f32(step * (float32_t) ((i * (2U * j + 1U)) % period));
+    }
+  }
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_f32.c
+ * Description:  Floating-point MFCC function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MFCC Mel-Frequency Cepstral Coefficients
+ *
+ * The MFCC functions compute the mel-frequency cepstral coefficients of one frame of
+ * <code>fftLen</code> real samples.  The pipeline is:
+ * - pre-emphasis <code>y[n] = x[n] - a * x[n-1]</code>, the first sample of the frame
+ *   being its own predecessor,
+ * - multiplication by the window,
+ * - fast real FFT and power spectrum of <code>fftLen/2+1</code> values,
+ * - mel filterbank,
+ * - natural logarithm of the mel energies, which are first clamped to 2^-24,
+ * - DCT-II of the log-mel energies.
+ *
+ * \par
+ * The filterbank is stored sparsely.  Filter <code>m</code> weights the
+ * <code>pFilterLengths[m]</code> power values starting at bin <code>pFilterPos[m]</code>
+ * with the next <code>pFilterLengths[m]</code> values of <code>pFilterCoefs</code>.
+ * A triangular filter only covers a few bins, so the filterbank costs a small fraction of
+ * a dense <code>nbMelFilters x (fftLen/2+1)</code> matrix multiplication.
+ * The DCT is a dense <code>nbDctOutputs x nbMelFilters</code> matrix stored row by row.
+ *
+ * \par Instance Structure
+ * The window, the filterbank and the DCT matrix are owned by the caller and referenced by
+ * the instance structure, so the functions never allocate memory and the tables can be
+ * in flash.  The processing functions use a caller provided work buffer of
+ * <code>fftLen</code> values.
+ *
+ * \par Initialization Functions
+ * arm_mfcc_init_f32() and arm_mfcc_init_q15() set up the real FFT and check that
+ * <code>nbDctOutputs <= nbMelFilters < fftLen/2</code>.
+ * The tables can be generated once with arm_window_f32(), arm_mfcc_filterbank_f32() and
+ * arm_mfcc_dct_f32(), and converted with arm_float_to_q15() for the Q15 function.
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Floating-point MFCC.
+ * @param[in]  S     points to an instance of the floating-point MFCC structure.
+ * @param[in]  pSrc  points to the frame of <code>fftLen</code> input samples.
+ * @param[out] pDst  points to the <code>nbDctOutputs</code> cepstral coefficients.
+ * @param[in]  pTmp  points to a work buffer of <code>fftLen</code> values.
+ * @return     none.
+ *
+ * The input frame is not modified.
+ */
+
+void arm_mfcc_f32(
+  arm_mfcc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pTmp)
+{
+  uint32_t fftLen = S->fftLen;                   /* frame length */
+  uint32_t numBins = fftLen >> 1U;               /* number of complex bins */
+  uint32_t nbMel = S->nbMelFilters;              /* number of mel filters */
+  float32_t a = S->preEmphasis;                  /* pre-emphasis coefficient */
+  const float32_t *pWindow = S->pWindow;         /* window */
+  const float32_t *pCoefs = S->pFilterCoefs;     /* filterbank coefficients */
+  const float32_t *pDct = S->pDctCoefs;          /* DCT matrix */
+  float32_t *pMel = pTmp + numBins + 1U;         /* mel energies, after the power spectrum */
+  float32_t prev, cur;                           /* consecutive input samples */
+  float32_t re, im, nyquist;                     /* spectrum values */
+  uint32_t n, len;                               /* loop counter, filter length */
+
+  /* Pre-emphasis and window */
+  prev = pSrc[0];
+
+  for (n = 0U; n < fftLen; n++)
+  {
+    cur = pSrc[n];
+    pTmp[n] = (cur - a * prev) * pWindow[n];
+    prev = cur;
+  }
+
+  arm_rfft_fast_inplace_f32(&S->rfft, pTmp, 0U);
+
+  /* Power spectrum, in place.  DC and Nyquist are packed in the first complex value */
+  nyquist = pTmp[1] * pTmp[1];
+  pTmp[0] = pTmp[0] * pTmp[0];
+
+  for (n = 1U; n < numBins; n++)
+  {
+    re = pTmp[2U * n];
+    im = pTmp[2U * n + 1U];
+    pTmp[n] = re * re + im * im;
+  }
+
+  pTmp[numBins] = nyquist;
+
+  /* Sparse mel filterbank, each filter is a dot product with a few power values */
+  for (n = 0U; n < nbMel; n++)
+  {
+    len = S->pFilterLengths[n];
+    pMel[n] = 0.0f;
+
+    if (len > 0U)
+    {
+      arm_dot_prod_f32(pTmp + S->pFilterPos[n], (float32_t *) pCoefs, len, pMel + n);
+      pCoefs += len;
+    }
+
+    /* Clamp the energy before the logarithm */
+    pMel[n] = (pMel[n] > 5.96046448e-8f) ? pMel[n] : 5.96046448e-8f;
+  }
+
+  arm_vlog_f32(pMel, pMel, nbMel);
+
+  /* DCT-II of the log-mel energies */
+  for (n = 0U; n < S->nbDctOutputs; n++)
+  {
+    arm_dot_prod_f32((float32_t *) pDct, pMel, nbMel, pDst + n);
+    pDct += nbMel;
+  }
+}
+
+/**
+ * @} end of MFCC group
+ */
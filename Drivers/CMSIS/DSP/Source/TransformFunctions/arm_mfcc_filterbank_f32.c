@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_filterbank_f32.c
+ * Description:  Mel filterbank generation function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/* Frequency in Hz of a mel value, mel = 1127 * ln(1 + f/700) */
+static float32_t mfcc_mel_to_hz(
+  float32_t mel)
+{
+  float32_t e;
+
+  mel = mel / 1127.0f;
+  arm_vexp_f32(&mel, &e, 1U);
+
+  return (700.0f * (e - 1.0f));
+}
+
+/**
+ * @brief  Generates a sparse triangular mel filterbank.
+ * @param[in]  sampleRate      sample rate in Hz.
+ * @param[in]  fftLen          frame and FFT length.
+ * @param[in]  nbMelFilters    number of mel filters.
+ * @param[in]  fMin            lower edge of the first filter in Hz.
+ * @param[in]  fMax            upper edge of the last filter in Hz, at most <code>sampleRate/2</code>.
+ * @param[out] pFilterPos      points to the first bin of each filter, <code>nbMelFilters</code> values.
+ * @param[out] pFilterLengths  points to the number of bins of each filter, <code>nbMelFilters</code> values.
+ * @param[out] pFilterCoefs    points to the filter coefficients, at most <code>fftLen+2</code> values.
+ * @return     number of coefficients written to <code>pFilterCoefs</code>.
+ *
+ * \par
+ * The filter edges are equally spaced on the mel scale <code>1127 * ln(1 + f/700)</code>.
+ * Filter <code>m</code> rises linearly in frequency from 0 at edge <code>m</code> to 1 at
+ * edge <code>m+1</code> and falls back to 0 at edge <code>m+2</code>.  Only its non zero
+ * coefficients are stored.  A filter narrower than a bin may have no coefficient.
+ * As two filters at most overlap at any bin, <code>fftLen+2</code> coefficients are enough.
+ */
+
+uint32_t arm_mfcc_filterbank_f32(
+  float32_t sampleRate,
+  uint16_t fftLen,
+  uint16_t nbMelFilters,
+  float32_t fMin,
+  float32_t fMax,
+  uint16_t * pFilterPos,
+  uint16_t * pFilterLengths,
+  float32_t * pFilterCoefs)
+{
+  float32_t melMin, melStep, mel;                /* mel scale */
+  float32_t left, center, right;                 /* edges of a filter in Hz */
+  float32_t binWidth = sampleRate / (float32_t) fftLen;   /* frequency step of the bins */
+  float32_t f, w;                                /* bin frequency and weight */
+  uint32_t numBins = ((uint32_t) fftLen >> 1U) + 1U;      /* number of power values */
+  uint32_t numCoefs = 0U;                        /* number of coefficients written */
+  uint32_t m, k, len;                            /* loop counters, filter length */
+
+  /* Mel values of the frequency range */
+  f = 1.0f + fMin / 700.0f;
+  arm_vlog_f32(&f, &melMin, 1U);
+  melMin = 1127.0f * melMin;
+
+  f = 1.0f + fMax / 700.0f;
+  arm_vlog_f32(&f, &mel, 1U);
+  melStep = (1127.0f * mel - melMin) / (float32_t) (nbMelFilters + 1U);
+
+  left = fMin;
+  center = mfcc_mel_to_hz(melMin + melStep);
+
+  for (m = 0U; m < nbMelFilters; m++)
+  {
+    right = mfcc_mel_to_hz(melMin + (float32_t) (m + 2U) * melStep);
+
+    /* First bin above the lower edge */
+    k = (uint32_t) (left / binWidth) + 1U;
+    pFilterPos[m] = (uint16_t) k;
+    len = 0U;
+
+    while (k < numBins)
+    {
+      f = (float32_t) k * binWidth;
+
+      if (f >= right)
+      {
+        break;
+      }
+
+      w = (f <= center) ? ((f - left) / (center - left)) : ((right - f) / (right - center));
+
+      pFilterCoefs[numCoefs++] = w;
+      len++;
+      k++;
+    }
+
+    pFilterLengths[m] = (uint16_t) len;
+
+    left = center;
+    center = right;
+  }
+
+  return (numCoefs);
+}
+
+/**
+ * @} end of MFCC group
+ */
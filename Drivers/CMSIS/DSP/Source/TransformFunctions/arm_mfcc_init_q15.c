@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_q15.c
+ * Description:  Q15 MFCC initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 MFCC.
+ * @param[out] S               points to an instance of the Q15 MFCC structure.
+ * @param[in]  fftLen          frame and FFT length.
+ * @param[in]  nbMelFilters    number of mel filters, smaller than <code>fftLen/2</code>.
+ * @param[in]  nbDctOutputs    number of cepstral coefficients, at most <code>nbMelFilters</code>.
+ * @param[in]  preEmphasis     pre-emphasis coefficient, 0 disables the pre-emphasis.
+ * @param[in]  pWindow         points to the window of <code>fftLen</code> values.
+ * @param[in]  pFilterPos      points to the first bin of each mel filter.
+ * @param[in]  pFilterLengths  points to the number of bins of each mel filter.
+ * @param[in]  pFilterCoefs    points to the coefficients of all the mel filters, one after the other.
+ * @param[in]  pDctCoefs       points to the <code>nbDctOutputs x nbMelFilters</code> DCT matrix.
+ * @return     The function returns ARM_MATH_SUCCESS if the initialization is successful,
+ * ARM_MATH_ARGUMENT_ERROR if the FFT length is not supported or the numbers of filters and
+ * outputs are not consistent.
+ */
+
+arm_status arm_mfcc_init_q15(
+  arm_mfcc_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t nbMelFilters,
+  uint16_t nbDctOutputs,
+  q15_t preEmphasis,
+  const q15_t * pWindow,
+  const uint16_t * pFilterPos,
+  const uint16_t * pFilterLengths,
+  const q15_t * pFilterCoefs,
+  const q15_t * pDctCoefs)
+{
+  arm_status status;
+
+  /* Initialize the real FFT, this also checks the FFT length */
+  status = arm_rfft_fast_init_q15(&S->rfft, fftLen);
+
+  /* The mel energies are stored after the power spectrum in the work buffer */
+  if ((nbMelFilters == 0U) || (nbMelFilters >= (fftLen >> 1U)) || (nbDctOutputs > nbMelFilters))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* Assign dimensions */
+    S->fftLen = fftLen;
+    S->nbMelFilters = nbMelFilters;
+    S->nbDctOutputs = nbDctOutputs;
+    S->preEmphasis = preEmphasis;
+
+    /* Assign table pointers */
+    S->pWindow = pWindow;
+    S->pFilterPos = pFilterPos;
+    S->pFilterLengths = pFilterLengths;
+    S->pFilterCoefs = pFilterCoefs;
+    S->pDctCoefs = pDctCoefs;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MFCC group
+ */
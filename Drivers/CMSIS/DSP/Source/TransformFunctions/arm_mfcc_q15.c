@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_q15.c
+ * Description:  Q15 MFCC function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Q15 MFCC.
+ * @param[in]  S     points to an instance of the Q15 MFCC structure.
+ * @param[in]  pSrc  points to the frame of <code>fftLen</code> input samples.
+ * @param[out] pDst  points to the <code>nbDctOutputs</code> cepstral coefficients in 12.20 format.
+ * @param[in]  pTmp  points to a work buffer of <code>fftLen</code> values.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The pre-emphasis is computed in 2.14 format so that it cannot overflow.  The
+ * windowed frame is then shifted left to use the full 1.15 range before the real FFT,
+ * and the mel energies are accumulated in 64 bits.  The logarithm of each energy is
+ * computed from its normalized mantissa with arm_vlog_q31() and its exponent, which
+ * includes the normalization shift and the scaling of arm_rfft_fast_q15().  The log-mel
+ * energies and the cepstral coefficients are therefore those of the floating-point
+ * function for the same input in 1.15 format, in 12.20 format.
+ */
+
+void arm_mfcc_q15(
+  arm_mfcc_instance_q15 * S,
+  q15_t * pSrc,
+  q31_t * pDst,
+  q31_t * pTmp)
+{
+  uint32_t fftLen = S->fftLen;                   /* frame length */
+  uint32_t numBins = fftLen >> 1U;               /* number of complex bins */
+  uint32_t nbMel = S->nbMelFilters;              /* number of mel filters */
+  q15_t a = S->preEmphasis;                      /* pre-emphasis coefficient */
+  const q15_t *pCoefs = S->pFilterCoefs;         /* filterbank coefficients */
+  const q15_t *pDct = S->pDctCoefs;              /* DCT matrix */
+  q15_t *pFrame = (q15_t *) pTmp;                /* windowed frame, first half of the buffer */
+  q15_t *pSpec = pFrame + fftLen;                /* packed FFT output, second half of the buffer */
+  q31_t *pMel = pTmp + numBins + 1U;             /* log-mel energies, after the power spectrum */
+  const q31_t *pPow;                             /* points to the power values of a filter */
+  q15_t prev, cur;                               /* consecutive input samples */
+  q31_t dc, nyquist, mant, lnm;                  /* spectrum values, mantissa and its logarithm */
+  q63_t acc;                                     /* accumulator */
+  uint32_t maxAbs, shift, hi, clz;               /* normalization */
+  int32_t exponent;                              /* power of two of an energy */
+  uint32_t n, k, len;                            /* loop counters, filter length */
+
+  /* Pre-emphasis, divided by 2 because the difference can reach 2 in magnitude */
+  prev = pSrc[0];
+  maxAbs = 0U;
+
+  for (n = 0U; n < fftLen; n++)
+  {
+    cur = pSrc[n];
+    pFrame[n] = (q15_t) ((((q31_t) cur << 15) - ((q31_t) a * prev)) >> 16);
+    prev = cur;
+  }
+
+  /* Window */
+  arm_mult_q15(pFrame, (q15_t *) S->pWindow, pFrame, fftLen);
+
+  /* Block floating point: shift the frame left to use the full range */
+  for (n = 0U; n < fftLen; n++)
+  {
+    k = (uint32_t) ((pFrame[n] < 0) ? -(q31_t) pFrame[n] : pFrame[n]);
+    maxAbs = (k > maxAbs) ? k : maxAbs;
+  }
+
+  shift = (maxAbs == 0U) ? 0U : (__CLZ(maxAbs) - 17U);
+
+  arm_shift_q15(pFrame, (int8_t) shift, pFrame, fftLen);
+
+  /* The spectrum is scaled down by 2^k */
+  k = arm_rfft_fast_q15(&S->rfft, pFrame, pSpec, 0U);
+
+  /* Power spectrum in 3.29 format over the frame.  DC and Nyquist are packed in the
+   * first complex value, which is overwritten last */
+  dc = ((q31_t) pSpec[0] * pSpec[0]) >> 1;
+  nyquist = ((q31_t) pSpec[1] * pSpec[1]) >> 1;
+
+  for (n = 1U; n < numBins; n++)
+  {
+    pTmp[n] = (q31_t) (((uint32_t) ((q31_t) pSpec[2U * n] * pSpec[2U * n]) +
+                        (uint32_t) ((q31_t) pSpec[2U * n + 1U] * pSpec[2U * n + 1U])) >> 1);
+  }
+
+  pTmp[0] = dc;
+  pTmp[numBins] = nyquist;
+
+  /* Power of two of the energies: 3.29 power times 1.15 coefficients, the FFT scaling, the
+   * halving of the pre-emphasis and the normalization of the frame, all squared */
+  exponent = 2 * (int32_t) k + 2 - 2 * (int32_t) shift - 44;
+
+  /* Sparse mel filterbank and logarithm */
+  for (n = 0U; n < nbMel; n++)
+  {
+    len = S->pFilterLengths[n];
+    pPow = pTmp + S->pFilterPos[n];
+    acc = 0;
+
+    for (k = 0U; k < len; k++)
+    {
+      acc += (q63_t) *pPow++ * *pCoefs++;
+    }
+
+    if (acc > 0)
+    {
+      /* Normalize the energy to a mantissa in [0.5 1) in 1.31 format */
+      hi = (uint32_t) ((uint64_t) acc >> 32);
+      clz = (hi != 0U) ? __CLZ(hi) : (32U + __CLZ((uint32_t) acc));
+      mant = (q31_t) (((uint64_t) acc << (clz - 1U)) >> 32);
+
+      /* ln(energy) = ln(mant) + (64 - clz + exponent) * ln(2), in 12.20 format */
+      arm_vlog_q31(&mant, &lnm, 1U);
+      lnm = (lnm >> 6) + (q31_t) (((q63_t) (64 - (int32_t) clz + exponent) * 1488522236) >> 11);
+    }
+    else
+    {
+      lnm = (q31_t) 0x80000000;
+    }
+
+    /* Clamp the logarithm to ln(2^-24) */
+    pMel[n] = (lnm > -17443619) ? lnm : -17443619;
+  }
+
+  /* DCT-II of the log-mel energies, 12.20 times 1.15 */
+  for (n = 0U; n < S->nbDctOutputs; n++)
+  {
+    acc = 0;
+
+    for (k = 0U; k < nbMel; k++)
+    {
+      acc += (q63_t) *pDct++ * pMel[k];
+    }
+
+    pDst[n] = clip_q63_to_q31(acc >> 15);
+  }
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_f16.c
+ * Description:  RFFT & RIFFT Half-precision process function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions
+ * -------------------------------------------------------------------- */
+
+/* Splits the CFFT of the packed real sequence into the first half of the
+ * real spectrum, as the arm_rfft_fast_f32() stage. */
+static void stage_rfft_f16(
+  const arm_rfft_fast_instance_f16 * S,
+  float16_t * p,
+  float16_t * pOut)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t twidStep = 2U * S->twidCoefRModifier; /* RFFT twiddle table stride */
+  const float32_t *pCoeff = S->pTwiddleRFFT;     /* Points to RFFT Twiddle factors */
+  float16_t *pA = p;                             /* increasing pointer */
+  float16_t *pB = p;                             /* decreasing pointer */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t twR, twI;                            /* RFFT Twiddle coefficients */
+  float32_t t1a, t1b;                            /* temporary variables */
+
+  k = (S->fftLenRFFT >> 1U) - 1U;
+
+  /* Pack first and last sample of the frequency domain together */
+  xAR = convert_f16_to_f32(pA[0]);
+  xAI = convert_f16_to_f32(pA[1]);
+
+  *pOut++ = convert_f32_to_f16(xAR + xAI);
+  *pOut++ = convert_f32_to_f16(xAR - xAI);
+
+  pB = p + 2U * k;
+  pA += 2;
+  pCoeff += twidStep;
+
+  while (k > 0U)
+  {
+    xBI = convert_f16_to_f32(pB[1]);
+    xBR = convert_f16_to_f32(pB[0]);
+    xAR = convert_f16_to_f32(pA[0]);
+    xAI = convert_f16_to_f32(pA[1]);
+
+    /* The CFFT table holds cos and sin, the real stage uses tw = sin + i cos */
+    twI = pCoeff[0];
+    twR = pCoeff[1];
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    /* 1/2 * (xA + conj(xB) + tw * (xB - conj(xA))) */
+    *pOut++ = convert_f32_to_f16(0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b)));
+    *pOut++ = convert_f32_to_f16(0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b)));
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+}
+
+/* Prepares the packed spectrum for the inverse CFFT, as the
+ * arm_rfft_fast_f32() merge stage. */
+static void merge_rfft_f16(
+  const arm_rfft_fast_instance_f16 * S,
+  float16_t * p,
+  float16_t * pOut)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t twidStep = 2U * S->twidCoefRModifier; /* RFFT twiddle table stride */
+  const float32_t *pCoeff = S->pTwiddleRFFT;     /* Points to RFFT Twiddle factors */
+  float16_t *pA = p;                             /* increasing pointer */
+  float16_t *pB = p;                             /* decreasing pointer */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t twR, twI;                            /* RFFT Twiddle coefficients */
+  float32_t t1a, t1b;                            /* temporary variables */
+
+  k = (S->fftLenRFFT >> 1U) - 1U;
+
+  xAR = convert_f16_to_f32(pA[0]);
+  xAI = convert_f16_to_f32(pA[1]);
+
+  *pOut++ = convert_f32_to_f16(0.5f * (xAR + xAI));
+  *pOut++ = convert_f32_to_f16(0.5f * (xAR - xAI));
+
+  pB = p + 2U * k;
+  pA += 2;
+  pCoeff += twidStep;
+
+  while (k > 0U)
+  {
+    xBI = convert_f16_to_f32(pB[1]);
+    xBR = convert_f16_to_f32(pB[0]);
+    xAR = convert_f16_to_f32(pA[0]);
+    xAI = convert_f16_to_f32(pA[1]);
+
+    twI = pCoeff[0];
+    twR = pCoeff[1];
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    /* 1/2 * (xA + conj(xB) - tw * (xA - conj(xB))) */
+    *pOut++ = convert_f32_to_f16(0.5f * (xAR + xBR - (twR * t1a) - (twI * t1b)));
+    *pOut++ = convert_f32_to_f16(0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b)));
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the half-precision fast real FFT.
+* @param[in]  *S              points to an arm_rfft_fast_instance_f16 structure.
+* @param[in]  *p              points to the input buffer, which is modified.
+* @param[out] *pOut           points to the output buffer.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* The output layout and scaling are the same as for arm_rfft_fast_f32(): the forward
+* transform is not scaled and the inverse transform is scaled by <code>1/(fftLen/2)</code>.
+* The forward spectrum must stay below 65504 in magnitude, which holds for inputs up to
+* <code>65504/(fftLen/2)</code>.
+*/
+void arm_rfft_fast_f16(
+  const arm_rfft_fast_instance_f16 * S,
+  float16_t * p,
+  float16_t * pOut,
+  uint8_t ifftFlag)
+{
+  /* Calculation of Real FFT */
+  if (ifftFlag)
+  {
+    /*  Real FFT compression */
+    merge_rfft_f16(S, p, pOut);
+
+    /* Complex IFFT process */
+    arm_cfft_f16(S->pCfft, pOut, ifftFlag, 1U);
+  }
+  else
+  {
+    /* Calculation of RFFT of input */
+    arm_cfft_f16(S->pCfft, p, ifftFlag, 1U);
+
+    /*  Real FFT extraction */
+    stage_rfft_f16(S, p, pOut);
+  }
+}
+
+/**
+* @} end of RealFFT group
+*/
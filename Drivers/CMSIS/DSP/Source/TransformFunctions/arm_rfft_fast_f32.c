@@ -239,6 +239,11 @@ float32_t * p, float32_t * pOut)
  * The complex transforms used internally include scaling to prevent fixed-point
  * overflows.  The overall scaling equals 1/(fftLen/2).
  * \par
+ * arm_rfft_fast_q31() and arm_rfft_fast_q15() follow the floating-point fast
+ * algorithm: a complex FFT of length fftLen/2 and a split stage, with the same
+ * packed output layout as arm_rfft_fast_f32().  They return the number of bits
+ * by which the output is scaled down compared to the floating-point result.
+ * \par
  * A separate instance structure must be defined for each transform used but
  * twiddle factor and bit reversal tables can be reused.
  * \par
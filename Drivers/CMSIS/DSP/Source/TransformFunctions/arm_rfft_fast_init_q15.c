@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_q15.c
+ * Description:  Q15 fast RFFT & RIFFT initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 fast real FFT.
+* @param[in,out] *S             points to an arm_rfft_fast_instance_q15 structure.
+* @param[in]     fftLen         length of the Real Sequence.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code>	Specifies length of RFFT/CIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* The internal complex FFT points to the constant <code>arm_cfft_sR_q15_lenN</code> instance of
+* length <code>fftLen/2</code>. The twiddle factors of the real stage are read from the
+* 4096 point CFFT table with a stride of <code>4096/fftLen</code>, so no separate real FFT
+* tables are needed.
+*/
+arm_status arm_rfft_fast_init_q15(
+  arm_rfft_fast_instance_q15 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLenRFFT = fftLen;
+
+  /*  Initialise the Twiddle coefficient pointer */
+  S->pTwiddleRFFT = twiddleCoef_4096_q15;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (fftLen)
+  {
+  case 4096U:
+    /*  Initializations of structure parameters for 4096 point FFT */
+    /*  Initialise the internal CFFT instance */
+    S->pCfft = &arm_cfft_sR_q15_len2048;
+    /*  Initialise the twiddle coef modifier value */
+    S->twidCoefRModifier = 1U;
+    break;
+  case 2048U:
+    S->pCfft = &arm_cfft_sR_q15_len1024;
+    S->twidCoefRModifier = 2U;
+    break;
+  case 1024U:
+    S->pCfft = &arm_cfft_sR_q15_len512;
+    S->twidCoefRModifier = 4U;
+    break;
+  case 512U:
+    S->pCfft = &arm_cfft_sR_q15_len256;
+    S->twidCoefRModifier = 8U;
+    break;
+  case 256U:
+    S->pCfft = &arm_cfft_sR_q15_len128;
+    S->twidCoefRModifier = 16U;
+    break;
+  case 128U:
+    S->pCfft = &arm_cfft_sR_q15_len64;
+    S->twidCoefRModifier = 32U;
+    break;
+  case 64U:
+    S->pCfft = &arm_cfft_sR_q15_len32;
+    S->twidCoefRModifier = 64U;
+    break;
+  case 32U:
+    S->pCfft = &arm_cfft_sR_q15_len16;
+    S->twidCoefRModifier = 128U;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RealFFT group
+ */
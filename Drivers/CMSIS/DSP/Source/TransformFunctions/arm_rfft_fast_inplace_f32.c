@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_inplace_f32.c
+ * Description:  In-place RFFT & RIFFT Floating point process function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/* Split stage of the forward transform, computing the bins k and L-k from the same pair of inputs */
+static void stage_rfft_inplace_f32(
+    arm_rfft_fast_instance_f32 * S,
+    float32_t * p)
+{
+    uint32_t L = (S->Sint).fftLen;                 /* length of the complex FFT */
+    const float32_t *pCoefA = S->pTwiddleRFFT + 2; /* twiddle of the increasing pointer */
+    const float32_t *pCoefB = S->pTwiddleRFFT + 2U * (L - 1U); /* twiddle of the decreasing pointer */
+    float32_t *pA = p + 2;                         /* increasing pointer */
+    float32_t *pB = p + 2U * (L - 1U);             /* decreasing pointer */
+    float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+    float32_t t1a, t1b;                            /* temporary variables */
+    float32_t twR, twI;                            /* RFFT twiddle coefficients */
+    uint32_t k;                                    /* loop counter */
+
+    /* Pack first and last sample of the frequency domain together */
+    xAR = p[0];
+    xAI = p[1];
+
+    p[0] = xAR + xAI;
+    p[1] = xAR - xAI;
+
+    /* The pair meets in the middle at k = L/2, where both halves compute the same bin */
+    k = L >> 1U;
+
+    while (k > 0U)
+    {
+        xAR = pA[0];
+        xAI = pA[1];
+        xBR = pB[0];
+        xBI = pB[1];
+
+        t1a = xBR - xAR;
+        t1b = xBI + xAI;
+
+        twR = pCoefA[0];
+        twI = pCoefA[1];
+
+        pA[0] = 0.5f * (xAR + xBR + twR * t1a + twI * t1b);
+        pA[1] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+
+        /* Same with A and B exchanged: t1a changes sign */
+        twR = pCoefB[0];
+        twI = pCoefB[1];
+
+        pB[0] = 0.5f * (xBR + xAR - twR * t1a + twI * t1b);
+        pB[1] = 0.5f * (xBI - xAI - twI * t1a - twR * t1b);
+
+        pA += 2;
+        pB -= 2;
+        pCoefA += 2;
+        pCoefB -= 2;
+
+        /* Decrement the loop counter */
+        k--;
+    }
+}
+
+/* Merge stage of the inverse transform, computing the outputs k and L-k from the same pair of inputs */
+static void merge_rfft_inplace_f32(
+    arm_rfft_fast_instance_f32 * S,
+    float32_t * p)
+{
+    uint32_t L = (S->Sint).fftLen;                 /* length of the complex FFT */
+    const float32_t *pCoefA = S->pTwiddleRFFT + 2; /* twiddle of the increasing pointer */
+    const float32_t *pCoefB = S->pTwiddleRFFT + 2U * (L - 1U); /* twiddle of the decreasing pointer */
+    float32_t *pA = p + 2;                         /* increasing pointer */
+    float32_t *pB = p + 2U * (L - 1U);             /* decreasing pointer */
+    float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+    float32_t t1a, t1b;                            /* temporary variables */
+    float32_t twR, twI;                            /* RFFT twiddle coefficients */
+    uint32_t k;                                    /* loop counter */
+
+    xAR = p[0];
+    xAI = p[1];
+
+    p[0] = 0.5f * (xAR + xAI);
+    p[1] = 0.5f * (xAR - xAI);
+
+    k = L >> 1U;
+
+    while (k > 0U)
+    {
+        xAR = pA[0];
+        xAI = pA[1];
+        xBR = pB[0];
+        xBI = pB[1];
+
+        t1a = xAR - xBR;
+        t1b = xAI + xBI;
+
+        twR = pCoefA[0];
+        twI = pCoefA[1];
+
+        pA[0] = 0.5f * (xAR + xBR - twR * t1a - twI * t1b);
+        pA[1] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+
+        /* Same with A and B exchanged: t1a changes sign */
+        twR = pCoefB[0];
+        twI = pCoefB[1];
+
+        pB[0] = 0.5f * (xBR + xAR + twR * t1a - twI * t1b);
+        pB[1] = 0.5f * (xBI - xAI - twI * t1a - twR * t1b);
+
+        pA += 2;
+        pB -= 2;
+        pCoefA += 2;
+        pCoefB -= 2;
+
+        /* Decrement the loop counter */
+        k--;
+    }
+}
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief In-place processing function for the floating-point real FFT.
+* @param[in]      *S         points to an arm_rfft_fast_instance_f32 structure.
+* @param[in, out] *p         points to the buffer of <code>fftLenRFFT</code> values. Processing occurs in-place.
+* @param[in]      ifftFlag   RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* Computes the same transform as arm_rfft_fast_f32(), with the same packed spectrum
+* layout, but overwrites the input with the output instead of writing to a second
+* buffer of <code>fftLenRFFT</code> values.  The split and merge stages process the
+* bins <code>k</code> and <code>fftLenRFFT/2-k</code> together so that both are
+* computed before either is overwritten.
+*/
+
+void arm_rfft_fast_inplace_f32(
+    arm_rfft_fast_instance_f32 * S,
+    float32_t * p,
+    uint8_t ifftFlag)
+{
+    arm_cfft_instance_f32 * Sint = &(S->Sint);
+    Sint->fftLen = S->fftLenRFFT / 2;
+
+    /* Calculation of Real FFT */
+    if (ifftFlag)
+    {
+        /*  Real FFT compression */
+        merge_rfft_inplace_f32(S, p);
+
+        /* Complex IFFT process */
+        arm_cfft_f32(Sint, p, ifftFlag, 1);
+    }
+    else
+    {
+        /* Calculation of RFFT of input */
+        arm_cfft_f32(Sint, p, ifftFlag, 1);
+
+        /*  Real FFT extraction */
+        stage_rfft_inplace_f32(S, p);
+    }
+}
+
+/**
+* @} end of RealFFT group
+*/
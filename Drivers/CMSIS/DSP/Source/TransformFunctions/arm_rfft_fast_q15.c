@@ -0,0 +1,303 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_q15.c
+ * Description:  Q15 fast RFFT & RIFFT built on the half length CFFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions
+ * -------------------------------------------------------------------- */
+
+/* Splits the CFFT of the packed real sequence into the first half of the
+ * real spectrum.  The output is half of the arm_rfft_fast_f32() stage. */
+static void stage_rfft_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t twidStep = 2U * S->twidCoefRModifier; /* RFFT twiddle table stride */
+  const q15_t *pCoeff = S->pTwiddleRFFT;         /* Points to RFFT Twiddle factors */
+  q15_t *pA = p;                                 /* increasing pointer */
+  q15_t *pB = p;                                 /* decreasing pointer */
+  q31_t outR, outI;                              /* temporary outputs */
+  q31_t p0, p1;                                  /* twiddle products */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t xA, xB, tw, s, t;                        /* packed complex values */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q31_t xAR, xAI, xBR, xBI;                      /* temporary variables */
+  q31_t twR, twI;                                /* RFFT Twiddle coefficients */
+  q31_t sR, sI, t1a, t1b;                        /* halved sums and differences */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  k = (S->fftLenRFFT >> 1U) - 1U;
+
+  /* Pack first and last sample of the frequency domain together */
+  outR = ((q31_t) pA[0] + pA[1]) >> 1;
+  outI = ((q31_t) pA[0] - pA[1]) >> 1;
+
+  *pOut++ = (q15_t) outR;
+  *pOut++ = (q15_t) outI;
+
+  pB = p + 2U * k;
+  pA += 2;
+  pCoeff += twidStep;
+
+#if defined (ARM_MATH_DSP)
+
+  while (k > 0U)
+  {
+    xA = *__SIMD32(pA);
+    xB = *__SIMD32(pB);
+
+    /* The CFFT table holds cos and sin, the real stage uses tw = sin + i cos */
+    tw = *__SIMD32(pCoeff);
+
+    /* s = ((xAR + xBR)/2, (xAI - xBI)/2), t = ((xBR - xAR)/2, (xBI + xAI)/2) */
+    s = __PKHBT(__SHADD16(xA, xB), __SHSUB16(xA, xB), 0);
+    t = __PKHBT(__SHSUB16(xB, xA), __SHADD16(xB, xA), 0);
+
+    /* real(tw * (xB - conj(xA))) and imag(tw * (xB - conj(xA))) in 2.30 format */
+    p0 = (q31_t) __SMUADX(tw, t);
+    p1 = (q31_t) __SMUSD(tw, t);
+
+    /* 1/4 * (xA + conj(xB) + tw * (xB - conj(xA))) */
+    outR = (((q31_t) (s << 16) >> 2) + (p0 >> 1)) >> 15;
+    outI = (((s >> 16) << 14) + (p1 >> 1)) >> 15;
+
+    *__SIMD32(pOut)++ = __PKHBT(__SSAT(outR, 16), __SSAT(outI, 16), 16);
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+
+#else
+
+  while (k > 0U)
+  {
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    /* The CFFT table holds cos and sin, the real stage uses tw = sin + i cos */
+    twI = pCoeff[0];
+    twR = pCoeff[1];
+
+    sR = (xAR + xBR) >> 1;
+    sI = (xAI - xBI) >> 1;
+    t1a = (xBR - xAR) >> 1;
+    t1b = (xBI + xAI) >> 1;
+
+    /* real(tw * (xB - conj(xA))) and imag(tw * (xB - conj(xA))) in 2.30 format */
+    p0 = twR * t1a + twI * t1b;
+    p1 = twI * t1a - twR * t1b;
+
+    /* 1/4 * (xA + conj(xB) + tw * (xB - conj(xA))) */
+    outR = ((sR << 14) + (p0 >> 1)) >> 15;
+    outI = ((sI << 14) + (p1 >> 1)) >> 15;
+
+    *pOut++ = (q15_t) __SSAT(outR, 16);
+    *pOut++ = (q15_t) __SSAT(outI, 16);
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+}
+
+/* Prepares the packed spectrum for the inverse CFFT.  The output is the same
+ * as the arm_rfft_fast_f32() merge stage. */
+static void merge_rfft_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t twidStep = 2U * S->twidCoefRModifier; /* RFFT twiddle table stride */
+  const q15_t *pCoeff = S->pTwiddleRFFT;         /* Points to RFFT Twiddle factors */
+  q15_t *pA = p;                                 /* increasing pointer */
+  q15_t *pB = p;                                 /* decreasing pointer */
+  q31_t outR, outI;                              /* temporary outputs */
+  q31_t p0, p1;                                  /* twiddle products */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t xA, xB, tw, s, t;                        /* packed complex values */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q31_t xAR, xAI, xBR, xBI;                      /* temporary variables */
+  q31_t twR, twI;                                /* RFFT Twiddle coefficients */
+  q31_t sR, sI, t1a, t1b;                        /* halved sums and differences */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  k = (S->fftLenRFFT >> 1U) - 1U;
+
+  outR = ((q31_t) pA[0] + pA[1]) >> 1;
+  outI = ((q31_t) pA[0] - pA[1]) >> 1;
+
+  *pOut++ = (q15_t) outR;
+  *pOut++ = (q15_t) outI;
+
+  pB = p + 2U * k;
+  pA += 2;
+  pCoeff += twidStep;
+
+#if defined (ARM_MATH_DSP)
+
+  while (k > 0U)
+  {
+    xA = *__SIMD32(pA);
+    xB = *__SIMD32(pB);
+    tw = *__SIMD32(pCoeff);
+
+    /* s = ((xAR + xBR)/2, (xAI - xBI)/2), t = ((xAR - xBR)/2, (xAI + xBI)/2) */
+    s = __PKHBT(__SHADD16(xA, xB), __SHSUB16(xA, xB), 0);
+    t = __PKHBT(__SHSUB16(xA, xB), __SHADD16(xA, xB), 0);
+
+    /* real(tw * (xA - conj(xB))) and imag(tw * (xA - conj(xB))) in 2.30 format */
+    p0 = (q31_t) __SMUADX(tw, t);
+    p1 = (q31_t) __SMUSD(tw, t);
+
+    /* 1/2 * (xA + conj(xB) - tw * (xA - conj(xB))) */
+    outR = (((q31_t) (s << 16) >> 2) - (p0 >> 1)) >> 14;
+    outI = (((s >> 16) << 14) + (p1 >> 1)) >> 14;
+
+    *__SIMD32(pOut)++ = __PKHBT(__SSAT(outR, 16), __SSAT(outI, 16), 16);
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+
+#else
+
+  while (k > 0U)
+  {
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twI = pCoeff[0];
+    twR = pCoeff[1];
+
+    sR = (xAR + xBR) >> 1;
+    sI = (xAI - xBI) >> 1;
+    t1a = (xAR - xBR) >> 1;
+    t1b = (xAI + xBI) >> 1;
+
+    /* real(tw * (xA - conj(xB))) and imag(tw * (xA - conj(xB))) in 2.30 format */
+    p0 = twR * t1a + twI * t1b;
+    p1 = twI * t1a - twR * t1b;
+
+    /* 1/2 * (xA + conj(xB) - tw * (xA - conj(xB))) */
+    outR = ((sR << 14) - (p0 >> 1)) >> 14;
+    outI = ((sI << 14) + (p1 >> 1)) >> 14;
+
+    *pOut++ = (q15_t) __SSAT(outR, 16);
+    *pOut++ = (q15_t) __SSAT(outI, 16);
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q15 fast real FFT.
+* @param[in]  *S              points to an arm_rfft_fast_instance_q15 structure.
+* @param[in]  *p              points to the input buffer, which is modified.
+* @param[out] *pOut           points to the output buffer.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return     number of bits by which the output is scaled down compared to arm_rfft_fast_f32().
+*
+* \par
+* The output layout and scaling are the same as for arm_rfft_fast_q31(): the forward
+* transform returns the spectrum divided by <code>fftLen</code> and reports
+* <code>log2(fftLen)</code>, the inverse transform has the arm_rfft_fast_f32() scaling
+* and returns 0.
+*/
+uint32_t arm_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t scale = 0U;                           /* output down scaling in bits */
+
+  /* Calculation of Real FFT */
+  if (ifftFlag)
+  {
+    /*  Real FFT compression */
+    merge_rfft_q15(S, p, pOut);
+
+    /* Complex IFFT process, scaled by 1/(fftLen/2) like the floating-point CIFFT */
+    arm_cfft_q15(S->pCfft, pOut, ifftFlag, 1U);
+  }
+  else
+  {
+    /* Calculation of RFFT of input, scaled by 1/(fftLen/2) */
+    arm_cfft_q15(S->pCfft, p, ifftFlag, 1U);
+
+    /*  Real FFT extraction, scaled by 1/2 */
+    stage_rfft_q15(S, p, pOut);
+
+    scale = 31U - __CLZ(S->fftLenRFFT);
+  }
+
+  return (scale);
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_q31.c
+ * Description:  Q31 fast RFFT & RIFFT built on the half length CFFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions
+ * -------------------------------------------------------------------- */
+
+/* Splits the CFFT of the packed real sequence into the first half of the
+ * real spectrum.  The output is half of the arm_rfft_fast_f32() stage. */
+static void stage_rfft_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t twidStep = 2U * S->twidCoefRModifier; /* RFFT twiddle table stride */
+  const q31_t *pCoeff = S->pTwiddleRFFT;         /* Points to RFFT Twiddle factors */
+  q31_t *pA = p;                                 /* increasing pointer */
+  q31_t *pB = p;                                 /* decreasing pointer */
+  q31_t xAR, xAI, xBR, xBI;                      /* temporary variables */
+  q31_t twR, twI;                                /* RFFT Twiddle coefficients */
+  q31_t t1a, t1b;                                /* halved differences */
+  q63_t p0, p1;                                  /* twiddle products */
+
+  k = (S->fftLenRFFT >> 1U) - 1U;
+
+  /* Pack first and last sample of the frequency domain together */
+  xAR = pA[0];
+  xAI = pA[1];
+
+  *pOut++ = (q31_t) (((q63_t) xAR + xAI) >> 1);
+  *pOut++ = (q31_t) (((q63_t) xAR - xAI) >> 1);
+
+  pB = p + 2U * k;
+  pA += 2;
+  pCoeff += twidStep;
+
+  while (k > 0U)
+  {
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    /* The CFFT table holds cos and sin, the real stage uses tw = sin + i cos */
+    twI = pCoeff[0];
+    twR = pCoeff[1];
+
+    /* Differences are halved to keep them in range */
+    t1a = (xBR >> 1) - (xAR >> 1);
+    t1b = (xBI >> 1) + (xAI >> 1);
+
+    /* real(tw * (xB - xA)) and imag(tw * (xB - xA)) in 2.62 format */
+    p0 = (q63_t) twR * t1a + (q63_t) twI * t1b;
+    p1 = (q63_t) twI * t1a - (q63_t) twR * t1b;
+
+    /* 1/4 * (xA + conj(xB) + tw * (xB - conj(xA))) */
+    *pOut++ = (q31_t) (((((q63_t) xAR + xBR) << 30) + p0) >> 32);
+    *pOut++ = (q31_t) (((((q63_t) xAI - xBI) << 30) + p1) >> 32);
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+}
+
+/* Prepares the packed spectrum for the inverse CFFT.  The output is the same
+ * as the arm_rfft_fast_f32() merge stage. */
+static void merge_rfft_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t twidStep = 2U * S->twidCoefRModifier; /* RFFT twiddle table stride */
+  const q31_t *pCoeff = S->pTwiddleRFFT;         /* Points to RFFT Twiddle factors */
+  q31_t *pA = p;                                 /* increasing pointer */
+  q31_t *pB = p;                                 /* decreasing pointer */
+  q31_t xAR, xAI, xBR, xBI;                      /* temporary variables */
+  q31_t twR, twI;                                /* RFFT Twiddle coefficients */
+  q31_t t1a, t1b;                                /* halved differences */
+  q63_t p0, p1;                                  /* twiddle products */
+
+  k = (S->fftLenRFFT >> 1U) - 1U;
+
+  xAR = pA[0];
+  xAI = pA[1];
+
+  *pOut++ = (q31_t) (((q63_t) xAR + xAI) >> 1);
+  *pOut++ = (q31_t) (((q63_t) xAR - xAI) >> 1);
+
+  pB = p + 2U * k;
+  pA += 2;
+  pCoeff += twidStep;
+
+  while (k > 0U)
+  {
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twI = pCoeff[0];
+    twR = pCoeff[1];
+
+    t1a = (xAR >> 1) - (xBR >> 1);
+    t1b = (xAI >> 1) + (xBI >> 1);
+
+    /* real(tw * (xA - conj(xB))) and imag(tw * (xA - conj(xB))) in 2.62 format */
+    p0 = (q63_t) twR * t1a + (q63_t) twI * t1b;
+    p1 = (q63_t) twI * t1a - (q63_t) twR * t1b;
+
+    /* 1/2 * (xA + conj(xB) - tw * (xA - conj(xB))) */
+    *pOut++ = clip_q63_to_q31(((((q63_t) xAR + xBR) << 30) - p0) >> 31);
+    *pOut++ = clip_q63_to_q31(((((q63_t) xAI - xBI) << 30) + p1) >> 31);
+
+    pA += 2;
+    pB -= 2;
+    pCoeff += twidStep;
+    k--;
+  }
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q31 fast real FFT.
+* @param[in]  *S              points to an arm_rfft_fast_instance_q31 structure.
+* @param[in]  *p              points to the input buffer, which is modified.
+* @param[out] *pOut           points to the output buffer.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return     number of bits by which the output is scaled down compared to arm_rfft_fast_f32().
+*
+* \par
+* The output uses the packed layout of arm_rfft_fast_f32(): <code>fftLen/2</code> complex
+* values where the imaginary part of the first value holds the real value at the Nyquist
+* frequency.  The function uses a complex FFT of half the length followed by a split stage,
+* which costs roughly half of arm_rfft_q31().
+* \par Scaling
+* The forward transform returns the spectrum divided by <code>fftLen</code> and reports
+* <code>log2(fftLen)</code>: the output must be shifted left by the returned number of bits
+* to obtain the arm_rfft_fast_f32() result.  The inverse transform has the same scaling as
+* arm_rfft_fast_f32() and returns 0, so the inverse of a forward output is the input
+* divided by <code>fftLen</code>.
+*/
+uint32_t arm_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t scale = 0U;                           /* output down scaling in bits */
+
+  /* Calculation of Real FFT */
+  if (ifftFlag)
+  {
+    /*  Real FFT compression */
+    merge_rfft_q31(S, p, pOut);
+
+    /* Complex IFFT process, scaled by 1/(fftLen/2) like the floating-point CIFFT */
+    arm_cfft_q31(S->pCfft, pOut, ifftFlag, 1U);
+  }
+  else
+  {
+    /* Calculation of RFFT of input, scaled by 1/(fftLen/2) */
+    arm_cfft_q31(S->pCfft, p, ifftFlag, 1U);
+
+    /*  Real FFT extraction, scaled by 1/2 */
+    stage_rfft_q31(S, p, pOut);
+
+    scale = 31U - __CLZ(S->fftLenRFFT);
+  }
+
+  return (scale);
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SDFT Sliding DFT
+ *
+ * The sliding DFT updates a few bins of the DFT of the last <code>windowLen</code>
+ * input samples at every new sample.  Bin <code>k</code> is computed recursively as
+ * <pre>
+ *    X[k] = exp(j*2*pi*k/windowLen) * (r * X[k] + x[n] - r^windowLen * x[n-windowLen])
+ * </pre>
+ * which costs one complex multiplication per bin and per sample, independently of
+ * <code>windowLen</code>.  With <code>r = 1</code> the bins are exactly the DFT of the
+ * window, with the oldest sample at index 0.
+ *
+ * \par
+ * The recursion is marginally stable: with <code>r = 1</code> rounding errors are never
+ * forgotten and slowly accumulate.  For long running streams, a damping factor slightly
+ * below one, e.g. 0.9999, makes the errors decay at the cost of a slight exponential
+ * weighting of the window.
+ *
+ * \par
+ * Use the sliding DFT when bins are needed at every sample, or at a hop too small for a
+ * block transform to be efficient.  For one result per block, the Goertzel functions
+ * are cheaper.
+ *
+ * \par Instance Structure
+ * The delay line, the bins and the twiddles are stored in a state buffer owned by the
+ * caller.  A separate instance structure must be defined for each stream.
+ *
+ * \par Initialization Functions
+ * arm_sdft_init_f32() computes the twiddles of the tracked bins and clears the state.
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point sliding DFT.
+ * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pDst       points to the complex bins after the last sample, <code>2*numBins</code> values.
+ * @param[in]     blockSize  number of input samples.
+ * @return none.
+ *
+ * \par
+ * The bins are updated at every sample of the block.  Call the function with a block
+ * size of 1 to read the bins at every sample.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t windowLen = S->windowLen;             /* window length */
+  uint32_t numBins = S->numBins;                 /* number of tracked bins */
+  uint32_t stateIndex = S->stateIndex;           /* oldest sample in the delay line */
+  float32_t r = S->damping;                      /* damping factor */
+  float32_t rN = S->dampingN;                    /* damping of the sample leaving the window */
+  float32_t *pDelay = S->pState;                 /* delay line */
+  float32_t *pBins = pDelay + windowLen;         /* complex bins */
+  float32_t *pTwiddle = pBins + 2U * numBins;    /* complex twiddles */
+  float32_t *pX, *pW;                            /* bin and twiddle pointers */
+  float32_t x, d;                                /* input and comb output */
+  float32_t re, im;                              /* damped bin plus comb output */
+  uint32_t binCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t re2, im2;                            /* second bin */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blockSize > 0U)
+  {
+    x = *pSrc++;
+
+    /* Comb: add the new sample and remove the one leaving the window */
+    d = x - rN * pDelay[stateIndex];
+    pDelay[stateIndex] = x;
+    stateIndex++;
+    stateIndex = (stateIndex == windowLen) ? 0U : stateIndex;
+
+    pX = pBins;
+    pW = pTwiddle;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Two bins at a time */
+    binCnt = numBins >> 1U;
+
+    while (binCnt > 0U)
+    {
+      re  = r * pX[0] + d;
+      im  = r * pX[1];
+      re2 = r * pX[2] + d;
+      im2 = r * pX[3];
+
+      /* Rotate by the twiddle */
+      pX[0] = re * pW[0] - im * pW[1];
+      pX[1] = re * pW[1] + im * pW[0];
+      pX[2] = re2 * pW[2] - im2 * pW[3];
+      pX[3] = re2 * pW[3] + im2 * pW[2];
+
+      pX += 4U;
+      pW += 4U;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is odd, update the remaining one here. */
+    binCnt = numBins % 0x2U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize binCnt with the number of bins */
+    binCnt = numBins;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (binCnt > 0U)
+    {
+      re = r * pX[0] + d;
+      im = r * pX[1];
+
+      /* Rotate by the twiddle */
+      pX[0] = re * pW[0] - im * pW[1];
+      pX[1] = re * pW[1] + im * pW[0];
+
+      pX += 2U;
+      pW += 2U;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  /* Save the position in the delay line */
+  S->stateIndex = (uint16_t) stateIndex;
+
+  /* Copy the bins to the output */
+  arm_copy_f32(pBins, pDst, 2U * numBins);
+}
+
+/**
+ * @} end of SDFT group
+ */
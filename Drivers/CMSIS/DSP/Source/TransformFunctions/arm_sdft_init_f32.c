@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Initialization function for the floating-point sliding DFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     windowLen  length of the sliding window, i.e. of the equivalent DFT.
+ * @param[in]     numBins    number of tracked bins.
+ * @param[in]     pBinIndex  points to the indices of the tracked bins, in the range [0 windowLen-1].
+ * @param[in]     damping    damping factor <code>r</code> in the range (0 1], 1.0 for the exact DFT.
+ * @param[in]     pState     points to the state buffer of <code>windowLen+4*numBins</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+ *
+ * \par
+ * The state buffer holds the delay line of <code>windowLen</code> samples followed by the
+ * complex bins and the complex twiddles of the tracked bins.  The delay line and the bins
+ * are cleared, so the bins are the DFT of a window of zeros followed by the input.
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t numBins,
+  const uint16_t * pBinIndex,
+  float32_t damping,
+  float32_t * pState)
+{
+  float32_t *pTwiddle;                           /* twiddles of the tracked bins */
+  float32_t dampingN = 1.0f;                     /* r^windowLen */
+  uint32_t k;                                    /* loop counter */
+
+  if ((windowLen == 0U) || (damping <= 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  pTwiddle = pState + windowLen + 2U * numBins;
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBinIndex[k] >= windowLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* exp(j * 2 * pi * bin / windowLen), the angle is in degrees */
+    arm_sin_cos_f32((360.0f * pBinIndex[k]) / windowLen, &pTwiddle[2U * k + 1U], &pTwiddle[2U * k]);
+  }
+
+  for (k = 0U; k < windowLen; k++)
+  {
+    dampingN *= damping;
+  }
+
+  /* Assign parameters */
+  S->windowLen = windowLen;
+  S->numBins = numBins;
+  S->stateIndex = 0U;
+  S->damping = damping;
+  S->dampingN = dampingN;
+  S->pState = pState;
+
+  /* Clear the delay line and the bins */
+  memset(pState, 0, (windowLen + 2U * numBins) * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SDFT group
+ */
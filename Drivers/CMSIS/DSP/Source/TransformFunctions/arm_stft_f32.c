@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point streaming short-time Fourier transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT Short-Time Fourier Transform
+ *
+ * The STFT functions turn a stream of real samples into a sequence of power spectra.
+ * Every <code>hopSize</code> input samples, the last <code>fftLen</code> samples are
+ * multiplied by a window, transformed with the fast real FFT and reduced to
+ * <code>fftLen/2+1</code> power values, from DC to the Nyquist frequency.
+ *
+ * \par
+ * The input is kept in a ring buffer, so a new frame only costs the copy of the
+ * <code>hopSize</code> new samples.  The window multiplication is done while the ring is
+ * copied to the FFT input, and the squared magnitudes are computed directly from the
+ * packed FFT output, so no intermediate frame is written by the caller.
+ *
+ * \par
+ * The process function accepts blocks of any size and returns the number of frames it
+ * produced.  A block of <code>blockSize</code> samples produces at most
+ * <code>blockSize/hopSize + 1</code> frames; the output buffer must be sized accordingly.
+ *
+ * \par Instance Structure
+ * The window, the input ring and the FFT buffers are owned by the caller and referenced
+ * by the instance structure, so the functions never allocate memory.  A separate instance
+ * structure must be defined for each stream.  The window can be shared.
+ *
+ * \par Initialization Functions
+ * arm_stft_init_f32() and arm_stft_init_q15() set up the real FFT, clear the state
+ * buffer of <code>3*fftLen</code> samples and arm the first frame.  The windows can be
+ * generated once with arm_window_f32() or arm_window_q15().
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point STFT.
+ * @param[in,out] S          points to an instance of the floating-point STFT structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pDst       points to the power spectra, <code>fftLen/2+1</code> values per frame.
+ * @param[in]     blockSize  number of input samples to process.
+ * @return        number of frames written to <code>pDst</code>.
+ */
+
+uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t fftLen = S->fftLen;                   /* frame length */
+  uint32_t numBins = fftLen >> 1U;               /* number of complex bins */
+  float32_t *pRing = S->pState;                  /* input ring */
+  float32_t *pFrame = pRing + fftLen;            /* windowed frame, FFT input */
+  float32_t *pSpec = pFrame + fftLen;            /* packed FFT output */
+  float32_t *pWindow = (float32_t *) S->pWindow; /* window */
+  uint32_t writeIndex = S->writeIndex;           /* write position and oldest sample in the ring */
+  uint32_t count = S->count;                     /* samples until the next frame */
+  uint32_t numFrames = 0U;                       /* number of frames produced */
+  uint32_t n;                                    /* number of samples copied at a time */
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame or the end of the ring */
+    n = (count < blockSize) ? count : blockSize;
+    n = (n < (fftLen - writeIndex)) ? n : (fftLen - writeIndex);
+
+    arm_copy_f32(pSrc, pRing + writeIndex, n);
+
+    pSrc += n;
+    blockSize -= n;
+    count -= n;
+    writeIndex += n;
+    writeIndex = (writeIndex == fftLen) ? 0U : writeIndex;
+
+    if (count == 0U)
+    {
+      /* Window the ring from its oldest sample while copying it to the FFT input */
+      arm_mult_f32(pRing + writeIndex, pWindow, pFrame, fftLen - writeIndex);
+      arm_mult_f32(pRing, pWindow + (fftLen - writeIndex), pFrame + (fftLen - writeIndex), writeIndex);
+
+      arm_rfft_fast_f32(&S->rfft, pFrame, pSpec, 0U);
+
+      /* DC and Nyquist are packed in the first complex value */
+      pDst[0] = pSpec[0] * pSpec[0];
+      pDst[numBins] = pSpec[1] * pSpec[1];
+
+      /* Power of the remaining bins */
+      arm_cmplx_mag_squared_f32(pSpec + 2U, pDst + 1U, numBins - 1U);
+
+      pDst += numBins + 1U;
+      numFrames++;
+
+      /* Arm the next frame */
+      count = S->hopSize;
+    }
+  }
+
+  /* Save the position in the stream */
+  S->writeIndex = (uint16_t) writeIndex;
+  S->count = (uint16_t) count;
+
+  return (numFrames);
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_q15.c
+ * Description:  Q15 STFT initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 STFT.
+ * @param[in,out] S          points to an instance of the Q15 STFT structure.
+ * @param[in]     fftLen     frame and FFT length, one of the arm_rfft_fast_q15() lengths.
+ * @param[in]     hopSize    number of input samples between two frames.
+ * @param[in]     pWindow    points to the window of <code>fftLen</code> samples.
+ * @param[in]     pState     points to the state buffer of <code>3*fftLen</code> samples.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported or <code>hopSize</code> is 0.
+ *
+ * \par
+ * The function does not allocate memory.  The window and the state buffer are owned by the
+ * caller; the window can be filled with arm_window_q15() and shared between instances.
+ * The first frame is produced once <code>fftLen</code> samples have been received.
+ */
+
+arm_status arm_stft_init_q15(
+  arm_stft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const q15_t * pWindow,
+  q15_t * pState)
+{
+  arm_status status;
+
+  /* Initialize the real FFT, this also checks the FFT length */
+  status = arm_rfft_fast_init_q15(&S->rfft, fftLen);
+
+  if (hopSize == 0U)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* Assign frame parameters */
+    S->fftLen = fftLen;
+    S->hopSize = hopSize;
+
+    /* The first frame needs a full input ring */
+    S->writeIndex = 0U;
+    S->count = fftLen;
+
+    /* Assign window and state pointers */
+    S->pWindow = pWindow;
+    S->pState = pState;
+
+    /* Clear the state buffer */
+    memset(pState, 0, 3U * fftLen * sizeof(q15_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of STFT group
+ */
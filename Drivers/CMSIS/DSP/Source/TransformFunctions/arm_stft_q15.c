@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_q15.c
+ * Description:  Q15 streaming short-time Fourier transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 STFT.
+ * @param[in,out] S          points to an instance of the Q15 STFT structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pDst       points to the power spectra, <code>fftLen/2+1</code> values per frame.
+ * @param[in]     blockSize  number of input samples to process.
+ * @return        number of frames written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The spectrum of arm_rfft_fast_q15() is divided by <code>fftLen</code>.  The squared
+ * magnitudes of its 1.15 values are written in 3.29 format without loss of precision,
+ * so the output is the power spectrum divided by <code>fftLen*fftLen</code>.
+ * The window multiplication saturates like arm_mult_q15().
+ */
+
+uint32_t arm_stft_q15(
+  arm_stft_instance_q15 * S,
+  q15_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t fftLen = S->fftLen;                   /* frame length */
+  uint32_t numBins = fftLen >> 1U;               /* number of complex bins */
+  q15_t *pRing = S->pState;                      /* input ring */
+  q15_t *pFrame = pRing + fftLen;                /* windowed frame, FFT input */
+  q15_t *pSpec = pFrame + fftLen;                /* packed FFT output */
+  q15_t *pWindow = (q15_t *) S->pWindow;         /* window */
+  uint32_t writeIndex = S->writeIndex;           /* write position and oldest sample in the ring */
+  uint32_t count = S->count;                     /* samples until the next frame */
+  uint32_t numFrames = 0U;                       /* number of frames produced */
+  uint32_t n;                                    /* number of samples copied at a time */
+  q15_t *pIn;                                    /* points to the packed FFT output */
+  uint32_t k;                                    /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in;                                      /* packed complex value */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q31_t re, im;                                  /* real and imaginary parts */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame or the end of the ring */
+    n = (count < blockSize) ? count : blockSize;
+    n = (n < (fftLen - writeIndex)) ? n : (fftLen - writeIndex);
+
+    arm_copy_q15(pSrc, pRing + writeIndex, n);
+
+    pSrc += n;
+    blockSize -= n;
+    count -= n;
+    writeIndex += n;
+    writeIndex = (writeIndex == fftLen) ? 0U : writeIndex;
+
+    if (count == 0U)
+    {
+      /* Window the ring from its oldest sample while copying it to the FFT input */
+      arm_mult_q15(pRing + writeIndex, pWindow, pFrame, fftLen - writeIndex);
+      arm_mult_q15(pRing, pWindow + (fftLen - writeIndex), pFrame + (fftLen - writeIndex), writeIndex);
+
+      arm_rfft_fast_q15(&S->rfft, pFrame, pSpec, 0U);
+
+      /* DC and Nyquist are packed in the first complex value, 2.30 to 3.29 format */
+      pDst[0] = ((q31_t) pSpec[0] * pSpec[0]) >> 1;
+      pDst[numBins] = ((q31_t) pSpec[1] * pSpec[1]) >> 1;
+
+      pIn = pSpec + 2U;
+      pDst++;
+      k = numBins - 1U;
+
+      while (k > 0U)
+      {
+#if defined (ARM_MATH_DSP)
+
+        /* re * re + im * im in 2.30 format, the sum reaches 2^31 only for (-1, -1) */
+        in = *__SIMD32(pIn)++;
+        *pDst++ = (q31_t) ((uint32_t) __SMUAD(in, in) >> 1);
+
+#else
+
+        re = *pIn++;
+        im = *pIn++;
+        *pDst++ = (q31_t) (((uint32_t) (re * re) + (uint32_t) (im * im)) >> 1);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        k--;
+      }
+
+      /* Skip the Nyquist value */
+      pDst++;
+      numFrames++;
+
+      /* Arm the next frame */
+      count = S->hopSize;
+    }
+  }
+
+  /* Save the position in the stream */
+  S->writeIndex = (uint16_t) writeIndex;
+  S->count = (uint16_t) count;
+
+  return (numFrames);
+}
+
+/**
+ * @} end of STFT group
+ */
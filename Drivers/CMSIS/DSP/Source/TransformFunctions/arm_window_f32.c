@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_f32.c
+ * Description:  Floating-point window generation for the STFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Generates a floating-point analysis window.
+ * @param[in]  type       window type.
+ * @param[out] pDst       points to the window of <code>windowLen</code> samples.
+ * @param[in]  windowLen  window length.
+ * @return none.
+ *
+ * \par
+ * The windows are periodic, w[n] for n = 0 ... windowLen-1 with a period of
+ * <code>windowLen</code>, which is the form used for spectral analysis with overlapping frames:
+ * <pre>
+ *    Hann:     w[n] = 0.5  - 0.5  * cos(2*pi*n/windowLen)
+ *    Hamming:  w[n] = 0.54 - 0.46 * cos(2*pi*n/windowLen)
+ *    Blackman: w[n] = 0.42 - 0.5  * cos(2*pi*n/windowLen) + 0.08 * cos(4*pi*n/windowLen)
+ * </pre>
+ * The window is computed once, typically at initialization, with arm_cos_f32().
+ */
+
+void arm_window_f32(
+  arm_window_type type,
+  float32_t * pDst,
+  uint16_t windowLen)
+{
+  float32_t step = 6.28318530717959f / (float32_t) windowLen;   /* angle increment */
+  float32_t c1, c2;                              /* cosines of the first two harmonics */
+  uint32_t n;                                    /* loop counter */
+
+  for (n = 0U; n < windowLen; n++)
+  {
+    c1 = arm_cos_f32(step * (float32_t) n);
+
+    switch (type)
+    {
+    case ARM_WINDOW_HAMMING:
+      pDst[n] = 0.54f - 0.46f * c1;
+      break;
+
+    case ARM_WINDOW_BLACKMAN:
+      /* cos(2x) = 2 * cos(x)^2 - 1 */
+      c2 = 2.0f * c1 * c1 - 1.0f;
+      pDst[n] = 0.42f - 0.5f * c1 + 0.08f * c2;
+      break;
+
+    default:
+      pDst[n] = 0.5f - 0.5f * c1;
+      break;
+    }
+  }
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_q15.c
+ * Description:  Q15 window generation for the STFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Generates a Q15 analysis window.
+ * @param[in]  type       window type.
+ * @param[out] pDst       points to the window of <code>windowLen</code> samples.
+ * @param[in]  windowLen  window length.
+ * @return none.
+ *
+ * \par
+ * Generates the same periodic windows as arm_window_f32() in Q15 format, using
+ * arm_cos_q15() so that no floating-point arithmetic is needed.  The peak value
+ * of 1.0 saturates to 0x7FFF.
+ */
+
+void arm_window_q15(
+  arm_window_type type,
+  q15_t * pDst,
+  uint16_t windowLen)
+{
+  q31_t c1, c2;                                  /* cosines of the first two harmonics */
+  q31_t w;                                       /* window value */
+  uint32_t phase;                                /* normalized angle, 0x8000 is 2*pi */
+  uint32_t n;                                    /* loop counter */
+
+  for (n = 0U; n < windowLen; n++)
+  {
+    phase = (n << 15U) / windowLen;
+    c1 = arm_cos_q15((q15_t) phase);
+
+    switch (type)
+    {
+    case ARM_WINDOW_HAMMING:
+      /* 0.54 - 0.46 * c1 */
+      w = 17695 - ((15073 * c1) >> 15);
+      break;
+
+    case ARM_WINDOW_BLACKMAN:
+      /* 0.42 - 0.5 * c1 + 0.08 * c2 */
+      c2 = arm_cos_q15((q15_t) ((2U * phase) & 0x7FFFU));
+      w = 13763 - (c1 >> 1) + ((2621 * c2) >> 15);
+      break;
+
+    default:
+      /* 0.5 - 0.5 * c1 */
+      w = 16384 - (c1 >> 1);
+      break;
+    }
+
+    /* Rounding can take the Blackman window slightly below zero */
+    w = (w < 0) ? 0 : w;
+
+    pDst[n] = (q15_t) __SSAT(w, 16);
+  }
+}
+
+/**
+ * @} end of STFT group
+ */
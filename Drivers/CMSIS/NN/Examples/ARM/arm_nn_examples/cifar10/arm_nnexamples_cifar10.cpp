@@ -55,8 +55,8 @@
  * of 3 convolution layers interspersed by ReLU activation and max pooling layers, followed by a 
  * fully-connected layer at the end. The input to the network is a 32x32 pixel color image, which will 
  * be classified into one of the 10 output classes. 
- * This example model implementation needs 32.3 KB to store weights, 40 KB for activations and 
- * 3.1 KB for storing the \c im2col data.
+ * This example model implementation needs 32.3 KB to store weights and 40 KB for activations,
+ * which also hold the \c im2col data.
  *
  * \image html CIFAR10_CNN.gif "Neural Network model definition"
  *
@@ -67,18 +67,21 @@
  * \li \c ip1_wt, ip1_bias point to fully-connected layer weights and biases
  * \li \c input_data points to the input image data
  * \li \c output_data points to the classification output
- * \li \c col_buffer is a buffer to store the \c im2col output
- * \li \c scratch_buffer is used to store the activation data (intermediate layer outputs)
+ * \li \c layers describes the network, in execution order, with the tensors each layer reads and writes
+ * \li \c arena holds the activation data (intermediate layer outputs) and the \c im2col output,
+ *     at the offsets computed by arm_nn_plan()
  *
  * \par CMSIS DSP Software Library Functions Used:
  * \par
  * - arm_convolve_HWC_q7_RGB()
- * - arm_convolve_HWC_q7_fast()
+ * - arm_convolve_HWC_q7_fast_relu_pool()
  * - arm_relu_q7()
  * - arm_maxpool_q7_HWC()
  * - arm_avepool_q7_HWC()
  * - arm_fully_connected_q7_opt()
  * - arm_fully_connected_q7()
+ * - arm_nn_plan()
+ * - arm_nn_run()
  *
  * <b> Refer  </b>
  * \link arm_nnexamples_cifar10.cpp \endlink
@@ -93,6 +96,7 @@
 #include "arm_nnexamples_cifar10_weights.h"
 
 #include "arm_nnfunctions.h"
+#include "arm_nn_plan.h"
 #include "arm_nnexamples_cifar10_inputs.h"
 
 #ifdef _RTE_
@@ -120,10 +124,35 @@ static q7_t ip1_bias[IP1_OUT] = IP1_BIAS;
 uint8_t   image_data[CONV1_IM_CH * CONV1_IM_DIM * CONV1_IM_DIM] = IMG_DATA;
 q7_t      output_data[IP1_OUT];
 
-//vector buffer: max(im2col buffer,average pool buffer, fully connected buffer)
-q7_t      col_buffer[2 * 5 * 5 * 32 * 2];
-
-q7_t      scratch_buffer[32 * 32 * 10 * 4];
+// tensors of the network, the input image is tensor 0 and the class scores tensor 7
+#define NUM_LAYERS 7
+#define NUM_TENSORS 8
+
+// type, input, output, dim_im_in, ch_im_in, dim_im_out, ch_im_out, dim_kernel, padding, stride,
+// bias_shift, out_shift, wt, bias, dim_conv_out, dim_pool_kernel, pool_padding, pool_stride
+static const arm_nn_layer layers[NUM_LAYERS] = {
+  {ARM_NN_LAYER_CONV, 0, 1, CONV1_IM_DIM, CONV1_IM_CH, CONV1_OUT_DIM, CONV1_OUT_CH, CONV1_KER_DIM, CONV1_PADDING,
+   CONV1_STRIDE, CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT, conv1_wt, conv1_bias},
+  {ARM_NN_LAYER_RELU, 1, 2, CONV1_OUT_DIM, CONV1_OUT_CH, CONV1_OUT_DIM, CONV1_OUT_CH},
+  {ARM_NN_LAYER_MAXPOOL, 2, 3, CONV1_OUT_DIM, CONV1_OUT_CH, POOL1_OUT_DIM, CONV1_OUT_CH, POOL1_KER_DIM, POOL1_PADDING,
+   POOL1_STRIDE},
+  // the outputs of conv2 and conv3 are never stored
+  {ARM_NN_LAYER_CONV_RELU_POOL, 3, 4, CONV2_IM_DIM, CONV2_IM_CH, POOL2_OUT_DIM, CONV2_OUT_CH, CONV2_KER_DIM,
+   CONV2_PADDING, CONV2_STRIDE, CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT, conv2_wt, conv2_bias, CONV2_OUT_DIM,
+   POOL2_KER_DIM, POOL2_PADDING, POOL2_STRIDE},
+  {ARM_NN_LAYER_CONV_RELU_POOL, 4, 5, CONV3_IM_DIM, CONV3_IM_CH, POOL3_OUT_DIM, CONV3_OUT_CH, CONV3_KER_DIM,
+   CONV3_PADDING, CONV3_STRIDE, CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT, conv3_wt, conv3_bias, CONV3_OUT_DIM,
+   POOL3_KER_DIM, POOL3_PADDING, POOL3_STRIDE},
+  {ARM_NN_LAYER_FC_OPT, 5, 6, 1, IP1_DIM, 1, IP1_OUT, 0, 0, 0, IP1_BIAS_LSHIFT, IP1_OUT_RSHIFT, ip1_wt, ip1_bias},
+  {ARM_NN_LAYER_SOFTMAX, 6, 7, 1, IP1_OUT, 1, IP1_OUT},
+};
+
+arm_nn_tensor tensors[NUM_TENSORS];
+uint32_t  scratch_offsets[NUM_LAYERS];
+
+// size reported by arm_nn_plan() for the layers above
+#define ARENA_SIZE (32 * 32 * 10 * 4)
+q31_t     arena[ARENA_SIZE / 4];
 
 int main()
 {
@@ -134,58 +163,31 @@ int main()
   printf("start execution\n");
   /* start the execution */
 
-  q7_t     *img_buffer1 = scratch_buffer;
-  q7_t     *img_buffer2 = img_buffer1 + 32 * 32 * 32;
+  arm_nn_plan_instance plan;
+  if (arm_nn_plan(&plan, layers, NUM_LAYERS, tensors, NUM_TENSORS, scratch_offsets) != ARM_MATH_SUCCESS ||
+      plan.arenaSize > ARENA_SIZE)
+  {
+    printf("the network needs an arena of %u bytes\n", (unsigned) plan.arenaSize);
+    return 1;
+  }
+
+  q7_t     *img_buffer = (q7_t *) arena + tensors[0].offset;
 
   /* input pre-processing */
   int mean_data[3] = INPUT_MEAN_SHIFT;
   unsigned int scale_data[3] = INPUT_RIGHT_SHIFT;
   for (int i=0;i<32*32*3; i+=3) {
-    img_buffer2[i] =   (q7_t)__SSAT( ((((int)image_data[i]   - mean_data[0])<<7) + (0x1<<(scale_data[0]-1)))
+    img_buffer[i] =   (q7_t)__SSAT( ((((int)image_data[i]   - mean_data[0])<<7) + (0x1<<(scale_data[0]-1)))
                              >> scale_data[0], 8);
-    img_buffer2[i+1] = (q7_t)__SSAT( ((((int)image_data[i+1] - mean_data[1])<<7) + (0x1<<(scale_data[1]-1)))
+    img_buffer[i+1] = (q7_t)__SSAT( ((((int)image_data[i+1] - mean_data[1])<<7) + (0x1<<(scale_data[1]-1)))
                              >> scale_data[1], 8);
-    img_buffer2[i+2] = (q7_t)__SSAT( ((((int)image_data[i+2] - mean_data[2])<<7) + (0x1<<(scale_data[2]-1)))
+    img_buffer[i+2] = (q7_t)__SSAT( ((((int)image_data[i+2] - mean_data[2])<<7) + (0x1<<(scale_data[2]-1)))
                              >> scale_data[2], 8);
   }
-  
-  // conv1 img_buffer2 -> img_buffer1
-  arm_convolve_HWC_q7_RGB(img_buffer2, CONV1_IM_DIM, CONV1_IM_CH, conv1_wt, CONV1_OUT_CH, CONV1_KER_DIM, CONV1_PADDING,
-                          CONV1_STRIDE, conv1_bias, CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT, img_buffer1, CONV1_OUT_DIM,
-                          (q15_t *) col_buffer, NULL);
-
-  arm_relu_q7(img_buffer1, CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH);
-
-  // pool1 img_buffer1 -> img_buffer2
-  arm_maxpool_q7_HWC(img_buffer1, CONV1_OUT_DIM, CONV1_OUT_CH, POOL1_KER_DIM,
-                     POOL1_PADDING, POOL1_STRIDE, POOL1_OUT_DIM, NULL, img_buffer2);
-
-  // conv2 img_buffer2 -> img_buffer1
-  arm_convolve_HWC_q7_fast(img_buffer2, CONV2_IM_DIM, CONV2_IM_CH, conv2_wt, CONV2_OUT_CH, CONV2_KER_DIM,
-                           CONV2_PADDING, CONV2_STRIDE, conv2_bias, CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT, img_buffer1,
-                           CONV2_OUT_DIM, (q15_t *) col_buffer, NULL);
-
-  arm_relu_q7(img_buffer1, CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH);
-
-  // pool2 img_buffer1 -> img_buffer2
-  arm_maxpool_q7_HWC(img_buffer1, CONV2_OUT_DIM, CONV2_OUT_CH, POOL2_KER_DIM,
-                     POOL2_PADDING, POOL2_STRIDE, POOL2_OUT_DIM, col_buffer, img_buffer2);
-
-// conv3 img_buffer2 -> img_buffer1
-  arm_convolve_HWC_q7_fast(img_buffer2, CONV3_IM_DIM, CONV3_IM_CH, conv3_wt, CONV3_OUT_CH, CONV3_KER_DIM,
-                           CONV3_PADDING, CONV3_STRIDE, conv3_bias, CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT, img_buffer1,
-                           CONV3_OUT_DIM, (q15_t *) col_buffer, NULL);
-
-  arm_relu_q7(img_buffer1, CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH);
-
-  // pool3 img_buffer-> img_buffer2
-  arm_maxpool_q7_HWC(img_buffer1, CONV3_OUT_DIM, CONV3_OUT_CH, POOL3_KER_DIM,
-                     POOL3_PADDING, POOL3_STRIDE, POOL3_OUT_DIM, col_buffer, img_buffer2);
 
-  arm_fully_connected_q7_opt(img_buffer2, ip1_wt, IP1_DIM, IP1_OUT, IP1_BIAS_LSHIFT, IP1_OUT_RSHIFT, ip1_bias,
-                             output_data, (q15_t *) img_buffer1);
+  arm_nn_run(&plan, (q7_t *) arena);
 
-  arm_softmax_q7(output_data, 10, output_data);
+  memcpy(output_data, (q7_t *) arena + tensors[7].offset, IP1_OUT);
 
   for (int i = 0; i < 10; i++)
   {
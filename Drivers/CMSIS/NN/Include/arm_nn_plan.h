@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_plan.h
+ * Description:  Memory planner and runtime for a list of q7 layers
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ * -------------------------------------------------------------------- */
+
+/**
+ * @defgroup NNPlan Neural Network Memory Planning Functions
+ *
+ * A network is described by a list of layers, in execution order, that read
+ * and write numbered tensors. A tensor that no layer writes is an input of the
+ * network, a tensor that no layer reads is an output of the network.
+ *
+ * arm_nn_plan() computes the lifetime of each tensor and places all the
+ * tensors and the scratch buffers of the kernels in a single arena, so that
+ * two buffers that are live at the same time never overlap. A ReLU or softmax
+ * layer whose input is not read afterwards runs in place. The plan only
+ * depends on the layer list, so it can be computed once on the host and the
+ * offsets stored with the network.
+ *
+ * arm_nn_run() then runs the layers on an arena of arenaSize bytes. The
+ * inputs are written and the outputs are read at pArena + pTensors[i].offset.
+ */
+
+#ifndef _ARM_NN_PLAN_H
+#define _ARM_NN_PLAN_H
+
+#include "arm_nnfunctions.h"
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+/**
+ * @brief Offset of a buffer that is not placed yet.
+ */
+#define ARM_NN_UNPLANNED 0xFFFFFFFFU
+
+  /**
+   * @brief Layer types and the kernels that run them.
+   */
+    typedef enum
+    {
+        ARM_NN_LAYER_CONV = 0,          /**< arm_convolve_HWC_q7_RGB when ch_im_in is 3, arm_convolve_HWC_q7_fast otherwise */
+        ARM_NN_LAYER_CONV_RELU_POOL,    /**< arm_convolve_HWC_q7_fast_relu_pool */
+        ARM_NN_LAYER_DEPTHWISE,         /**< arm_depthwise_separable_conv_HWC_q7 */
+        ARM_NN_LAYER_RELU,              /**< arm_relu_q7 */
+        ARM_NN_LAYER_MAXPOOL,           /**< arm_maxpool_q7_HWC, the input is overwritten */
+        ARM_NN_LAYER_AVEPOOL,           /**< arm_avepool_q7_HWC, the input is overwritten */
+        ARM_NN_LAYER_FC,                /**< arm_fully_connected_q7 */
+        ARM_NN_LAYER_FC_OPT,            /**< arm_fully_connected_q7_opt, with interleaved weights */
+        ARM_NN_LAYER_SOFTMAX            /**< arm_softmax_q7 */
+    } arm_nn_layer_type;
+
+  /**
+   * @brief Description of a layer.
+   *
+   * The input tensor has dim_im_in * dim_im_in * ch_im_in values and the
+   * output tensor dim_im_out * dim_im_out * ch_im_out values. The fully-connected
+   * and softmax layers take dim_im_in = dim_im_out = 1, with ch_im_in the length
+   * of the input vector. The pooling, ReLU and softmax layers keep the number
+   * of channels.
+   */
+    typedef struct
+    {
+        arm_nn_layer_type type;         /**< kernel of the layer */
+        uint16_t  input;                /**< index of the input tensor */
+        uint16_t  output;               /**< index of the output tensor */
+        uint16_t  dim_im_in;            /**< input tensor dimension */
+        uint16_t  ch_im_in;             /**< number of input tensor channels */
+        uint16_t  dim_im_out;           /**< output tensor dimension */
+        uint16_t  ch_im_out;            /**< number of output tensor channels */
+        uint16_t  dim_kernel;           /**< convolution or pooling kernel size */
+        uint16_t  padding;              /**< convolution or pooling padding */
+        uint16_t  stride;               /**< convolution or pooling stride */
+        uint16_t  bias_shift;           /**< amount of left-shift for bias */
+        uint16_t  out_shift;            /**< amount of right-shift for output */
+        const q7_t *wt;                 /**< weights */
+        const q7_t *bias;               /**< bias */
+        uint16_t  dim_conv_out;         /**< convolution output dimension of a fused layer */
+        uint16_t  dim_pool_kernel;      /**< pooling kernel size of a fused layer */
+        uint16_t  pool_padding;         /**< pooling padding of a fused layer */
+        uint16_t  pool_stride;          /**< pooling stride of a fused layer */
+    } arm_nn_layer;
+
+  /**
+   * @brief Tensor of a network, filled by the planner.
+   */
+    typedef struct
+    {
+        uint32_t  size;                 /**< number of bytes of the tensor */
+        uint32_t  offset;               /**< offset of the tensor in the arena */
+        int16_t   first;                /**< first layer that uses the tensor */
+        int16_t   last;                 /**< last layer that uses the tensor */
+        uint16_t  alias;                /**< tensor that owns the buffer, the tensor itself unless in place */
+    } arm_nn_tensor;
+
+  /**
+   * @brief Instance structure for a planned network.
+   */
+    typedef struct
+    {
+        uint16_t  numLayers;            /**< number of layers */
+        const arm_nn_layer *pLayers;    /**< points to the layers, in execution order */
+        uint16_t  numTensors;           /**< number of tensors */
+        arm_nn_tensor *pTensors;        /**< points to the tensors */
+        uint32_t *pScratchOffset;       /**< points to the offset of the scratch buffer of each layer */
+        uint32_t  arenaSize;            /**< number of bytes of the arena */
+        uint32_t  minArenaSize;         /**< largest number of bytes live during a layer, no plan can do better */
+    } arm_nn_plan_instance;
+
+  /**
+   * @brief Number of bytes of the scratch buffer of a layer
+   * @param[in]       pLayer      points to the layer
+   * @return     the number of bytes of bufferA and bufferB of the kernel.
+   */
+
+    uint32_t  arm_nn_layer_scratch_size(const arm_nn_layer * pLayer);
+
+  /**
+   * @brief Places the tensors and the scratch buffers of a network in an arena
+   * @param[out]      S               points to an instance of the plan structure
+   * @param[in]       pLayers         points to the layers, in execution order
+   * @param[in]       numLayers       number of layers
+   * @param[out]      pTensors        points to numTensors tensors
+   * @param[in]       numTensors      number of tensors
+   * @param[out]      pScratchOffset  points to numLayers scratch offsets
+   * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the layers
+   * disagree on the size of a tensor, <code>ARM_MATH_ARGUMENT_ERROR</code> if a tensor
+   * index is out of range, a tensor is written twice or read before it is written,
+   * or the input of a pooling layer is read afterwards, and <code>ARM_MATH_SUCCESS</code>
+   * otherwise.
+   */
+
+    arm_status arm_nn_plan(arm_nn_plan_instance * S,
+                           const arm_nn_layer * pLayers,
+                           uint16_t numLayers,
+                           arm_nn_tensor * pTensors,
+                           uint16_t numTensors,
+                           uint32_t * pScratchOffset);
+
+  /**
+   * @brief Runs a planned network
+   * @param[in]       S           points to an instance of the plan structure
+   * @param[in,out]   pArena      points to the arena, S->arenaSize bytes aligned on 4 bytes
+   * @return     The function returns the first error of a kernel, or <code>ARM_MATH_SUCCESS</code>.
+   */
+
+    arm_status arm_nn_run(const arm_nn_plan_instance * S, q7_t * pArena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -44,9 +44,11 @@
    * - Neural Network Pooling Functions
    * - Softmax Functions
    * - Neural Network Support Functions
+   * - Neural Network Memory Planning Functions, declared in arm_nn_plan.h
    *
    * The library has separate functions for operating on different weight and activation data
-   * types including 8-bit integers (q7_t) and 16-bit integers (q15_t). The descrition of the
+   * types including 8-bit integers (q7_t) and 16-bit integers (q15_t), and int8 kernels with
+   * per-channel quantization for the models of the int8 exporters. The descrition of the
    * kernels are included in the function description. The implementation details are also 
    * described in this paper [1]. 
    *
@@ -119,6 +121,12 @@ extern    "C"
  * Each iteration, only a few column (i.e., patches) are generated and 
  * computed with GEMM kernels similar to CMSIS-DSP arm_mat_mult functions.
  *
+ * The q7 functions scale the bias and the output of a layer with a single
+ * power-of-two shift.  The s8 functions use the quantization of the int8
+ * model exporters instead: symmetric weights with a multiplier and a shift
+ * per output channel, asymmetric activations with a zero point, s32 bias
+ * and a clamped activation range, so that such models run without retraining.
+ *
  */
 
   /**
@@ -258,13 +266,11 @@ extern    "C"
    * @param[in]       dim_im_out  output tensor dimension
    * @param[in,out]   bufferA     pointer to buffer space for input 
    * @param[in,out]   bufferB     pointer to buffer space for output
-   * @return     The function returns either
-   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
    *
-   * This function is the version with full list of optimization tricks, but with
-   * some contraints:
-   *   ch_im_in is multiple of 4
-   *   ch_im_out is multiple of 2
+   * This function is the version with full list of optimization tricks. It
+   * works for any ch_im_in and ch_im_out, with the reordered im2col when
+   * ch_im_in is a multiple of 4.
    */
 
     arm_status arm_convolve_HWC_q7_fast(const q7_t * Im_in,
@@ -283,6 +289,53 @@ extern    "C"
                                         q15_t * bufferA, 
                                         q7_t * bufferB);
 
+  /**
+   * @brief Fast Q7 convolution function fused with ReLU and max pooling
+   * @param[in]       Im_in           pointer to input tensor
+   * @param[in]       dim_im_in       input tensor dimention
+   * @param[in]       ch_im_in        number of input tensor channels
+   * @param[in]       wt              pointer to kernel weights
+   * @param[in]       ch_im_out       number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel      filter kernel size
+   * @param[in]       padding         padding sizes
+   * @param[in]       stride          convolution stride
+   * @param[in]       bias            pointer to bias
+   * @param[in]       bias_shift      amount of left-shift for bias
+   * @param[in]       out_shift       amount of right-shift for output
+   * @param[in]       dim_conv_out    convolution output dimension, i.e., pooling input dimension
+   * @param[in]       dim_pool_kernel pooling window size
+   * @param[in]       pool_padding    pooling padding sizes
+   * @param[in]       pool_stride     pooling stride
+   * @param[in,out]   Im_out          pointer to output tensor
+   * @param[in]       dim_im_out      output tensor dimension
+   * @param[in,out]   bufferA         pointer to buffer space for input
+   * @param[in,out]   bufferB         pointer to buffer space for output
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * Same as arm_convolve_HWC_q7_fast followed by arm_relu_q7 and arm_maxpool_q7_HWC,
+   * without storing the convolution output.
+   */
+
+    arm_status arm_convolve_HWC_q7_fast_relu_pool(const q7_t * Im_in,
+                                                  const uint16_t dim_im_in,
+                                                  const uint16_t ch_im_in,
+                                                  const q7_t * wt,
+                                                  const uint16_t ch_im_out,
+                                                  const uint16_t dim_kernel,
+                                                  const uint16_t padding,
+                                                  const uint16_t stride,
+                                                  const q7_t * bias,
+                                                  const uint16_t bias_shift,
+                                                  const uint16_t out_shift,
+                                                  const uint16_t dim_conv_out,
+                                                  const uint16_t dim_pool_kernel,
+                                                  const uint16_t pool_padding,
+                                                  const uint16_t pool_stride,
+                                                  q7_t * Im_out,
+                                                  const uint16_t dim_im_out,
+                                                  q15_t * bufferA,
+                                                  q7_t * bufferB);
+
   /**
    * @brief Fast Q7 convolution function (non-sqaure shape)
    * @param[in]       Im_in        pointer to input tensor
@@ -305,13 +358,11 @@ extern    "C"
    * @param[in]       dim_im_out_y output tensor dimension y
    * @param[in,out]   bufferA      pointer to buffer space for input 
    * @param[in,out]   bufferB      pointer to buffer space for output
-   * @return     The function returns either
-   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
    *
-   * This function is the version with full list of optimization tricks, but with
-   * some contraints:
-   *   ch_im_in is multiple of 4
-   *   ch_im_out is multiple of 2
+   * This function is the version with full list of optimization tricks. It
+   * works for any ch_im_in and ch_im_out, with the reordered im2col when
+   * ch_im_in is a multiple of 4.
    */
 
     arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
@@ -366,8 +417,8 @@ extern    "C"
    *
    * This function is the version with full list of optimization tricks, but with
    * some contraints:
-   *   ch_im_in is multiple of 4
-   *   ch_im_out is multiple of 2
+   *   dim_kernel_x and dim_kernel_y are 1
+   *   padding_x, padding_y are 0 and stride_x, stride_y are 1
    */
     arm_status arm_convolve_1x1_HWC_q7_fast_nonsquare(const q7_t * Im_in,
                                                       const uint16_t dim_im_in_x,
@@ -558,8 +609,7 @@ extern    "C"
    *
    * This function is the version with full list of optimization tricks, but with
    * some contraints:
-   *   ch_im_in is multiple of 2
-   *   ch_im_out is multiple of 2
+   *   ch_im_in is equal to ch_im_out
    */
 
     arm_status arm_depthwise_separable_conv_HWC_q7(const q7_t * Im_in,
@@ -578,6 +628,49 @@ extern    "C"
                                                    q15_t * bufferA, 
                                                    q7_t * bufferB);
 
+  /**
+   * @brief Q7 depthwise separable convolution function for 3x3 kernels
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input, unused
+   * @param[in,out]   bufferB     pointer to buffer space for output, unused
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * This function reads the input tensor directly, without column buffer,
+   * with the constraints:
+   *   ch_im_in is equal to ch_im_out
+   *   dim_kernel is equal to 3
+   *   stride is 1 or 2
+   */
+
+    arm_status arm_depthwise_separable_conv_3x3_HWC_q7(const q7_t * Im_in,
+                                                       const uint16_t dim_im_in,
+                                                       const uint16_t ch_im_in,
+                                                       const q7_t * wt,
+                                                       const uint16_t ch_im_out,
+                                                       const uint16_t dim_kernel,
+                                                       const uint16_t padding,
+                                                       const uint16_t stride,
+                                                       const q7_t * bias,
+                                                       const uint16_t bias_shift,
+                                                       const uint16_t out_shift,
+                                                       q7_t * Im_out,
+                                                       const uint16_t dim_im_out,
+                                                       q15_t * bufferA,
+                                                       q7_t * bufferB);
+
   /**
    * @brief Q7 depthwise separable convolution function (non-square shape)
    * @param[in]       Im_in         pointer to input tensor
@@ -605,8 +698,7 @@ extern    "C"
    *
    * This function is the version with full list of optimization tricks, but with
    * some contraints:
-   *   ch_im_in is multiple of 2
-   *   ch_im_out is multiple of 2
+   *   ch_im_in is equal to ch_im_out
    */
     arm_status arm_depthwise_separable_conv_HWC_q7_nonsquare(const q7_t * Im_in,
                                                              const uint16_t dim_im_in_x,
@@ -629,6 +721,59 @@ extern    "C"
                                                              q15_t * bufferA,
                                                              q7_t * bufferB);
 
+  /**
+   * @brief s8 convolution function with per-channel requantization (non-square shape)
+   * @param[in]       Im_in               pointer to input tensor
+   * @param[in]       dim_im_in_x         input tensor dimention x
+   * @param[in]       dim_im_in_y         input tensor dimention y
+   * @param[in]       ch_im_in            number of input tensor channels
+   * @param[in]       wt                  pointer to kernel weights
+   * @param[in]       ch_im_out           number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel_x        filter kernel size x
+   * @param[in]       dim_kernel_y        filter kernel size y
+   * @param[in]       padding_x           padding size x
+   * @param[in]       padding_y           padding size y
+   * @param[in]       stride_x            convolution stride x
+   * @param[in]       stride_y            convolution stride y
+   * @param[in]       bias                pointer to per-channel s32 bias, or NULL
+   * @param[in]       out_mult            pointer to per-channel output multipliers
+   * @param[in]       out_shift           pointer to per-channel output shifts, left if positive
+   * @param[in]       input_offset        negated zero point of the input
+   * @param[in]       output_offset       zero point of the output
+   * @param[in]       out_activation_min  smallest output value, -128 without activation
+   * @param[in]       out_activation_max  largest output value, 127 without activation
+   * @param[in,out]   Im_out              pointer to output tensor
+   * @param[in]       dim_im_out_x        output tensor dimension x
+   * @param[in]       dim_im_out_y        output tensor dimension y
+   * @param[in,out]   bufferA             pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y
+   */
+    arm_status arm_convolve_HWC_s8_nonsquare(const q7_t * Im_in,
+                                             const uint16_t dim_im_in_x,
+                                             const uint16_t dim_im_in_y,
+                                             const uint16_t ch_im_in,
+                                             const q7_t * wt,
+                                             const uint16_t ch_im_out,
+                                             const uint16_t dim_kernel_x,
+                                             const uint16_t dim_kernel_y,
+                                             const uint16_t padding_x,
+                                             const uint16_t padding_y,
+                                             const uint16_t stride_x,
+                                             const uint16_t stride_y,
+                                             const int32_t * bias,
+                                             const int32_t * out_mult,
+                                             const int32_t * out_shift,
+                                             const int32_t input_offset,
+                                             const int32_t output_offset,
+                                             const int32_t out_activation_min,
+                                             const int32_t out_activation_max,
+                                             q7_t * Im_out,
+                                             const uint16_t dim_im_out_x,
+                                             const uint16_t dim_im_out_y,
+                                             q15_t * bufferA);
+
 
 /**
  * @defgroup FC Fully-connected Layer Functions
@@ -796,6 +941,39 @@ extern    "C"
                                                       q15_t * pOut, 
                                                       q15_t * vec_buffer);
 
+  /**
+   * @brief s8 fully-connected layer function with per-row requantization
+   * @param[in]       pV                  pointer to input vector
+   * @param[in]       pM                  pointer to matrix weights
+   * @param[in]       dim_vec             length of the vector
+   * @param[in]       num_of_rows         number of rows in weight matrix
+   * @param[in]       bias                pointer to per-row s32 bias, or NULL
+   * @param[in]       out_mult            pointer to per-row output multipliers
+   * @param[in]       out_shift           pointer to per-row output shifts, left if positive
+   * @param[in]       input_offset        negated zero point of the input
+   * @param[in]       output_offset       zero point of the output
+   * @param[in]       out_activation_min  smallest output value, -128 without activation
+   * @param[in]       out_activation_max  largest output value, 127 without activation
+   * @param[in,out]   pOut                pointer to output vector
+   * @param[in,out]   vec_buffer          pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+    arm_status arm_fully_connected_s8(const q7_t * pV,
+                                      const q7_t * pM,
+                                      const uint16_t dim_vec,
+                                      const uint16_t num_of_rows,
+                                      const int32_t * bias,
+                                      const int32_t * out_mult,
+                                      const int32_t * out_shift,
+                                      const int32_t input_offset,
+                                      const int32_t output_offset,
+                                      const int32_t out_activation_min,
+                                      const int32_t out_activation_max,
+                                      q7_t * pOut,
+                                      q15_t * vec_buffer);
+
 /**
  * @brief Matrix-Multiplication Kernels for Convolution
  *
@@ -852,6 +1030,34 @@ extern    "C"
                                                       const q7_t * bias, 
                                                       q7_t * pOut);
 
+  /**
+   * @brief Matrix-multiplication function for s8 convolution
+   * @param[in]       pA                  pointer to operand A, the s8 weights
+   * @param[in]       pInBuffer           pointer to operand B, always conssists of 2 vectors
+   * @param[in]       ch_im_out           numRow of A
+   * @param[in]       numCol_A            numCol of A
+   * @param[in]       out_mult            per-channel output multipliers
+   * @param[in]       out_shift           per-channel output shifts, left if positive
+   * @param[in]       output_offset       zero point of the output
+   * @param[in]       out_activation_min  smallest output value
+   * @param[in]       out_activation_max  largest output value
+   * @param[in]       bias                per-channel s32 bias, or NULL
+   * @param[in,out]   pOut                pointer to output
+   * @return     The function returns the incremented output pointer
+   */
+
+    q7_t     *arm_nn_mat_mult_kernel_s8_s16(const q7_t * pA,
+                                            const q15_t * pInBuffer,
+                                            const uint16_t ch_im_out,
+                                            const uint16_t numCol_A,
+                                            const int32_t * out_mult,
+                                            const int32_t * out_shift,
+                                            const int32_t output_offset,
+                                            const int32_t out_activation_min,
+                                            const int32_t out_activation_max,
+                                            const int32_t * bias,
+                                            q7_t * pOut);
+
 #ifdef __cplusplus
 }
 #endif
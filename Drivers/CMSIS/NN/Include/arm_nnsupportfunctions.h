@@ -93,6 +93,18 @@ void      arm_q7_to_q15_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t block
 
 void      arm_q7_to_q15_reordered_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize);
 
+/**
+ * @brief Converts the elements of the Q7 vector to Q15 vector and adds an offset
+ * @param[in]       *pSrc points to the Q7 input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       offset value added to each element
+ * @return none.
+ *
+ */
+
+void      arm_q7_to_q15_with_offset(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize, q15_t offset);
+
 #if defined (ARM_MATH_DSP)
 
 /**
@@ -186,6 +198,106 @@ void arm_nn_mult_q7(
   const uint16_t out_shift,
   uint32_t blockSize);
  
+/**
+ * @brief Saturating rounding doubling high multiplication
+ * @param[in]       m1            first multiplicand
+ * @param[in]       m2            second multiplicand
+ * @return          the high word of 2 * m1 * m2, rounded to the nearest, ties upward.
+ *
+ * The only overflow, 0x80000000 * 0x80000000, saturates to 0x7FFFFFFF.
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_sat_doubling_high_mult(const q31_t m1, const q31_t m2)
+{
+    q31_t     result;
+    q63_t     mult = (q63_t) m1 * m2;
+
+    mult += (mult >= 0) ? (1LL << 30) : (1LL - (1LL << 30));
+    result = (q31_t) (mult / (1LL << 31));
+
+    if ((m1 == m2) && (m1 == (q31_t) 0x80000000))
+    {
+        result = 0x7FFFFFFF;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Rounding division by a power of two
+ * @param[in]       dividend      value to divide
+ * @param[in]       exponent      power of two, 0 to 31
+ * @return          dividend / 2^exponent, rounded to the nearest, ties away from zero.
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_divide_by_power_of_two(const q31_t dividend, const q31_t exponent)
+{
+    q31_t     result;
+    const q31_t remainder_mask = (q31_t) (((uint32_t) 1 << exponent) - 1U);
+    const q31_t remainder = remainder_mask & dividend;
+    q31_t     threshold = remainder_mask >> 1;
+
+    result = dividend >> exponent;
+
+    if (result < 0)
+    {
+        threshold++;
+    }
+    if (remainder > threshold)
+    {
+        result++;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Requantization of an accumulator with a multiplier and a shift
+ * @param[in]       val           accumulator
+ * @param[in]       multiplier    Q31 multiplier, 0x40000000 to 0x7FFFFFFF for a normalized scale
+ * @param[in]       shift         left shift if positive, right shift if negative
+ * @return          val * multiplier * 2^(shift - 31), rounded to the nearest.
+ *
+ * The accumulator is scaled by a real factor given as a Q31 multiplier and a
+ * power of two, the same arithmetic as the int8 reference kernels of the common
+ * model exporters, so that the results are bit-exact with them.
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_requantize(const q31_t val, const q31_t multiplier, const q31_t shift)
+{
+    const q31_t left_shift = (shift > 0) ? shift : 0;
+    const q31_t right_shift = (shift > 0) ? 0 : -shift;
+
+    return arm_nn_divide_by_power_of_two(arm_nn_sat_doubling_high_mult((q31_t) ((uint32_t) val << left_shift),
+                                                                       multiplier), right_shift);
+}
+
+/**
+ * @brief Requantization of an accumulator to an s8 output
+ * @param[in]       val           accumulator
+ * @param[in]       multiplier    Q31 multiplier
+ * @param[in]       shift         left shift if positive, right shift if negative
+ * @param[in]       offset        zero point of the output
+ * @param[in]       act_min       smallest output value
+ * @param[in]       act_max       largest output value
+ * @return          the requantized value with the offset, clamped to [act_min act_max].
+ */
+
+__STATIC_FORCEINLINE q7_t arm_nn_requantize_s8(const q31_t val,
+                                               const q31_t multiplier,
+                                               const q31_t shift,
+                                               const q31_t offset,
+                                               const q31_t act_min,
+                                               const q31_t act_max)
+{
+    q31_t     out = arm_nn_requantize(val, multiplier, shift) + offset;
+
+    out = (out < act_min) ? act_min : out;
+    out = (out > act_max) ? act_max : out;
+
+    return (q7_t) out;
+}
+
 /**
  * @brief defition to adding rouding offset
  */
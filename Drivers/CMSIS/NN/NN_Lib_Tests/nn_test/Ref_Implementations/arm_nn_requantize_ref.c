@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+/*
+ * Same rounding as the int8 exporters, written with 64-bit floor divisions:
+ * acc * mult / 2^31 rounded half up, then divided by 2^-shift rounded half
+ * away from zero.
+ */
+q7_t arm_nn_requantize_s8_ref(int32_t acc, int32_t mult, int32_t shift, int32_t offset,
+                              int32_t act_min, int32_t act_max)
+{
+    int       left = shift > 0 ? shift : 0;
+    int       right = shift > 0 ? 0 : -shift;
+    int32_t   scaled = (int32_t) ((uint32_t) acc << left);
+    int64_t   prod = (int64_t) scaled * mult;
+    int64_t   high = (prod + (1LL << 30)) >> 31;
+    int64_t   half = right > 0 ? (1LL << (right - 1)) : 0;
+    int64_t   out;
+
+    if (high >= 0)
+    {
+        out = (high + half) >> right;
+    } else
+    {
+        out = -((-high + half) >> right);
+    }
+
+    /* the saturated product of two 0x80000000 */
+    if (scaled == (int32_t) 0x80000000 && mult == (int32_t) 0x80000000)
+    {
+        out = 0x7FFFFFFF >> right;
+    }
+
+    out += offset;
+    out = out < act_min ? act_min : out;
+    out = out > act_max ? act_max : out;
+
+    return (q7_t) out;
+}
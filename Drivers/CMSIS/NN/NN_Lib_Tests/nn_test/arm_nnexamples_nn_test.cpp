@@ -46,9 +46,14 @@
 #define TEST_CONV
 #define TEST_NONSQUARE
 #define TEST_NNMULT
+#define TEST_S8
+#define TEST_CONV_POOL
+#define TEST_ODD_CH
+#define TEST_DW3X3
+#define TEST_PLAN
 
 int test_index = 0;
-q7_t test_flags[50];
+q7_t test_flags[100];
 bool test_pass;
 
 int main()
@@ -63,7 +68,7 @@ int main()
     q7_t     *test3;
     q15_t    *test4;
 
-    for (test_index = 0; test_index<50; test_index++) {
+    for (test_index = 0; test_index<100; test_index++) {
         test_flags[test_index] = -1;
     }
     test_index = 0;
@@ -781,6 +786,534 @@ int main()
     delete[]test3;
     delete[]test4;
 
+#endif
+
+#ifdef TEST_S8
+
+/* Odd channel counts and an odd number of output pixels exercise every tail */
+
+#define S8_IM_DIM_X 9
+#define S8_IM_DIM_Y 7
+#define S8_IM_CH 3
+#define S8_KER_DIM_X 3
+#define S8_KER_DIM_Y 3
+#define S8_PADDING_X 1
+#define S8_PADDING_Y 1
+#define S8_OUT_CH 5
+#define S8_OUT_DIM_X 9
+#define S8_OUT_DIM_Y 7
+#define S8_OUT_DIM_X_2 5
+#define S8_OUT_DIM_Y_2 4
+#define S8_WT_SIZE (S8_KER_DIM_Y * S8_KER_DIM_X * S8_IM_CH * S8_OUT_CH)
+#define S8_IM_SIZE (S8_IM_DIM_Y * S8_IM_DIM_X * S8_IM_CH)
+#define S8_OUT_SIZE (S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_OUT_CH)
+#define S8_FC_DIM 127
+#define S8_FC_ROWS 31
+#define S8_REQUANT_DIM 256
+
+    q7_t      s8_weights[S8_FC_DIM * S8_FC_ROWS];
+    q7_t      s8_in[S8_FC_DIM > S8_IM_SIZE ? S8_FC_DIM : S8_IM_SIZE];
+    int32_t   s8_bias[S8_FC_ROWS];
+    int32_t   s8_mult[S8_REQUANT_DIM];
+    int32_t   s8_shift[S8_REQUANT_DIM];
+    int32_t   s8_acc[S8_REQUANT_DIM];
+
+    test2 = new q15_t[2 * S8_KER_DIM_Y * S8_KER_DIM_X * S8_IM_CH + S8_FC_DIM];
+    test3 = new q7_t[2 * S8_OUT_SIZE + 2 * S8_REQUANT_DIM];
+
+    q7_t     *s8_out_ref = test3;
+    q7_t     *s8_out_opt = test3 + S8_OUT_SIZE;
+    q7_t     *s8_requant_ref = test3 + 2 * S8_OUT_SIZE;
+    q7_t     *s8_requant_opt = s8_requant_ref + S8_REQUANT_DIM;
+
+    for (int i = 0; i < S8_FC_DIM * S8_FC_ROWS; i++)
+    {
+        s8_weights[i] = rand() % 256 - 128;
+    }
+    for (int i = 0; i < (int) sizeof(s8_in); i++)
+    {
+        s8_in[i] = rand() % 256 - 128;
+    }
+    for (int i = 0; i < S8_FC_ROWS; i++)
+    {
+        s8_bias[i] = rand() % 20000 - 10000;
+    }
+
+    /* requantization, including the saturated product and exact ties */
+    for (int i = 0; i < S8_REQUANT_DIM; i++)
+    {
+        s8_acc[i] = (int32_t) (((uint32_t) rand() << 16) ^ (uint32_t) rand());
+        s8_mult[i] = 0x40000000 + (rand() % 0x4000) * 0x10000 + rand() % 0x10000;
+        s8_shift[i] = -(rand() % 31);
+    }
+    s8_acc[0] = (int32_t) 0x80000000;
+    s8_mult[0] = (int32_t) 0x80000000;
+    s8_shift[0] = -24;
+    for (int i = 1; i < 9; i++)
+    {
+        /* acc * mult / 2^31 is -1.5, -0.5, 0.5 or 1.5, then ties of the shift */
+        s8_acc[i] = (2 * (i & 3) - 3) * 0x100;
+        s8_mult[i] = 0x40000000;
+        s8_shift[i] = (i < 5) ? -8 : 0;
+    }
+    s8_shift[9] = 2;
+    s8_acc[9] = 1000;
+
+    for (int i = 0; i < S8_REQUANT_DIM; i++)
+    {
+        s8_requant_ref[i] = arm_nn_requantize_s8_ref(s8_acc[i], s8_mult[i], s8_shift[i], 3, -128, 127);
+        s8_requant_opt[i] = arm_nn_requantize_s8(s8_acc[i], s8_mult[i], s8_shift[i], 3, -128, 127);
+    }
+
+    printf("start s8 requantization\n");
+    verify_results_q7(s8_requant_ref, s8_requant_opt, S8_REQUANT_DIM);
+
+    /* per-channel scales that keep most of the outputs in range */
+    for (int i = 0; i < S8_FC_ROWS; i++)
+    {
+        s8_mult[i] = 0x40000000 + (rand() % 0x4000) * 0x10000;
+        s8_shift[i] = -(rand() % 4) - 8;
+    }
+
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_OUT_SIZE);
+
+    printf("start conv s8 nonsquare ref implementation\n");
+    arm_convolve_HWC_s8_ref_nonsquare(s8_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weights, S8_OUT_CH,
+                                      S8_KER_DIM_X, S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, 1, 1,
+                                      s8_bias, s8_mult, s8_shift, 17, -5, -128, 127,
+                                      s8_out_ref, S8_OUT_DIM_X, S8_OUT_DIM_Y);
+
+    printf("start conv s8 nonsquare implementation\n");
+    arm_convolve_HWC_s8_nonsquare(s8_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weights, S8_OUT_CH,
+                                  S8_KER_DIM_X, S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, 1, 1,
+                                  s8_bias, s8_mult, s8_shift, 17, -5, -128, 127,
+                                  s8_out_opt, S8_OUT_DIM_X, S8_OUT_DIM_Y, test2);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_OUT_SIZE);
+
+    /* stride 2, no bias and a fused ReLU6 range */
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_OUT_SIZE);
+
+    printf("start conv s8 nonsquare ref implementation with stride 2\n");
+    arm_convolve_HWC_s8_ref_nonsquare(s8_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weights, S8_OUT_CH,
+                                      S8_KER_DIM_X, S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, 2, 2,
+                                      NULL, s8_mult, s8_shift, -40, 10, 10, 70,
+                                      s8_out_ref, S8_OUT_DIM_X_2, S8_OUT_DIM_Y_2);
+
+    printf("start conv s8 nonsquare implementation with stride 2\n");
+    arm_convolve_HWC_s8_nonsquare(s8_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weights, S8_OUT_CH,
+                                  S8_KER_DIM_X, S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, 2, 2,
+                                  NULL, s8_mult, s8_shift, -40, 10, 10, 70,
+                                  s8_out_opt, S8_OUT_DIM_X_2, S8_OUT_DIM_Y_2, test2);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_OUT_DIM_X_2 * S8_OUT_DIM_Y_2 * S8_OUT_CH);
+
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_FC_ROWS);
+
+    printf("start s8 fully-connected ref implementation\n");
+    arm_fully_connected_s8_ref(s8_in, s8_weights, S8_FC_DIM, S8_FC_ROWS, s8_bias, s8_mult, s8_shift,
+                               128, -20, -128, 127, s8_out_ref);
+
+    printf("start s8 fully-connected implementation\n");
+    arm_fully_connected_s8(s8_in, s8_weights, S8_FC_DIM, S8_FC_ROWS, s8_bias, s8_mult, s8_shift,
+                           128, -20, -128, 127, s8_out_opt, test2);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_FC_ROWS);
+
+    delete[]test2;
+    delete[]test3;
+
+#endif
+
+#ifdef TEST_CONV_POOL
+
+#define CONV_POOL_NUM_LAYERS 4
+#define CONV_POOL_MAX_IM 16 * 16 * 32
+#define CONV_POOL_MAX_WT 5 * 5 * 32 * 16
+#define CONV_POOL_MAX_OUT 16 * 16 * 16
+
+    // dim_im_in, ch_im_in, dim_kernel, padding, stride, ch_im_out, dim_conv_out,
+    // dim_pool_kernel, pool_padding, pool_stride, dim_im_out
+    const uint16_t conv_pool_layers[CONV_POOL_NUM_LAYERS][11] = {
+        {16, 32, 5, 2, 1, 16, 16, 3, 0, 2, 8},  // cifar10 conv2 + pool2
+        {9, 8, 3, 1, 1, 6, 9, 2, 0, 2, 4},      // 2x2 pooling, last row and column dropped
+        {11, 4, 3, 0, 2, 8, 5, 2, 1, 3, 2},     // conv rows and columns outside of every window
+        {7, 4, 3, 1, 1, 2, 7, 3, 1, 2, 4},      // padded and clipped windows
+    };
+
+    test1 = new q7_t[CONV_POOL_MAX_WT + 32];
+    test2 = new q15_t[2 * 5 * 5 * 32];
+    test3 = new q7_t[CONV_POOL_MAX_IM + CONV_POOL_MAX_OUT + 2 * 8 * 8 * 16 + 2 * 16];
+
+    q7_t     *conv_pool_wt = test1;
+    q7_t     *conv_pool_bias = test1 + CONV_POOL_MAX_WT;
+    q7_t     *conv_pool_in = test3;
+    q7_t     *conv_pool_conv_ref = test3 + CONV_POOL_MAX_IM;
+    q7_t     *conv_pool_out_ref = conv_pool_conv_ref + CONV_POOL_MAX_OUT;
+    q7_t     *conv_pool_out_opt = conv_pool_out_ref + 8 * 8 * 16;
+    q7_t     *conv_pool_buf = conv_pool_out_opt + 8 * 8 * 16;
+
+    for (int i = 0; i < CONV_POOL_MAX_WT + 32; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for (int i = 0; i < CONV_POOL_MAX_IM; i++)
+    {
+        conv_pool_in[i] = rand() % 256 - 128;
+    }
+
+    for (int n = 0; n < CONV_POOL_NUM_LAYERS; n++)
+    {
+        const uint16_t *l = conv_pool_layers[n];
+
+        initialize_results_q7(conv_pool_out_ref, conv_pool_out_opt, l[10] * l[10] * l[5]);
+
+        printf("start ref conv, relu and maxpool implementation\n");
+
+        arm_convolve_HWC_q7_ref(conv_pool_in, l[0], l[1], conv_pool_wt, l[5], l[2], l[3], l[4],
+                                conv_pool_bias, 1, 7, conv_pool_conv_ref, l[6], test2, NULL);
+        arm_relu_q7_ref(conv_pool_conv_ref, l[6] * l[6] * l[5]);
+        arm_maxpool_q7_HWC_ref(conv_pool_conv_ref, l[6], l[5], l[7], l[8], l[9], l[10], NULL,
+                               conv_pool_out_ref);
+
+        printf("start fused conv, relu and maxpool implementation\n");
+
+        arm_convolve_HWC_q7_fast_relu_pool(conv_pool_in, l[0], l[1], conv_pool_wt, l[5], l[2], l[3], l[4],
+                                           conv_pool_bias, 1, 7, l[6], l[7], l[8], l[9],
+                                           conv_pool_out_opt, l[10], test2, conv_pool_buf);
+
+        verify_results_q7(conv_pool_out_ref, conv_pool_out_opt, l[10] * l[10] * l[5]);
+    }
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
+#endif
+
+#ifdef TEST_ODD_CH
+
+/* Channel counts that are not multiples of 4 (input) or 2 (output) */
+#define ODD_NUM_CONFIGS 3
+#define ODD_IM_DIM_X 9
+#define ODD_IM_DIM_Y 7
+#define ODD_MAX_CH 8
+
+    // ch_im_in, ch_im_out
+    const uint16_t odd_ch[ODD_NUM_CONFIGS][2] = {
+        {8, 5},                 // reordered columns, left-over row
+        {7, 6},                 // plain columns
+        {5, 3},
+    };
+
+    test1 = new q7_t[5 * 5 * ODD_MAX_CH * ODD_MAX_CH + ODD_MAX_CH];
+    test2 = new q15_t[2 * 5 * 5 * ODD_MAX_CH];
+    test3 = new q7_t[ODD_IM_DIM_X * ODD_IM_DIM_X * ODD_MAX_CH * 4 + 2 * ODD_MAX_CH];
+
+    q7_t     *odd_wt = test1;
+    q7_t     *odd_bias = test1 + 5 * 5 * ODD_MAX_CH * ODD_MAX_CH;
+    q7_t     *odd_in = test3;
+    q7_t     *odd_out_ref = test3 + ODD_IM_DIM_X * ODD_IM_DIM_X * ODD_MAX_CH;
+    q7_t     *odd_out_opt = odd_out_ref + ODD_IM_DIM_X * ODD_IM_DIM_X * ODD_MAX_CH;
+    q7_t     *odd_conv = odd_out_opt + ODD_IM_DIM_X * ODD_IM_DIM_X * ODD_MAX_CH;
+    q7_t     *odd_buf = odd_conv + ODD_IM_DIM_X * ODD_IM_DIM_X * ODD_MAX_CH;
+
+    for (int i = 0; i < 5 * 5 * ODD_MAX_CH * ODD_MAX_CH + ODD_MAX_CH; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for (int i = 0; i < ODD_IM_DIM_X * ODD_IM_DIM_X * ODD_MAX_CH; i++)
+    {
+        odd_in[i] = rand() % 256 - 128;
+    }
+
+    for (int n = 0; n < ODD_NUM_CONFIGS; n++)
+    {
+        uint16_t  ch_in = odd_ch[n][0];
+        uint16_t  ch_out = odd_ch[n][1];
+
+        printf("start q7 fast conv with %d input and %d output channels\n", ch_in, ch_out);
+
+        initialize_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_X * ch_out);
+        arm_convolve_HWC_q7_ref(odd_in, ODD_IM_DIM_X, ch_in, odd_wt, ch_out, 3, 1, 1, odd_bias, 1, 10,
+                                odd_out_ref, ODD_IM_DIM_X, test2, NULL);
+        arm_convolve_HWC_q7_fast(odd_in, ODD_IM_DIM_X, ch_in, odd_wt, ch_out, 3, 1, 1, odd_bias, 1, 10,
+                                 odd_out_opt, ODD_IM_DIM_X, test2, NULL);
+        verify_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_X * ch_out);
+
+        printf("start q7 fast nonsquare conv\n");
+
+        initialize_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_Y * ch_out);
+        arm_convolve_HWC_q7_ref_nonsquare(odd_in, ODD_IM_DIM_X, ODD_IM_DIM_Y, ch_in, odd_wt, ch_out, 5, 3, 2, 1,
+                                          1, 1, odd_bias, 1, 10, odd_out_ref, ODD_IM_DIM_X, ODD_IM_DIM_Y, test2, NULL);
+        arm_convolve_HWC_q7_fast_nonsquare(odd_in, ODD_IM_DIM_X, ODD_IM_DIM_Y, ch_in, odd_wt, ch_out, 5, 3, 2, 1,
+                                           1, 1, odd_bias, 1, 10, odd_out_opt, ODD_IM_DIM_X, ODD_IM_DIM_Y, test2,
+                                           NULL);
+        verify_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_Y * ch_out);
+
+        printf("start q7 1x1 conv\n");
+
+        initialize_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_Y * ch_out);
+        arm_convolve_HWC_q7_ref_nonsquare(odd_in, ODD_IM_DIM_X, ODD_IM_DIM_Y, ch_in, odd_wt, ch_out, 1, 1, 0, 0,
+                                          1, 1, odd_bias, 1, 7, odd_out_ref, ODD_IM_DIM_X, ODD_IM_DIM_Y, test2, NULL);
+        arm_convolve_1x1_HWC_q7_fast_nonsquare(odd_in, ODD_IM_DIM_X, ODD_IM_DIM_Y, ch_in, odd_wt, ch_out, 1, 1, 0, 0,
+                                               1, 1, odd_bias, 1, 7, odd_out_opt, ODD_IM_DIM_X, ODD_IM_DIM_Y, test2,
+                                               NULL);
+        verify_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_Y * ch_out);
+
+        printf("start q7 fused conv, relu and maxpool\n");
+
+        initialize_results_q7(odd_out_ref, odd_out_opt, 4 * 4 * ch_out);
+        arm_convolve_HWC_q7_ref(odd_in, ODD_IM_DIM_X, ch_in, odd_wt, ch_out, 3, 1, 1, odd_bias, 1, 10,
+                                odd_conv, ODD_IM_DIM_X, test2, NULL);
+        arm_relu_q7_ref(odd_conv, ODD_IM_DIM_X * ODD_IM_DIM_X * ch_out);
+        arm_maxpool_q7_HWC_ref(odd_conv, ODD_IM_DIM_X, ch_out, 2, 0, 2, 4, NULL, odd_out_ref);
+        arm_convolve_HWC_q7_fast_relu_pool(odd_in, ODD_IM_DIM_X, ch_in, odd_wt, ch_out, 3, 1, 1, odd_bias, 1, 10,
+                                           ODD_IM_DIM_X, 2, 0, 2, odd_out_opt, 4, test2, odd_buf);
+        verify_results_q7(odd_out_ref, odd_out_opt, 4 * 4 * ch_out);
+
+        printf("start q7 depthwise separable conv with %d channels\n", ch_out);
+
+        initialize_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_X * ch_out);
+        arm_depthwise_separable_conv_HWC_q7_ref(odd_in, ODD_IM_DIM_X, ch_out, odd_wt, ch_out, 3, 1, 1, odd_bias, 1, 7,
+                                                odd_out_ref, ODD_IM_DIM_X, test2, NULL);
+        arm_depthwise_separable_conv_HWC_q7(odd_in, ODD_IM_DIM_X, ch_out, odd_wt, ch_out, 3, 1, 1, odd_bias, 1, 7,
+                                            odd_out_opt, ODD_IM_DIM_X, test2, NULL);
+        verify_results_q7(odd_out_ref, odd_out_opt, ODD_IM_DIM_X * ODD_IM_DIM_X * ch_out);
+    }
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
+#endif
+
+#ifdef TEST_DW3X3
+
+#define DW_NUM_CONFIGS 5
+#define DW_MAX_DIM 10
+#define DW_MAX_CH 16
+
+    // ch, dim_im_in, padding, stride, dim_im_out
+    const uint16_t dw_cfg[DW_NUM_CONFIGS][5] = {
+        {8, 9, 1, 1, 9},
+        {7, 9, 1, 2, 5},        // 4-channel group and scalar tail
+        {12, 10, 0, 2, 4},
+        {3, 7, 0, 1, 5},        // scalar channels only
+        {16, 8, 1, 2, 4},       // last window is padded on one side only
+    };
+
+    test1 = new q7_t[5 * 5 * DW_MAX_CH + DW_MAX_CH];
+    test2 = new q15_t[2 * 5 * 5 * DW_MAX_CH];
+    test3 = new q7_t[DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH * 3];
+
+    q7_t     *dw_wt = test1;
+    q7_t     *dw_bias = test1 + 5 * 5 * DW_MAX_CH;
+    q7_t     *dw_in = test3;
+    q7_t     *dw_out_ref = test3 + DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH;
+    q7_t     *dw_out_opt = dw_out_ref + DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH;
+
+    for (int i = 0; i < 5 * 5 * DW_MAX_CH + DW_MAX_CH; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for (int i = 0; i < DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH; i++)
+    {
+        dw_in[i] = rand() % 256 - 128;
+    }
+
+    for (int n = 0; n < DW_NUM_CONFIGS; n++)
+    {
+        uint16_t  ch = dw_cfg[n][0];
+        uint16_t  dim_in = dw_cfg[n][1];
+        uint16_t  pad = dw_cfg[n][2];
+        uint16_t  stride = dw_cfg[n][3];
+        uint16_t  dim_out = dw_cfg[n][4];
+
+        printf("start q7 3x3 depthwise conv with %d channels, stride %d, padding %d\n", ch, stride, pad);
+
+        initialize_results_q7(dw_out_ref, dw_out_opt, dim_out * dim_out * ch);
+        arm_depthwise_separable_conv_HWC_q7_ref(dw_in, dim_in, ch, dw_wt, ch, 3, pad, stride, dw_bias, 1, 7,
+                                                dw_out_ref, dim_out, test2, NULL);
+        arm_depthwise_separable_conv_3x3_HWC_q7(dw_in, dim_in, ch, dw_wt, ch, 3, pad, stride, dw_bias, 1, 7,
+                                                dw_out_opt, dim_out, NULL, NULL);
+        verify_results_q7(dw_out_ref, dw_out_opt, dim_out * dim_out * ch);
+
+        // the generic entry point goes through the same kernel
+        initialize_results_q7(dw_out_ref, dw_out_opt, dim_out * dim_out * ch);
+        arm_depthwise_separable_conv_HWC_q7_ref(dw_in, dim_in, ch, dw_wt, ch, 3, pad, stride, dw_bias, 1, 7,
+                                                dw_out_ref, dim_out, test2, NULL);
+        arm_depthwise_separable_conv_HWC_q7(dw_in, dim_in, ch, dw_wt, ch, 3, pad, stride, dw_bias, 1, 7,
+                                            dw_out_opt, dim_out, test2, NULL);
+        verify_results_q7(dw_out_ref, dw_out_opt, dim_out * dim_out * ch);
+    }
+
+    printf("start q7 5x5 depthwise conv\n");
+
+    // other kernel sizes still take the column buffer path
+    initialize_results_q7(dw_out_ref, dw_out_opt, 8 * 8 * 12);
+    arm_depthwise_separable_conv_HWC_q7_ref(dw_in, 8, 12, dw_wt, 12, 5, 2, 1, dw_bias, 1, 7,
+                                            dw_out_ref, 8, test2, NULL);
+    arm_depthwise_separable_conv_HWC_q7(dw_in, 8, 12, dw_wt, 12, 5, 2, 1, dw_bias, 1, 7,
+                                        dw_out_opt, 8, test2, NULL);
+    verify_results_q7(dw_out_ref, dw_out_opt, 8 * 8 * 12);
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
+#endif
+
+#ifdef TEST_PLAN
+
+#define PLAN_NUM_LAYERS 9
+#define PLAN_NUM_TENSORS 10
+
+    test1 = new q7_t[3 * 3 * 8 * 16 + 3 * 3 * 3 * 8 + 3 * 3 * 16 + 144 * 10 + 64];
+    test2 = new q15_t[2 * 144];
+    test3 = new q7_t[6 * 12 * 12 * 16];
+
+    q7_t     *plan_wt_conv1 = test1;
+    q7_t     *plan_wt_conv2 = plan_wt_conv1 + 3 * 3 * 3 * 8;
+    q7_t     *plan_wt_dw = plan_wt_conv2 + 3 * 3 * 8 * 16;
+    q7_t     *plan_wt_fc = plan_wt_dw + 3 * 3 * 16;
+    q7_t     *plan_bias = plan_wt_fc + 144 * 10;
+
+    for (int i = 0; i < 3 * 3 * 8 * 16 + 3 * 3 * 3 * 8 + 3 * 3 * 16 + 144 * 10 + 64; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    // type, input, output, dim_im_in, ch_im_in, dim_im_out, ch_im_out, dim_kernel, padding, stride,
+    // bias_shift, out_shift, wt, bias, dim_conv_out, dim_pool_kernel, pool_padding, pool_stride
+    arm_nn_layer plan_layers[PLAN_NUM_LAYERS] = {
+        {ARM_NN_LAYER_CONV, 0, 1, 12, 3, 12, 8, 3, 1, 1, 1, 9, plan_wt_conv1, plan_bias},
+        {ARM_NN_LAYER_RELU, 1, 2, 12, 8, 12, 8},                                            // in place
+        {ARM_NN_LAYER_CONV_RELU_POOL, 2, 3, 12, 8, 6, 16, 3, 1, 1, 1, 10, plan_wt_conv2, plan_bias, 12, 2, 0, 2},
+        {ARM_NN_LAYER_DEPTHWISE, 3, 4, 6, 16, 6, 16, 3, 1, 1, 1, 7, plan_wt_dw, plan_bias},
+        {ARM_NN_LAYER_RELU, 4, 5, 6, 16, 6, 16},                                            // input read again
+        {ARM_NN_LAYER_MAXPOOL, 5, 6, 6, 16, 3, 16, 2, 0, 2},
+        {ARM_NN_LAYER_AVEPOOL, 4, 7, 6, 16, 3, 16, 2, 0, 2},                                // output of the network
+        {ARM_NN_LAYER_FC, 6, 8, 1, 144, 1, 10, 0, 0, 0, 1, 9, plan_wt_fc, plan_bias},
+        {ARM_NN_LAYER_SOFTMAX, 8, 9, 1, 10, 1, 10},                                         // in place
+    };
+    arm_nn_tensor plan_tensors[PLAN_NUM_TENSORS];
+    uint32_t  plan_scratch[PLAN_NUM_LAYERS];
+    arm_nn_plan_instance plan;
+
+    printf("start q7 network plan\n");
+
+    arm_status plan_status = arm_nn_plan(&plan, plan_layers, PLAN_NUM_LAYERS, plan_tensors, PLAN_NUM_TENSORS,
+                                         plan_scratch);
+
+    printf("arena of %u bytes, at least %u live\n", (unsigned) plan.arenaSize, (unsigned) plan.minArenaSize);
+
+    // buffers live during the same layer must not overlap
+    bool      plan_ok = plan_status == ARM_MATH_SUCCESS && plan.arenaSize == plan.minArenaSize &&
+        plan_tensors[2].offset == plan_tensors[1].offset && plan_tensors[9].offset == plan_tensors[8].offset &&
+        plan_tensors[5].offset != plan_tensors[4].offset;
+
+    for (int i = 0; i < PLAN_NUM_TENSORS + PLAN_NUM_LAYERS; i++)
+    {
+        for (int j = i + 1; j < PLAN_NUM_TENSORS + PLAN_NUM_LAYERS; j++)
+        {
+            uint32_t  off[2], size[2];
+            int       first[2], last[2], k[2] = {i, j};
+
+            for (int m = 0; m < 2; m++)
+            {
+                if (k[m] < PLAN_NUM_TENSORS)
+                {
+                    off[m] = plan_tensors[k[m]].offset;
+                    size[m] = plan_tensors[plan_tensors[k[m]].alias].size;
+                    first[m] = plan_tensors[plan_tensors[k[m]].alias].first;
+                    last[m] = plan_tensors[plan_tensors[k[m]].alias].last;
+                } else
+                {
+                    off[m] = plan_scratch[k[m] - PLAN_NUM_TENSORS];
+                    size[m] = arm_nn_layer_scratch_size(&plan_layers[k[m] - PLAN_NUM_TENSORS]);
+                    first[m] = last[m] = k[m] - PLAN_NUM_TENSORS;
+                }
+            }
+
+            if (k[1] < PLAN_NUM_TENSORS && plan_tensors[i].alias == plan_tensors[j].alias)
+            {
+                continue;
+            }
+            if (size[0] && size[1] && first[0] <= last[1] && first[1] <= last[0] &&
+                off[0] < off[1] + size[1] && off[1] < off[0] + size[0])
+            {
+                printf("Buffers %d and %d overlap\n", i, j);
+                plan_ok = false;
+            }
+            if (off[0] + size[0] > plan.arenaSize || off[1] + size[1] > plan.arenaSize)
+            {
+                plan_ok = false;
+            }
+        }
+    }
+
+    // a pooling layer overwrites its input, which must not be read afterwards
+    plan_layers[5].input = 4;
+    plan_ok = plan_ok && arm_nn_plan(&plan, plan_layers, PLAN_NUM_LAYERS, plan_tensors, PLAN_NUM_TENSORS,
+                                     plan_scratch) == ARM_MATH_ARGUMENT_ERROR;
+    plan_layers[5].input = 5;
+
+    plan_layers[7].ch_im_in = 100;
+    plan_ok = plan_ok && arm_nn_plan(&plan, plan_layers, PLAN_NUM_LAYERS, plan_tensors, PLAN_NUM_TENSORS,
+                                     plan_scratch) == ARM_MATH_SIZE_MISMATCH;
+    plan_layers[7].ch_im_in = 144;
+
+    printf(plan_ok ? "Plan is valid.\r\n\r\n" : "Plan is not valid.\r\n\r\n");
+    test_flags[test_index++] = plan_ok ? 0 : 1;
+
+    printf("start q7 network run\n");
+
+    arm_nn_plan(&plan, plan_layers, PLAN_NUM_LAYERS, plan_tensors, PLAN_NUM_TENSORS, plan_scratch);
+
+    q7_t     *plan_arena = new q7_t[plan.arenaSize];
+    q7_t     *plan_in = test3;
+    q7_t     *plan_a = test3 + 12 * 12 * 16;
+    q7_t     *plan_b = plan_a + 12 * 12 * 16;
+    q7_t     *plan_c = plan_b + 12 * 12 * 16;
+    q7_t     *plan_d = plan_c + 12 * 12 * 16;
+    q7_t     *plan_e = plan_d + 12 * 12 * 16;
+
+    for (int i = 0; i < 12 * 12 * 3; i++)
+    {
+        plan_in[i] = rand() % 256 - 128;
+    }
+    memset(plan_arena, 0x5A, plan.arenaSize);
+    memcpy(plan_arena + plan_tensors[0].offset, plan_in, 12 * 12 * 3);
+
+    arm_nn_run(&plan, plan_arena);
+
+    arm_convolve_HWC_q7_ref(plan_in, 12, 3, plan_wt_conv1, 8, 3, 1, 1, plan_bias, 1, 9, plan_a, 12, test2, NULL);
+    arm_relu_q7_ref(plan_a, 12 * 12 * 8);
+    arm_convolve_HWC_q7_ref(plan_a, 12, 8, plan_wt_conv2, 16, 3, 1, 1, plan_bias, 1, 10, plan_b, 12, test2, NULL);
+    arm_relu_q7_ref(plan_b, 12 * 12 * 16);
+    arm_maxpool_q7_HWC_ref(plan_b, 12, 16, 2, 0, 2, 6, NULL, plan_c);
+    arm_depthwise_separable_conv_HWC_q7_ref(plan_c, 6, 16, plan_wt_dw, 16, 3, 1, 1, plan_bias, 1, 7, plan_d, 6,
+                                            test2, NULL);
+    memcpy(plan_a, plan_d, 6 * 6 * 16);
+    arm_relu_q7_ref(plan_a, 6 * 6 * 16);
+    arm_maxpool_q7_HWC_ref(plan_a, 6, 16, 2, 0, 2, 3, NULL, plan_b);
+    // the avepool kernel rounds differently from its ref, and the input is not read again
+    arm_avepool_q7_HWC(plan_d, 6, 16, 2, 0, 2, 3, (q7_t *) test2, plan_e);
+    arm_fully_connected_q7_ref(plan_b, plan_wt_fc, 144, 10, 1, 9, plan_bias, plan_c, test2);
+    arm_softmax_q7(plan_c, 10, plan_c);
+
+    verify_results_q7(plan_e, plan_arena + plan_tensors[7].offset, 3 * 3 * 16);
+    verify_results_q7(plan_c, plan_arena + plan_tensors[9].offset, 10);
+
+    delete[]plan_arena;
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
 #endif
 
     test_pass = true;
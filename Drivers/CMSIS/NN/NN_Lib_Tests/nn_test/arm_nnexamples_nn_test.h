@@ -8,10 +8,11 @@
 #include "arm_math.h"
 
 #include "arm_nnfunctions.h"
+#include "arm_nn_plan.h"
 #include "ref_functions.h"
 
 extern int test_index;
-extern q7_t test_flags[50];
+extern q7_t test_flags[100];
 
 void initialize_results_q7(q7_t * ref, q7_t * opt, int length)
 {
@@ -71,8 +71,12 @@
  *
  * This function is the version with full list of optimization tricks, but with
  * some contraints:
- *   ch_im_in is multiple of 4
- *   ch_im_out is multiple of 2
+ *   dim_kernel_x and dim_kernel_y are 1
+ *   padding_x and padding_y are 0
+ *   stride_x and stride_y are 1
+ *
+ * The column of each pixel is a single group of ch_im_in values, so the
+ * reordering lines up with the weights for any ch_im_in.
  *
  * [1] MobileNets: Efficient Convolutional Neural Networks for Mobile Vision Applications
  * https://arxiv.org/abs/1704.04861
@@ -114,7 +118,7 @@ arm_status arm_convolve_1x1_HWC_q7_fast_nonsquare(const q7_t * Im_in,
     q15_t    *pBuffer = bufferA;
     q7_t     *pOut = Im_out;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0 || dim_kernel_x != 1 || dim_kernel_y != 1
+    if (dim_kernel_x != 1 || dim_kernel_y != 1
         || padding_x != 0 || padding_y != 0 || stride_x != 1 || stride_y != 1)
     {
         /* check if the input dimension meets the constraints */
@@ -188,7 +192,7 @@ arm_status arm_convolve_1x1_HWC_q7_fast_nonsquare(const q7_t * Im_in,
     int       conv_out;
     int       in_row, in_col;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0 || dim_kernel_x != 1 || dim_kernel_y != 1
+    if (dim_kernel_x != 1 || dim_kernel_y != 1
         || padding_x != 0 || padding_y != 0 || stride_x != 1 || stride_y != 1)
     {
         /* check if the input dimension meets the constraints */
@@ -57,8 +57,7 @@
    * @param[in]       dim_im_out  output tensor dimension
    * @param[in,out]   bufferA     pointer to buffer space for input 
    * @param[in,out]   bufferB     pointer to buffer space for output
-   * @return     The function returns either
-   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
    *
    * @details
    *
@@ -68,12 +67,6 @@
    *
    * bufferB size: 0
    *
-   * <b>Input dimension constraints:</b>
-   *
-   * ch_im_in is multiple of 4    ( because of the SIMD32 read and swap )
-   *
-   * ch_im_out is multipe of 2    ( bacause 2x2 mat_mult kernel )
-   *
    * The im2col converts the Q7 tensor input into Q15 column, which is stored in
    * bufferA. There is reordering happenning during this im2col process with
    * arm_q7_to_q15_reordered_no_shift. For every four elements, the second and
@@ -82,6 +75,12 @@
    * The computation kernel arm_nn_mat_mult_kernel_q7_q15_reordered does the
    * GEMM computation with the reordered columns.
    *
+   * The weights are read in groups of four along the whole column, so the
+   * reordering only lines up when ch_im_in is a multiple of 4. For other
+   * channel counts, the im2col uses arm_q7_to_q15_no_shift and the GEMM uses
+   * arm_nn_mat_mult_kernel_q7_q15. An odd ch_im_out is handled by the
+   * left-over row of the kernels.
+   *
    * To speed-up the determination of the padding condition, we split the
    * computation into 3x3 parts, i.e., {top, mid, bottom} X {left, mid, right}.
    * This reduces the total number of boundary condition checks and improves
@@ -119,10 +118,19 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
     q15_t    *pBuffer = bufferA;
     q7_t     *pOut = Im_out;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
+    /*
+     *  The reordered im2col matches the reordered weights only when every pixel
+     *  holds whole groups of 4 channels, otherwise the plain ones are used
+     */
+    void      (*im2col) (const q7_t *, q15_t *, uint32_t) = arm_q7_to_q15_reordered_no_shift;
+    q7_t     *(*mat_mult) (const q7_t *, const q15_t *, const uint16_t, const uint16_t,
+                           const uint16_t, const uint16_t, const q7_t *, q7_t *) =
+        arm_nn_mat_mult_kernel_q7_q15_reordered;
+
+    if (ch_im_in % 4 != 0)
     {
-        /* check if the input dimension meets the constraints */
-        return ARM_MATH_SIZE_MISMATCH;
+        im2col = arm_q7_to_q15_no_shift;
+        mat_mult = arm_nn_mat_mult_kernel_q7_q15;
     }
 
     /*
@@ -148,7 +156,7 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift
+                        im2col
                             ((q7_t *) Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
@@ -158,12 +166,8 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel * dim_kernel)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt,
-                                                            bufferA,
-                                                            ch_im_out,
-                                                            ch_im_in
-                                                            *
-                                                            dim_kernel * dim_kernel, bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel * dim_kernel,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -188,7 +192,7 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift
+                        im2col
                             ((q7_t *) Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
@@ -198,12 +202,8 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel * dim_kernel)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt,
-                                                            bufferA,
-                                                            ch_im_out,
-                                                            ch_im_in
-                                                            *
-                                                            dim_kernel * dim_kernel, bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel * dim_kernel,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -215,24 +215,16 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
             /* This part implements the im2col function */
             for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
             {
-                arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in
-                                                 +
-                                                 (i_ker_y *
-                                                  dim_im_in +
-                                                  i_out_x *
-                                                  stride - padding) * ch_im_in, pBuffer, ch_im_in * dim_kernel);
+                im2col((q7_t *) Im_in + (i_ker_y * dim_im_in + i_out_x * stride - padding) * ch_im_in,
+                       pBuffer, ch_im_in * dim_kernel);
                 pBuffer += ch_im_in * dim_kernel;
             }
 
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel * dim_kernel)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt,
-                                                            bufferA,
-                                                            ch_im_out,
-                                                            ch_im_in
-                                                            *
-                                                            dim_kernel * dim_kernel, bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel * dim_kernel,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -252,7 +244,7 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift
+                        im2col
                             ((q7_t *) Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
@@ -262,12 +254,8 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel * dim_kernel)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt,
-                                                            bufferA,
-                                                            ch_im_out,
-                                                            ch_im_in
-                                                            *
-                                                            dim_kernel * dim_kernel, bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel * dim_kernel,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -289,7 +277,7 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift
+                        im2col
                             ((q7_t *) Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
@@ -299,12 +287,8 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel * dim_kernel)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt,
-                                                            bufferA,
-                                                            ch_im_out,
-                                                            ch_im_in
-                                                            *
-                                                            dim_kernel * dim_kernel, bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel * dim_kernel,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -330,7 +314,13 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
                 q31_t     inA1, inA2;
                 q31_t     inB1, inB2;
 
-                pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+                if (ch_im_in % 4 == 0)
+                {
+                    pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+                } else
+                {
+                    pA = (q7_t *) read_and_pad((void *)pA, &inA1, &inA2);
+                }
 
                 inB1 = *__SIMD32(pB)++;
                 sum = __SMLAD(inA1, inB1, sum);
@@ -360,12 +350,6 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
     int       conv_out;
     signed char in_row, in_col;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
-    {
-        /* check if the input dimension meets the constraints */
-        return ARM_MATH_SIZE_MISMATCH;
-    }
-
     for (i = 0; i < ch_im_out; i++)
     {
         for (j = 0; j < dim_im_out; j++)
@@ -62,13 +62,11 @@
  * @param[in]       dim_im_out_y output tensor dimension y
  * @param[in,out]   bufferA      pointer to buffer space for input 
  * @param[in,out]   bufferB      pointer to buffer space for output
- * @return     The function returns either
- * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
  *
- * This function is the version with full list of optimization tricks, but with
- * some contraints:
- *   ch_im_in is multiple of 4
- *   ch_im_out is multiple of 2
+ * This function is the version with full list of optimization tricks. When
+ * ch_im_in is not a multiple of 4, the columns are not reordered, see
+ * arm_convolve_HWC_q7_fast.
  */
 
 arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
@@ -106,10 +104,19 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
     q15_t    *pBuffer = bufferA;
     q7_t     *pOut = Im_out;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
+    /*
+     *  The reordered im2col matches the reordered weights only when every pixel
+     *  holds whole groups of 4 channels, otherwise the plain ones are used
+     */
+    void      (*im2col) (const q7_t *, q15_t *, uint32_t) = arm_q7_to_q15_reordered_no_shift;
+    q7_t     *(*mat_mult) (const q7_t *, const q15_t *, const uint16_t, const uint16_t,
+                           const uint16_t, const uint16_t, const q7_t *, q7_t *) =
+        arm_nn_mat_mult_kernel_q7_q15_reordered;
+
+    if (ch_im_in % 4 != 0)
     {
-        /* check if the input dimension meets the constraints */
-        return ARM_MATH_SIZE_MISMATCH;
+        im2col = arm_q7_to_q15_no_shift;
+        mat_mult = arm_nn_mat_mult_kernel_q7_q15;
     }
 
     /*
@@ -137,8 +144,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
-                                                         pBuffer, ch_im_in);
+                        im2col((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
+                               pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
                 }
@@ -147,8 +154,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel_x * dim_kernel_y)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
-                                                  bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -175,8 +182,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
-                                                         pBuffer, ch_im_in);
+                        im2col((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
+                               pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
                 }
@@ -185,8 +192,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel_x * dim_kernel_y)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
-                                                  bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -199,17 +206,17 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
             for (i_ker_y = i_out_y * stride_y - padding_y; i_ker_y < i_out_y * stride_y - padding_y + dim_kernel_y;
                  i_ker_y++)
             {
-                arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in +
-                                                 (i_ker_y * dim_im_in_x + i_out_x * stride_x - padding_x) * ch_im_in,
-                                                 pBuffer, ch_im_in * dim_kernel_x);
+                im2col((q7_t *) Im_in +
+                       (i_ker_y * dim_im_in_x + i_out_x * stride_x - padding_x) * ch_im_in,
+                       pBuffer, ch_im_in * dim_kernel_x);
                 pBuffer += ch_im_in * dim_kernel_x;
             }
 
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel_x * dim_kernel_y)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
-                                                  bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -231,8 +238,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
-                                                         pBuffer, ch_im_in);
+                        im2col((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
+                               pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
                 }
@@ -241,8 +248,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel_x * dim_kernel_y)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
-                                                  bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -266,8 +273,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
                         memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
                     } else
                     {
-                        arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
-                                                         pBuffer, ch_im_in);
+                        im2col((q7_t *) Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
+                               pBuffer, ch_im_in);
                     }
                     pBuffer += ch_im_in;
                 }
@@ -276,8 +283,8 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
             if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel_x * dim_kernel_y)
             {
                 pOut =
-                    arm_nn_mat_mult_kernel_q7_q15_reordered(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
-                                                  bias_shift, out_shift, bias, pOut);
+                    mat_mult(wt, bufferA, ch_im_out, ch_im_in * dim_kernel_x * dim_kernel_y,
+                             bias_shift, out_shift, bias, pOut);
                 /* counter reset */
                 pBuffer = bufferA;
             }
@@ -302,7 +309,13 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
                 q31_t     inA1, inA2;
                 q31_t     inB1, inB2;
 
-                pA = (const q7_t *)read_and_pad_reordered((void *)pA, &inA1, &inA2);
+                if (ch_im_in % 4 == 0)
+                {
+                    pA = (const q7_t *)read_and_pad_reordered((void *)pA, &inA1, &inA2);
+                } else
+                {
+                    pA = (const q7_t *)read_and_pad((void *)pA, &inA1, &inA2);
+                }
 
                 inB1 = *__SIMD32(pB)++;
                 sum = __SMLAD(inA1, inB1, sum);
@@ -332,12 +345,6 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
     int       conv_out;
     int       in_row, in_col;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
-    {
-        /* check if the input dimension meets the constraints */
-        return ARM_MATH_SIZE_MISMATCH;
-    }
-
     for (i = 0; i < ch_im_out; i++)
     {
         for (j = 0; j < dim_im_out_y; j++)
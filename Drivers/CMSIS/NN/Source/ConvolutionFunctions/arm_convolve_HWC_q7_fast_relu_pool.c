@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q7_fast_relu_pool.c
+ * Description:  Q7 convolution fused with ReLU and max pooling
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief Range of the pooling windows that contain a convolution output row or column
+ *
+ * Returns the last window index, the first one is stored in pFirst. The range is
+ * empty when the row or column is not part of any window.
+ */
+
+static int16_t pool_window_range(const int16_t pos,
+                                 const uint16_t dim_pool_kernel,
+                                 const uint16_t pool_padding,
+                                 const uint16_t pool_stride,
+                                 const uint16_t dim_im_out,
+                                 int16_t * pFirst)
+{
+    int16_t   first = pos + pool_padding - dim_pool_kernel + 1;
+    int16_t   last = (pos + pool_padding) / pool_stride;
+
+    if (first <= 0)
+    {
+        first = 0;
+    } else
+    {
+        first = (first + pool_stride - 1) / pool_stride;
+    }
+
+    if (last >= dim_im_out)
+    {
+        last = dim_im_out - 1;
+    }
+
+    *pFirst = first;
+    return last;
+}
+
+/**
+ * @brief Reduces one convolution output pixel into all the pooling windows that contain it
+ */
+
+static void max_pool_pixel_q7(const q7_t * pPixel,
+                              const int16_t i_conv_y,
+                              const int16_t i_conv_x,
+                              const uint16_t ch_im_out,
+                              const uint16_t dim_pool_kernel,
+                              const uint16_t pool_padding,
+                              const uint16_t pool_stride,
+                              const uint16_t dim_im_out,
+                              q7_t * Im_out)
+{
+    int16_t   first_y, last_y, first_x, last_x;
+    int16_t   i_y, i_x;
+    uint16_t  i_ch;
+
+    last_y = pool_window_range(i_conv_y, dim_pool_kernel, pool_padding, pool_stride, dim_im_out, &first_y);
+    last_x = pool_window_range(i_conv_x, dim_pool_kernel, pool_padding, pool_stride, dim_im_out, &first_x);
+
+    for (i_y = first_y; i_y <= last_y; i_y++)
+    {
+        for (i_x = first_x; i_x <= last_x; i_x++)
+        {
+            q7_t     *pOut = Im_out + (i_y * dim_im_out + i_x) * ch_im_out;
+
+            for (i_ch = 0; i_ch < ch_im_out; i_ch++)
+            {
+                if (pPixel[i_ch] > pOut[i_ch])
+                {
+                    pOut[i_ch] = pPixel[i_ch];
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Fast Q7 convolution function fused with ReLU and max pooling
+   * @param[in]       Im_in           pointer to input tensor
+   * @param[in]       dim_im_in       input tensor dimention
+   * @param[in]       ch_im_in        number of input tensor channels
+   * @param[in]       wt              pointer to kernel weights
+   * @param[in]       ch_im_out       number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel      filter kernel size
+   * @param[in]       padding         padding sizes
+   * @param[in]       stride          convolution stride
+   * @param[in]       bias            pointer to bias
+   * @param[in]       bias_shift      amount of left-shift for bias
+   * @param[in]       out_shift       amount of right-shift for output
+   * @param[in]       dim_conv_out    convolution output dimension, i.e., pooling input dimension
+   * @param[in]       dim_pool_kernel pooling window size
+   * @param[in]       pool_padding    pooling padding sizes
+   * @param[in]       pool_stride     pooling stride
+   * @param[in,out]   Im_out          pointer to output tensor
+   * @param[in]       dim_im_out      output tensor dimension
+   * @param[in,out]   bufferA         pointer to buffer space for input
+   * @param[in,out]   bufferB         pointer to buffer space for output
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+   *
+   * bufferB size: 2*ch_im_out
+   *
+   * Gives the same result as arm_convolve_HWC_q7_fast followed by arm_relu_q7
+   * and arm_maxpool_q7_HWC, without the dim_conv_out x dim_conv_out activation
+   * map in between. The convolution is computed two output pixels at a time
+   * into bufferB, and each pixel is reduced right away into the pooling windows
+   * that contain it, which are accumulated in Im_out. As the windows start
+   * from zero, the ReLU comes for free with the max.
+   *
+   * Pooling windows are clipped at the border of the convolution output, as in
+   * arm_maxpool_q7_HWC. Output pixels that are not part of any window are not
+   * computed.
+   *
+   * There is no constraint on the channel counts, see arm_convolve_HWC_q7_fast.
+   */
+
+arm_status
+arm_convolve_HWC_q7_fast_relu_pool(const q7_t * Im_in,
+                                   const uint16_t dim_im_in,
+                                   const uint16_t ch_im_in,
+                                   const q7_t * wt,
+                                   const uint16_t ch_im_out,
+                                   const uint16_t dim_kernel,
+                                   const uint16_t padding,
+                                   const uint16_t stride,
+                                   const q7_t * bias,
+                                   const uint16_t bias_shift,
+                                   const uint16_t out_shift,
+                                   const uint16_t dim_conv_out,
+                                   const uint16_t dim_pool_kernel,
+                                   const uint16_t pool_padding,
+                                   const uint16_t pool_stride,
+                                   q7_t * Im_out,
+                                   const uint16_t dim_im_out,
+                                   q15_t * bufferA,
+                                   q7_t * bufferB)
+{
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    int16_t   first_y, last_y, first_x, last_x;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    q15_t    *pBuffer = bufferA;
+    int16_t   pending_y = 0;
+    int16_t   pending_x = 0;
+
+    /*
+     *  The reordered im2col matches the reordered weights only when every pixel
+     *  holds whole groups of 4 channels, otherwise the plain ones are used
+     */
+    void      (*im2col) (const q7_t *, q15_t *, uint32_t) = arm_q7_to_q15_reordered_no_shift;
+    q7_t     *(*mat_mult) (const q7_t *, const q15_t *, const uint16_t, const uint16_t,
+                           const uint16_t, const uint16_t, const q7_t *, q7_t *) =
+        arm_nn_mat_mult_kernel_q7_q15_reordered;
+
+    if (ch_im_in % 4 != 0)
+    {
+        im2col = arm_q7_to_q15_no_shift;
+        mat_mult = arm_nn_mat_mult_kernel_q7_q15;
+    }
+
+    /* all windows start at zero, which also applies the ReLU */
+    memset(Im_out, 0, dim_im_out * dim_im_out * ch_im_out);
+
+    for (i_out_y = 0; i_out_y < dim_conv_out; i_out_y++)
+    {
+        last_y = pool_window_range(i_out_y, dim_pool_kernel, pool_padding, pool_stride, dim_im_out, &first_y);
+
+        for (i_out_x = 0; i_out_x < dim_conv_out && first_y <= last_y; i_out_x++)
+        {
+            last_x = pool_window_range(i_out_x, dim_pool_kernel, pool_padding, pool_stride, dim_im_out, &first_x);
+
+            if (first_x <= last_x)
+            {
+                int16_t   base_x = i_out_x * stride - padding;
+
+                /* This part implements the im2col function */
+                for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
+                {
+                    if (i_ker_y < 0 || i_ker_y >= dim_im_in)
+                    {
+                        memset(pBuffer, 0, sizeof(q15_t) * ch_im_in * dim_kernel);
+                    } else if (base_x >= 0 && base_x + dim_kernel <= dim_im_in)
+                    {
+                        im2col((q7_t *) Im_in + (i_ker_y * dim_im_in + base_x) * ch_im_in,
+                               pBuffer, ch_im_in * dim_kernel);
+                    } else
+                    {
+                        for (i_ker_x = base_x; i_ker_x < base_x + dim_kernel; i_ker_x++)
+                        {
+                            if (i_ker_x < 0 || i_ker_x >= dim_im_in)
+                            {
+                                memset(pBuffer + (i_ker_x - base_x) * ch_im_in, 0, sizeof(q15_t) * ch_im_in);
+                            } else
+                            {
+                                im2col
+                                    ((q7_t *) Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in,
+                                     pBuffer + (i_ker_x - base_x) * ch_im_in, ch_im_in);
+                            }
+                        }
+                    }
+                    pBuffer += ch_im_in * dim_kernel;
+                }
+
+                if (pBuffer == bufferA + 2 * ch_im_in * dim_kernel * dim_kernel)
+                {
+                    mat_mult(wt, bufferA, ch_im_out,
+                             ch_im_in * dim_kernel * dim_kernel,
+                             bias_shift, out_shift, bias, bufferB);
+
+                    max_pool_pixel_q7(bufferB, pending_y, pending_x, ch_im_out,
+                                      dim_pool_kernel, pool_padding, pool_stride, dim_im_out, Im_out);
+                    max_pool_pixel_q7(bufferB + ch_im_out, i_out_y, i_out_x, ch_im_out,
+                                      dim_pool_kernel, pool_padding, pool_stride, dim_im_out, Im_out);
+
+                    /* counter reset */
+                    pBuffer = bufferA;
+                } else
+                {
+                    pending_y = i_out_y;
+                    pending_x = i_out_x;
+                }
+            }
+        }
+    }
+
+    /* check if there is left-over for compute */
+    if (pBuffer != bufferA)
+    {
+        const q7_t *pA = wt;
+        int       i;
+
+        for (i = 0; i < ch_im_out; i++)
+        {
+            q31_t     sum = ((q31_t)bias[i] << bias_shift) + NN_ROUND(out_shift);
+            q15_t    *pB = bufferA;
+            /* each time it process 4 entries */
+            uint16_t  colCnt = ch_im_in * dim_kernel * dim_kernel >> 2;
+
+            while (colCnt)
+            {
+                q31_t     inA1, inA2;
+                q31_t     inB1, inB2;
+
+                if (ch_im_in % 4 == 0)
+                {
+                    pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+                } else
+                {
+                    pA = (q7_t *) read_and_pad((void *)pA, &inA1, &inA2);
+                }
+
+                inB1 = *__SIMD32(pB)++;
+                sum = __SMLAD(inA1, inB1, sum);
+                inB2 = *__SIMD32(pB)++;
+                sum = __SMLAD(inA2, inB2, sum);
+
+                colCnt--;
+            }
+            colCnt = ch_im_in * dim_kernel * dim_kernel & 0x3;
+            while (colCnt)
+            {
+                q7_t      inA1 = *pA++;
+                q15_t     inB1 = *pB++;
+                sum += inA1 * inB1;
+                colCnt--;
+            }
+            bufferB[i] = (q7_t) __SSAT((sum >> out_shift), 8);
+        }
+
+        max_pool_pixel_q7(bufferB, pending_y, pending_x, ch_im_out,
+                          dim_pool_kernel, pool_padding, pool_stride, dim_im_out, Im_out);
+    }
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint16_t  i, l;
+    int       conv_out;
+    int16_t   in_row, in_col;
+
+    /* all windows start at zero, which also applies the ReLU */
+    memset(Im_out, 0, dim_im_out * dim_im_out * ch_im_out);
+
+    for (i_out_y = 0; i_out_y < dim_conv_out; i_out_y++)
+    {
+        last_y = pool_window_range(i_out_y, dim_pool_kernel, pool_padding, pool_stride, dim_im_out, &first_y);
+
+        for (i_out_x = 0; i_out_x < dim_conv_out && first_y <= last_y; i_out_x++)
+        {
+            last_x = pool_window_range(i_out_x, dim_pool_kernel, pool_padding, pool_stride, dim_im_out, &first_x);
+
+            if (first_x <= last_x)
+            {
+                for (i = 0; i < ch_im_out; i++)
+                {
+                    conv_out = (bias[i] << bias_shift) + NN_ROUND(out_shift);
+                    for (i_ker_y = 0; i_ker_y < dim_kernel; i_ker_y++)
+                    {
+                        for (i_ker_x = 0; i_ker_x < dim_kernel; i_ker_x++)
+                        {
+                            in_row = stride * i_out_y + i_ker_y - padding;
+                            in_col = stride * i_out_x + i_ker_x - padding;
+                            if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                            {
+                                for (l = 0; l < ch_im_in; l++)
+                                {
+                                    conv_out +=
+                                        Im_in[(in_row * dim_im_in + in_col) * ch_im_in + l] *
+                                        wt[i * ch_im_in * dim_kernel * dim_kernel +
+                                           (i_ker_y * dim_kernel + i_ker_x) * ch_im_in + l];
+                                }
+                            }
+                        }
+                    }
+                    bufferB[i] = (q7_t) __SSAT((conv_out >> out_shift), 8);
+                }
+
+                max_pool_pixel_q7(bufferB, i_out_y, i_out_x, ch_im_out,
+                                  dim_pool_kernel, pool_padding, pool_stride, dim_im_out, Im_out);
+            }
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_s8_nonsquare.c
+ * Description:  s8 version of convolution with per-channel requantization
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief s8 convolution function with per-channel requantization (non-square shape)
+   * @param[in]       Im_in               pointer to input tensor
+   * @param[in]       dim_im_in_x         input tensor dimention x
+   * @param[in]       dim_im_in_y         input tensor dimention y
+   * @param[in]       ch_im_in            number of input tensor channels
+   * @param[in]       wt                  pointer to kernel weights
+   * @param[in]       ch_im_out           number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel_x        filter kernel size x
+   * @param[in]       dim_kernel_y        filter kernel size y
+   * @param[in]       padding_x           padding size x
+   * @param[in]       padding_y           padding size y
+   * @param[in]       stride_x            convolution stride x
+   * @param[in]       stride_y            convolution stride y
+   * @param[in]       bias                pointer to per-channel s32 bias, or NULL
+   * @param[in]       out_mult            pointer to per-channel output multipliers
+   * @param[in]       out_shift           pointer to per-channel output shifts, left if positive
+   * @param[in]       input_offset        negated zero point of the input
+   * @param[in]       output_offset       zero point of the output
+   * @param[in]       out_activation_min  smallest output value, -128 without activation
+   * @param[in]       out_activation_max  largest output value, 127 without activation
+   * @param[in,out]   Im_out              pointer to output tensor
+   * @param[in]       dim_im_out_x        output tensor dimension x
+   * @param[in]       dim_im_out_y        output tensor dimension y
+   * @param[in,out]   bufferA             pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y
+   *
+   * The weights are symmetric, with a zero point of 0, and the activations
+   * are asymmetric.  Output channel i is computed as
+   *
+   * <pre>
+   *    acc = bias[i] + sum (Im_in + input_offset) * wt
+   *    out = clamp(requantize(acc, out_mult[i], out_shift[i]) + output_offset,
+   *                out_activation_min, out_activation_max)
+   * </pre>
+   *
+   * with the requantization of arm_nn_requantize(), bit-exact with the int8
+   * reference kernels of the common model exporters.  A fused ReLU or ReLU6
+   * is given by the activation range.  Padded pixels are at the zero point
+   * of the input.  There is no constraint on the number of channels.
+   */
+
+arm_status arm_convolve_HWC_s8_nonsquare(const q7_t * Im_in,
+                                         const uint16_t dim_im_in_x,
+                                         const uint16_t dim_im_in_y,
+                                         const uint16_t ch_im_in,
+                                         const q7_t * wt,
+                                         const uint16_t ch_im_out,
+                                         const uint16_t dim_kernel_x,
+                                         const uint16_t dim_kernel_y,
+                                         const uint16_t padding_x,
+                                         const uint16_t padding_y,
+                                         const uint16_t stride_x,
+                                         const uint16_t stride_y,
+                                         const int32_t * bias,
+                                         const int32_t * out_mult,
+                                         const int32_t * out_shift,
+                                         const int32_t input_offset,
+                                         const int32_t output_offset,
+                                         const int32_t out_activation_min,
+                                         const int32_t out_activation_max,
+                                         q7_t * Im_out,
+                                         const uint16_t dim_im_out_x,
+                                         const uint16_t dim_im_out_y,
+                                         q15_t * bufferA)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    const uint16_t numCol = ch_im_in * dim_kernel_y * dim_kernel_x;
+
+    /* 
+     *  Here we use bufferA as q15_t internally as computation are done with q15_t level
+     *  im2col are done to output in q15_t format from q7_t input, with the input offset
+     */
+    q15_t    *pBuffer = bufferA;
+    q7_t     *pOut = Im_out;
+
+    /* This part implements the im2col function */
+    for (i_out_y = 0; i_out_y < dim_im_out_y; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out_x; i_out_x++)
+        {
+            for (i_ker_y = i_out_y * stride_y - padding_y; i_ker_y < i_out_y * stride_y - padding_y + dim_kernel_y; i_ker_y++)
+            {
+                for (i_ker_x = i_out_x * stride_x - padding_x; i_ker_x < i_out_x * stride_x - padding_x + dim_kernel_x; i_ker_x++)
+                {
+                    if (i_ker_y < 0 || i_ker_y >= dim_im_in_y || i_ker_x < 0 || i_ker_x >= dim_im_in_x)
+                    {
+                        /* Filling 0, the input zero point after the offset, for out-of-bound paddings */
+                        memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
+                    } else
+                    {
+                        /* Copying the pixel data to column */
+                        arm_q7_to_q15_with_offset(Im_in + (i_ker_y * dim_im_in_x + i_ker_x) * ch_im_in,
+                                                  pBuffer, ch_im_in, (q15_t) input_offset);
+                    }
+                    pBuffer += ch_im_in;
+                }
+            }
+
+            /* Computation is filed for every 2 columns */
+            if (pBuffer == bufferA + 2 * numCol)
+            {
+                pOut =
+                    arm_nn_mat_mult_kernel_s8_s16(wt, bufferA, ch_im_out, numCol,
+                                                  out_mult, out_shift, output_offset,
+                                                  out_activation_min, out_activation_max, bias, pOut);
+
+                /* counter reset */
+                pBuffer = bufferA;
+            }
+        }
+    }
+
+    /* left-over because odd number of output pixels */
+    if (pBuffer != bufferA)
+    {
+        const q7_t *pA = wt;
+        int       i;
+
+        for (i = 0; i < ch_im_out; i++)
+        {
+            /* Load the accumulator with bias first */
+            q31_t     sum = (bias != NULL) ? bias[i] : 0;
+
+            /* Point to the beging of the im2col buffer */
+            q15_t    *pB = bufferA;
+
+            /* Each time it process 4 entries */
+            uint16_t  colCnt = numCol >> 2;
+
+            while (colCnt)
+            {
+                q31_t     inA1, inA2;
+                q31_t     inB1, inB2;
+
+                pA = (q7_t *) read_and_pad((void *)pA, &inA1, &inA2);
+
+                inB1 = *__SIMD32(pB)++;
+                sum = __SMLAD(inA1, inB1, sum);
+                inB2 = *__SIMD32(pB)++;
+                sum = __SMLAD(inA2, inB2, sum);
+
+                colCnt--;
+            }
+            colCnt = numCol & 0x3;
+            while (colCnt)
+            {
+                q7_t      inA1 = *pA++;
+                q15_t     inB1 = *pB++;
+                sum += inA1 * inB1;
+                colCnt--;
+            }
+            *pOut++ = arm_nn_requantize_s8(sum, out_mult[i], out_shift[i], output_offset,
+                                           out_activation_min, out_activation_max);
+        }
+    }
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint16_t  i, j, k, l, m, n;
+    q31_t     conv_out;
+    int       in_row, in_col;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out_y; j++)
+        {
+            for (k = 0; k < dim_im_out_x; k++)
+            {
+                conv_out = (bias != NULL) ? bias[i] : 0;
+                for (m = 0; m < dim_kernel_y; m++)
+                {
+                    for (n = 0; n < dim_kernel_x; n++)
+                    {
+                        // if-for implementation
+                        in_row = stride_y * j + m - padding_y;
+                        in_col = stride_x * k + n - padding_x;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in_y && in_col < dim_im_in_x)
+                        {
+                            for (l = 0; l < ch_im_in; l++)
+                            {
+                                conv_out +=
+                                    (Im_in[(in_row * dim_im_in_x + in_col) * ch_im_in + l] + input_offset) *
+                                    wt[i * ch_im_in * dim_kernel_y * dim_kernel_x + (m * dim_kernel_x + n) * ch_im_in + l];
+                            }
+                        }
+                    }
+                }
+                Im_out[i + (j * dim_im_out_x + k) * ch_im_out] =
+                    arm_nn_requantize_s8(conv_out, out_mult[i], out_shift[i], output_offset,
+                                         out_activation_min, out_activation_max);
+            }
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
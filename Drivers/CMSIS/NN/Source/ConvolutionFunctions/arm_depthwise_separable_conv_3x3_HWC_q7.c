@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_separable_conv_3x3_HWC_q7.c
+ * Description:  Q7 depthwise separable convolution function for 3x3 kernels
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief Q7 depthwise separable convolution function for 3x3 kernels
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor dimention
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding sizes
+ * @param[in]       stride      convolution stride
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @param[in]       dim_im_out  output tensor dimension
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @param[in,out]   bufferB     pointer to buffer space for output
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 0
+ *
+ * bufferB size: 0
+ *
+ * <b>Input dimension constraints:</b>
+ *
+ * ch_im_in equals ch_im_out
+ *
+ * dim_kernel equals 3
+ *
+ * stride is 1 or 2
+ *
+ * Implementation:
+ * The outer loop goes over groups of 4 channels, so that the weights of the
+ * group are unpacked once into 20 words of q15_t pairs: the 9 taps are paired
+ * as (0,1), (2,3), (4,5), (6,7) and (8,0) for each of the 4 channels. The inner
+ * loop goes over the output pixels and reads the 9 input words of the group
+ * directly from the input tensor, so no column buffer is needed. Each __SMLAD
+ * then accumulates two taps of one channel. Taps outside of the input are
+ * read as zero. The remaining channels are computed one at a time.
+ */
+
+arm_status arm_depthwise_separable_conv_3x3_HWC_q7(const q7_t * Im_in,
+                                                   const uint16_t dim_im_in,
+                                                   const uint16_t ch_im_in,
+                                                   const q7_t * wt,
+                                                   const uint16_t ch_im_out,
+                                                   const uint16_t dim_kernel,
+                                                   const uint16_t padding,
+                                                   const uint16_t stride,
+                                                   const q7_t * bias,
+                                                   const uint16_t bias_shift,
+                                                   const uint16_t out_shift,
+                                                   q7_t * Im_out,
+                                                   const uint16_t dim_im_out,
+                                                   q15_t * bufferA,
+                                                   q7_t * bufferB)
+{
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    uint16_t  i_ch;
+
+    if (ch_im_in != ch_im_out || dim_kernel != 3 || (stride != 1 && stride != 2))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    i_ch = 0;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    for (; i_ch + 4 <= ch_im_out; i_ch += 4)
+    {
+        q31_t     wt02[5], wt22[5], wt13[5], wt33[5];
+        q31_t     inA, inB, a02, a13, b02, b13;
+        const q7_t *pA;
+        int       i_tap;
+
+        /* unpack the weights of the 4 channels, two taps per word */
+        for (i_tap = 0; i_tap < 8; i_tap += 2)
+        {
+            pA = wt + i_tap * ch_im_in + i_ch;
+            inA = *__SIMD32(pA);
+            pA += ch_im_in;
+            inB = *__SIMD32(pA);
+
+            a02 = __SXTB16(inA);
+            a13 = __SXTB16(__ROR(inA, 8));
+            b02 = __SXTB16(inB);
+            b13 = __SXTB16(__ROR(inB, 8));
+
+            wt02[i_tap >> 1] = __PKHBT(a02, b02, 16);
+            wt22[i_tap >> 1] = __PKHTB(b02, a02, 16);
+            wt13[i_tap >> 1] = __PKHBT(a13, b13, 16);
+            wt33[i_tap >> 1] = __PKHTB(b13, a13, 16);
+        }
+
+        /* the last tap is paired with zero, in the half that matches its channel */
+        pA = wt + 8 * ch_im_in + i_ch;
+        inA = *__SIMD32(pA);
+        a02 = __SXTB16(inA);
+        a13 = __SXTB16(__ROR(inA, 8));
+        wt02[4] = a02 & 0x0000FFFF;
+        wt22[4] = a02 & 0xFFFF0000;
+        wt13[4] = a13 & 0x0000FFFF;
+        wt33[4] = a13 & 0xFFFF0000;
+
+        for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+        {
+            for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+            {
+                q31_t     in[9];
+#ifndef ARM_MATH_BIG_ENDIAN
+                q31_t     sum =  ((q31_t)(bias[i_ch]) << bias_shift) + NN_ROUND(out_shift);
+                q31_t     sum2 = ((q31_t)(bias[i_ch + 1]) << bias_shift) + NN_ROUND(out_shift);
+                q31_t     sum3 = ((q31_t)(bias[i_ch + 2]) << bias_shift) + NN_ROUND(out_shift);
+                q31_t     sum4 = ((q31_t)(bias[i_ch + 3]) << bias_shift) + NN_ROUND(out_shift);
+#else
+                /* the lanes hold the channels in reverse order */
+                q31_t     sum =  ((q31_t)(bias[i_ch + 3]) << bias_shift) + NN_ROUND(out_shift);
+                q31_t     sum2 = ((q31_t)(bias[i_ch + 2]) << bias_shift) + NN_ROUND(out_shift);
+                q31_t     sum3 = ((q31_t)(bias[i_ch + 1]) << bias_shift) + NN_ROUND(out_shift);
+                q31_t     sum4 = ((q31_t)(bias[i_ch]) << bias_shift) + NN_ROUND(out_shift);
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+                int16_t   base_y = i_out_y * stride - padding;
+                int16_t   base_x = i_out_x * stride - padding;
+                q7_t     *pOut = Im_out + (i_out_y * dim_im_out + i_out_x) * ch_im_out + i_ch;
+
+                /* read the 9 taps of the 4 channels */
+                if (base_y >= 0 && base_x >= 0 && base_y + 3 <= dim_im_in && base_x + 3 <= dim_im_in)
+                {
+                    const q7_t *pB = Im_in + (base_y * dim_im_in + base_x) * ch_im_in + i_ch;
+
+                    for (i_ker_y = 0; i_ker_y < 3; i_ker_y++)
+                    {
+                        in[3 * i_ker_y] = *__SIMD32(pB);
+                        pB += ch_im_in;
+                        in[3 * i_ker_y + 1] = *__SIMD32(pB);
+                        pB += ch_im_in;
+                        in[3 * i_ker_y + 2] = *__SIMD32(pB);
+                        pB += (dim_im_in - 2) * ch_im_in;
+                    }
+                } else
+                {
+                    for (i_ker_y = 0; i_ker_y < 3; i_ker_y++)
+                    {
+                        for (i_ker_x = 0; i_ker_x < 3; i_ker_x++)
+                        {
+                            int16_t   in_row = base_y + i_ker_y;
+                            int16_t   in_col = base_x + i_ker_x;
+
+                            if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                            {
+                                const q7_t *pB = Im_in + (in_row * dim_im_in + in_col) * ch_im_in + i_ch;
+                                in[3 * i_ker_y + i_ker_x] = *__SIMD32(pB);
+                            } else
+                            {
+                                in[3 * i_ker_y + i_ker_x] = 0;
+                            }
+                        }
+                    }
+                }
+
+                for (i_tap = 0; i_tap < 8; i_tap += 2)
+                {
+                    a02 = __SXTB16(in[i_tap]);
+                    a13 = __SXTB16(__ROR(in[i_tap], 8));
+                    b02 = __SXTB16(in[i_tap + 1]);
+                    b13 = __SXTB16(__ROR(in[i_tap + 1], 8));
+
+                    sum = __SMLAD(wt02[i_tap >> 1], __PKHBT(a02, b02, 16), sum);
+                    sum3 = __SMLAD(wt22[i_tap >> 1], __PKHTB(b02, a02, 16), sum3);
+                    sum2 = __SMLAD(wt13[i_tap >> 1], __PKHBT(a13, b13, 16), sum2);
+                    sum4 = __SMLAD(wt33[i_tap >> 1], __PKHTB(b13, a13, 16), sum4);
+                }
+
+                a02 = __SXTB16(in[8]);
+                a13 = __SXTB16(__ROR(in[8], 8));
+                sum = __SMLAD(wt02[4], a02, sum);
+                sum3 = __SMLAD(wt22[4], a02, sum3);
+                sum2 = __SMLAD(wt13[4], a13, sum2);
+                sum4 = __SMLAD(wt33[4], a13, sum4);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+                pOut[0] = (q7_t) __SSAT((sum >> out_shift), 8);
+                pOut[1] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+                pOut[2] = (q7_t) __SSAT((sum3 >> out_shift), 8);
+                pOut[3] = (q7_t) __SSAT((sum4 >> out_shift), 8);
+#else
+                pOut[3] = (q7_t) __SSAT((sum >> out_shift), 8);
+                pOut[2] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+                pOut[1] = (q7_t) __SSAT((sum3 >> out_shift), 8);
+                pOut[0] = (q7_t) __SSAT((sum4 >> out_shift), 8);
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+            }
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* remaining channels, and all the channels for Cortex-M0 and Cortex-M3 */
+    for (; i_ch < ch_im_out; i_ch++)
+    {
+        q7_t      w0 = wt[i_ch];
+        q7_t      w1 = wt[ch_im_in + i_ch];
+        q7_t      w2 = wt[2 * ch_im_in + i_ch];
+        q7_t      w3 = wt[3 * ch_im_in + i_ch];
+        q7_t      w4 = wt[4 * ch_im_in + i_ch];
+        q7_t      w5 = wt[5 * ch_im_in + i_ch];
+        q7_t      w6 = wt[6 * ch_im_in + i_ch];
+        q7_t      w7 = wt[7 * ch_im_in + i_ch];
+        q7_t      w8 = wt[8 * ch_im_in + i_ch];
+
+        for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+        {
+            for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+            {
+                q31_t     sum = ((q31_t)(bias[i_ch]) << bias_shift) + NN_ROUND(out_shift);
+                int16_t   base_y = i_out_y * stride - padding;
+                int16_t   base_x = i_out_x * stride - padding;
+
+                if (base_y >= 0 && base_x >= 0 && base_y + 3 <= dim_im_in && base_x + 3 <= dim_im_in)
+                {
+                    const q7_t *pB = Im_in + (base_y * dim_im_in + base_x) * ch_im_in + i_ch;
+                    const q7_t *pB2 = pB + dim_im_in * ch_im_in;
+                    const q7_t *pB3 = pB2 + dim_im_in * ch_im_in;
+
+                    sum += w0 * pB[0] + w1 * pB[ch_im_in] + w2 * pB[2 * ch_im_in];
+                    sum += w3 * pB2[0] + w4 * pB2[ch_im_in] + w5 * pB2[2 * ch_im_in];
+                    sum += w6 * pB3[0] + w7 * pB3[ch_im_in] + w8 * pB3[2 * ch_im_in];
+                } else
+                {
+                    for (i_ker_y = 0; i_ker_y < 3; i_ker_y++)
+                    {
+                        for (i_ker_x = 0; i_ker_x < 3; i_ker_x++)
+                        {
+                            int16_t   in_row = base_y + i_ker_y;
+                            int16_t   in_col = base_x + i_ker_x;
+
+                            if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                            {
+                                sum += wt[(i_ker_y * 3 + i_ker_x) * ch_im_in + i_ch] *
+                                    Im_in[(in_row * dim_im_in + in_col) * ch_im_in + i_ch];
+                            }
+                        }
+                    }
+                }
+
+                Im_out[(i_out_y * dim_im_out + i_out_x) * ch_im_out + i_ch] = (q7_t) __SSAT((sum >> out_shift), 8);
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -72,6 +72,9 @@
  *
  * ch_im_in equals ch_im_out
  *
+ * 3x3 kernels with stride 1 or 2 are handed over to
+ * arm_depthwise_separable_conv_3x3_HWC_q7(), which does not use bufferA.
+ *
  * Implementation:
  * There are 3 nested loop here:
  * Inner loop: calculate each output value with MAC instruction over an accumulator
@@ -95,6 +98,12 @@ arm_status arm_depthwise_separable_conv_HWC_q7(const q7_t * Im_in,
                                                q15_t * bufferA, 
                                                q7_t * bufferB)
 {
+    if (dim_kernel == 3 && (stride == 1 || stride == 2) && ch_im_in == ch_im_out)
+    {
+        return arm_depthwise_separable_conv_3x3_HWC_q7(Im_in, dim_im_in, ch_im_in, wt, ch_im_out,
+                                                       dim_kernel, padding, stride, bias, bias_shift,
+                                                       out_shift, Im_out, dim_im_out, bufferA, bufferB);
+    }
 
 #if defined (ARM_MATH_DSP)
     /* Run the following code for Cortex-M4 and Cortex-M7 */
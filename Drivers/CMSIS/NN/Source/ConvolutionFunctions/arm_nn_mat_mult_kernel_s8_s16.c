@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_kernel_s8_s16.c
+ * Description:  Matrix-multiplication function for s8 convolution with per-channel requantization
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+  /**
+   * @brief Matrix-multiplication function for s8 convolution
+   * @param[in]       pA                  pointer to operand A, the s8 weights
+   * @param[in]       pInBuffer           pointer to operand B, always conssists of 2 vectors
+   * @param[in]       ch_im_out           numRow of A
+   * @param[in]       numCol_A            numCol of A
+   * @param[in]       out_mult            per-channel output multipliers
+   * @param[in]       out_shift           per-channel output shifts, left if positive
+   * @param[in]       output_offset       zero point of the output
+   * @param[in]       out_activation_min  smallest output value
+   * @param[in]       out_activation_max  largest output value
+   * @param[in]       bias                per-channel s32 bias, or NULL
+   * @param[in,out]   pOut                pointer to output
+   * @return     The function returns the incremented output pointer
+   *
+   * @details
+   *
+   * This function does the matrix multiplication with weight matrix
+   * and 2 columns from im2col, which already include the input offset.
+   * Each row is requantized with its own multiplier and shift.
+   */
+
+q7_t     *arm_nn_mat_mult_kernel_s8_s16(const q7_t * pA,
+                                        const q15_t * pInBuffer,
+                                        const uint16_t ch_im_out,
+                                        const uint16_t numCol_A,
+                                        const int32_t * out_mult,
+                                        const int32_t * out_shift,
+                                        const int32_t output_offset,
+                                        const int32_t out_activation_min,
+                                        const int32_t out_activation_max,
+                                        const int32_t * bias,
+                                        q7_t * pOut)
+{
+    /* set up the second output pointers */
+    q7_t     *pOut2 = pOut + ch_im_out;
+    const q15_t *pB = pInBuffer;
+    const q15_t *pB2 = pB + numCol_A;
+    uint16_t  row = 0;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    uint16_t  rowCnt = ch_im_out >> 1;
+    /* this loop over rows in A */
+    while (rowCnt)
+    {
+        /* align the second pointer for A */
+        const q7_t *pA2 = pA + numCol_A;
+
+        /* init the sum with bias */
+        q31_t     sum = (bias != NULL) ? bias[row] : 0;
+        q31_t     sum2 = sum;
+        q31_t     sum3 = (bias != NULL) ? bias[row + 1] : 0;
+        q31_t     sum4 = sum3;
+
+        uint16_t  colCnt = numCol_A >> 2;
+
+        /* setup pointers for B */
+        pB = pInBuffer;
+        pB2 = pB + numCol_A;
+
+        /* accumulate over the vector */
+        while (colCnt)
+        {
+            q31_t     inA11, inA12, inA21, inA22;
+            q31_t     inB1 = *__SIMD32(pB)++;
+            q31_t     inB2 = *__SIMD32(pB2)++;
+
+            pA = (q7_t *) read_and_pad((void *)pA, &inA11, &inA12);
+            pA2 = (q7_t *) read_and_pad((void *)pA2, &inA21, &inA22);
+
+            sum = __SMLAD(inA11, inB1, sum);
+            sum2 = __SMLAD(inA11, inB2, sum2);
+            sum3 = __SMLAD(inA21, inB1, sum3);
+            sum4 = __SMLAD(inA21, inB2, sum4);
+
+            inB1 = *__SIMD32(pB)++;
+            inB2 = *__SIMD32(pB2)++;
+
+            sum = __SMLAD(inA12, inB1, sum);
+            sum2 = __SMLAD(inA12, inB2, sum2);
+            sum3 = __SMLAD(inA22, inB1, sum3);
+            sum4 = __SMLAD(inA22, inB2, sum4);
+
+            colCnt--;
+        }                       /* while over colCnt */
+        colCnt = numCol_A & 0x3;
+        while (colCnt)
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            q7_t      inA2 = *pA2++;
+            q15_t     inB2 = *pB2++;
+
+            sum += inA1 * inB1;
+            sum2 += inA1 * inB2;
+            sum3 += inA2 * inB1;
+            sum4 += inA2 * inB2;
+            colCnt--;
+        }                       /* while over colCnt */
+
+        *pOut++ = arm_nn_requantize_s8(sum, out_mult[row], out_shift[row], output_offset,
+                                       out_activation_min, out_activation_max);
+        *pOut++ = arm_nn_requantize_s8(sum3, out_mult[row + 1], out_shift[row + 1], output_offset,
+                                       out_activation_min, out_activation_max);
+        *pOut2++ = arm_nn_requantize_s8(sum2, out_mult[row], out_shift[row], output_offset,
+                                        out_activation_min, out_activation_max);
+        *pOut2++ = arm_nn_requantize_s8(sum4, out_mult[row + 1], out_shift[row + 1], output_offset,
+                                        out_activation_min, out_activation_max);
+
+        /* skip the row computed with A2 */
+        pA += numCol_A;
+        row += 2;
+        rowCnt--;
+    }                           /* for over ch_im_out */
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* compute left-over row if any, or all the rows for Cortex-M0 and Cortex-M3 */
+    while (row < ch_im_out)
+    {
+        q31_t     sum = (bias != NULL) ? bias[row] : 0;
+        q31_t     sum2 = sum;
+        uint16_t  colCnt = numCol_A;
+
+        /* setup pointers for B */
+        pB = pInBuffer;
+        pB2 = pB + numCol_A;
+
+        while (colCnt)
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            q15_t     inB2 = *pB2++;
+
+            sum += inA1 * inB1;
+            sum2 += inA1 * inB2;
+            colCnt--;
+        }
+
+        *pOut++ = arm_nn_requantize_s8(sum, out_mult[row], out_shift[row], output_offset,
+                                       out_activation_min, out_activation_max);
+        *pOut2++ = arm_nn_requantize_s8(sum2, out_mult[row], out_shift[row], output_offset,
+                                        out_activation_min, out_activation_max);
+        row++;
+    }
+
+    pOut += ch_im_out;
+
+    /* return the new output pointer with offset */
+    return pOut;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_layer_scratch_size.c
+ * Description:  Scratch buffer size of the kernel of a layer
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_plan.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNPlan
+ * @{
+ */
+
+  /**
+   * @brief Number of bytes of the scratch buffer of a layer
+   * @param[in]       pLayer      points to the layer
+   * @return     the number of bytes of bufferA and bufferB of the kernel.
+   *
+   * @details
+   *
+   * The sizes are the ones documented with the kernels. The bufferA of the
+   * convolutions holds two columns of q15_t values. The fused convolution
+   * also needs 2*ch_im_out bytes for bufferB, placed after bufferA.
+   */
+
+uint32_t arm_nn_layer_scratch_size(const arm_nn_layer * pLayer)
+{
+    uint32_t  kernel_size = (uint32_t) pLayer->dim_kernel * pLayer->dim_kernel;
+
+    switch (pLayer->type)
+    {
+    case ARM_NN_LAYER_CONV:
+        return 2 * sizeof(q15_t) * pLayer->ch_im_in * kernel_size;
+
+    case ARM_NN_LAYER_CONV_RELU_POOL:
+        return 2 * sizeof(q15_t) * pLayer->ch_im_in * kernel_size + 2 * pLayer->ch_im_out;
+
+    case ARM_NN_LAYER_DEPTHWISE:
+        /* arm_depthwise_separable_conv_3x3_HWC_q7 reads the input directly */
+        if (pLayer->dim_kernel == 3 && (pLayer->stride == 1 || pLayer->stride == 2))
+        {
+            return 0;
+        }
+        return 2 * pLayer->ch_im_in * kernel_size;
+
+    case ARM_NN_LAYER_AVEPOOL:
+        return 2 * pLayer->dim_im_out * pLayer->ch_im_in;
+
+    case ARM_NN_LAYER_FC:
+    case ARM_NN_LAYER_FC_OPT:
+        return sizeof(q15_t) * pLayer->ch_im_in;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @} end of NNPlan group
+ */
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_plan.c
+ * Description:  Places the tensors and scratch buffers of a network in an arena
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_plan.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNPlan
+ * @{
+ */
+
+/* buffers are placed on 4 bytes, for the word accesses of the kernels */
+#define PLAN_ALIGN(x) (((x) + 3U) & ~3U)
+
+/*
+ * Buffer b of the plan: tensor b for b < numTensors, scratch buffer of layer
+ * b - numTensors otherwise. A tensor that runs in place has no buffer of its own.
+ */
+static uint32_t *plan_buffer(const arm_nn_plan_instance * S, uint32_t b, uint32_t * pSize, int16_t * pFirst,
+                             int16_t * pLast)
+{
+    if (b < S->numTensors)
+    {
+        arm_nn_tensor *pT = &S->pTensors[b];
+
+        *pSize = (pT->alias == b) ? PLAN_ALIGN(pT->size) : 0;
+        *pFirst = pT->first;
+        *pLast = pT->last;
+        return &pT->offset;
+    } else
+    {
+        uint16_t  l = b - S->numTensors;
+
+        *pSize = PLAN_ALIGN(arm_nn_layer_scratch_size(&S->pLayers[l]));
+        *pFirst = l;
+        *pLast = l;
+        return &S->pScratchOffset[l];
+    }
+}
+
+  /**
+   * @brief Places the tensors and the scratch buffers of a network in an arena
+   * @param[out]      S               points to an instance of the plan structure
+   * @param[in]       pLayers         points to the layers, in execution order
+   * @param[in]       numLayers       number of layers
+   * @param[out]      pTensors        points to numTensors tensors
+   * @param[in]       numTensors      number of tensors
+   * @param[out]      pScratchOffset  points to numLayers scratch offsets
+   * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the layers
+   * disagree on the size of a tensor, <code>ARM_MATH_ARGUMENT_ERROR</code> if a tensor
+   * index is out of range, a tensor is written twice or read before it is written,
+   * or the input of a pooling layer is read afterwards, and <code>ARM_MATH_SUCCESS</code>
+   * otherwise.
+   *
+   * @details
+   *
+   * A tensor is live from the layer that writes it, or the first layer for the
+   * inputs of the network, to the last layer that reads it, or the last layer
+   * for the outputs of the network. The scratch buffer of a layer is live
+   * during that layer only. The output of a ReLU or softmax layer shares the
+   * buffer of its input when no later layer reads the input.
+   *
+   * The buffers are placed from the largest to the smallest, each at the
+   * lowest offset that does not overlap a buffer placed before and live at the
+   * same time. minArenaSize is the largest total size of the buffers live
+   * during a layer, which no placement can go below: the placement is optimal
+   * when arenaSize is equal to it, which is the case for chains of layers.
+   */
+
+arm_status arm_nn_plan(arm_nn_plan_instance * S,
+                       const arm_nn_layer * pLayers,
+                       uint16_t numLayers,
+                       arm_nn_tensor * pTensors,
+                       uint16_t numTensors,
+                       uint32_t * pScratchOffset)
+{
+    uint32_t  numBuffers = (uint32_t) numTensors + numLayers;
+    uint32_t  b, c, size, sizeC, live;
+    uint32_t *pOffset, *pOffsetC;
+    int16_t   first, last, firstC, lastC;
+    int16_t   l;
+
+    S->numLayers = numLayers;
+    S->pLayers = pLayers;
+    S->numTensors = numTensors;
+    S->pTensors = pTensors;
+    S->pScratchOffset = pScratchOffset;
+    S->arenaSize = 0;
+    S->minArenaSize = 0;
+
+    for (b = 0; b < numTensors; b++)
+    {
+        pTensors[b].size = 0;
+        pTensors[b].offset = ARM_NN_UNPLANNED;
+        pTensors[b].first = -1;
+        pTensors[b].last = -1;
+        pTensors[b].alias = b;
+    }
+    for (l = 0; l < numLayers; l++)
+    {
+        pScratchOffset[l] = ARM_NN_UNPLANNED;
+    }
+
+    /* sizes and lifetimes of the tensors */
+    for (l = 0; l < numLayers; l++)
+    {
+        const arm_nn_layer *pL = &pLayers[l];
+        arm_nn_tensor *pIn, *pOut;
+        uint32_t  in_size = (uint32_t) pL->dim_im_in * pL->dim_im_in * pL->ch_im_in;
+        uint32_t  out_size = (uint32_t) pL->dim_im_out * pL->dim_im_out * pL->ch_im_out;
+
+        if (pL->input >= numTensors || pL->output >= numTensors || pL->input == pL->output)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        pIn = &pTensors[pL->input];
+        pOut = &pTensors[pL->output];
+
+        if (pIn->first < 0)
+        {
+            /* input of the network */
+            pIn->first = 0;
+            pIn->size = in_size;
+        }
+        if (pIn->size != in_size)
+        {
+            return ARM_MATH_SIZE_MISMATCH;
+        }
+        pIn->last = l;
+
+        if (pOut->first >= 0)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+        pOut->first = l;
+        pOut->size = out_size;
+    }
+
+    for (b = 0; b < numTensors; b++)
+    {
+        if (pTensors[b].first >= 0 && pTensors[b].last < 0)
+        {
+            /* output of the network */
+            pTensors[b].last = numLayers - 1;
+        }
+    }
+
+    /* in-place layers and pooling layers that overwrite their input */
+    for (l = 0; l < numLayers; l++)
+    {
+        const arm_nn_layer *pL = &pLayers[l];
+        arm_nn_tensor *pIn = &pTensors[pL->input];
+        arm_nn_tensor *pOut = &pTensors[pL->output];
+
+        switch (pL->type)
+        {
+        case ARM_NN_LAYER_MAXPOOL:
+        case ARM_NN_LAYER_AVEPOOL:
+            if (pIn->last != l)
+            {
+                return ARM_MATH_ARGUMENT_ERROR;
+            }
+            break;
+
+        case ARM_NN_LAYER_RELU:
+        case ARM_NN_LAYER_SOFTMAX:
+            if (pIn->last == l)
+            {
+                arm_nn_tensor *pRoot = &pTensors[pIn->alias];
+
+                pOut->alias = pIn->alias;
+                pRoot->last = pOut->last;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    /* lower bound on the arena size */
+    for (l = 0; l < numLayers; l++)
+    {
+        live = 0;
+        for (b = 0; b < numBuffers; b++)
+        {
+            plan_buffer(S, b, &size, &first, &last);
+            if (first <= l && l <= last)
+            {
+                live += size;
+            }
+        }
+        if (live > S->minArenaSize)
+        {
+            S->minArenaSize = live;
+        }
+    }
+
+    /* place the largest buffer left, at the lowest offset where it fits */
+    for (;;)
+    {
+        uint32_t  best = numBuffers;
+        uint32_t  bestSize = 0;
+        uint32_t  offset = 0;
+        uint8_t   moved;
+
+        for (b = 0; b < numBuffers; b++)
+        {
+            pOffset = plan_buffer(S, b, &size, &first, &last);
+            if (size > bestSize && *pOffset == ARM_NN_UNPLANNED)
+            {
+                best = b;
+                bestSize = size;
+            }
+        }
+
+        if (best == numBuffers)
+        {
+            break;
+        }
+
+        pOffset = plan_buffer(S, best, &size, &first, &last);
+        do
+        {
+            moved = 0;
+            for (c = 0; c < numBuffers; c++)
+            {
+                pOffsetC = plan_buffer(S, c, &sizeC, &firstC, &lastC);
+                if (sizeC > 0 && *pOffsetC != ARM_NN_UNPLANNED && firstC <= last && first <= lastC &&
+                    *pOffsetC < offset + size && offset < *pOffsetC + sizeC)
+                {
+                    offset = *pOffsetC + sizeC;
+                    moved = 1;
+                }
+            }
+        }
+        while (moved);
+
+        *pOffset = offset;
+        if (offset + size > S->arenaSize)
+        {
+            S->arenaSize = offset + size;
+        }
+    }
+
+    /* empty scratch buffers, unused tensors and tensors that run in place */
+    for (l = 0; l < numLayers; l++)
+    {
+        if (pScratchOffset[l] == ARM_NN_UNPLANNED)
+        {
+            pScratchOffset[l] = 0;
+        }
+    }
+    for (b = 0; b < numTensors; b++)
+    {
+        if (pTensors[b].alias != b)
+        {
+            pTensors[b].offset = pTensors[pTensors[b].alias].offset;
+        } else if (pTensors[b].offset == ARM_NN_UNPLANNED)
+        {
+            pTensors[b].offset = 0;
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNPlan group
+ */
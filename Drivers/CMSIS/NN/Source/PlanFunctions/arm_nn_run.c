@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_run.c
+ * Description:  Runs the layers of a planned network on its arena
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_plan.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNPlan
+ * @{
+ */
+
+  /**
+   * @brief Runs a planned network
+   * @param[in]       S           points to an instance of the plan structure
+   * @param[in,out]   pArena      points to the arena, S->arenaSize bytes aligned on 4 bytes
+   * @return     The function returns the first error of a kernel, or <code>ARM_MATH_SUCCESS</code>.
+   *
+   * @details
+   *
+   * The inputs of the network are written at pArena + pTensors[i].offset
+   * before the call, and the outputs read at the same place after it.
+   * A ReLU layer that does not run in place copies its input to its output
+   * first.
+   */
+
+arm_status arm_nn_run(const arm_nn_plan_instance * S, q7_t * pArena)
+{
+    arm_status status = ARM_MATH_SUCCESS;
+    uint16_t  l;
+
+    for (l = 0; l < S->numLayers && status == ARM_MATH_SUCCESS; l++)
+    {
+        const arm_nn_layer *pL = &S->pLayers[l];
+        q7_t     *pIn = pArena + S->pTensors[pL->input].offset;
+        q7_t     *pOut = pArena + S->pTensors[pL->output].offset;
+        q7_t     *pScratch = pArena + S->pScratchOffset[l];
+        uint32_t  size = S->pTensors[pL->output].size;
+        uint32_t  block;
+
+        switch (pL->type)
+        {
+        case ARM_NN_LAYER_CONV:
+            if (pL->ch_im_in == 3)
+            {
+                status = arm_convolve_HWC_q7_RGB(pIn, pL->dim_im_in, pL->ch_im_in, pL->wt, pL->ch_im_out,
+                                                 pL->dim_kernel, pL->padding, pL->stride, pL->bias, pL->bias_shift,
+                                                 pL->out_shift, pOut, pL->dim_im_out, (q15_t *) pScratch, NULL);
+            } else
+            {
+                status = arm_convolve_HWC_q7_fast(pIn, pL->dim_im_in, pL->ch_im_in, pL->wt, pL->ch_im_out,
+                                                  pL->dim_kernel, pL->padding, pL->stride, pL->bias, pL->bias_shift,
+                                                  pL->out_shift, pOut, pL->dim_im_out, (q15_t *) pScratch, NULL);
+            }
+            break;
+
+        case ARM_NN_LAYER_CONV_RELU_POOL:
+            status = arm_convolve_HWC_q7_fast_relu_pool(pIn, pL->dim_im_in, pL->ch_im_in, pL->wt, pL->ch_im_out,
+                                                        pL->dim_kernel, pL->padding, pL->stride, pL->bias,
+                                                        pL->bias_shift, pL->out_shift, pL->dim_conv_out,
+                                                        pL->dim_pool_kernel, pL->pool_padding, pL->pool_stride,
+                                                        pOut, pL->dim_im_out, (q15_t *) pScratch,
+                                                        pScratch + 2 * sizeof(q15_t) * pL->ch_im_in *
+                                                        pL->dim_kernel * pL->dim_kernel);
+            break;
+
+        case ARM_NN_LAYER_DEPTHWISE:
+            status = arm_depthwise_separable_conv_HWC_q7(pIn, pL->dim_im_in, pL->ch_im_in, pL->wt, pL->ch_im_out,
+                                                         pL->dim_kernel, pL->padding, pL->stride, pL->bias,
+                                                         pL->bias_shift, pL->out_shift, pOut, pL->dim_im_out,
+                                                         (q15_t *) pScratch, NULL);
+            break;
+
+        case ARM_NN_LAYER_RELU:
+            if (pOut != pIn)
+            {
+                memcpy(pOut, pIn, size);
+            }
+            /* arm_relu_q7 takes at most 65535 values */
+            for (; size > 0; size -= block, pOut += block)
+            {
+                block = size > 0x8000 ? 0x8000 : size;
+                arm_relu_q7(pOut, block);
+            }
+            break;
+
+        case ARM_NN_LAYER_MAXPOOL:
+            arm_maxpool_q7_HWC(pIn, pL->dim_im_in, pL->ch_im_in, pL->dim_kernel, pL->padding, pL->stride,
+                               pL->dim_im_out, NULL, pOut);
+            break;
+
+        case ARM_NN_LAYER_AVEPOOL:
+            arm_avepool_q7_HWC(pIn, pL->dim_im_in, pL->ch_im_in, pL->dim_kernel, pL->padding, pL->stride,
+                               pL->dim_im_out, pScratch, pOut);
+            break;
+
+        case ARM_NN_LAYER_FC:
+            status = arm_fully_connected_q7(pIn, pL->wt, pL->ch_im_in, pL->ch_im_out, pL->bias_shift,
+                                            pL->out_shift, pL->bias, pOut, (q15_t *) pScratch);
+            break;
+
+        case ARM_NN_LAYER_FC_OPT:
+            status = arm_fully_connected_q7_opt(pIn, pL->wt, pL->ch_im_in, pL->ch_im_out, pL->bias_shift,
+                                                pL->out_shift, pL->bias, pOut, (q15_t *) pScratch);
+            break;
+
+        case ARM_NN_LAYER_SOFTMAX:
+            arm_softmax_q7(pIn, pL->ch_im_in, pOut);
+            break;
+
+        default:
+            status = ARM_MATH_ARGUMENT_ERROR;
+            break;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @} end of NNPlan group
+ */